@@ -0,0 +1,7 @@
+__thread int g_Test = -1;
+
+int main(int argc, char** argv)
+{
+	g_Test = 0;
+	return g_Test;
+}
@@ -506,7 +506,7 @@ int mmo_char_tosql(int char_id, struct mmo_charstatus *p)
 
 	cp = (struct mmo_charstatus *)idb_ensure(char_db_, char_id, create_charstatus);
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	memset(save_status, 0, sizeof(save_status));
 
 	//Map inventory data
@@ -519,7 +519,7 @@ int mmo_char_tosql(int char_id, struct mmo_charstatus *p)
 
 	//Map cart data
 	if( memcmp(p->cart, cp->cart, sizeof(p->cart)) ) {
-		if (!memitemdata_to_sql(p->cart, MAX_CART, p->char_id, TABLE_CART))
+		if (!memitemdata_to_sql(p->cart, MAX_CART, p->char_id, TABLE_CART, NULL))
 			strcat(save_status, " cart");
 		else
 			errors++;
@@ -527,7 +527,7 @@ int mmo_char_tosql(int char_id, struct mmo_charstatus *p)
 
 	//Map storage data
 	if( memcmp(p->storage.items, cp->storage.items, sizeof(p->storage.items)) ) {
-		if (!memitemdata_to_sql(p->storage.items, MAX_STORAGE, p->account_id, TABLE_STORAGE))
+		if (!memitemdata_to_sql(p->storage.items, MAX_STORAGE, p->account_id, TABLE_STORAGE, NULL))
 			strcat(save_status, " storage");
 		else
 			errors++;
@@ -763,7 +763,8 @@ int mmo_char_tosql(int char_id, struct mmo_charstatus *p)
 }
 
 /// Saves an array of 'item' entries into the specified table.
-int memitemdata_to_sql(const struct item items[], int max, int id, int tableswitch)
+/// @param rows : if not NULL, receives the `id` of the row each entry was saved to (0 for empty entries)
+int memitemdata_to_sql(const struct item items[], int max, int id, int tableswitch, int rows[])
 {
 	StringBuf buf;
 	SqlStmt* stmt;
@@ -775,6 +776,7 @@ int memitemdata_to_sql(const struct item items[], int max, int id, int tableswit
 	bool* flag; // bit array for inventory matching
 	bool found;
 	int errors = 0;
+	int inserted = 0;
 
 	switch (tableswitch) {
 		case TABLE_INVENTORY:     tablename = inventory_db;     selectoption = "char_id";    break;
@@ -792,7 +794,7 @@ int memitemdata_to_sql(const struct item items[], int max, int id, int tableswit
 	// This approach is more complicated than a trivial delete&insert, but
 	// it significantly reduces cpu load on the database server.
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_AppendStr(&buf, "SELECT `id`, `nameid`, `amount`, `equip`, `identify`, `refine`, `attribute`, `expire_time`, `bound`");
 	for( j = 0; j < MAX_SLOTS; ++j )
 		StringBuf_Printf(&buf, ", `card%d`", j);
@@ -821,6 +823,8 @@ int memitemdata_to_sql(const struct item items[], int max, int id, int tableswit
 
 	// Bit array indicating which inventory items have already been matched
 	flag = (bool*) aCalloc(max, sizeof(bool));
+	if( rows )
+		memset(rows, 0, max * sizeof(int));
 
 	while( SQL_SUCCESS == SqlStmt_NextRow(stmt) ) {
 		found = false;
@@ -861,6 +865,8 @@ int memitemdata_to_sql(const struct item items[], int max, int id, int tableswit
 				}
 
 				found = flag[i] = true; // Item dealt with,
+				if( rows )
+					rows[i] = item.id;
 				break; // Skip to next item in the db.
 			}
 		}
@@ -896,11 +902,35 @@ int memitemdata_to_sql(const struct item items[], int max, int id, int tableswit
 		for( j = 0; j < MAX_SLOTS; ++j )
 			StringBuf_Printf(&buf, ", '%hu'", items[i].card[j]);
 		StringBuf_AppendStr(&buf, ")");
+		inserted++;
 	}
 
 	if( found && SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) ) {
 		Sql_ShowDebug(sql_handle);
 		errors++;
+	} else if( found && rows ) {
+		// A multi-row insert only reports the id of its first row, InnoDB gives the others
+		// the following ids unless innodb_autoinc_lock_mode is 2, so check that the range is ours.
+		int first = (int)Sql_LastInsertId(sql_handle);
+		char* data;
+
+		if( SQL_ERROR == Sql_Query(sql_handle, "SELECT COUNT(*) FROM `%s` WHERE `%s`='%d' AND `id` BETWEEN '%d' AND '%d'", tablename, selectoption, id, first, first + inserted - 1)
+		||  SQL_SUCCESS != Sql_NextRow(sql_handle) ) {
+			Sql_ShowDebug(sql_handle);
+			errors++;
+		} else {
+			Sql_GetData(sql_handle, 0, &data, NULL);
+			if( atoi(data) != inserted ) {
+				ShowWarning("memitemdata_to_sql: Inserted rows of %s %d didn't get consecutive ids, the row mapping is dropped.\n", selectoption, id);
+				errors++;
+			} else {
+				for( i = 0; i < max; ++i ) {
+					if( items[i].nameid && !flag[i] )
+						rows[i] = first++;
+				}
+			}
+		}
+		Sql_FreeResult(sql_handle);
 	}
 
 	StringBuf_Destroy(&buf);
@@ -926,7 +956,7 @@ int inventory_to_sql(const struct item items[], int max, int id) {
 	// This approach is more complicated than a trivial delete&insert, but
 	// it significantly reduces cpu load on the database server.
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_AppendStr(&buf, "SELECT `id`, `nameid`, `amount`, `equip`, `identify`, `refine`, `attribute`, `expire_time`, `favorite`, `bound`");
 	for( j = 0; j < MAX_SLOTS; ++j )
 		StringBuf_Printf(&buf, ", `card%d`", j);
@@ -1294,7 +1324,7 @@ int mmo_char_fromsql(int char_id, struct mmo_charstatus *p, bool load_everything
 
 	//Read inventory
 	//`inventory` (`id`,`char_id`, `nameid`, `amount`, `equip`, `identify`, `refine`, `attribute`, `card0`, `card1`, `card2`, `card3`, `expire_time`, `favorite`, `unique_id`)
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_AppendStr(&buf, "SELECT `id`, `nameid`, `amount`, `equip`, `identify`, `refine`, `attribute`, `expire_time`, `favorite`, `bound`, `unique_id`");
 	for( i = 0; i < MAX_SLOTS; ++i )
 		StringBuf_Printf(&buf, ", `card%d`", i);
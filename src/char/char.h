@@ -36,7 +36,7 @@ enum {
 	TABLE_GUILD_STORAGE,
 };
 
-int memitemdata_to_sql(const struct item items[], int max, int id, int tableswitch);
+int memitemdata_to_sql(const struct item items[], int max, int id, int tableswitch, int rows[]);
 
 int mapif_sendall(unsigned char *buf, unsigned int len);
 int mapif_sendallwos(int fd, unsigned char *buf, unsigned int len);
@@ -12,6 +12,7 @@
 #include "char.h"
 #include "inter.h"
 #include "int_guild.h"
+#include "int_storage.h"
 
 #include <string.h>
 #include <stdio.h>
@@ -153,7 +154,7 @@ int inter_guild_tosql(struct guild *g,int flag)
 		StringBuf buf;
 		bool add_comma = false;
 
-		StringBuf_Init(&buf);
+		StringBuf_InitArena(&buf);
 		StringBuf_Printf(&buf, "UPDATE `%s` SET ", guild_db);
 
 		if( flag&GS_EMBLEM ) {
@@ -511,7 +512,7 @@ int inter_guildcastle_tosql(struct guild_castle *gc)
 	StringBuf buf;
 	int i;
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_Printf(&buf, "REPLACE INTO `%s` SET `castle_id`='%d', `guild_id`='%d', `economy`='%d', `defense`='%d', "
 	                 "`triggerE`='%d', `triggerD`='%d', `nextTime`='%d', `payTime`='%d', `createTime`='%d', `visibleC`='%d'",
 	                 guild_castle_db, gc->castle_id, gc->guild_id, gc->economy, gc->defense,
@@ -539,7 +540,7 @@ static struct guild_castle* inter_guildcastle_fromsql(int castle_id)
 	if (gc != NULL)
 		return gc;
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_AppendStr(&buf, "SELECT `castle_id`, `guild_id`, `economy`, `defense`, `triggerE`, "
 	                    "`triggerD`, `nextTime`, `payTime`, `createTime`, `visibleC`");
 	for (i = 0; i < MAX_GUARDIANS; ++i)
@@ -1367,8 +1368,7 @@ int mapif_parse_BreakGuild(int fd,int guild_id)
 	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `guild_id` = '%d'", guild_castle_db, guild_id) )
 		Sql_ShowDebug(sql_handle);
 
-	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `guild_id` = '%d'", guild_storage_db, guild_id) )
-		Sql_ShowDebug(sql_handle);
+	inter_guild_storage_delete(guild_id);
 
 	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `guild_id` = '%d' OR `alliance_id` = '%d'", guild_alliance_db, guild_id, guild_id) )
 		Sql_ShowDebug(sql_handle);
@@ -26,7 +26,7 @@ static int mail_fromsql(int char_id, struct mail_data* md)
 	md->amount = 0;
 	md->full = false;
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_AppendStr(&buf, "SELECT `id`,`send_name`,`send_id`,`dest_name`,`dest_id`,`title`,`message`,`time`,`status`,"
 		"`zeny`,`amount`,`nameid`,`refine`,`attribute`,`identify`,`unique_id`,`bound`");
 	for (i = 0; i < MAX_SLOTS; i++)
@@ -108,7 +108,7 @@ int mail_savemessage(struct mail_message* msg)
 	int j;
 
 	// Build message save query
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_Printf(&buf, "INSERT INTO `%s` (`send_name`, `send_id`, `dest_name`, `dest_id`, `title`, `message`, `time`, `status`, `zeny`, `amount`, `nameid`, `refine`, `attribute`, `identify`, `unique_id`, `bound`", mail_db);
 	for (j = 0; j < MAX_SLOTS; j++)
 		StringBuf_Printf(&buf, ", `card%d`", j);
@@ -145,7 +145,7 @@ static bool mail_loadmessage(int mail_id, struct mail_message* msg)
 	int j;
 	StringBuf buf;
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_AppendStr(&buf, "SELECT `id`,`send_name`,`send_id`,`dest_name`,`dest_id`,`title`,`message`,`time`,`status`,"
 		"`zeny`,`amount`,`nameid`,`refine`,`attribute`,`identify`,`unique_id`,`bound`");
 	for( j = 0; j < MAX_SLOTS; j++ )
@@ -233,7 +233,7 @@ static bool mail_DeleteAttach(int mail_id)
 	StringBuf buf;
 	int i;
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_Printf(&buf, "UPDATE `%s` SET `zeny` = '0', `nameid` = '0', `amount` = '0', `refine` = '0', `attribute` = '0', `identify` = '0'", mail_db);
 	for (i = 0; i < MAX_SLOTS; i++)
 		StringBuf_Printf(&buf, ", `card%d` = '0'", i);
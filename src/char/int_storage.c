@@ -2,6 +2,7 @@
 // For more information, see LICENCE in the main folder
 
 #include "../common/mmo.h"
+#include "../common/db.h"
 #include "../common/malloc.h"
 #include "../common/showmsg.h"
 #include "../common/socket.h"
@@ -17,10 +18,33 @@
 
 #define STORAGE_MEMINC	16
 
+/// Row ids of a guild storage known to the map-servers, indexed by storage slot.
+/// Lets slot deltas (0x3057) be written row by row instead of re-matching the table.
+struct guild_storage_rows {
+	uint32 version; // version the map-server has to quote to send a delta
+	int id[MAX_GUILD_STORAGE]; // `id` of the row stored in each slot, 0 if empty
+};
+
+static DBMap* guild_storage_rows_db; // int guild_id -> struct guild_storage_rows*
+static uint32 guild_storage_version = 0; // last version handed out
+
+/// Returns a storage version that was not handed out before, never 0.
+static uint32 guild_storage_nextversion(void)
+{
+	if( ++guild_storage_version == 0 )
+		++guild_storage_version;
+	return guild_storage_version;
+}
+
+static DBData create_guild_storage_rows(DBKey key, va_list args)
+{
+	return db_ptr2data(aCalloc(1, sizeof(struct guild_storage_rows)));
+}
+
 /// Save storage data to sql
 int storage_tosql(int account_id, struct storage_data* p)
 {
-	memitemdata_to_sql(p->items, MAX_STORAGE, account_id, TABLE_STORAGE);
+	memitemdata_to_sql(p->items, MAX_STORAGE, account_id, TABLE_STORAGE, NULL);
 	return 0;
 }
 
@@ -34,7 +58,7 @@ int storage_fromsql(int account_id, struct storage_data* p)
 	p->storage_amount = 0;
 
 	// Storage {`account_id`/`id`/`nameid`/`amount`/`equip`/`identify`/`refine`/`attribute`/`card0`/`card1`/`card2`/`card3`}
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_AppendStr(&buf, "SELECT `id`,`nameid`,`amount`,`equip`,`identify`,`refine`,`attribute`,`expire_time`,`bound`,`unique_id`");
 	for( j = 0; j < MAX_SLOTS; ++j )
 		StringBuf_Printf(&buf, ",`card%d`", j);
@@ -75,7 +99,8 @@ int storage_fromsql(int account_id, struct storage_data* p)
 /// Save guild_storage data to sql
 int guild_storage_tosql(int guild_id, struct guild_storage *p)
 {
-	memitemdata_to_sql(p->items, MAX_GUILD_STORAGE, guild_id, TABLE_GUILD_STORAGE);
+	memitemdata_to_sql(p->items, MAX_GUILD_STORAGE, guild_id, TABLE_GUILD_STORAGE, NULL);
+	idb_remove(guild_storage_rows_db, guild_id); // Row ids unknown now, map-servers have to send the whole storage
 	ShowInfo ("guild storage save to DB - guild: %d\n", guild_id);
 	return 0;
 }
@@ -91,7 +116,7 @@ int guild_storage_fromsql(int guild_id, struct guild_storage *p)
 	p->guild_id = guild_id;
 
 	//Storage {`guild_id`/`id`/`nameid`/`amount`/`equip`/`identify`/`refine`/`attribute`/`card0`/`card1`/`card2`/`card3`}
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_AppendStr(&buf, "SELECT `id`,`nameid`,`amount`,`equip`,`identify`,`refine`,`attribute`,`bound`,`unique_id`");
 	for( j = 0; j < MAX_SLOTS; ++j )
 		StringBuf_Printf(&buf, ",`card%d`", j);
@@ -133,11 +158,13 @@ int guild_storage_fromsql(int guild_id, struct guild_storage *p)
 // storage data initialize
 int inter_storage_sql_init(void)
 {
+	guild_storage_rows_db = idb_alloc(DB_OPT_RELEASE_DATA);
 	return 1;
 }
 // storage data finalize
 void inter_storage_sql_final(void)
 {
+	db_destroy(guild_storage_rows_db);
 	return;
 }
 
@@ -152,14 +179,45 @@ int inter_guild_storage_delete(int guild_id)
 {
 	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `guild_id`='%d'", guild_storage_db, guild_id) )
 		Sql_ShowDebug(sql_handle);
+	idb_remove(guild_storage_rows_db, guild_id);
 	return 0;
 }
 
+/// Remembers the row ids of a guild storage that was just read from the db.
+/// @return version the map-server must quote in its deltas
+static uint32 guild_storage_bindrows(int guild_id, const struct guild_storage* gs)
+{
+	struct guild_storage_rows* rows = (struct guild_storage_rows*)idb_ensure(guild_storage_rows_db, guild_id, create_guild_storage_rows);
+	int i;
+
+	for( i = 0; i < MAX_GUILD_STORAGE; ++i )
+		rows->id[i] = gs->items[i].nameid ? gs->items[i].id : 0;
+	rows->version = guild_storage_nextversion();
+	return rows->version;
+}
+
+/// Saves a whole guild storage and remembers the row every slot was saved to.
+/// @return version the map-server must quote in its deltas, 0 if the save failed
+static uint32 guild_storage_tosql_rows(int guild_id, const struct guild_storage* gs)
+{
+	struct guild_storage_rows* rows = (struct guild_storage_rows*)idb_ensure(guild_storage_rows_db, guild_id, create_guild_storage_rows);
+
+	if( memitemdata_to_sql(gs->items, MAX_GUILD_STORAGE, guild_id, TABLE_GUILD_STORAGE, rows->id) ) { // Don't trust the mapping, keep sending it whole
+		idb_remove(guild_storage_rows_db, guild_id);
+		return 0;
+	}
+	ShowInfo ("guild storage save to DB - guild: %d\n", guild_id);
+	rows->version = guild_storage_nextversion();
+	return rows->version;
+}
+
 //---------------------------------------------------------
 // packet from map server
 
 int mapif_load_guild_storage(int fd,int account_id,int guild_id, char flag)
 {
+	struct guild_storage* gs;
+
 	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT `guild_id` FROM `%s` WHERE `guild_id`='%d'", guild_db, guild_id) )
 		Sql_ShowDebug(sql_handle);
 	else if( Sql_NumRows(sql_handle) > 0 ) { //Guild exists
@@ -169,7 +227,9 @@ int mapif_load_guild_storage(int fd,int account_id,int guild_id, char flag)
 		WFIFOL(fd,4) = account_id;
 		WFIFOL(fd,8) = guild_id;
 		WFIFOB(fd,12) = flag; //1 open storage, 0 don't open
-		guild_storage_fromsql(guild_id, (struct guild_storage*)WFIFOP(fd,13));
+		gs = (struct guild_storage*)WFIFOP(fd,13);
+		guild_storage_fromsql(guild_id, gs);
+		gs->version = guild_storage_bindrows(guild_id, gs);
 		WFIFOSET(fd, WFIFOW(fd,2));
 		return 0;
 	}
@@ -183,14 +243,20 @@ int mapif_load_guild_storage(int fd,int account_id,int guild_id, char flag)
 	WFIFOSET(fd, 12);
 	return 0;
 }
-int mapif_save_guild_storage_ack(int fd,int account_id,int guild_id,int fail)
+/**
+ * IZ 0x3819 <account_id>.L <guild_id>.L <fail>.B <version>.L
+ * @param fail : 0 saved, 1 failed, 2 delta refused, send the whole storage
+ * @param version : version to quote in the next delta, 0 to send the whole storage
+ */
+int mapif_save_guild_storage_ack(int fd,int account_id,int guild_id,int fail,uint32 version)
 {
-	WFIFOHEAD(fd,11);
+	WFIFOHEAD(fd,15);
 	WFIFOW(fd,0) = 0x3819;
 	WFIFOL(fd,2) = account_id;
 	WFIFOL(fd,6) = guild_id;
 	WFIFOB(fd,10) = fail;
-	WFIFOSET(fd,11);
+	WFIFOL(fd,11) = version;
+	WFIFOSET(fd,15);
 	return 0;
 }
 
@@ -220,13 +286,93 @@ int mapif_parse_SaveGuildStorage(int fd)
 			Sql_ShowDebug(sql_handle);
 		else if( Sql_NumRows(sql_handle) > 0 ) { //Guild exists
 			Sql_FreeResult(sql_handle);
-			guild_storage_tosql(guild_id, (struct guild_storage*)RFIFOP(fd,12));
-			mapif_save_guild_storage_ack(fd, RFIFOL(fd,4), guild_id, 0);
+			mapif_save_guild_storage_ack(fd, RFIFOL(fd,4), guild_id, 0, guild_storage_tosql_rows(guild_id, (struct guild_storage*)RFIFOP(fd,12)));
 			return 0;
 		}
 		Sql_FreeResult(sql_handle);
 	}
-	mapif_save_guild_storage_ack(fd, RFIFOL(fd,4), guild_id, 1);
+	mapif_save_guild_storage_ack(fd, RFIFOL(fd,4), guild_id, 1, 0);
+	return 0;
+}
+
+/**
+ * ZI 0x3057 <size>.W <account_id>.L <guild_id>.L <version>.L <count>.W { <slot>.W <item>.?B }*count
+ * Saves only the guild storage slots changed since the save that returned <version>.
+ * Refused if the slot to row mapping moved on in the meantime, the map-server then sends the whole storage.
+ */
+int mapif_parse_SaveGuildStorageDelta(int fd)
+{
+	struct guild_storage_rows* rows;
+	struct item item;
+	StringBuf buf;
+	const int entry = 2 + sizeof(struct item);
+	int account_id, guild_id, count, i, j, errors = 0;
+
+	RFIFOHEAD(fd);
+	account_id = RFIFOL(fd,4);
+	guild_id = RFIFOL(fd,8);
+	count = RFIFOW(fd,16);
+
+	if( RFIFOW(fd,2) != 18 + count * entry ) {
+		ShowError("inter storage: delta size error %d != %d\n", RFIFOW(fd,2), 18 + count * entry);
+		mapif_save_guild_storage_ack(fd, account_id, guild_id, 2, 0);
+		return 0;
+	}
+
+	rows = (struct guild_storage_rows*)idb_get(guild_storage_rows_db, guild_id);
+	if( rows == NULL || rows->version != RFIFOL(fd,12) ) {
+		mapif_save_guild_storage_ack(fd, account_id, guild_id, 2, 0);
+		return 0;
+	}
+
+	StringBuf_InitArena(&buf);
+	for( i = 0; i < count; ++i ) {
+		int slot = RFIFOW(fd,18 + i * entry);
+
+		if( slot >= MAX_GUILD_STORAGE ) {
+			errors++;
+			continue;
+		}
+		memcpy(&item, RFIFOP(fd,18 + i * entry + 2), sizeof(struct item));
+
+		StringBuf_Clear(&buf);
+		if( item.nameid == 0 ) {
+			if( rows->id[slot] == 0 )
+				continue;
+			StringBuf_Printf(&buf, "DELETE FROM `%s` WHERE `id`='%d' LIMIT 1", guild_storage_db, rows->id[slot]);
+		} else if( rows->id[slot] ) {
+			StringBuf_Printf(&buf, "UPDATE `%s` SET `nameid`='%hu', `amount`='%d', `equip`='%d', `identify`='%d', `refine`='%d', `attribute`='%d', `expire_time`='%u', `bound`='%d', `unique_id`='%"PRIu64"'",
+				guild_storage_db, item.nameid, item.amount, item.equip, item.identify, item.refine, item.attribute, item.expire_time, item.bound, item.unique_id);
+			for( j = 0; j < MAX_SLOTS; ++j )
+				StringBuf_Printf(&buf, ", `card%d`=%hu", j, item.card[j]);
+			StringBuf_Printf(&buf, " WHERE `id`='%d' LIMIT 1", rows->id[slot]);
+		} else {
+			StringBuf_Printf(&buf, "INSERT INTO `%s`(`guild_id`, `nameid`, `amount`, `equip`, `identify`, `refine`, `attribute`, `expire_time`, `bound`, `unique_id`", guild_storage_db);
+			for( j = 0; j < MAX_SLOTS; ++j )
+				StringBuf_Printf(&buf, ", `card%d`", j);
+			StringBuf_Printf(&buf, ") VALUES ('%d', '%hu', '%d', '%d', '%d', '%d', '%d', '%u', '%d', '%"PRIu64"'",
+				guild_id, item.nameid, item.amount, item.equip, item.identify, item.refine, item.attribute, item.expire_time, item.bound, item.unique_id);
+			for( j = 0; j < MAX_SLOTS; ++j )
+				StringBuf_Printf(&buf, ", '%hu'", item.card[j]);
+			StringBuf_AppendStr(&buf, ")");
+		}
+
+		if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) ) {
+			Sql_ShowDebug(sql_handle);
+			errors++;
+			continue;
+		}
+		rows->id[slot] = item.nameid ? (rows->id[slot] ? rows->id[slot] : (int)Sql_LastInsertId(sql_handle)) : 0;
+	}
+	StringBuf_Destroy(&buf);
+
+	if( errors ) { // Don't trust the mapping anymore, have the whole storage sent
+		idb_remove(guild_storage_rows_db, guild_id);
+		mapif_save_guild_storage_ack(fd, account_id, guild_id, 2, 0);
+		return 0;
+	}
+	rows->version = guild_storage_nextversion();
+	mapif_save_guild_storage_ack(fd, account_id, guild_id, 0, rows->version);
 	return 0;
 }
 
@@ -288,7 +434,7 @@ int mapif_parse_itembound_retrieve(int fd)
 	int j, guild_id = RFIFOW(fd,10);
 	uint32 char_id = RFIFOL(fd,2), account_id = RFIFOL(fd,6);
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 
 	//Get bound items from player's inventory
 	StringBuf_AppendStr(&buf, "SELECT `id`, `nameid`, `amount`, `equip`, `identify`, `refine`, `attribute`, `expire_time`, `bound`");
@@ -379,7 +525,7 @@ int mapif_parse_itembound_retrieve(int fd)
 	//Update player's view
 	if( j ) {
 		StringBuf buf2;
-		StringBuf_Init(&buf2);
+		StringBuf_InitArena(&buf2);
 		StringBuf_Printf(&buf2, "UPDATE `%s` SET %s WHERE `char_id`='%d'", char_db, StringBuf_Value(&buf), char_id);
 
 		if( SQL_ERROR == SqlStmt_PrepareStr(stmt, StringBuf_Value(&buf)) ||
@@ -410,6 +556,7 @@ int inter_storage_parse_frommap(int fd)
 	switch( RFIFOW(fd,0) ) {
 		case 0x3018: mapif_parse_LoadGuildStorage(fd); break;
 		case 0x3019: mapif_parse_SaveGuildStorage(fd); break;
+		case 0x3057: mapif_parse_SaveGuildStorageDelta(fd); break;
 #ifdef BOUND_ITEMS
 		case 0x3056: mapif_parse_itembound_retrieve(fd); break;
 #endif
@@ -50,7 +50,7 @@ int inter_recv_packet_length[] = {
 	-1,10,-1,14, 14,19, 6,-1, 14,14, 6, 0,  0, 0,  0, 0, // 3020- Party
 	-1, 6,-1,-1, 55,19, 6,-1, 14,-1,-1,-1, 18,19,186,-1, // 3030-
 	-1, 9, 0, 0,  0, 0, 0, 0,  7, 6,10,10, 10,-1,  0, 0, // 3040-
-	-1,-1,10,10,  0,-1,12, 0,  0, 0, 0, 0,  0, 0,  0, 0, // 3050-  Auction System [Zephyrus]
+	-1,-1,10,10,  0,-1,12,-1,  0, 0, 0, 0,  0, 0,  0, 0, // 3050-  Auction System [Zephyrus]
 	 6,-1, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0,  0, 0, // 3060-  Quest system [Kevin] [Inkfish]
 	-1,10, 6,-1,  0, 0, 0, 0,  0, 0, 0, 0, -1,10,  6,-1, // 3070-  Mercenary packets [Zephyrus], Elemental packets [pakpil]
 	48,14,-1, 6,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0,  0, 0, // 3080-
@@ -618,7 +618,7 @@ int inter_accreg_tosql(int account_id, int char_id, struct accreg* reg, int type
 	if( reg->reg_num <= 0 )
 		return 0;
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_Printf(&buf, "INSERT INTO `%s` (`type`,`account_id`,`char_id`,`str`,`value`) VALUES ", reg_db);
 
 	for( i = 0; i < reg->reg_num; ++i ) {
@@ -0,0 +1,197 @@
+//
+// Per-tick Arena Allocator
+//
+// Copyright (c) rAthena Project (www.rathena.org) - Licensed under GNU GPL
+// For more information, see LICENCE in the main folder
+//
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../common/cbasetypes.h"
+#include "../common/showmsg.h"
+#include "../common/malloc.h"
+#include "../common/arena.h"
+
+
+#define ARENA_CHUNK_SIZE (64*1024)
+#define ARENA_ALIGN(x) ( ((x) + 15) & ~((size_t)15) )
+
+// Chunks are linked from the current one back to the first one of the tick,
+// the blocks follow the (aligned) header.
+struct arena_chunk{
+	struct arena_chunk *prev;
+	size_t size;	// usable bytes
+	size_t used;
+};
+
+#define CHUNK_DATA(c) ( (char*)(c) + ARENA_ALIGN(sizeof(struct arena_chunk)) )
+
+
+static struct arena_chunk *l_chunk = NULL;
+static size_t l_size = 0;		// bytes in all chunks
+static size_t l_tick_size = 0;	// peak of l_size in the current tick
+
+// Statistics
+static uint32 l_tick_allocs = 0;
+static size_t l_tick_bytes = 0;
+static uint64 l_ticks = 0;
+static uint64 l_allocs = 0;
+static uint64 l_bytes = 0;
+static size_t l_peak_bytes = 0;
+static uint64 l_chunk_allocs = 0; // allocations that went to the memory manager
+
+
+static void chunk_add(size_t min_size){
+	struct arena_chunk *c;
+	size_t size = max(ARENA_CHUNK_SIZE, ARENA_ALIGN(min_size));
+
+	c = (struct arena_chunk*)aMalloc(ARENA_ALIGN(sizeof(struct arena_chunk)) + size);
+	c->prev = l_chunk;
+	c->size = size;
+	c->used = 0;
+	l_chunk = c;
+
+	l_size += size;
+	if(l_size > l_tick_size)
+		l_tick_size = l_size;
+
+	l_chunk_allocs++;
+}//end: chunk_add()
+
+
+void arena_init(){
+	l_chunk = NULL;
+	l_size = l_tick_size = 0;
+	l_tick_allocs = 0;
+	l_tick_bytes = 0;
+	l_ticks = l_allocs = l_bytes = l_chunk_allocs = 0;
+	l_peak_bytes = 0;
+
+	chunk_add(ARENA_CHUNK_SIZE);
+}//end: arena_init()
+
+
+void arena_final(){
+	arena_mark none = { NULL, 0 };
+
+	if(l_ticks > 0){
+		ShowInfo("Arena: %u transient allocations (%.2f per tick, %.2f KiB per tick, peak %u KiB) kept off the memory manager in %u ticks, %u chunk allocations.\n",
+			(uint32)l_allocs, (double)l_allocs/l_ticks, (double)l_bytes/l_ticks/1024.0, (uint32)(l_peak_bytes/1024), (uint32)l_ticks, (uint32)l_chunk_allocs);
+	}
+
+	arena_rewind(none);
+}//end: arena_final()
+
+
+void *arena_alloc(size_t size){
+	void *ptr;
+
+	size = ARENA_ALIGN(size);
+	if(size == 0)
+		size = 16;
+
+	if(l_chunk == NULL || l_chunk->size - l_chunk->used < size)
+		chunk_add(size);
+
+	ptr = CHUNK_DATA(l_chunk) + l_chunk->used;
+	l_chunk->used += size;
+
+	l_tick_allocs++;
+	l_tick_bytes += size;
+
+	return ptr;
+}//end: arena_alloc()
+
+
+void *arena_realloc(void *ptr, size_t old_size, size_t new_size){
+	void *newptr;
+
+	if(ptr == NULL)
+		return arena_alloc(new_size);
+
+	old_size = ARENA_ALIGN(old_size);
+	new_size = ARENA_ALIGN(new_size);
+
+	// Last block and still fits? grow / shrink in place.
+	if((char*)ptr + old_size == CHUNK_DATA(l_chunk) + l_chunk->used
+	&& l_chunk->size - (l_chunk->used - old_size) >= new_size){
+		l_chunk->used = l_chunk->used - old_size + new_size;
+		if(new_size > old_size)
+			l_tick_bytes += new_size - old_size;
+		return ptr;
+	}
+
+	newptr = arena_alloc(new_size);
+	memcpy(newptr, ptr, min(old_size, new_size));
+
+	return newptr;
+}//end: arena_realloc()
+
+
+void arena_free(void *ptr, size_t size){
+
+	if(ptr == NULL || l_chunk == NULL)
+		return;
+
+	size = ARENA_ALIGN(size);
+	if(size == 0)
+		size = 16;
+
+	if((char*)ptr + size == CHUNK_DATA(l_chunk) + l_chunk->used)
+		l_chunk->used -= size;
+
+}//end: arena_free()
+
+
+arena_mark arena_checkpoint(){
+	arena_mark mark;
+
+	mark.chunk = l_chunk;
+	mark.used = (l_chunk != NULL) ? l_chunk->used : 0;
+
+	return mark;
+}//end: arena_checkpoint()
+
+
+void arena_rewind(arena_mark mark){
+
+	while(l_chunk != mark.chunk){
+		struct arena_chunk *prev = l_chunk->prev;
+		l_size -= l_chunk->size;
+		aFree(l_chunk);
+		l_chunk = prev;
+	}
+
+	if(l_chunk != NULL)
+		l_chunk->used = mark.used;
+
+}//end: arena_rewind()
+
+
+void arena_reset(){
+
+	l_ticks++;
+	l_allocs += l_tick_allocs;
+	l_bytes += l_tick_bytes;
+	if(l_tick_bytes > l_peak_bytes)
+		l_peak_bytes = l_tick_bytes;
+	l_tick_allocs = 0;
+	l_tick_bytes = 0;
+
+	if(l_chunk != NULL && l_chunk->prev == NULL && l_chunk->size >= l_tick_size){
+		l_chunk->used = 0;
+	}else{
+		// The tick needed more than the first chunk (maybe already rewound),
+		// replace everything by one chunk that fits the peak.
+		arena_mark none = { NULL, 0 };
+		size_t size = l_tick_size;
+
+		arena_rewind(none);
+		chunk_add(size);
+	}
+	l_tick_size = l_size;
+
+}//end: arena_reset()
@@ -0,0 +1,77 @@
+// Copyright (c) rAthena Project (www.rathena.org) - Licensed under GNU GPL
+// For more information, see LICENCE in the main folder
+
+#ifndef _rA_ARENA_H_
+#define _rA_ARENA_H_
+
+#include "../common/cbasetypes.h"
+
+//
+// Per-tick bump allocator for transient memory.
+//
+// Memory taken from the arena is valid until core calls arena_reset at the
+// end of the current main loop iteration (after do_timer and do_sockets).
+// So it must only be used for data that doesnt outlive the timer callback
+// or packet parse it was allocated in, like query buffers and iterators.
+//
+// Not thread-safe, only the main thread may use the arena.
+//
+
+typedef struct arena_mark{
+	struct arena_chunk *chunk;
+	size_t used;
+} arena_mark;
+
+
+void arena_init();
+void arena_final();
+
+
+/**
+ * Allocates a block from the arena (sizes are rounded up to 16 byte).
+ *
+ * @param size - number of bytes
+ *
+ * @return block that stays valid until the next arena_reset / arena_rewind
+ */
+void *arena_alloc(size_t size);
+
+
+/**
+ * Resizes a block, in place if it is the last one allocated.
+ *
+ * @param ptr - block returned by arena_alloc / arena_realloc, or NULL
+ * @param old_size - size the block was allocated with
+ * @param new_size - requested size
+ *
+ * @return the (possibly moved) block
+ */
+void *arena_realloc(void *ptr, size_t old_size, size_t new_size);
+
+
+/**
+ * Gives a block back to the arena.
+ * Only the last allocated block is actually reused, any other block stays
+ * until the next reset.
+ */
+void arena_free(void *ptr, size_t size);
+
+
+/**
+ * Checkpoints:
+ *  arena_mark m = arena_checkpoint();
+ *  ...
+ *  arena_rewind(m); // releases every block allocated since the checkpoint
+ */
+arena_mark arena_checkpoint();
+void arena_rewind(arena_mark mark);
+
+
+/**
+ * Releases all blocks and updates the per tick statistics.
+ * Called by core after each main loop iteration.
+ */
+void arena_reset();
+
+
+#endif
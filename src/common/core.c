@@ -12,6 +12,7 @@
 #include "timer.h"
 #include "thread.h"
 #include "mempool.h"
+#include "arena.h"
 #include "sql.h"
 #include "cbasetypes.h"
 #include "msg_conf.h"
@@ -32,6 +33,9 @@
 /// Called when a terminate signal is received.
 void (*shutdown_callback)(void) = NULL;
 
+/// Called after each batch of expired timers and received packets.
+void (*step_callback)(void) = NULL;
+
 #if defined(BUILDBOT)
 	int buildbotflag = 0;
 #endif
@@ -316,6 +320,7 @@ int main (int argc, char **argv)
 	Sql_init();
 	rathread_init();
 	mempool_init();
+	arena_init();
 	db_init();
 	signals_init();
 
@@ -331,10 +336,16 @@ int main (int argc, char **argv)
 	// Main runtime cycle
 	while (runflag != CORE_ST_STOP) {
 		int next = do_timer(gettick_nocache());
+		if( step_callback != NULL )
+			step_callback();
 		do_sockets(next);
+		if( step_callback != NULL )
+			step_callback();
+		arena_reset();
 	}
 
 	do_final();
+	arena_final();
 
 	timer_final();
 	socket_final();
@@ -49,4 +49,8 @@ enum E_CORE_ST
 /// If NULL, runflag is set to CORE_ST_STOP instead.
 extern void (*shutdown_callback)(void);
 
+/// Called after each batch of expired timers and after each batch of received packets.
+/// If NULL, nothing is done.
+extern void (*step_callback)(void);
+
 #endif /* _CORE_H_ */
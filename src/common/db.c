@@ -79,7 +79,8 @@
  *  (1) Private typedefs, enums, structures, defines and global variables of *
  *  the database system.                                                     *
  *  DB_ENABLE_STATS - Define to enable database statistics.                  *
- *  HASH_SIZE       - Define with the size of the hashtable.                 *
+ *  HASH_SIZE       - Define with the initial size of the hashtable.         *
+ *  HASH_SIZE_MAX   - Define with the maximum size of the hashtable.         *
  *  DBNColor        - Enumeration of colors of the nodes.                    *
  *  DBNode          - Structure of a node in RED-BLACK trees.                *
  *  struct db_free  - Structure that holds a deleted node to be freed.       *
@@ -100,11 +101,22 @@
 //#define DB_ENABLE_STATS
 
 /**
- * Size of the hashtable in the database.
+ * Initial size of the hashtable in the database, when none is given to
+ * {@link #db_alloc_sized(const char*,int,DBType,DBOptions,unsigned short,unsigned int)}.
+ * The hashtable doubles whenever the database holds more entries than
+ * buckets, so small databases stay small and big ones keep short trees.
  * @private
  * @see DBMap_impl#ht
+ * @see #db_rehash(DBMap_impl*,unsigned int)
  */
-#define HASH_SIZE (256+27)
+#define HASH_SIZE 31
+
+/**
+ * Maximum size the hashtable grows to.
+ * @private
+ * @see DBMap_impl#ht
+ */
+#define HASH_SIZE_MAX (0x1000000-1)
 
 /**
  * The color of individual nodes.
@@ -167,6 +179,7 @@ struct db_free {
  * @param hash Hasher of the database
  * @param release Releaser of the database
  * @param ht Hashtable of RED-BLACK trees
+ * @param ht_size Number of buckets in ht
  * @param type Type of the database
  * @param options Options of the database
  * @param item_count Number of items in the database
@@ -191,7 +204,8 @@ typedef struct DBMap_impl {
 	DBComparator cmp;
 	DBHasher hash;
 	DBReleaser release;
-	DBNode ht[HASH_SIZE];
+	DBNode *ht;
+	unsigned int ht_size;
 	DBNode cache;
 	DBType type;
 	DBOptions options;
@@ -794,6 +808,7 @@ static void db_free_lock(DBMap_impl* db)
  * @see #db_free_dbn(DBNode)
  * @see #db_lock(DBMap_impl*)
  */
+static void db_rehash(DBMap_impl* db, unsigned int size);
 static void db_free_unlock(DBMap_impl* db)
 {
 	unsigned int i;
@@ -816,6 +831,86 @@ static void db_free_unlock(DBMap_impl* db)
 		ers_free(db->nodes, db->free_list[i].node);
 	}
 	db->free_count = 0;
+
+	// Grow the hashtable now that no one is walking it
+	if (db->item_count > db->ht_size && db->ht_size < HASH_SIZE_MAX && !(db->options&DB_OPT_NO_RESIZE) && !db->global_lock)
+		db_rehash(db, min(db->ht_size*2+1, HASH_SIZE_MAX));
+}
+
+/**
+ * Moves all nodes of the database to a hashtable of a different size.
+ * Only called when the database isn't locked, so there are no deleted
+ * nodes and no iterator holds a position in the hashtable.
+ * The nodes themselves don't move, pointers to their data stay valid.
+ * @param db Target database
+ * @param size New number of buckets
+ * @private
+ * @see #db_free_unlock(DBMap_impl*)
+ */
+static void db_rehash(DBMap_impl* db, unsigned int size)
+{
+	DBNode *ht;
+	DBNode node;
+	DBNode next;
+	DBNode parent;
+	DBNode *root;
+	unsigned int i;
+	int c;
+
+	CREATE(ht, DBNode, size);
+	for (i = 0; i < db->ht_size; i++) {
+		// Move the nodes in the order: left tree, right tree, current node
+		node = db->ht[i];
+		while (node) {
+			if (node->left) {
+				node = node->left;
+				continue;
+			}
+			if (node->right) {
+				node = node->right;
+				continue;
+			}
+			next = node->parent;
+			if (next) {
+				if (next->left == node)
+					next->left = NULL;
+				else
+					next->right = NULL;
+			}
+			// insert the leaf into the new hashtable
+			root = &ht[db->hash(node->key, db->maxlen)%size];
+			c = 0;
+			for (parent = *root; parent; ) {
+				c = db->cmp(node->key, parent->key, db->maxlen);
+				if (c < 0) {
+					if (parent->left == NULL)
+						break;
+					parent = parent->left;
+				} else {
+					if (parent->right == NULL)
+						break;
+					parent = parent->right;
+				}
+			}
+			node->parent = parent;
+			if (parent == NULL) { // hash entry is empty
+				node->color = BLACK;
+				*root = node;
+			} else {
+				node->color = RED;
+				if (c < 0)
+					parent->left = node;
+				else
+					parent->right = node;
+				if (parent->color == RED) // two consecutive RED nodes, must rebalance
+					db_rebalance(node, root);
+			}
+			node = next;
+		}
+	}
+	aFree(db->ht);
+	db->ht = ht;
+	db->ht_size = size;
 }
 
 /*****************************************************************************\
@@ -1144,7 +1239,7 @@ DBData* dbit_obj_last(DBIterator *self, DBKey* out_key)
 	
 	DB_COUNTSTAT(dbit_last);
 	// position after the last entry
-	it->ht_index = HASH_SIZE;
+	it->ht_index = it->db->ht_size;
 	it->node = NULL;
 	// get previous entry
 	return self->prev(self, out_key);
@@ -1175,7 +1270,7 @@ DBData* dbit_obj_next(DBIterator *self, DBKey* out_key)
 	}
 	node = it->node;
 	memset(&fake, 0, sizeof(fake));
-	for( ; it->ht_index < HASH_SIZE; ++(it->ht_index) )
+	for( ; it->ht_index < (int)it->db->ht_size; ++(it->ht_index) )
 	{
 		// Iterate in the order: left tree, current node, right tree
 		if( node == NULL )
@@ -1244,9 +1339,9 @@ DBData* dbit_obj_prev(DBIterator *self, DBKey* out_key)
 	struct dbn fake;
 
 	DB_COUNTSTAT(dbit_prev);
-	if( it->ht_index >= HASH_SIZE )
+	if( it->ht_index >= (int)it->db->ht_size )
 	{// get last node
-		it->ht_index = HASH_SIZE-1;
+		it->ht_index = it->db->ht_size-1;
 		it->node = NULL;
 	}
 	node = it->node;
@@ -1434,7 +1529,7 @@ static bool db_obj_exists(DBMap *self, DBKey key)
 	}
 
 	db_free_lock(db);
-	node = db->ht[db->hash(key, db->maxlen)%HASH_SIZE];
+	node = db->ht[db->hash(key, db->maxlen)%db->ht_size];
 	while (node) {
 		int c = db->cmp(key, node->key, db->maxlen);
 
@@ -1486,7 +1581,7 @@ static DBData* db_obj_get(DBMap *self, DBKey key)
 	}
 
 	db_free_lock(db);
-	node = db->ht[db->hash(key, db->maxlen)%HASH_SIZE];
+	node = db->ht[db->hash(key, db->maxlen)%db->ht_size];
 	while (node) {
 		int c = db->cmp(key, node->key, db->maxlen);
 
@@ -1535,7 +1630,7 @@ static unsigned int db_obj_vgetall(DBMap *self, DBData **buf, unsigned int max,
 	if (match == NULL) return 0; // nullpo candidate
 
 	db_free_lock(db);
-	for (i = 0; i < HASH_SIZE; i++) {
+	for (i = 0; i < db->ht_size; i++) {
 		// Match in the order: current node, left tree, right tree
 		node = db->ht[i];
 		while (node) {
@@ -1644,7 +1739,7 @@ static DBData* db_obj_vensure(DBMap *self, DBKey key, DBCreateData create, va_li
 		return &db->cache->data; // cache hit
 
 	db_free_lock(db);
-	hash = db->hash(key, db->maxlen)%HASH_SIZE;
+	hash = db->hash(key, db->maxlen)%db->ht_size;
 	node = db->ht[hash];
 	while (node) {
 		c = db->cmp(key, node->key, db->maxlen);
@@ -1779,7 +1874,7 @@ static int db_obj_put(DBMap *self, DBKey key, DBData data, DBData *out_data)
 	}
 	// search for an equal node
 	db_free_lock(db);
-	hash = db->hash(key, db->maxlen)%HASH_SIZE;
+	hash = db->hash(key, db->maxlen)%db->ht_size;
 	for (node = db->ht[hash]; node; ) {
 		c = db->cmp(key, node->key, db->maxlen);
 		if (c == 0) { // equal entry, replace
@@ -1872,7 +1967,7 @@ static int db_obj_remove(DBMap *self, DBKey key, DBData *out_data)
 	}
 
 	db_free_lock(db);
-	hash = db->hash(key, db->maxlen)%HASH_SIZE;
+	hash = db->hash(key, db->maxlen)%db->ht_size;
 	for(node = db->ht[hash]; node; ){
 		int c = db->cmp(key, node->key, db->maxlen);
 
@@ -1923,7 +2018,7 @@ static int db_obj_vforeach(DBMap *self, DBApply func, va_list args)
 	}
 
 	db_free_lock(db);
-	for (i = 0; i < HASH_SIZE; i++) {
+	for (i = 0; i < db->ht_size; i++) {
 		// Apply func in the order: current node, left node, right node
 		node = db->ht[i];
 		while (node) {
@@ -2006,7 +2101,7 @@ static int db_obj_vclear(DBMap *self, DBApply func, va_list args)
 
 	db_free_lock(db);
 	db->cache = NULL;
-	for (i = 0; i < HASH_SIZE; i++) {
+	for (i = 0; i < db->ht_size; i++) {
 		// Apply the func and delete in the order: left tree, right tree, current node
 		node = db->ht[i];
 		db->ht[i] = NULL;
@@ -2128,6 +2223,7 @@ static int db_obj_vdestroy(DBMap *self, DBApply func, va_list args)
 	db->free_max = 0;
 	ers_destroy(db->nodes);
 	db_free_unlock(db);
+	aFree(db->ht);
 	aFree(db);
 	return sum;
 }
@@ -2397,9 +2493,31 @@ DBReleaser db_custom_release(DBRelease which)
  * @see #db_fix_options(DBType,DBOptions)
  */
 DBMap *db_alloc(const char *file, int line, DBType type, DBOptions options, unsigned short maxlen)
+{
+	return db_alloc_sized(file, line, type, options, maxlen, 0);
+}
+
+/**
+ * Allocate a new database of the specified type with a hashtable of
+ * <code>size</code> buckets.
+ * NOTE: the options are fixed by {@link #db_fix_options(DBType,DBOptions)}
+ * before creating the database.
+ * @param file File where the database is being allocated
+ * @param line Line of the file where the database is being allocated
+ * @param type Type of database
+ * @param options Options of the database
+ * @param maxlen Maximum length of the string to be used as key in string 
+ *          databases. If 0, the maximum number of maxlen is used (64K).
+ * @param size Initial number of buckets, about the number of entries
+ *          expected. If 0, HASH_SIZE is used.
+ * @return The interface of the database
+ * @public
+ * @see #DBMap_impl
+ * @see #db_fix_options(DBType,DBOptions)
+ */
+DBMap *db_alloc_sized(const char *file, int line, DBType type, DBOptions options, unsigned short maxlen, unsigned int size)
 {
 	DBMap_impl* db;
-	unsigned int i;
 
 #ifdef DB_ENABLE_STATS
 	DB_COUNTSTAT(db_alloc);
@@ -2445,8 +2563,8 @@ DBMap *db_alloc(const char *file, int line, DBType type, DBOptions options, unsi
 	db->cmp = db_default_cmp(type);
 	db->hash = db_default_hash(type);
 	db->release = db_default_release(type, options);
-	for (i = 0; i < HASH_SIZE; i++)
-		db->ht[i] = NULL;
+	db->ht_size = ( size == 0 ? HASH_SIZE : min(size, HASH_SIZE_MAX) );
+	CREATE(db->ht, DBNode, db->ht_size);
 	db->cache = NULL;
 	db->type = type;
 	db->options = options;
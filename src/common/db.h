@@ -115,6 +115,8 @@ typedef enum DBType {
  * @param DB_OPT_RELEASE_BOTH Releases both key and data.
  * @param DB_OPT_ALLOW_NULL_KEY Allow NULL keys in the database.
  * @param DB_OPT_ALLOW_NULL_DATA Allow NULL data in the database.
+ * @param DB_OPT_NO_RESIZE Keeps the hashtable at the size it was allocated 
+ *          with instead of growing it with the number of entries.
  * @public
  * @see #db_fix_options(DBType,DBOptions)
  * @see #db_default_release(DBType,DBOptions)
@@ -128,6 +130,7 @@ typedef enum DBOptions {
 	DB_OPT_RELEASE_BOTH    = 6,
 	DB_OPT_ALLOW_NULL_KEY  = 8,
 	DB_OPT_ALLOW_NULL_DATA = 16,
+	DB_OPT_NO_RESIZE       = 32,
 } DBOptions;
 
 /**
@@ -657,6 +660,10 @@ struct DBMap {
 #define uidb_alloc(opt)           db_alloc(__FILE__,__LINE__,DB_UINT,(opt),sizeof(unsigned int))
 #define strdb_alloc(opt,maxlen)   db_alloc(__FILE__,__LINE__,DB_STRING,(opt),(maxlen))
 #define stridb_alloc(opt,maxlen)  db_alloc(__FILE__,__LINE__,DB_ISTRING,(opt),(maxlen))
+#define idb_alloc_sized(opt,size)            db_alloc_sized(__FILE__,__LINE__,DB_INT,(opt),sizeof(int),(size))
+#define uidb_alloc_sized(opt,size)           db_alloc_sized(__FILE__,__LINE__,DB_UINT,(opt),sizeof(unsigned int),(size))
+#define strdb_alloc_sized(opt,maxlen,size)   db_alloc_sized(__FILE__,__LINE__,DB_STRING,(opt),(maxlen),(size))
+#define stridb_alloc_sized(opt,maxlen,size)  db_alloc_sized(__FILE__,__LINE__,DB_ISTRING,(opt),(maxlen),(size))
 #define db_destroy(db)            ( (db)->destroy((db),NULL) )
 // Other macros
 #define db_clear(db)        ( (db)->clear(db,NULL) )
@@ -679,6 +686,7 @@ struct DBMap {
  *           with the fixed options.                                         *
  *  db_custom_release  - Get the releaser that behaves as specified.         *
  *  db_alloc           - Allocate a new database.                            *
+ *  db_alloc_sized     - Allocate a new database with a given hashtable size.*
  *  db_i2key           - Manual cast from 'int' to 'DBKey'.                  *
  *  db_ui2key          - Manual cast from 'unsigned int' to 'DBKey'.         *
  *  db_str2key         - Manual cast from 'unsigned char *' to 'DBKey'.      *
@@ -777,6 +785,26 @@ DBReleaser db_custom_release(DBRelease which);
  */
 DBMap *db_alloc(const char *file, int line, DBType type, DBOptions options, unsigned short maxlen);
 
+/**
+ * Allocate a new database of the specified type, like 
+ * {@link #db_alloc(const char *,int,DBType,DBOptions,unsigned short)}, 
+ * starting with a hashtable of <code>size</code> buckets.
+ * Databases known to hold many entries should be sized up front so they 
+ * don't have to grow while the server starts.
+ * @param file File where the database is being allocated
+ * @param line Line of the file where the database is being allocated
+ * @param type Type of database
+ * @param options Options of the database
+ * @param maxlen Maximum length of the string to be used as key in string 
+ *          databases. If 0, the maximum number of maxlen is used (64K).
+ * @param size Initial number of buckets, about the number of entries 
+ *          expected. If 0, the default size is used.
+ * @return The interface of the database
+ * @public
+ * @see #db_alloc(const char *,int,DBType,DBOptions,unsigned short)
+ */
+DBMap *db_alloc_sized(const char *file, int line, DBType type, DBOptions options, unsigned short maxlen, unsigned int size);
+
 /**
  * Manual cast from 'int' to the union DBKey.
  * @param key Key to be casted
@@ -28,11 +28,14 @@
  *    destroyed so memory will usually only be recovered near the end.       *
  *  - Always wastes space for entries smaller than a pointer.                *
  *                                                                           *
- *  WARNING: The system is not thread-safe at the moment.                    *
+ *  WARNING: Managers are not thread-safe unless created with               *
+ *           ERS_OPT_THREADCACHE. Managers themselves must always be created *
+ *           and destroyed by the main thread.                               *
  *                                                                           *
  *  HISTORY:                                                                 *
  *    0.1 - Initial version                                                  *
  *    1.0 - ERS Rework                                                       *
+ *    1.1 - Thread caching managers (ERS_OPT_THREADCACHE)                    *
  *                                                                           *
  * @version 1.0 - ERS Rework                                                 *
  * @author GreenBox @ rAthena Project                                        *
@@ -42,8 +45,11 @@
 #include <stdlib.h>
 
 #include "../common/cbasetypes.h"
+#include "../common/atomic.h" // InterlockedIncrement, InterlockedDecrement
 #include "../common/malloc.h" // CREATE, RECREATE, aMalloc, aFree
 #include "../common/showmsg.h" // ShowMessage, ShowError, ShowFatalError, CL_BOLD, CL_NORMAL
+#include "../common/spinlock.h" // SPIN_LOCK, EnterSpinLock, LeaveSpinLock
+#include "../common/thread.h" // RA_THREADS_MAX, rathread_get_tid
 #include "ers.h"
 
 #ifndef DISABLE_ERS
@@ -51,11 +57,27 @@
 #define ERS_ROOT_SIZE 256
 #define ERS_BLOCK_ENTRIES 4096
 
+// Number of entries moved at once between a thread cache and its shared cache
+#define ERS_TCACHE_BATCH 64
+
 struct ers_list
 {
 	struct ers_list *Next;
 };
 
+// Entries kept by one thread of an ERS_OPT_THREADCACHE cache, only touched by that thread
+typedef struct ra_align(64) ers_tcache
+{
+	struct ers_list *ReuseList;
+	unsigned int Count;
+} ers_tcache_t;
+
+// Objects of an ERS_OPT_THREADCACHE instance counted by one thread, only touched by that thread
+typedef struct ra_align(64) ers_tcount
+{
+	int32 Count;
+} ers_tcount_t;
+
 typedef struct ers_cache
 {
 	// Allocated object size, including ers_list size
@@ -79,6 +101,13 @@ typedef struct ers_cache
 	// Used objects count
 	unsigned int Used;
 
+	// Shared by threads (ERS_OPT_THREADCACHE), Lock guards everything above
+	bool ThreadCache;
+	SPIN_LOCK Lock;
+
+	// Per thread entry caches, indexed by rathread_get_tid()
+	ers_tcache_t *Threads;
+
 	// Linked list
 	struct ers_cache *Next, *Prev;
 } ers_cache_t;
@@ -98,19 +127,22 @@ typedef struct
 	ers_cache_t *Cache;
 
 	// Count of objects in use, used for detecting memory leaks
-	unsigned int Count;
+	volatile int32 Count;
+
+	// Per thread part of Count (ERS_OPT_THREADCACHE), indexed by rathread_get_tid()
+	ers_tcount_t *ThreadCounts;
 } ers_instance_t;
 
 
 // Array containing a pointer for all ers_cache structures
 static ers_cache_t *CacheList;
 
-static ers_cache_t *ers_find_cache(unsigned int size)
+static ers_cache_t *ers_find_cache(unsigned int size, bool threadcache)
 {
 	ers_cache_t *cache;
 
 	for (cache = CacheList; cache; cache = cache->Next)
-		if (cache->ObjectSize == size)
+		if (cache->ObjectSize == size && cache->ThreadCache == threadcache)
 			return cache;
 
 	CREATE(cache, ers_cache_t, 1);
@@ -121,6 +153,14 @@ static ers_cache_t *ers_find_cache(unsigned int size)
 	cache->Free = 0;
 	cache->Used = 0;
 	cache->Max = 0;
+	cache->ThreadCache = threadcache;
+	cache->Threads = NULL;
+
+	if (threadcache)
+	{
+		InitializeSpinLock(&cache->Lock);
+		CREATE(cache->Threads, ers_tcache_t, RA_THREADS_MAX);
+	}
 	
 	if (CacheList == NULL)
 	{
@@ -152,47 +192,158 @@ static void ers_free_cache(ers_cache_t *cache, bool remove)
 	else
 		CacheList = cache->Next;
 
+	if (cache->ThreadCache)
+		FinalizeSpinLock(&cache->Lock);
+
+	aFree(cache->Threads);
 	aFree(cache->Blocks);
 	aFree(cache);
 }
 
-static void *ers_obj_alloc_entry(ERS self)
+/**
+ * Take an entry from the reuse list of the cache, or from its blocks.
+ * @return Header of the entry
+ */
+static struct ers_list *ers_cache_take(ers_cache_t *cache)
 {
-	ers_instance_t *instance = (ers_instance_t *)self;
-	void *ret;
-
-	if (instance == NULL) 
-	{
-		ShowError("ers_obj_alloc_entry: NULL object, aborting entry freeing.\n");
-		return NULL;
-	}
+	struct ers_list *ret;
 
-	if (instance->Cache->ReuseList != NULL)
+	if (cache->ReuseList != NULL)
 	{
-		ret = (void *)((unsigned char *)instance->Cache->ReuseList + sizeof(struct ers_list));
-		instance->Cache->ReuseList = instance->Cache->ReuseList->Next;
+		ret = cache->ReuseList;
+		cache->ReuseList = ret->Next;
 	} 
-	else if (instance->Cache->Free > 0) 
+	else if (cache->Free > 0) 
 	{
-		instance->Cache->Free--;
-		ret = &instance->Cache->Blocks[instance->Cache->Used - 1][instance->Cache->Free * instance->Cache->ObjectSize + sizeof(struct ers_list)];
+		cache->Free--;
+		ret = (struct ers_list *)&cache->Blocks[cache->Used - 1][cache->Free * cache->ObjectSize];
 	} 
 	else 
 	{
-		if (instance->Cache->Used == instance->Cache->Max) 
+		if (cache->Used == cache->Max) 
 		{
-			instance->Cache->Max = (instance->Cache->Max * 4) + 3;
-			RECREATE(instance->Cache->Blocks, unsigned char *, instance->Cache->Max);
+			cache->Max = (cache->Max * 4) + 3;
+			RECREATE(cache->Blocks, unsigned char *, cache->Max);
 		}
 
-		CREATE(instance->Cache->Blocks[instance->Cache->Used], unsigned char, instance->Cache->ObjectSize * ERS_BLOCK_ENTRIES);
-		instance->Cache->Used++;
+		CREATE(cache->Blocks[cache->Used], unsigned char, cache->ObjectSize * ERS_BLOCK_ENTRIES);
+		cache->Used++;
+
+		cache->Free = ERS_BLOCK_ENTRIES -1;
+		ret = (struct ers_list *)&cache->Blocks[cache->Used - 1][cache->Free * cache->ObjectSize];
+	}
+
+	return ret;
+}
+
+/**
+ * Take an entry from a thread caching cache.
+ * The calling thread's cache is refilled by a batch from the shared cache when empty,
+ * so the lock is only taken once every ERS_TCACHE_BATCH allocations.
+ * @param tid Calling thread
+ * @return Header of the entry
+ */
+static struct ers_list *ers_tcache_take(ers_cache_t *cache, int tid)
+{
+	ers_tcache_t *tc;
+	struct ers_list *ret;
+	unsigned int i;
 
-		instance->Cache->Free = ERS_BLOCK_ENTRIES -1;
-		ret = &instance->Cache->Blocks[instance->Cache->Used - 1][instance->Cache->Free * instance->Cache->ObjectSize + sizeof(struct ers_list)];
+	if (tid < 0 || tid >= RA_THREADS_MAX)
+	{// Not a rathread, no cache of its own
+		EnterSpinLock(&cache->Lock);
+		ret = ers_cache_take(cache);
+		LeaveSpinLock(&cache->Lock);
+		return ret;
 	}
 
-	instance->Count++;
+	tc = &cache->Threads[tid];
+	if (tc->ReuseList == NULL)
+	{
+		EnterSpinLock(&cache->Lock);
+		for (i = 0; i < ERS_TCACHE_BATCH; i++)
+		{
+			ret = ers_cache_take(cache);
+			ret->Next = tc->ReuseList;
+			tc->ReuseList = ret;
+		}
+		LeaveSpinLock(&cache->Lock);
+		tc->Count += ERS_TCACHE_BATCH;
+	}
+
+	ret = tc->ReuseList;
+	tc->ReuseList = ret->Next;
+	tc->Count--;
+	return ret;
+}
+
+/**
+ * Give an entry back to a thread caching cache.
+ * Once the calling thread's cache holds two batches, one is returned to the shared cache.
+ * @param reuse Header of the entry
+ * @param tid Calling thread
+ */
+static void ers_tcache_give(ers_cache_t *cache, struct ers_list *reuse, int tid)
+{
+	ers_tcache_t *tc;
+	struct ers_list *entry;
+	unsigned int i;
+
+	if (tid < 0 || tid >= RA_THREADS_MAX)
+	{// Not a rathread, no cache of its own
+		EnterSpinLock(&cache->Lock);
+		reuse->Next = cache->ReuseList;
+		cache->ReuseList = reuse;
+		LeaveSpinLock(&cache->Lock);
+		return;
+	}
+
+	tc = &cache->Threads[tid];
+	reuse->Next = tc->ReuseList;
+	tc->ReuseList = reuse;
+	tc->Count++;
+
+	if (tc->Count >= ERS_TCACHE_BATCH * 2)
+	{
+		EnterSpinLock(&cache->Lock);
+		for (i = 0; i < ERS_TCACHE_BATCH; i++)
+		{
+			entry = tc->ReuseList;
+			tc->ReuseList = entry->Next;
+			entry->Next = cache->ReuseList;
+			cache->ReuseList = entry;
+		}
+		LeaveSpinLock(&cache->Lock);
+		tc->Count -= ERS_TCACHE_BATCH;
+	}
+}
+
+static void *ers_obj_alloc_entry(ERS self)
+{
+	ers_instance_t *instance = (ers_instance_t *)self;
+	void *ret;
+
+	if (instance == NULL) 
+	{
+		ShowError("ers_obj_alloc_entry: NULL object, aborting entry freeing.\n");
+		return NULL;
+	}
+
+	if (instance->Cache->ThreadCache)
+	{
+		int tid = rathread_get_tid();
+
+		ret = (unsigned char *)ers_tcache_take(instance->Cache, tid) + sizeof(struct ers_list);
+		if (tid >= 0 && tid < RA_THREADS_MAX)
+			instance->ThreadCounts[tid].Count++;
+		else
+			InterlockedIncrement(&instance->Count);
+	}
+	else
+	{
+		ret = (unsigned char *)ers_cache_take(instance->Cache) + sizeof(struct ers_list);
+		instance->Count++;
+	}
 
 	return ret;
 }
@@ -213,9 +364,22 @@ static void ers_obj_free_entry(ERS self, void *entry)
 		return;
 	}
 
-	reuse->Next = instance->Cache->ReuseList;
-	instance->Cache->ReuseList = reuse;
-	instance->Count--;
+	if (instance->Cache->ThreadCache)
+	{
+		int tid = rathread_get_tid();
+
+		ers_tcache_give(instance->Cache, reuse, tid);
+		if (tid >= 0 && tid < RA_THREADS_MAX)
+			instance->ThreadCounts[tid].Count--;
+		else
+			InterlockedDecrement(&instance->Count);
+	}
+	else
+	{
+		reuse->Next = instance->Cache->ReuseList;
+		instance->Cache->ReuseList = reuse;
+		instance->Count--;
+	}
 }
 
 static size_t ers_obj_entry_size(ERS self)
@@ -241,6 +405,15 @@ static void ers_obj_destroy(ERS self)
 		return;
 	}
 
+	if (instance->ThreadCounts != NULL)
+	{// Entries freed by another thread than the one that allocated them leave the per thread counts unbalanced, only the sum matters
+		int i;
+
+		for (i = 0; i < RA_THREADS_MAX; i++)
+			instance->Count += instance->ThreadCounts[i].Count;
+		aFree(instance->ThreadCounts);
+	}
+
 	if (instance->Count > 0)
 		if (!(instance->Options & ERS_OPT_CLEAR))
 			ShowWarning("Memory leak detected at ERS '%s', %d objects not freed.\n", instance->Name, instance->Count);
@@ -268,10 +441,13 @@ ERS ers_new(uint32 size, char *name, enum ERSOptions options)
 	instance->Name = name;
 	instance->Options = options;
 
-	instance->Cache = ers_find_cache(size);
+	instance->Cache = ers_find_cache(size, (options&ERS_OPT_THREADCACHE) != 0);
 	instance->Cache->ReferenceCount++;
 
 	instance->Count = 0;
+	instance->ThreadCounts = NULL;
+	if (instance->Cache->ThreadCache)
+		CREATE(instance->ThreadCounts, ers_tcount_t, RA_THREADS_MAX);
 
 	return &instance->VTable;
 }
@@ -28,7 +28,8 @@
  *    destroyed so memory will usually only be recovered near the end.       *
  *  - Always wastes space for entries smaller than a pointer.                *
  *                                                                           *
- *  WARNING: The system is not thread-safe at the moment.                    *
+ *  WARNING: Managers are not thread-safe unless created with               *
+ *           ERS_OPT_THREADCACHE.                                            *
  *                                                                           *
  *  HISTORY:                                                                 *
  *    0.1 - Initial version                                                  *
@@ -73,6 +74,7 @@
 enum ERSOptions {
 	ERS_OPT_NONE           = 0,
 	ERS_OPT_CLEAR          = 1,/* silently clears any entries left in the manager upon destruction */
+	ERS_OPT_THREADCACHE    = 2,/* entries can be allocated and freed by any rathread, each thread keeps a cache of free entries */
 };
 
 /**
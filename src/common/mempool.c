@@ -220,6 +220,7 @@ static void segment_allocate_add(mempool p,  uint64 count){
 	size_t total_sz;
 	struct pool_segment *seg = NULL;
 	struct node *nodeList = NULL;
+	struct node *nodeTail = NULL;
 	struct node *node = NULL;
 	char *ptr = NULL;	
 	uint64 i;
@@ -279,6 +280,8 @@ static void segment_allocate_add(mempool p,  uint64 count){
 
 		node->next = nodeList;
 		nodeList = node;
+		if(nodeTail == NULL)
+			nodeTail = node;
 	}	
 
 
@@ -291,7 +294,7 @@ static void segment_allocate_add(mempool p,  uint64 count){
 	
 	// Link in Nodes
 	EnterSpinLock(&p->nodeLock);
-		nodeList->next = p->free_list;
+		nodeTail->next = p->free_list;
 		p->free_list = nodeList;
 	LeaveSpinLock(&p->nodeLock);
 
@@ -478,7 +481,7 @@ void *mempool_node_get(mempool p){
 	struct node *node;
 	int64 num_used;
 	
-	if(p->num_nodes_free < p->elem_realloc_thresh)
+	if(p->num_nodes_free < p->elem_realloc_thresh && l_async_thread != NULL)
 		racond_signal(l_async_cond);
 	
 	while(1){
@@ -493,6 +496,18 @@ void *mempool_node_get(mempool p){
 
 		if(node != NULL)
 			break;
+		
+		if(l_async_thread == NULL){
+			// No async allocator running, grow the pool ourself.
+			// (segmentLock keeps concurrent getters from growing it at once)
+			EnterSpinLock(&p->segmentLock);
+			if(p->free_list == NULL){
+				segment_allocate_add(p, p->elem_realloc_step);
+				InterlockedIncrement64(&p->num_realloc_events);
+			}
+			LeaveSpinLock(&p->segmentLock);
+			continue;
+		}
 			
 		rathread_yield();
 	}
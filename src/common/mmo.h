@@ -288,6 +288,8 @@ struct guild_storage {
 	struct item items[MAX_GUILD_STORAGE]; //Item entries
 	bool locked; //If locked, can't use storage when item bound retrieval
 	uint32 opened; //Holds the char_id that open the storage
+	uint32 version; //Char-server version the slots below are relative to, 0 = unknown (send whole storage)
+	uint32 dirty_slots[(MAX_GUILD_STORAGE+31)/32]; //Slots changed since the last save
 };
 
 struct s_pet {
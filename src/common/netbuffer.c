@@ -33,13 +33,28 @@
 //
 
 
+//
+// Every rathread keeps a small cache of free buffers per pool,
+// so netbuffer_get / netbuffer_put dont take any lock as long as a thread 
+// gets and puts about as many buffers as it uses.
+// The caches are refilled from / drained to the mempools in batches.
+//
+#define NETBUFFER_TCACHE_BATCH 32
+
+
 ///
 // Implementation:
 //
+struct ra_align(64) netbuffer_tcache{
+	netbuf list;	// free buffers, linked by netbuf->next
+	sysint count;
+};
+
 static volatile int32 l_nEmergencyAllocations = 0; // stats.
 static sysint l_nPools = 0;
 static sysint *l_poolElemSize = NULL;
 static mempool *l_pool = NULL;
+static struct netbuffer_tcache *l_tcache = NULL; // [pool * RA_THREADS_MAX + tid], only touched by thread tid
 
 
 void netbuffer_init(){
@@ -76,6 +91,7 @@ void netbuffer_init(){
 	// Allocate arrays.
 	l_poolElemSize = (sysint*)aCalloc( l_nPools, sizeof(sysint) );
 	l_pool = (mempool*)aCalloc( l_nPools, sizeof(mempool) );
+	l_tcache = (struct netbuffer_tcache*)aCalloc( l_nPools * RA_THREADS_MAX, sizeof(struct netbuffer_tcache) );
 	
 
 	for(i = 0; i < l_nPools; i++){
@@ -123,6 +139,16 @@ void netbuffer_final(){
 	sysint i;
 	
 	if(l_nPools > 0){
+		/// .. return the buffers cached by threads
+		for(i = 0; i < l_nPools * RA_THREADS_MAX; i++){
+			while(l_tcache[i].list != NULL){
+				netbuf nb = l_tcache[i].list;
+				l_tcache[i].list = nb->next;
+				mempool_node_put(l_pool[i / RA_THREADS_MAX], nb);
+			}
+			l_tcache[i].count = 0;
+		}
+
 		/// .. finalize mempools
 		for(i = 0; i < l_nPools; i++){
 			mempool_stats stats = mempool_get_stats(l_pool[i]);
@@ -139,6 +165,7 @@ void netbuffer_final(){
 	
 		aFree(l_poolElemSize);  l_poolElemSize = NULL;
 		aFree(l_pool);	l_pool = NULL;
+		aFree(l_tcache);	l_tcache = NULL;
 		l_nPools = 0;
 	}
 	
@@ -146,6 +173,70 @@ void netbuffer_final(){
 }//end: netbuffer_final()
 
 
+/**
+ * Gets a buffer of the given pool from the calling threads cache.
+ * Threads that arent rathreads get it from the mempool directly.
+ */
+static netbuf netbuffer_pool_get( sysint pool ){
+	int tid = rathread_get_tid();
+	struct netbuffer_tcache *tc;
+	netbuf nb;
+	sysint i;
+	
+	if(tid < 0 || tid >= RA_THREADS_MAX)
+		return (netbuf)mempool_node_get(l_pool[pool]);
+	
+	tc = &l_tcache[pool * RA_THREADS_MAX + tid];
+	if(tc->list == NULL){
+		// refill cache
+		for(i = 0; i < NETBUFFER_TCACHE_BATCH; i++){
+			nb = (netbuf)mempool_node_get(l_pool[pool]);
+			nb->next = tc->list;
+			tc->list = nb;
+		}
+		tc->count += NETBUFFER_TCACHE_BATCH;
+	}
+	
+	nb = tc->list;
+	tc->list = nb->next;
+	tc->count--;
+	
+	return nb;
+}//end: netbuffer_pool_get()
+
+
+/**
+ * Returns a buffer to the calling threads cache,
+ * once it holds two batches one batch goes back to the mempool.
+ */
+static void netbuffer_pool_put( netbuf nb ){
+	int tid = rathread_get_tid();
+	struct netbuffer_tcache *tc;
+	sysint i;
+	
+	if(tid < 0 || tid >= RA_THREADS_MAX){
+		mempool_node_put(l_pool[nb->pool], nb);
+		return;
+	}
+	
+	tc = &l_tcache[nb->pool * RA_THREADS_MAX + tid];
+	nb->next = tc->list;
+	tc->list = nb;
+	tc->count++;
+	
+	if(tc->count >= NETBUFFER_TCACHE_BATCH * 2){
+		// drain cache
+		for(i = 0; i < NETBUFFER_TCACHE_BATCH; i++){
+			nb = tc->list;
+			tc->list = nb->next;
+			mempool_node_put(l_pool[nb->pool], nb);
+		}
+		tc->count -= NETBUFFER_TCACHE_BATCH;
+	}
+	
+}//end: netbuffer_pool_put()
+
+
 netbuf netbuffer_get( sysint sz ){
 	sysint i;
 	netbuf nb = NULL;
@@ -155,7 +246,7 @@ netbuf netbuffer_get( sysint sz ){
 		if(sz <= l_poolElemSize[i]){
 			// match 
 			
-			nb = (netbuf)mempool_node_get(l_pool[i]); 
+			nb = netbuffer_pool_get(i);
 			nb->pool = i;
 			
 			break;
@@ -207,8 +298,8 @@ void netbuffer_put( netbuf nb ){
 	
 	
 	// Otherwise its a normal mempool based buffer
-	// return it to the according mempool:
-	mempool_node_put( l_pool[nb->pool], nb);
+	// return it to the according pool:
+	netbuffer_pool_put(nb);
 	
 	
 }//end: netbuffer_put()
@@ -2,6 +2,7 @@
 // For more information, see LICENCE in the main folder
 
 #include "../common/cbasetypes.h"
+#include "../common/arena.h"
 #include "../common/mmo.h"
 #include "../common/timer.h"
 #include "../common/malloc.h"
@@ -827,6 +828,8 @@ int do_sockets(int next)
 	// parse input data on each socket
 	for(i = 1; i < fd_max; i++)
 	{
+		arena_mark mark;
+
 		if(!session[i])
 			continue;
 
@@ -840,7 +843,9 @@ int do_sockets(int next)
 			}
 		}
 
+		mark = arena_checkpoint();
 		session[i]->func_parse(i);
+		arena_rewind(mark); // transient memory of the parse
 
 		if(!session[i])
 			continue;
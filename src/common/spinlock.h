@@ -52,8 +52,9 @@ static forceinline void FinalizeSpinLock(PSPIN_LOCK lck){
 #define getsynclock(l) { while(1){ if(InterlockedCompareExchange(l, 1, 0) == 0) break; rathread_yield(); } }
 #define dropsynclock(l) { InterlockedExchange(l, 0); }
 
+// lock holds the owner as rathread_get_lockid(), as 0 means unlocked.
 static forceinline void EnterSpinLock(PSPIN_LOCK lck){
-		int tid = rathread_get_tid();
+		int tid = rathread_get_lockid();
 		
 		// Get Sync Lock && Check if the requester thread already owns the lock. 
 		// if it owns, increase nesting level
@@ -82,7 +83,7 @@ static forceinline void EnterSpinLock(PSPIN_LOCK lck){
 }
 
 static forceinline void LeaveSpinLock(PSPIN_LOCK lck){
-		int tid = rathread_get_tid();
+		int tid = rathread_get_lockid();
 
 		getsynclock(&lck->sync_lock);
 		
@@ -2,6 +2,7 @@
 // For more information, see LICENCE in the main folder
 
 #include "../common/cbasetypes.h"
+#include "../common/arena.h"
 #include "../common/malloc.h"
 #include "../common/showmsg.h"
 #include "strlib.h"
@@ -1062,6 +1063,29 @@ void StringBuf_Init(StringBuf* self)
 {
 	self->max_ = 1024;
 	self->ptr_ = self->buf_ = (char*)aMalloc(self->max_ + 1);
+	self->arena_ = false;
+}
+
+/// Initializes a previously allocated StringBuf with a buffer from the per-tick arena.
+/// Only for StringBufs that are destroyed before the current timer callback / packet parse returns.
+void StringBuf_InitArena(StringBuf* self)
+{
+	self->max_ = 1024;
+	self->ptr_ = self->buf_ = (char*)arena_alloc(self->max_ + 1);
+	self->arena_ = true;
+}
+
+/// Resizes the buffer of the StringBuf to hold max characters
+static void StringBuf_Resize(StringBuf* self, unsigned int max)
+{
+	int off = (int)(self->ptr_ - self->buf_);
+
+	if( self->arena_ )
+		self->buf_ = (char*)arena_realloc(self->buf_, self->max_ + 1, max + 1);
+	else
+		self->buf_ = (char*)aRealloc(self->buf_, max + 1);
+	self->max_ = max;
+	self->ptr_ = self->buf_ + off;
 }
 
 /// Appends the result of printf to the StringBuf
@@ -1081,7 +1105,7 @@ int StringBuf_Printf(StringBuf* self, const char* fmt, ...)
 int StringBuf_Vprintf(StringBuf* self, const char* fmt, va_list ap)
 {
 	for(;;) {
-		int n, size, off;
+		int n, size;
 
 		va_list apcopy;
 		/* Try to print in the allocated space. */
@@ -1095,10 +1119,7 @@ int StringBuf_Vprintf(StringBuf* self, const char* fmt, va_list ap)
 			return (int)(self->ptr_ - self->buf_);
 		}
 		/* Else try again with more space. */
-		self->max_ *= 2; // twice the old size
-		off = (int)(self->ptr_ - self->buf_);
-		self->buf_ = (char*)aRealloc(self->buf_, self->max_ + 1);
-		self->ptr_ = self->buf_ + off;
+		StringBuf_Resize(self, self->max_ * 2); // twice the old size
 	}
 }
 
@@ -1108,12 +1129,8 @@ int StringBuf_Append(StringBuf* self, const StringBuf* sbuf)
 	int available = self->max_ - (self->ptr_ - self->buf_);
 	int needed = (int)(sbuf->ptr_ - sbuf->buf_);
 
-	if( needed >= available ) {
-		int off = (int)(self->ptr_ - self->buf_);
-		self->max_ += needed;
-		self->buf_ = (char*)aRealloc(self->buf_, self->max_ + 1);
-		self->ptr_ = self->buf_ + off;
-	}
+	if( needed >= available )
+		StringBuf_Resize(self, self->max_ + needed);
 
 	memcpy(self->ptr_, sbuf->buf_, needed);
 	self->ptr_ += needed;
@@ -1126,12 +1143,8 @@ int StringBuf_AppendStr(StringBuf* self, const char* str)
 	int available = self->max_ - (self->ptr_ - self->buf_);
 	int needed = (int)strlen(str);
 
-	if( needed >= available ) { // not enough space, expand the buffer (minimum expansion = 1024)
-		int off = (int)(self->ptr_ - self->buf_);
-		self->max_ += max(needed, 1024);
-		self->buf_ = (char*)aRealloc(self->buf_, self->max_ + 1);
-		self->ptr_ = self->buf_ + off;
-	}
+	if( needed >= available ) // not enough space, expand the buffer (minimum expansion = 1024)
+		StringBuf_Resize(self, self->max_ + max(needed, 1024));
 
 	memcpy(self->ptr_, str, needed);
 	self->ptr_ += needed;
@@ -1160,7 +1173,10 @@ void StringBuf_Clear(StringBuf* self)
 /// Destroys the StringBuf
 void StringBuf_Destroy(StringBuf* self)
 {
-	aFree(self->buf_);
+	if( self->arena_ )
+		arena_free(self->buf_, self->max_ + 1);
+	else
+		aFree(self->buf_);
 	self->ptr_ = self->buf_ = 0;
 	self->max_ = 0;
 }
@@ -137,11 +137,13 @@ struct StringBuf
 	char *buf_;
 	char *ptr_;
 	unsigned int max_;
+	bool arena_; // buffer lives in the per-tick arena
 };
 typedef struct StringBuf StringBuf;
 
 StringBuf* StringBuf_Malloc(void);
 void StringBuf_Init(StringBuf* self);
+void StringBuf_InitArena(StringBuf* self);
 int StringBuf_Printf(StringBuf* self, const char* fmt, ...);
 int StringBuf_Vprintf(StringBuf* self, const char* fmt, va_list args);
 int StringBuf_Append(StringBuf* self, const StringBuf *sbuf);
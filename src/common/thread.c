@@ -20,6 +20,7 @@
 #endif
 
 #include "cbasetypes.h"
+#include "atomic.h"
 #include "malloc.h"
 #include "showmsg.h"
 #include "thread.h"
@@ -30,8 +31,6 @@
 #endif
 
 
-#define RA_THREADS_MAX 64
-
 struct rAthread {
 	unsigned int myID;
 	
@@ -49,6 +48,8 @@ struct rAthread {
 
 #ifdef HAS_TLS
 __thread int g_rathread_ID = -1;
+static __thread int l_lockid = 0; // lock owner id of a thread that is no rathread, see rathread_get_lockid
+static volatile int32 l_lockid_next = RA_THREADS_MAX; // last lock owner id handed out to such a thread
 #endif
 
 
@@ -279,6 +280,26 @@ int rathread_get_tid(){
 }//end: rathread_get_tid()
 
 
+int rathread_get_lockid(){
+
+#ifdef HAS_TLS
+	if(g_rathread_ID >= 0)
+		return g_rathread_ID + 1;
+
+	// Not created by rathread, give it an id above all rathread ones.
+	if(l_lockid == 0)
+		l_lockid = InterlockedIncrement(&l_lockid_next);
+
+	return l_lockid;
+#else
+	int id = rathread_get_tid();
+
+	return (id == 0) ? -1 : id;
+#endif
+
+}//end: rathread_get_lockid()
+
+
 bool rathread_wait( rAthread handle,  void* *out_exitCode ){
 	
 	// Hint:
@@ -16,6 +16,9 @@ typedef enum RATHREAD_PRIO {
 	RAT_PRIO_HIGH	
 } RATHREAD_PRIO;
 
+// Maximum number of threads, ids returned by rathread_get_tid() are below it when TLS is available
+#define RA_THREADS_MAX 64
+
 
 /**
  * Creates a new Thread
@@ -73,6 +76,17 @@ rAthread rathread_self( );
 int rathread_get_tid();
 
 
+/**
+ * Gets an identifier of the calling thread to mark the owner of a lock.
+ *
+ * @note unlike rathread_get_tid this is never 0, also for threads that were
+ *        not created by rathread_create (which have no tid).
+ *
+ * @return non zero id, unique among running threads
+ */
+int rathread_get_lockid();
+
+
 /**
  * Waits for the given thread to terminate 
  *
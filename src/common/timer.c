@@ -2,6 +2,7 @@
 // For more information, see LICENCE in the main folder
 
 #include "../common/cbasetypes.h"
+#include "../common/arena.h"
 #include "../common/db.h"
 #include "../common/malloc.h"
 #include "../common/showmsg.h"
@@ -363,11 +364,15 @@ int do_timer(unsigned int tick)
 
 		if( timer_data[tid].func )
 		{
+			arena_mark mark = arena_checkpoint();
+
 			if( diff < -1000 )
 				// timer was delayed for more than 1 second, use current tick instead
 				timer_data[tid].func(tid, tick, timer_data[tid].id, timer_data[tid].data);
 			else
 				timer_data[tid].func(tid, timer_data[tid].tick, timer_data[tid].id, timer_data[tid].data);
+
+			arena_rewind(mark); // transient memory of the callback
 		}
 
 		// in the case the function didn't change anything...
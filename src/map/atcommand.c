@@ -4565,7 +4565,7 @@ ACMD_FUNC(jail)
 		return -1;
 	}
 
-	if (pl_sd->sc.data[SC_JAILED]) {
+	if (sc_data(&pl_sd->sc, SC_JAILED)) {
 		clif_displaymessage(fd, msg_txt(118)); // Player warped in jails.
 		return -1;
 	}
@@ -4615,7 +4615,7 @@ ACMD_FUNC(unjail)
 		return -1;
 	}
 
-	if (!pl_sd->sc.data[SC_JAILED]) {
+	if (!sc_data(&pl_sd->sc, SC_JAILED)) {
 		clif_displaymessage(fd, msg_txt(119)); // This player is not in jails.
 		return -1;
 	}
@@ -4663,8 +4663,8 @@ ACMD_FUNC(jailfor) {
 	}
 
 	// Added by Coltaro
-	if (pl_sd->sc.data[SC_JAILED] && pl_sd->sc.data[SC_JAILED]->val1 != INT_MAX) { // Update the player's jail time
-		jailtime += pl_sd->sc.data[SC_JAILED]->val1;
+	if (sc_data(&pl_sd->sc, SC_JAILED) && sc_data(&pl_sd->sc, SC_JAILED)->val1 != INT_MAX) { // Update the player's jail time
+		jailtime += sc_data(&pl_sd->sc, SC_JAILED)->val1;
 		if (jailtime <= 0) {
 			jailtime = 0;
 			clif_displaymessage(pl_sd->fd, msg_txt(120)); // GM has discharge you.
@@ -4713,26 +4713,26 @@ ACMD_FUNC(jailtime) {
 
 	nullpo_retr(-1, sd);
 
-	if (!sd->sc.data[SC_JAILED]) {
+	if (!sc_data(&sd->sc, SC_JAILED)) {
 		clif_displaymessage(fd, msg_txt(1139)); // You are not in jail.
 		return -1;
 	}
 
-	if (sd->sc.data[SC_JAILED]->val1 == INT_MAX) {
+	if (sc_data(&sd->sc, SC_JAILED)->val1 == INT_MAX) {
 		clif_displaymessage(fd, msg_txt(1140)); // You have been jailed indefinitely.
 		return 0;
 	}
 
-	if (sd->sc.data[SC_JAILED]->val1 <= 0) { // Was not jailed with @jailfor (maybe @jail? or warped there? or got recalled?)
+	if (sc_data(&sd->sc, SC_JAILED)->val1 <= 0) { // Was not jailed with @jailfor (maybe @jail? or warped there? or got recalled?)
 		clif_displaymessage(fd, msg_txt(1141)); // You have been jailed for an unknown amount of time.
 		return -1;
 	}
 
 	// Get remaining jail time
-	split_time(sd->sc.data[SC_JAILED]->val1 * 60, &year, &month, &day, &hour, &minute, &second);
+	split_time(sc_data(&sd->sc, SC_JAILED)->val1 * 60, &year, &month, &day, &hour, &minute, &second);
 	sprintf(atcmd_output, msg_txt(402), msg_txt(1142), year, month, day, hour, minute); // You will remain in jail for %d years, %d months, %d days, %d hours and %d minutes
 	clif_displaymessage(fd, atcmd_output);
-	timestamp2string(timestr, 20, now + sd->sc.data[SC_JAILED]->val1 * 60, "%Y-%m-%d %H:%M");
+	timestamp2string(timestr, 20, now + sc_data(&sd->sc, SC_JAILED)->val1 * 60, "%Y-%m-%d %H:%M");
 	sprintf(atcmd_output, "Release date is: %s", timestr);
 	clif_displaymessage(fd, atcmd_output);
 
@@ -4773,7 +4773,7 @@ ACMD_FUNC(disguise)
 		return -1;
 	}
 
-	if (sd->sc.data[SC_MONSTER_TRANSFORM]) {
+	if (sc_data(&sd->sc, SC_MONSTER_TRANSFORM)) {
 		clif_displaymessage(fd, msg_txt(1492)); // Character cannot be disguised while in monster form.
 		return -1;
 	}
@@ -6628,7 +6628,7 @@ ACMD_FUNC(unmute)
 		return -1;
 	}
 
-	if(!pl_sd->sc.data[SC_NOCHAT]) {
+	if(!sc_data(&pl_sd->sc, SC_NOCHAT)) {
 		clif_displaymessage(sd->fd,msg_txt(1235)); // Player is not muted.
 		return -1;
 	}
@@ -8822,7 +8822,7 @@ ACMD_FUNC(charcommands)
 //For new mounts
 ACMD_FUNC(mount2) {
 	clif_displaymessage(sd->fd,msg_txt(1362)); // NOTICE: If you crash with mount your LUA is outdated.
-	if( !sd->sc.data[SC_ALL_RIDING] ) {
+	if( !sc_data(&sd->sc, SC_ALL_RIDING) ) {
 		clif_displaymessage(sd->fd, msg_txt(1363)); // You have mounted.
 		sc_start(&sd->bl, &sd->bl, SC_ALL_RIDING, 100, 0, -1);
 	} else {
@@ -9276,7 +9276,7 @@ ACMD_FUNC(costume) {
 
 	if( !message || !*message ) {
 		for( k = 0; k < len; k++ ) {
-			if( sd->sc.data[name2id[k]] ) {
+			if( sc_data(&sd->sc, name2id[k]) ) {
 				sprintf(atcmd_output, msg_txt(1488), names[k]); // '%s' costume removed.
 				clif_displaymessage(sd->fd, atcmd_output);
 				status_change_end(&sd->bl, (sc_type)name2id[k], INVALID_TIMER);
@@ -9293,7 +9293,7 @@ ACMD_FUNC(costume) {
 	}
 
 	for( k = 0; k < len; k++ ) {
-		if( sd->sc.data[name2id[k]] ) {
+		if( sc_data(&sd->sc, name2id[k]) ) {
 			sprintf(atcmd_output, msg_txt(1485), names[k]); // You're already with a '%s' costume, type '@costume' to remove it.
 			clif_displaymessage(sd->fd, atcmd_output);
 			return -1;
@@ -10034,7 +10034,7 @@ bool is_atcommand(const int fd, struct map_session_data *sd, const char *message
 		return false;
 
 	//Block NOCHAT but do not display it as a normal message
-	if ( sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCOMMAND )
+	if ( sc_data(&sd->sc, SC_NOCHAT) && sc_data(&sd->sc, SC_NOCHAT)->val1&MANNER_NOCOMMAND )
 		return true;
 
 	//Skip 10/11-langtype's codepage indicator, if detected
@@ -270,10 +270,10 @@ int battle_delay_damage(unsigned int tick, int amotion, struct block_list *src,
 
 	sc = status_get_sc(target);
 
-	if( sc && sc->data[SC_DEVOTION] && sc->data[SC_DEVOTION]->val1 )
-		d_tbl = map_id2bl(sc->data[SC_DEVOTION]->val1);
+	if( sc && sc_data(sc, SC_DEVOTION) && sc_data(sc, SC_DEVOTION)->val1 )
+		d_tbl = map_id2bl(sc_data(sc, SC_DEVOTION)->val1);
 
-	if( d_tbl && check_distance_bl(target, d_tbl, sc->data[SC_DEVOTION]->val3) &&
+	if( d_tbl && check_distance_bl(target, d_tbl, sc_data(sc, SC_DEVOTION)->val3) &&
 		damage > 0 && skill_id != PA_PRESSURE && skill_id != CR_REFLECTSHIELD )
 		damage = 0;
 
@@ -352,20 +352,20 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 	if( sc && sc->count ) { //Increase damage by src status
 		switch( atk_elem ) {
 			case ELE_FIRE:
-				if( sc->data[SC_VOLCANO] )
-					ratio += sc->data[SC_VOLCANO]->val3;
+				if( sc_data(sc, SC_VOLCANO) )
+					ratio += sc_data(sc, SC_VOLCANO)->val3;
 				break;
 			case ELE_WIND:
-				if( sc->data[SC_VIOLENTGALE] )
-					ratio += sc->data[SC_VIOLENTGALE]->val3;
+				if( sc_data(sc, SC_VIOLENTGALE) )
+					ratio += sc_data(sc, SC_VIOLENTGALE)->val3;
 				break;
 			case ELE_WATER:
-				if( sc->data[SC_DELUGE] )
-					ratio += sc->data[SC_DELUGE]->val3;
+				if( sc_data(sc, SC_DELUGE) )
+					ratio += sc_data(sc, SC_DELUGE)->val3;
 				break;
 			case ELE_GHOST:
-				if( sc->data[SC_TELEKINESIS_INTENSE] )
-					ratio += sc->data[SC_TELEKINESIS_INTENSE]->val3;
+				if( sc_data(sc, SC_TELEKINESIS_INTENSE) )
+					ratio += sc_data(sc, SC_TELEKINESIS_INTENSE)->val3;
 				break;
 		}
 	}
@@ -388,6 +388,7 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 					if( ud->skillunit[i]->skill_id == GN_WALLOFTHORN ) {
 						ud->skillunit[i]->unit->group->unit_id = UNT_USED_TRAPS;
 						ud->skillunit[i]->unit->group->limit = 0;
+						skill_unit_group_wake(ud->skillunit[i]->unit->group);
 						skill_unitsetting(map_id2bl(ud->skillunit[i]->unit->group->src_id),
 							ud->skillunit[i]->unit->group->skill_id,ud->skillunit[i]->unit->group->skill_lv,
 								ud->skillunit[i]->unit->group->val3>>16,ud->skillunit[i]->unit->group->val3&0xffff,1);
@@ -400,13 +401,13 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 	if( tsc && tsc->count ) { //Since an atk can only have one type let's optimise this a bit
 		switch( atk_elem ) {
 			case ELE_FIRE:
-				if( tsc->data[SC_SPIDERWEB] ) {
-					struct unit_data *ud = unit_bl2ud(map_id2bl(tsc->data[SC_SPIDERWEB]->val3));
+				if( sc_data(tsc, SC_SPIDERWEB) ) {
+					struct unit_data *ud = unit_bl2ud(map_id2bl(sc_data(tsc, SC_SPIDERWEB)->val3));
 					uint8 i;
 
-					if( tsc->data[SC_SPIDERWEB]->val2-- > 0 )
+					if( sc_data(tsc, SC_SPIDERWEB)->val2-- > 0 )
 						ratio += 100; //Double damage
-					if( tsc->data[SC_SPIDERWEB]->val2 == 0 )
+					if( sc_data(tsc, SC_SPIDERWEB)->val2 == 0 )
 						status_change_end(target, SC_SPIDERWEB, INVALID_TIMER);
 					if( ud ) {
 						ARR_FIND(0, MAX_SKILLUNITGROUP, i, ud->skillunit[i] && ud->skillunit[i]->skill_id == PF_SPIDERWEB);
@@ -414,44 +415,44 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 							skill_delunit(ud->skillunit[i]->unit);
 					}
 				}
-				if( tsc->data[SC_THORNSTRAP] ) {
-					struct skill_unit_group* group = skill_id2group(tsc->data[SC_THORNSTRAP]->val3);
+				if( sc_data(tsc, SC_THORNSTRAP) ) {
+					struct skill_unit_group* group = skill_id2group(sc_data(tsc, SC_THORNSTRAP)->val3);
 
 					if( group )
 						skill_delunitgroup(group);
 				}
-				if( tsc->data[SC_CRYSTALIZE] )
+				if( sc_data(tsc, SC_CRYSTALIZE) )
 					status_change_end(target, SC_CRYSTALIZE, INVALID_TIMER);
-				if( tsc->data[SC_EARTH_INSIGNIA] )
+				if( sc_data(tsc, SC_EARTH_INSIGNIA) )
 					ratio += 50;
 				break;
 			case ELE_HOLY:
-				if( tsc->data[SC_ORATIO] )
-					ratio += tsc->data[SC_ORATIO]->val1 * 2;
+				if( sc_data(tsc, SC_ORATIO) )
+					ratio += sc_data(tsc, SC_ORATIO)->val1 * 2;
 				break;
 			case ELE_POISON:
-				if( tsc->data[SC_VENOMIMPRESS] )
-					ratio += tsc->data[SC_VENOMIMPRESS]->val2;
+				if( sc_data(tsc, SC_VENOMIMPRESS) )
+					ratio += sc_data(tsc, SC_VENOMIMPRESS)->val2;
 				break;
 			case ELE_WIND:
-				if( tsc->data[SC_CRYSTALIZE] )
+				if( sc_data(tsc, SC_CRYSTALIZE) )
 					ratio += 50;
-				if( tsc->data[SC_WATER_INSIGNIA] )
+				if( sc_data(tsc, SC_WATER_INSIGNIA) )
 					ratio += 50;
 				break;
 			case ELE_WATER:
-				if( tsc->data[SC_FIRE_INSIGNIA] )
+				if( sc_data(tsc, SC_FIRE_INSIGNIA) )
 					ratio += 50;
 				break;
 			case ELE_EARTH:
-				if( tsc->data[SC_WIND_INSIGNIA] )
+				if( sc_data(tsc, SC_WIND_INSIGNIA) )
 					ratio += 50;
-				if( tsc->data[SC_MAGNETICFIELD] )
+				if( sc_data(tsc, SC_MAGNETICFIELD) )
 					status_change_end(target, SC_MAGNETICFIELD, INVALID_TIMER); //Freed if received earth damage
 				break;
 			case ELE_NEUTRAL:
-				if( tsc->data[SC_ANTI_M_BLAST] )
-					ratio += tsc->data[SC_ANTI_M_BLAST]->val2;
+				if( sc_data(tsc, SC_ANTI_M_BLAST) )
+					ratio += sc_data(tsc, SC_ANTI_M_BLAST)->val2;
 				break;
 		}
 	}
@@ -540,8 +541,8 @@ int battle_calc_cardfix(int attack_type, struct block_list *src, struct block_li
 					cardfix = cardfix * (100 - tsd->bonus.long_attack_def_rate) / 100;
 #endif
 				cardfix = cardfix * (100 - tsd->bonus.magic_def_rate) / 100;
-				if( tsd->sc.data[SC_MDEF_RATE] )
-					cardfix = cardfix * (100 - tsd->sc.data[SC_MDEF_RATE]->val1) / 100;
+				if( sc_data(&tsd->sc, SC_MDEF_RATE) )
+					cardfix = cardfix * (100 - sc_data(&tsd->sc, SC_MDEF_RATE)->val1) / 100;
 				if( cardfix != 1000 )
 					damage = damage * cardfix / 1000;
 			}
@@ -718,8 +719,8 @@ int battle_calc_cardfix(int attack_type, struct block_list *src, struct block_li
 					cardfix = cardfix * (100 - tsd->bonus.near_attack_def_rate) / 100;
 				else
 					cardfix = cardfix * (100 - tsd->bonus.long_attack_def_rate) / 100;
-				if( tsd->sc.data[SC_DEF_RATE] )
-					cardfix = cardfix * (100 - tsd->sc.data[SC_DEF_RATE]->val1) / 100;
+				if( sc_data(&tsd->sc, SC_DEF_RATE) )
+					cardfix = cardfix * (100 - sc_data(&tsd->sc, SC_DEF_RATE)->val1) / 100;
 				if( cardfix != 1000 )
 					damage = damage * cardfix / 1000;
 			}
@@ -799,10 +800,10 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 	status = status_get_status_data(bl);
 
 	if( sc ) {
-		if( sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+		if( sc_data(sc, SC_INVINCIBLE) && !sc_data(sc, SC_INVINCIBLEOFF) )
 			return 1;
 
-		if( sc->data[SC__MAELSTROM] && skill_get_type(skill_id) != BF_MISC &&
+		if( sc_data(sc, SC__MAELSTROM) && skill_get_type(skill_id) != BF_MISC &&
 			skill_get_casttype(skill_id) == CAST_GROUND )
 			return 0;
 	}
@@ -812,13 +813,13 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 
 	if( sc && sc->count ) {
 		//SC_* that reduce damage to 0
-		if( sc->data[SC_BASILICA] && !(status_get_mode(src)&MD_BOSS) ) {
+		if( sc_data(sc, SC_BASILICA) && !(status_get_mode(src)&MD_BOSS) ) {
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
 
 		//Gravitation and Pressure do damage without removing the effect
-		if( sc->data[SC_WHITEIMPRISON] ) {
+		if( sc_data(sc, SC_WHITEIMPRISON) ) {
 			if( (skill_id && skill_get_ele(skill_id,skill_lv) == ELE_GHOST) ||
 				(!skill_id && (status_get_status_data(src))->rhw.ele == ELE_GHOST) )
 				status_change_end(bl,SC_WHITEIMPRISON,INVALID_TIMER); //Those skills do damage and removes effect
@@ -830,7 +831,7 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 
 		//Block all ranged attacks, all short-ranged skills, and targeted magic skills
 		//Normal melee attacks and ground magic skills can still hit the player inside Zephyr
-		if( sc->data[SC_ZEPHYR] && (((flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT && skill_id) ||
+		if( sc_data(sc, SC_ZEPHYR) && (((flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT && skill_id) ||
 			(flag&(BF_LONG|BF_MAGIC)) == BF_LONG || (flag&BF_MAGIC &&
 			!(skill_get_inf(skill_id)&(INF_GROUND_SKILL|INF_SELF_SKILL)))) )
 		{
@@ -838,7 +839,7 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			return 0;
 		}
 
-		if( (sce = sc->data[SC_SAFETYWALL]) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT ) {
+		if( (sce = sc_data(sc, SC_SAFETYWALL)) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT ) {
 			struct skill_unit_group* group = skill_id2group(sce->val3);
 			uint16 skill_id = sce->val2;
 
@@ -869,18 +870,18 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			status_change_end(bl,SC_SAFETYWALL,INVALID_TIMER);
 		}
 
-		if( (sc->data[SC_PNEUMA] && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG) ||
-			sc->data[SC__MANHOLE] || (src->type == BL_PC && sc->data[SC_KINGS_GRACE]) ) {
+		if( (sc_data(sc, SC_PNEUMA) && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG) ||
+			sc_data(sc, SC__MANHOLE) || (src->type == BL_PC && sc_data(sc, SC_KINGS_GRACE)) ) {
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
 
-		if( sc->data[SC_ELEMENTAL_SHIELD] && flag&BF_MAGIC ) { //In kRO, only block magic skills
+		if( sc_data(sc, SC_ELEMENTAL_SHIELD) && flag&BF_MAGIC ) { //In kRO, only block magic skills
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
 
-		if( (sce = sc->data[SC_WEAPONBLOCKING]) && (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) &&
+		if( (sce = sc_data(sc, SC_WEAPONBLOCKING)) && (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) &&
 			rnd()%100 < sce->val2 ) {
 			clif_skill_nodamage(bl,src,GC_WEAPONBLOCKING,sce->val1,1);
 			sc_start2(src,bl,SC_COMBO,100,GC_WEAPONBLOCKING,src->id,skill_get_time2(GC_WEAPONBLOCKING,sce->val1));
@@ -888,13 +889,13 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			return 0;
 		}
 
-		if( (sce = sc->data[SC_AUTOGUARD]) && flag&BF_WEAPON &&
+		if( (sce = sc_data(sc, SC_AUTOGUARD)) && flag&BF_WEAPON &&
 #ifdef RENEWAL
 			skill_id != WS_CARTTERMINATION &&
 #endif
 			!(skill_get_nk(skill_id)&NK_NO_CARDFIX_ATK) && rnd()%100 < sce->val2 ) {
 			int delay;
-			struct status_change_entry *sce_d = sc->data[SC_DEVOTION];
+			struct status_change_entry *sce_d = sc_data(sc, SC_DEVOTION);
 			struct block_list *d_bl = NULL;
 
 			//Different delay depending on skill level [celest]
@@ -916,14 +917,14 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			} else {
 				clif_skill_nodamage(bl,bl,CR_AUTOGUARD,sce->val1,1);
 				unit_set_walkdelay(bl,gettick(),delay,1);
-				if( sc->data[SC_SHRINK] && rnd()%100 < 5 * sce->val1 )
+				if( sc_data(sc, SC_SHRINK) && rnd()%100 < 5 * sce->val1 )
 					skill_blown(bl,src,skill_get_blewcount(CR_SHRINK,1),-1,0);
 				d->dmg_lv = ATK_MISS;
 				return 0;
 			}
 		}
 
-		if( damage > 0 && (sce = sc->data[SC_MILLENNIUMSHIELD]) && sce->val2 > 0 ) {
+		if( damage > 0 && (sce = sc_data(sc, SC_MILLENNIUMSHIELD)) && sce->val2 > 0 ) {
 			sce->val3 -= (int)cap_value(damage,INT_MIN,INT_MAX); //Absorb damage
 			d->dmg_lv = ATK_BLOCK;
 			if( sce->val3 <= 0 ) { //Shield down
@@ -940,7 +941,7 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			return 0;
 		}
 
-		if( (sce = sc->data[SC_PARRYING]) && flag&BF_WEAPON &&
+		if( (sce = sc_data(sc, SC_PARRYING)) && flag&BF_WEAPON &&
 #ifdef RENEWAL
 			skill_id != WS_CARTTERMINATION &&
 #endif
@@ -950,30 +951,30 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			return 0; //Attack blocked by Parrying
 		}
 
-		if( (sce = sc->data[SC_DODGE]) && (!sc->opt1 || sc->opt1 == OPT1_BURNING || sc->opt1 == OPT1_FREEZING) &&
-			((flag&BF_LONG) || sc->data[SC_SPURT]) && rnd()%100 < 20 ) {
+		if( (sce = sc_data(sc, SC_DODGE)) && (!sc->opt1 || sc->opt1 == OPT1_BURNING || sc->opt1 == OPT1_FREEZING) &&
+			((flag&BF_LONG) || sc_data(sc, SC_SPURT)) && rnd()%100 < 20 ) {
 			if( sd && pc_issit(sd) )
 				pc_setstand(sd); //Stand it to dodge
 			clif_skill_nodamage(bl,bl,TK_DODGE,sce->val1,1);
-			if( !sc->data[SC_COMBO] )
+			if( !sc_data(sc, SC_COMBO) )
 				sc_start4(src,bl,SC_COMBO,100,TK_JUMPKICK,src->id,1,0,2000);
 			return 0;
 		}
 
-		if( sc->data[SC_HERMODE] && flag&BF_MAGIC )
+		if( sc_data(sc, SC_HERMODE) && flag&BF_MAGIC )
 			return 0;
 
-		if( sc->data[SC_TATAMIGAESHI] && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG )
+		if( sc_data(sc, SC_TATAMIGAESHI) && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG )
 			return 0;
 
-		if( sc->data[SC_NEUTRALBARRIER] && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG &&
+		if( sc_data(sc, SC_NEUTRALBARRIER) && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG &&
 			skill_id != NJ_ZENYNAGE && skill_id != KO_MUCHANAGE ) {
 			d->dmg_lv = ATK_MISS;
 			return 0;
 		}
 
 		//Kaupe blocks damage (skill or otherwise) from players, mobs, homuns, mercenaries
-		if( (sce = sc->data[SC_KAUPE]) && rnd()%100 < sce->val2 ) {
+		if( (sce = sc_data(sc, SC_KAUPE)) && rnd()%100 < sce->val2 ) {
 			clif_specialeffect(bl,462,AREA);
 #ifndef RENEWAL //Shouldn't end until Breaker's non-weapon part connects
 			if( skill_id != ASC_BREAKER || !(flag&BF_WEAPON) )
@@ -984,16 +985,16 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 		}
 
 #ifdef RENEWAL //400% damage receive
-		if( sc->data[SC_KAITE] && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT )
+		if( sc_data(sc, SC_KAITE) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT )
 			damage <<= 2;
 #endif
 
-		if( (sce = sc->data[SC_PRESTIGE]) && flag&BF_MAGIC && rnd()%100 < sce->val2 ) {
+		if( (sce = sc_data(sc, SC_PRESTIGE)) && flag&BF_MAGIC && rnd()%100 < sce->val2 ) {
 			clif_specialeffect(bl,462,AREA); //Still need confirm it
 			return 0;
 		}
 
-		if( ((sce = sc->data[SC_UTSUSEMI]) || sc->data[SC_BUNSINJYUTSU]) && flag&BF_WEAPON &&
+		if( ((sce = sc_data(sc, SC_UTSUSEMI)) || sc_data(sc, SC_BUNSINJYUTSU)) && flag&BF_WEAPON &&
 #ifdef RENEWAL
 			skill_id != WS_CARTTERMINATION &&
 #endif
@@ -1009,12 +1010,12 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			//Both need to be consumed if they are active
 			if( sce && --(sce->val2) <= 0 )
 				status_change_end(bl,SC_UTSUSEMI,INVALID_TIMER);
-			if( (sce = sc->data[SC_BUNSINJYUTSU]) && --(sce->val2) <= 0 )
+			if( (sce = sc_data(sc, SC_BUNSINJYUTSU)) && --(sce->val2) <= 0 )
 				status_change_end(bl,SC_BUNSINJYUTSU,INVALID_TIMER);
 			return 0;
 		}
 
-		if( sc->data[SC_AETERNA] && skill_id != PF_SOULBURN ) { //Now damage increasing effects
+		if( sc_data(sc, SC_AETERNA) && skill_id != PF_SOULBURN ) { //Now damage increasing effects
 			if( src->type != BL_MER || !skill_id )
 				damage <<= 1; //Lex Aeterna only doubles damage of regular attacks from mercenaries
 #ifndef RENEWAL //Shouldn't end until Breaker's non-weapon part connects
@@ -1024,14 +1025,14 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 		}
 
 #ifdef RENEWAL
-		if( sc->data[SC_RAID] ) {
+		if( sc_data(sc, SC_RAID) ) {
 			damage += damage * 20 / 100;
-			if( --sc->data[SC_RAID]->val1 == 0 )
+			if( --sc_data(sc, SC_RAID)->val1 == 0 )
 				status_change_end(bl,SC_RAID,INVALID_TIMER);
 		}
 #else
 		//Damage reductions
-		if( sc->data[SC_ASSUMPTIO] ) {
+		if( sc_data(sc, SC_ASSUMPTIO) ) {
 			if( map_flag_vs(bl->m) )
 				damage = damage * 2 / 3; //Receive 66% damage
 			else
@@ -1042,11 +1043,11 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 		if( damage > 0 ) {
 			struct map_session_data *tsd = BL_CAST(BL_PC,src);
 
-			if( sc->data[SC_DEEPSLEEP] ) {
+			if( sc_data(sc, SC_DEEPSLEEP) ) {
 				damage += damage / 2; //1.5 times more damage while in Deep Sleep
 				status_change_end(bl,SC_DEEPSLEEP,INVALID_TIMER);
 			}
-			if( tsd && sd && sc->data[SC_CRYSTALIZE] && flag&BF_WEAPON ) {
+			if( tsd && sd && sc_data(sc, SC_CRYSTALIZE) && flag&BF_WEAPON ) {
 				switch( tsd->status.weapon ) {
 					case W_MACE:
 					case W_2HMACE:
@@ -1071,12 +1072,12 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 						break;
 				}
 			}
-			if( sc->data[SC_VOICEOFSIREN] )
+			if( sc_data(sc, SC_VOICEOFSIREN) )
 				status_change_end(bl,SC_VOICEOFSIREN,INVALID_TIMER);
 		}
 
-		if( sc->data[SC_DEVOTION] ) {
-			struct status_change_entry *sce_d = sc->data[SC_DEVOTION];
+		if( sc_data(sc, SC_DEVOTION) ) {
+			struct status_change_entry *sce_d = sc_data(sc, SC_DEVOTION);
 			struct block_list *d_bl = map_id2bl(sce_d->val1);
 
 			if( d_bl &&
@@ -1086,16 +1087,16 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			{
 				struct status_change *d_sc = status_get_sc(d_bl);
 
-				if( d_sc && d_sc->data[SC_DEFENDER] && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG &&
+				if( d_sc && sc_data(d_sc, SC_DEFENDER) && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG &&
 #ifndef RENEWAL
 					skill_id != ASC_BREAKER && skill_id != CR_ACIDDEMONSTRATION &&
 #endif
 					skill_id != NJ_ZENYNAGE && skill_id != KO_MUCHANAGE )
-					damage -= damage * d_sc->data[SC_DEFENDER]->val2 / 100;
+					damage -= damage * sc_data(d_sc, SC_DEFENDER)->val2 / 100;
 			}
 		}
 
-		if( (sce = sc->data[SC_DEFENDER]) && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG &&
+		if( (sce = sc_data(sc, SC_DEFENDER)) && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG &&
 #ifndef RENEWAL
 			skill_id != ASC_BREAKER && skill_id != CR_ACIDDEMONSTRATION &&
 #endif
@@ -1103,11 +1104,11 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			damage -= damage * sce->val2 / 100;
 
 #ifndef RENEWAL
-		if( sc->data[SC_ADJUSTMENT] && (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) )
+		if( sc_data(sc, SC_ADJUSTMENT) && (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) )
 			damage -= damage * 20 / 100;
 #endif
 
-		if( sc->data[SC_FOGWALL] ) {
+		if( sc_data(sc, SC_FOGWALL) ) {
 			if( flag&BF_SKILL ) {
 				if( !(skill_get_inf(skill_id)&INF_GROUND_SKILL) && !(skill_get_nk(skill_id)&NK_SPLASH) )
 					damage -= damage * 25 / 100; //25% reduction
@@ -1115,20 +1116,20 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 				damage >>= 2; //75% reduction
 		}
 
-		if( sc->data[SC_SMOKEPOWDER] ) {
+		if( sc_data(sc, SC_SMOKEPOWDER) ) {
 			if( (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) )
 				damage -= damage * 15 / 100; //15% reduction to physical melee attacks
 			else if( (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) )
 				damage -= damage * 50 / 100; //50% reduction to physical ranged attacks
 		}
 
-		if( sc->data[SC_WATER_BARRIER] )
+		if( sc_data(sc, SC_WATER_BARRIER) )
 			damage = damage * 80 / 100; //20% reduction to all type attacks
 
 		if( src->type == BL_MOB ) { //Compressed code, fixed by map.h [Epoque]
 			int i;
 
-			if( (sce = sc->data[SC_MANU_DEF]) ) {
+			if( (sce = sc_data(sc, SC_MANU_DEF)) ) {
 				for( i = 0; ARRAYLENGTH(mob_manuk) > i; i++ ) {
 					if( mob_manuk[i] == ((TBL_MOB *)src)->mob_id ) {
 						damage -= damage * sce->val1 / 100;
@@ -1136,7 +1137,7 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 					}
 				}
 			}
-			if( (sce = sc->data[SC_SPL_DEF]) ) {
+			if( (sce = sc_data(sc, SC_SPL_DEF)) ) {
 				for( i = 0; ARRAYLENGTH(mob_splendide) > i; i++ ) {
 					if( mob_splendide[i] == ((TBL_MOB *)src)->mob_id ) {
 						damage -= damage * sce->val1 / 100;
@@ -1146,11 +1147,11 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			}
 		}
 
-		if( (sce = sc->data[SC_ARMOR]) && //NPC_DEFENDER
+		if( (sce = sc_data(sc, SC_ARMOR)) && //NPC_DEFENDER
 			sce->val3&flag && sce->val4&flag )
 			damage -= damage * sce->val2 / 100;
 
-		if( sc->data[SC_ENERGYCOAT]
+		if( sc_data(sc, SC_ENERGYCOAT)
 #ifndef RENEWAL
 			&& flag&BF_WEAPON && !(skill_get_nk(skill_id)&NK_NO_CARDFIX_ATK)
 #endif
@@ -1165,19 +1166,19 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			damage -= damage * 6 * (1 + per) / 100; //Reduction: 6% + 6% every 20%
 		}
 
-		if( (sce = sc->data[SC_GRANITIC_ARMOR]) )
+		if( (sce = sc_data(sc, SC_GRANITIC_ARMOR)) )
 			damage -= damage * sce->val2 / 100;
 
-		if( (sce = sc->data[SC_PAIN_KILLER]) )
+		if( (sce = sc_data(sc, SC_PAIN_KILLER)) )
 			damage -= damage * sce->val3 / 100;
 
-		if( (sce = sc->data[SC_DARKCROW]) && (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) )
+		if( (sce = sc_data(sc, SC_DARKCROW)) && (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) )
 			damage += damage * sce->val2 / 100;
 
-		if( (sce = sc->data[SC_MAGMA_FLOW]) && rnd()%100 <= sce->val2 )
+		if( (sce = sc_data(sc, SC_MAGMA_FLOW)) && rnd()%100 <= sce->val2 )
 			skill_castend_nodamage_id(bl,bl,MH_MAGMA_FLOW,sce->val1,gettick(),flag|2);
 
-		if( damage > 0 && (sce = sc->data[SC_STONEHARDSKIN]) && (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) ) {
+		if( damage > 0 && (sce = sc_data(sc, SC_STONEHARDSKIN)) && (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) ) {
 			sce->val2 -= (int)cap_value(damage,INT_MIN,INT_MAX);
 			if( src->type == BL_MOB ) //Using explicit call instead break_equip for duration
 				sc_start(src,src,SC_STRIPWEAPON,30,0,skill_get_time2(RK_STONEHARDSKIN,sce->val1));
@@ -1188,10 +1189,10 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 		}
 
 #ifdef RENEWAL
-		if( sc->data[SC_STEELBODY] ) //Renewal: Steel Body reduces all incoming damage to 1/10 [helvetica]
+		if( sc_data(sc, SC_STEELBODY) ) //Renewal: Steel Body reduces all incoming damage to 1/10 [helvetica]
 			damage = (damage > 10 ? damage / 10 : 1);
 
-		if( (sce = sc->data[SC_ARMORCHANGE]) ) {
+		if( (sce = sc_data(sc, SC_ARMORCHANGE)) ) {
 			if( flag&BF_WEAPON )
 				damage -= damage * sce->val2 / 100;
 			if( flag&BF_MAGIC )
@@ -1200,14 +1201,14 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 #endif
 
 		//Finally added to remove the status of immobile when Aimed Bolt is used [Jobbie]
-		if( skill_id == RA_AIMEDBOLT && (sc->data[SC_BITE] || sc->data[SC_ANKLE] || sc->data[SC_ELECTRICSHOCKER]) ) {
+		if( skill_id == RA_AIMEDBOLT && (sc_data(sc, SC_BITE) || sc_data(sc, SC_ANKLE) || sc_data(sc, SC_ELECTRICSHOCKER)) ) {
 			status_change_end(bl,SC_BITE,INVALID_TIMER);
 			status_change_end(bl,SC_ANKLE,INVALID_TIMER);
 			status_change_end(bl,SC_ELECTRICSHOCKER,INVALID_TIMER);
 		}
 
 		if( damage > 0 ) {
-			if( (sce = sc->data[SC_KYRIE]) ) { //Finally Kyrie because it may, or not, reduce damage to 0
+			if( (sce = sc_data(sc, SC_KYRIE)) ) { //Finally Kyrie because it may, or not, reduce damage to 0
 				sce->val2 -= (int)cap_value(damage,INT_MIN,INT_MAX);
 				if( flag&BF_WEAPON ) {
 					if( sce->val2 >= 0 )
@@ -1218,12 +1219,12 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 				if( --sce->val3 <= 0 || sce->val2 <= 0 || skill_id == AL_HOLYLIGHT )
 					status_change_end(bl,SC_KYRIE,INVALID_TIMER);
 			}
-			if( sc->data[SC_MEIKYOUSISUI] && rnd()%100 < 40 ) //Custom value
+			if( sc_data(sc, SC_MEIKYOUSISUI) && rnd()%100 < 40 ) //Custom value
 				status_change_end(bl,SC_MEIKYOUSISUI,INVALID_TIMER);
 		} else
 			return 0;
 
-		if( (sce = sc->data[SC_LIGHTNINGWALK]) && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG && rnd()%100 < sce->val2 ) {
+		if( (sce = sc_data(sc, SC_LIGHTNINGWALK)) && (flag&(BF_LONG|BF_MAGIC)) == BF_LONG && rnd()%100 < sce->val2 ) {
 			int dx[8] = { 0,-1,-1,-1,0,1,1,1 };
 			int dy[8] = { 1,1,0,-1,-1,-1,0,1 };
 			uint8 dir = map_calc_dir(bl,src->x,src->y);
@@ -1238,24 +1239,24 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			return 0;
 		}
 
-		if( sd && (sce = sc->data[SC_FORCEOFVANGUARD]) && flag&BF_WEAPON && rnd()%100 < sce->val2 )
+		if( sd && (sce = sc_data(sc, SC_FORCEOFVANGUARD)) && flag&BF_WEAPON && rnd()%100 < sce->val2 )
 			pc_addspiritball(sd,skill_get_time(LG_FORCEOFVANGUARD,sce->val1),sce->val3);
 
-		if( sd && (sce = sc->data[SC_GT_ENERGYGAIN]) && flag&BF_WEAPON && rnd()%100 < sce->val2 ) {
+		if( sd && (sce = sc_data(sc, SC_GT_ENERGYGAIN)) && flag&BF_WEAPON && rnd()%100 < sce->val2 ) {
 			int spheremax = 0;
 
-			if( sc->data[SC_RAISINGDRAGON] )
-				spheremax = 5 + sc->data[SC_RAISINGDRAGON]->val1;
+			if( sc_data(sc, SC_RAISINGDRAGON) )
+				spheremax = 5 + sc_data(sc, SC_RAISINGDRAGON)->val1;
 			else
 				spheremax = 5;
 			pc_addspiritball(sd,skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN,sce->val1),spheremax);
 		}
 
-		if( (sce = sc->data[SC__DEADLYINFECT]) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT &&
+		if( (sce = sc_data(sc, SC__DEADLYINFECT)) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT &&
 			rnd()%100 < 30 + 10 * sce->val1 )
 			status_change_spread(bl,src); //Deadly infect attacked side
 
-		if( (sce = sc->data[SC_STYLE_CHANGE]) && sce->val1 == MH_MD_GRAPPLING ) {
+		if( (sce = sc_data(sc, SC_STYLE_CHANGE)) && sce->val1 == MH_MD_GRAPPLING ) {
 			TBL_HOM *hd = BL_CAST(BL_HOM,bl); //We add a sphere for when the Homunculus is being hit
 
 			if( hd && rnd()%100 < 50 ) //According to WarpPortal, this is a flat 50% chance
@@ -1267,18 +1268,18 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 	sc = status_get_sc(src);
 
 	if( sc && sc->count ) {
-		if( sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+		if( sc_data(sc, SC_INVINCIBLE) && !sc_data(sc, SC_INVINCIBLEOFF) )
 			damage += damage * 75 / 100;
 
-		if( damage > 0 && (sce = sc->data[SC_BLOODLUST]) && flag&BF_WEAPON && rnd()%100 < sce->val3 )
+		if( damage > 0 && (sce = sc_data(sc, SC_BLOODLUST)) && flag&BF_WEAPON && rnd()%100 < sce->val3 )
 			status_heal(src,damage * sce->val4 / 100,0,3);
 
 		//[Epoque]
 		if( bl->type == BL_MOB ) {
 			int i;
 
-			if( ((sce = sc->data[SC_MANU_ATK]) && flag&BF_WEAPON) ||
-				((sce = sc->data[SC_MANU_MATK]) && flag&BF_MAGIC) ) {
+			if( ((sce = sc_data(sc, SC_MANU_ATK)) && flag&BF_WEAPON) ||
+				((sce = sc_data(sc, SC_MANU_MATK)) && flag&BF_MAGIC) ) {
 				for( i = 0; ARRAYLENGTH(mob_manuk) > i; i++ ) {
 					if( ((TBL_MOB *)bl)->mob_id == mob_manuk[i] ) {
 						damage += damage * sce->val1 / 100;
@@ -1287,8 +1288,8 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 				}
 			}
 
-			if( ((sce = sc->data[SC_SPL_ATK]) && flag&BF_WEAPON) ||
-				((sce = sc->data[SC_SPL_MATK]) && flag&BF_MAGIC) ) {
+			if( ((sce = sc_data(sc, SC_SPL_ATK)) && flag&BF_WEAPON) ||
+				((sce = sc_data(sc, SC_SPL_MATK)) && flag&BF_MAGIC) ) {
 				for( i = 0; ARRAYLENGTH(mob_splendide) > i; i++ ) {
 					if( ((TBL_MOB *)bl)->mob_id == mob_splendide[i] ) {
 						damage += damage * sce->val1 / 100;
@@ -1298,18 +1299,18 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			}
 		}
 
-		if( (sce = sc->data[SC_SHIELDSPELL_REF]) && sce->val1 == 1 && flag&BF_WEAPON )
+		if( (sce = sc_data(sc, SC_SHIELDSPELL_REF)) && sce->val1 == 1 && flag&BF_WEAPON )
 			skill_break_equip(src,bl,EQP_ARMOR,10000,BCT_ENEMY);
 
 		if( damage > 0 ) {
-			if( (sce = sc->data[SC_POISONINGWEAPON]) && skill_id != GC_VENOMPRESSURE && flag&BF_WEAPON && rnd()%100 < sce->val3 )
+			if( (sce = sc_data(sc, SC_POISONINGWEAPON)) && skill_id != GC_VENOMPRESSURE && flag&BF_WEAPON && rnd()%100 < sce->val3 )
 				sc_start(src,bl,(sc_type)sce->val2,100,sce->val1,skill_get_time2(GC_POISONINGWEAPON,1));
 
-			if( (sce = sc->data[SC__DEADLYINFECT]) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT && rnd()%100 < 30 + 10 * sce->val1 )
+			if( (sce = sc_data(sc, SC__DEADLYINFECT)) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT && rnd()%100 < 30 + 10 * sce->val1 )
 				status_change_spread(src,bl);
 		}
 
-		if( (sce = sc->data[SC_STYLE_CHANGE]) && sce->val1 == MH_MD_FIGHTING ) {
+		if( (sce = sc_data(sc, SC_STYLE_CHANGE)) && sce->val1 == MH_MD_FIGHTING ) {
 			TBL_HOM *hd = BL_CAST(BL_HOM,src); //When attacking
 
 			if( hd && rnd()%100 < 50 )
@@ -1531,7 +1532,7 @@ int64 battle_addmastery(struct map_session_data *sd, struct block_list *target,
 
 	if((skill = pc_checkskill(sd,HT_BEASTBANE)) > 0 && (status->race == RC_BRUTE || status->race == RC_INSECT) ) {
 		damage += (skill * 4);
-		if (sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_HUNTER)
+		if (sc_data(&sd->sc, SC_SPIRIT) && sc_data(&sd->sc, SC_SPIRIT)->val2 == SL_HUNTER)
 			damage += sd->status.str;
 	}
 
@@ -1656,7 +1657,7 @@ static int battle_calc_base_weapon_attack(struct block_list *src, struct status_
 	}
 
 	if (skill_id != SR_TIGERCANNON) {
-		if (!(sc && sc->data[SC_MAXIMIZEPOWER])) {
+		if (!(sc && sc_data(sc, SC_MAXIMIZEPOWER))) {
 			if (atkmax > atkmin)
 				atkmax = atkmin + rnd()%(atkmax - atkmin + 1);
 			else
@@ -1673,7 +1674,7 @@ static int battle_calc_base_weapon_attack(struct block_list *src, struct status_
 
 	damage = atkmax;
 
-	if (sc && sc->data[SC_WEAPONPERFECTION])
+	if (sc && sc_data(sc, SC_WEAPONPERFECTION))
 		weapon_perfection = true;
 
 	damage = battle_calc_sizefix(damage, sd, tstatus->size, type, weapon_perfection);
@@ -1743,7 +1744,7 @@ static int64 battle_calc_base_damage(struct block_list *src, struct status_data
 		}
 	}
 
-	if((sc && sc->data[SC_MAXIMIZEPOWER]) || skill_id == SR_TIGERCANNON)
+	if((sc && sc_data(sc, SC_MAXIMIZEPOWER)) || skill_id == SR_TIGERCANNON)
 		atkmin = atkmax;
 
 	//Weapon Damage calculation
@@ -2006,6 +2007,134 @@ static int battle_skill_damage(struct block_list *src, struct block_list *target
 }
 #endif
 
+/**
+ * Cache of the skill db and bonus lookups of an attacker, the ones that don't depend on the target.
+ * Built for the first target of a source/skill/tick and reused for the other targets
+ * of the same area skill or skill unit pass.
+ * This is only a lookup cache: there is no attacker phase or batched target evaluation,
+ * the ATK/MATK formulas still run completely for every target.
+ */
+static struct battle_src_context {
+	int src_id;
+	int16 m;
+	uint16 skill_id, skill_lv;
+	unsigned int tick;
+	int nk, inf, div_;
+	int blewcount; //Includes item bonuses
+	bool bonus_done; //Following bonuses were looked up
+	uint16 bonus_skill; //Skill the following bonuses were looked up for
+	int skillatk, adjust; //pc_skillatk_bonus, battle_adjust_skill_damage
+#ifdef ADJUST_SKILL_DAMAGE
+	int skill_damage[4]; //battle_skill_damage per target class: player, monster, boss, other
+	uint8 skill_damage_done; //Bitmask of the classes already looked up
+#endif
+} battle_src_ctx;
+
+static bool battle_src_ctx_enabled = true;
+static bool battle_bench_dryrun = false; //aoe_bench: skip battle_calc_damage and reflection, they change the units
+static struct {
+	unsigned int built, reused;
+} battle_src_ctx_stats;
+
+/**
+ * Returns the attacker context of a skill attack, building it if the cached one is for another source/skill/tick
+ * @param src: Attacker
+ * @param skill_id: Skill used
+ * @param skill_lv: Skill level
+ * @return Attacker context
+ */
+static struct battle_src_context *battle_get_src_context(struct block_list *src, uint16 skill_id, uint16 skill_lv)
+{
+	struct battle_src_context *ctx = &battle_src_ctx;
+	struct map_session_data *sd;
+	unsigned int tick = gettick();
+
+	if( battle_src_ctx_enabled && ctx->src_id == src->id && ctx->skill_id == skill_id &&
+		ctx->skill_lv == skill_lv && ctx->tick == tick && ctx->m == src->m ) {
+		battle_src_ctx_stats.reused++;
+		return ctx;
+	}
+
+	sd = BL_CAST(BL_PC, src);
+	ctx->src_id = src->id;
+	ctx->m = src->m;
+	ctx->skill_id = skill_id;
+	ctx->skill_lv = skill_lv;
+	ctx->tick = tick;
+	ctx->nk = skill_get_nk(skill_id);
+	ctx->inf = skill_get_inf(skill_id);
+	ctx->div_ = skill_get_num(skill_id, skill_lv);
+	ctx->blewcount = skill_get_blewcount(skill_id, skill_lv) + (sd ? battle_blewcount_bonus(sd, skill_id) : 0);
+	ctx->bonus_done = false;
+	ctx->bonus_skill = 0;
+	ctx->skillatk = 0;
+	ctx->adjust = 0;
+#ifdef ADJUST_SKILL_DAMAGE
+	ctx->skill_damage_done = 0;
+#endif
+	battle_src_ctx_stats.built++;
+	return ctx;
+}
+
+/**
+ * Forgets the cached attacker context of a unit, called when its bonuses change
+ * @param src_id: Attacker ID
+ */
+void battle_src_context_invalidate(int src_id)
+{
+	if( battle_src_ctx.src_id == src_id )
+		battle_src_ctx.src_id = 0;
+}
+
+/**
+ * Player skill damage bonuses of the attacker context
+ * @param ctx: Attacker context
+ * @param sd: Attacking player
+ * @param skill: Skill the bonuses apply to (may differ from the used skill)
+ * @param skillatk: pc_skillatk_bonus
+ * @param adjust: battle_adjust_skill_damage
+ */
+static void battle_src_skill_bonus(struct battle_src_context *ctx, struct map_session_data *sd, uint16 skill, int *skillatk, int *adjust)
+{
+	if( !ctx->bonus_done || ctx->bonus_skill != skill ) {
+		ctx->bonus_done = true;
+		ctx->bonus_skill = skill;
+		ctx->skillatk = pc_skillatk_bonus(sd, skill);
+		ctx->adjust = battle_adjust_skill_damage(ctx->m, skill);
+	}
+	*skillatk = ctx->skillatk;
+	*adjust = ctx->adjust;
+}
+
+#ifdef ADJUST_SKILL_DAMAGE
+/**
+ * battle_skill_damage through the attacker context, looked up once per target class
+ * @param ctx: Attacker context
+ * @param src: Attacker
+ * @param target: Target
+ * @return Total damage rate
+ */
+static int battle_src_skill_damage(struct battle_src_context *ctx, struct block_list *src, struct block_list *target)
+{
+	int i;
+
+	if( !target )
+		return 0;
+
+	switch( target->type ) {
+		case BL_PC:  i = 0; break;
+		case BL_MOB: i = (is_boss(target) ? 2 : 1); break;
+		default:     i = 3; break;
+	}
+
+	if( !(ctx->skill_damage_done&(1<<i)) ) {
+		ctx->skill_damage[i] = battle_skill_damage(src, target, ctx->skill_id);
+		ctx->skill_damage_done |= 1<<i;
+	}
+	return ctx->skill_damage[i];
+}
+#endif
+
 struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list *target,uint16 skill_id,uint16 skill_lv,int mflag);
 struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *target,uint16 skill_id,uint16 skill_lv,int mflag);
 
@@ -2142,19 +2271,19 @@ static bool is_attack_critical(struct Damage wd, struct block_list *src, struct
 				cri += sd->bonus.arrow_cri;
 		}
 
-		if(sc && sc->data[SC_CAMOUFLAGE])
-			cri += 100 * min(10, sc->data[SC_CAMOUFLAGE]->val3); //Max 100% (1K)
+		if(sc && sc_data(sc, SC_CAMOUFLAGE))
+			cri += 100 * min(10, sc_data(sc, SC_CAMOUFLAGE)->val3); //Max 100% (1K)
 
 		//The official equation is * 2, but that only applies when sd's do critical
 		//Therefore, we use the old value 3 on cases when an sd gets attacked by a mob
 		cri -= tstatus->luk * (!sd && tsd ? 3 : 2);
 
-		if(tsc && tsc->data[SC_SLEEP])
+		if(tsc && sc_data(tsc, SC_SLEEP))
 			cri <<= 1;
 
 		switch(skill_id) {
 			case 0:
-				if(!(sc && sc->data[SC_AUTOCOUNTER]))
+				if(!(sc && sc_data(sc, SC_AUTOCOUNTER)))
 					break;
 				clif_specialeffect(src, 131, AREA);
 				status_change_end(src, SC_AUTOCOUNTER, INVALID_TIMER);
@@ -2261,18 +2390,18 @@ static bool is_attack_hitting(struct Damage wd, struct block_list *src, struct b
 		return true;
 	else if(sd && sd->bonus.perfect_hit > 0 && rnd()%100 < sd->bonus.perfect_hit)
 		return true;
-	else if(sc && sc->data[SC_FUSION])
+	else if(sc && sc_data(sc, SC_FUSION))
 		return true;
 	else if(skill_id == AS_SPLASHER && !wd.miscflag)
 		return true;
-	else if(skill_id == CR_SHIELDBOOMERANG && sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_CRUSADER)
+	else if(skill_id == CR_SHIELDBOOMERANG && sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_CRUSADER)
 		return true;
 	else if(tsc && tsc->opt1 && tsc->opt1 != OPT1_STONEWAIT && tsc->opt1 != OPT1_BURNING && tsc->opt1 != OPT1_FREEZING)
 		return true;
 	else if(nk&NK_IGNORE_FLEE)
 		return true;
 
-	if(sc && (sc->data[SC_NEUTRALBARRIER] || sc->data[SC_NEUTRALBARRIER_MASTER]) && (wd.flag&(BF_LONG|BF_MAGIC)) == BF_LONG)
+	if(sc && (sc_data(sc, SC_NEUTRALBARRIER) || sc_data(sc, SC_NEUTRALBARRIER_MASTER)) && (wd.flag&(BF_LONG|BF_MAGIC)) == BF_LONG)
 		return false;
 
 	flee = tstatus->flee;
@@ -2298,7 +2427,7 @@ static bool is_attack_hitting(struct Damage wd, struct block_list *src, struct b
 	hitrate += sstatus->hit - flee;
 
 	//Fogwall's hit penalty is only for normal ranged attacks
-	if(!skill_id && (wd.flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) && tsc && tsc->data[SC_FOGWALL])
+	if(!skill_id && (wd.flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) && tsc && sc_data(tsc, SC_FOGWALL))
 		hitrate -= 50;
 
 	if(sd && is_skill_using_arrow(src,skill_id))
@@ -2392,10 +2521,10 @@ static bool is_attack_hitting(struct Damage wd, struct block_list *src, struct b
 	}
 
 	if(sc) {
-		if(sc->data[SC_MTF_ASPD])
-			hitrate += sc->data[SC_MTF_ASPD]->val2;
-		if(sc->data[SC_MTF_ASPD2])
-			hitrate += sc->data[SC_MTF_ASPD2]->val2;
+		if(sc_data(sc, SC_MTF_ASPD))
+			hitrate += sc_data(sc, SC_MTF_ASPD)->val2;
+		if(sc_data(sc, SC_MTF_ASPD2))
+			hitrate += sc_data(sc, SC_MTF_ASPD2)->val2;
 	}
 
 	hitrate = cap_value(hitrate,battle_config.min_hitrate,battle_config.max_hitrate);
@@ -2422,7 +2551,7 @@ static bool attack_ignores_def(struct Damage wd, struct block_list *src, struct
 		return true;
 	else
 #endif
-	if(sc && sc->data[SC_FUSION])
+	if(sc && sc_data(sc, SC_FUSION))
 		return true;
 	else if(skill_id != CR_GRANDCROSS && skill_id != NPC_GRANDDARKNESS) { //Ignore Defense?
 		if(sd && (sd->right_weapon.ignore_def_ele&(1<<tstatus->def_ele) || sd->right_weapon.ignore_def_ele&(1<<ELE_ALL) ||
@@ -2519,8 +2648,8 @@ static int battle_get_weapon_element(struct Damage wd, struct block_list *src, s
 		if(sd && sd->spiritcharm_type != CHARM_TYPE_NONE && sd->spiritcharm >= MAX_SPIRITCHARM)
 			element = sd->spiritcharm_type; //Summoning 10 spiritcharm will endow your weapon
 		//On official endows override all other elements [helvetica]
-		if(sc && sc->data[SC_ENCHANTARMS]) //Check for endows
-			element = sc->data[SC_ENCHANTARMS]->val2;
+		if(sc && sc_data(sc, SC_ENCHANTARMS)) //Check for endows
+			element = sc_data(sc, SC_ENCHANTARMS)->val2;
 	} else if(element == -2) //Use enchantment's element
 		element = status_get_attack_sc_element(src,sc);
 	else if(element == -3) //Use random element
@@ -2532,7 +2661,7 @@ static int battle_get_weapon_element(struct Damage wd, struct block_list *src, s
 				element = ELE_NEUTRAL; //Forced neutral for monsters
 			break;
 		case LG_HESPERUSLIT:
-			if(sc && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 4)
+			if(sc && sc_data(sc, SC_BANDING) && sc_data(sc, SC_BANDING)->val2 > 4)
 				element = ELE_HOLY;
 			break;
 		case RL_H_MINE:
@@ -2541,8 +2670,8 @@ static int battle_get_weapon_element(struct Damage wd, struct block_list *src, s
 			break;
 	}
 
-	if(sc && ((sc->data[SC_GOLDENE_FERSE] && ((!skill_id && (rnd()%100 < sc->data[SC_GOLDENE_FERSE]->val4)) ||
-		skill_id == MH_STAHL_HORN)) || sc->data[SC_P_ALTER]))
+	if(sc && ((sc_data(sc, SC_GOLDENE_FERSE) && ((!skill_id && (rnd()%100 < sc_data(sc, SC_GOLDENE_FERSE)->val4)) ||
+		skill_id == MH_STAHL_HORN)) || sc_data(sc, SC_P_ALTER)))
 		element = ELE_HOLY;
 
 	//Calc_flag means the element should be calculated for damage only
@@ -2613,13 +2742,13 @@ static struct Damage battle_calc_element_damage(struct Damage wd, struct block_l
 		if(is_attack_left_handed(src, skill_id) && wd.damage2 > 0)
 			wd.damage2 = battle_attr_fix(src, target, wd.damage2, left_element, tstatus->def_ele, tstatus->ele_lv);
 		//Descriptions indicate this means adding a percent of a normal attack in another element [Skotlex]
-		if(sc && sc->data[SC_WATK_ELEMENT] && (wd.damage || wd.damage2)) {
-			int64 damage = battle_calc_base_damage(src, sstatus, &sstatus->rhw, sc, tstatus->size, sd, skill_id, (is_skill_using_arrow(src, skill_id) ? 2 : 0)) * sc->data[SC_WATK_ELEMENT]->val2 / 100;
+		if(sc && sc_data(sc, SC_WATK_ELEMENT) && (wd.damage || wd.damage2)) {
+			int64 damage = battle_calc_base_damage(src, sstatus, &sstatus->rhw, sc, tstatus->size, sd, skill_id, (is_skill_using_arrow(src, skill_id) ? 2 : 0)) * sc_data(sc, SC_WATK_ELEMENT)->val2 / 100;
 
-			wd.damage += battle_attr_fix(src, target, damage, sc->data[SC_WATK_ELEMENT]->val1, tstatus->def_ele, tstatus->ele_lv);
+			wd.damage += battle_attr_fix(src, target, damage, sc_data(sc, SC_WATK_ELEMENT)->val1, tstatus->def_ele, tstatus->ele_lv);
 			if(is_attack_left_handed(src, skill_id)) {
-				damage = battle_calc_base_damage(src, sstatus, &sstatus->lhw, sc, tstatus->size, sd, skill_id, (is_skill_using_arrow(src, skill_id) ? 2 : 0)) * sc->data[SC_WATK_ELEMENT]->val2 / 100;
-				wd.damage2 += battle_attr_fix(src, target, damage, sc->data[SC_WATK_ELEMENT]->val1, tstatus->def_ele, tstatus->ele_lv);
+				damage = battle_calc_base_damage(src, sstatus, &sstatus->lhw, sc, tstatus->size, sd, skill_id, (is_skill_using_arrow(src, skill_id) ? 2 : 0)) * sc_data(sc, SC_WATK_ELEMENT)->val2 / 100;
+				wd.damage2 += battle_attr_fix(src, target, damage, sc_data(sc, SC_WATK_ELEMENT)->val1, tstatus->def_ele, tstatus->ele_lv);
 			}
 		}
 	}
@@ -2702,7 +2831,7 @@ static struct Damage battle_calc_attack_masteries(struct Damage wd, struct block
 		if(sc) { //Status change considered as masteries
 			uint8 i;
 
-			if(sc->data[SC_MIRACLE])
+			if(sc_data(sc, SC_MIRACLE))
 				i = 2; //Star anger
 			else
 				ARR_FIND(0, MAX_PC_FEELHATE, i, t_class == sd->hate_mob[i]);
@@ -2719,25 +2848,25 @@ static struct Damage battle_calc_attack_masteries(struct Damage wd, struct block
 #endif
 			}
 #ifdef RENEWAL
-			if(sc->data[SC_PROVOKE])
-				ATK_ADDRATE(wd.masteryAtk, wd.masteryAtk2, sc->data[SC_PROVOKE]->val3);
+			if(sc_data(sc, SC_PROVOKE))
+				ATK_ADDRATE(wd.masteryAtk, wd.masteryAtk2, sc_data(sc, SC_PROVOKE)->val3);
 #endif
-			if(sc->data[SC_CAMOUFLAGE]) {
-				ATK_ADD(wd.damage, wd.damage2, 30 * min(10, sc->data[SC_CAMOUFLAGE]->val3));
+			if(sc_data(sc, SC_CAMOUFLAGE)) {
+				ATK_ADD(wd.damage, wd.damage2, 30 * min(10, sc_data(sc, SC_CAMOUFLAGE)->val3));
 #ifdef RENEWAL
-				ATK_ADD(wd.masteryAtk, wd.masteryAtk2, 30 * min(10, sc->data[SC_CAMOUFLAGE]->val3));
+				ATK_ADD(wd.masteryAtk, wd.masteryAtk2, 30 * min(10, sc_data(sc, SC_CAMOUFLAGE)->val3));
 #endif
 			}
-			if(sc->data[SC_GN_CARTBOOST]) {
-				ATK_ADD(wd.damage, wd.damage2, 10 * sc->data[SC_GN_CARTBOOST]->val1);
+			if(sc_data(sc, SC_GN_CARTBOOST)) {
+				ATK_ADD(wd.damage, wd.damage2, 10 * sc_data(sc, SC_GN_CARTBOOST)->val1);
 #ifdef RENEWAL
-				ATK_ADD(wd.masteryAtk, wd.masteryAtk2, 10 * sc->data[SC_GN_CARTBOOST]->val1);
+				ATK_ADD(wd.masteryAtk, wd.masteryAtk2, 10 * sc_data(sc, SC_GN_CARTBOOST)->val1);
 #endif
 			}
-			if(sc->data[SC_RUSHWINDMILL]) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_RUSHWINDMILL]->val3);
+			if(sc_data(sc, SC_RUSHWINDMILL)) {
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_RUSHWINDMILL)->val3);
 #ifdef RENEWAL
-				ATK_ADD(wd.masteryAtk, wd.masteryAtk2, sc->data[SC_RUSHWINDMILL]->val3);
+				ATK_ADD(wd.masteryAtk, wd.masteryAtk2, sc_data(sc, SC_RUSHWINDMILL)->val3);
 #endif
 			}
 		}
@@ -2767,7 +2896,7 @@ struct Damage battle_calc_damage_parts(struct Damage wd, struct block_list *src,
 	wd.statusAtk += battle_calc_status_attack(sstatus, EQI_HAND_R);
 	wd.statusAtk2 += battle_calc_status_attack(sstatus, EQI_HAND_L);
 
-	if(skill_id || (sd && sd->sc.data[SC_SEVENWIND])) { //Mild Wind applies element to status ATK as well as weapon ATK [helvetica]
+	if(skill_id || (sd && sc_data(&sd->sc, SC_SEVENWIND))) { //Mild Wind applies element to status ATK as well as weapon ATK [helvetica]
 		wd.statusAtk = battle_attr_fix(src, target, wd.statusAtk, right_element, tstatus->def_ele, tstatus->ele_lv);
 		wd.statusAtk2 = battle_attr_fix(src, target, wd.statusAtk, left_element, tstatus->def_ele, tstatus->ele_lv);
 	} else { //Status ATK is considered neutral on normal attacks [helvetica]
@@ -2951,7 +3080,7 @@ struct Damage battle_calc_skill_base_damage(struct Damage wd, struct block_list
 				wd = battle_calc_damage_parts(wd, src, target, skill_id, skill_lv);
 			else {
 				i = (is_attack_critical(wd, src, target, skill_id, skill_lv, false) ? 1 : 0)|
-					(!skill_id && sc && sc->data[SC_CHANGE] ? 4 : 0);
+					(!skill_id && sc && sc_data(sc, SC_CHANGE) ? 4 : 0);
 				wd.damage = battle_calc_base_damage(src, sstatus, &sstatus->rhw, sc, tstatus->size, sd, skill_id, i);
 				if(is_attack_left_handed(src, skill_id))
 					wd.damage2 = battle_calc_base_damage(src, sstatus, &sstatus->lhw, sc, tstatus->size, sd, skill_id, i);
@@ -2960,9 +3089,9 @@ struct Damage battle_calc_skill_base_damage(struct Damage wd, struct block_list
 			i = (is_attack_critical(wd, src, target, skill_id, skill_lv, false) ? 1 : 0)|
 				(is_skill_using_arrow(src, skill_id) ? 2 : 0)|
 				(skill_id == HW_MAGICCRASHER ? 4 : 0)|
-				(!skill_id && sc && sc->data[SC_CHANGE] ? 4 : 0)|
+				(!skill_id && sc && sc_data(sc, SC_CHANGE) ? 4 : 0)|
 				(skill_id == MO_EXTREMITYFIST ? 8 : 0)|
-				(sc && sc->data[SC_WEAPONPERFECTION] ? 8 : 0);
+				(sc && sc_data(sc, SC_WEAPONPERFECTION) ? 8 : 0);
 			if(is_skill_using_arrow(src, skill_id) && sd) {
 				switch(sd->status.weapon) {
 					case W_BOW:
@@ -3049,11 +3178,11 @@ static struct Damage battle_calc_multi_attack(struct Damage wd, struct block_lis
 		if(sd->bonus.double_rate > 0 && sd->weapontype1 != W_FIST)
 			dachance = sd->bonus.double_rate;
 
-		if(sc && sc->data[SC_KAGEMUSYA] && sc->data[SC_KAGEMUSYA]->val3 > dachance && sd->weapontype1 != W_FIST)
-			dachance = sc->data[SC_KAGEMUSYA]->val3;
+		if(sc && sc_data(sc, SC_KAGEMUSYA) && sc_data(sc, SC_KAGEMUSYA)->val3 > dachance && sd->weapontype1 != W_FIST)
+			dachance = sc_data(sc, SC_KAGEMUSYA)->val3;
 
-		if(sc && sc->data[SC_E_CHAIN] && 5 * sc->data[SC_E_CHAIN]->val1 > dachance)
-			dachance = 5 * sc->data[SC_E_CHAIN]->val1;
+		if(sc && sc_data(sc, SC_E_CHAIN) && 5 * sc_data(sc, SC_E_CHAIN)->val1 > dachance)
+			dachance = 5 * sc_data(sc, SC_E_CHAIN)->val1;
 
 		if(5 * pc_checkskill(sd,TF_DOUBLE) > dachance && sd->weapontype1 == W_DAGGER)
 			dachance = 5 * pc_checkskill(sd,TF_DOUBLE);
@@ -3062,7 +3191,7 @@ static struct Damage battle_calc_multi_attack(struct Damage wd, struct block_lis
 			dachance = 5 * pc_checkskill(sd,GS_CHAINACTION);
 
 		//This checks if the generated value is within fear breeze's success chance range for the level used as set by gendetect
-		if(sc && sc->data[SC_FEARBREEZE] && generate <= gendetect[sc->data[SC_FEARBREEZE]->val1 - 1] &&
+		if(sc && sc_data(sc, SC_FEARBREEZE) && generate <= gendetect[sc_data(sc, SC_FEARBREEZE)->val1 - 1] &&
 			sd->weapontype1 == W_BOW && (i = sd->equip_index[EQI_AMMO]) > 0 && sd->inventory_data[i] &&
 			sd->status.inventory[i].amount > 1)
 		{
@@ -3075,7 +3204,7 @@ static struct Damage battle_calc_multi_attack(struct Damage wd, struct block_lis
 				else if(generate >= 28 && generate <= 30) //3% chance to deal 5 hits.
 					hitnumber = 5;
 				hitnumber = min(hitnumber,sd->status.inventory[i].amount);
-				sc->data[SC_FEARBREEZE]->val4 = hitnumber - 1;
+				sc_data(sc, SC_FEARBREEZE)->val4 = hitnumber - 1;
 		}
 		//If the generated value is higher then Fear Breeze's success chance range,
 		//but not higher then the player's double attack success chance, then allow a double attack to happen
@@ -3085,18 +3214,18 @@ static struct Damage battle_calc_multi_attack(struct Damage wd, struct block_lis
 		if(hitnumber > 1) { //Needed to allow critical attacks to hit when not hitting more then once
 			wd.div_ = hitnumber;
 			wd.type = DMG_MULTI_HIT;
-			if(sc && sc->data[SC_E_CHAIN])
+			if(sc && sc_data(sc, SC_E_CHAIN))
 				sc_start(src,src,SC_QD_SHOT_READY,100,target->id,skill_get_time(RL_QD_SHOT,1));
 		}
 	}
 
 	switch(skill_id) {
 		case RA_AIMEDBOLT:
-			if(tsc && (tsc->data[SC_BITE] || tsc->data[SC_ANKLE] || tsc->data[SC_ELECTRICSHOCKER]))
+			if(tsc && (sc_data(tsc, SC_BITE) || sc_data(tsc, SC_ANKLE) || sc_data(tsc, SC_ELECTRICSHOCKER)))
 				wd.div_ = tstatus->size + 2 + ((rnd()%100 < 50 - tstatus->size * 10) ? 1 : 0);
 			break;
 		case SC_JYUMONJIKIRI:
-			if(tsc && tsc->data[SC_JYUMONJIKIRI])
+			if(tsc && sc_data(tsc, SC_JYUMONJIKIRI))
 				wd.div_ = wd.div_ * -1; //Needs more info
 			break;
 	}
@@ -3124,21 +3253,21 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 	int i;
 
 	if(sc && skill_id != PA_SACRIFICE) { //Skill damage modifiers that stack linearly
-		if(sc->data[SC_OVERTHRUST])
-			skillratio += sc->data[SC_OVERTHRUST]->val3;
-		if(sc->data[SC_MAXOVERTHRUST])
-			skillratio += sc->data[SC_MAXOVERTHRUST]->val2;
-		if(sc->data[SC_BERSERK])
+		if(sc_data(sc, SC_OVERTHRUST))
+			skillratio += sc_data(sc, SC_OVERTHRUST)->val3;
+		if(sc_data(sc, SC_MAXOVERTHRUST))
+			skillratio += sc_data(sc, SC_MAXOVERTHRUST)->val2;
+		if(sc_data(sc, SC_BERSERK))
 #ifndef RENEWAL
 			skillratio += 100;
 #else
 			skillratio += 200;
-		if(sc->data[SC_TRUESIGHT])
-			skillratio += 2 * sc->data[SC_TRUESIGHT]->val1;
-		if(sc->data[SC_CONCENTRATION])
-			skillratio += sc->data[SC_CONCENTRATION]->val2;
+		if(sc_data(sc, SC_TRUESIGHT))
+			skillratio += 2 * sc_data(sc, SC_TRUESIGHT)->val1;
+		if(sc_data(sc, SC_CONCENTRATION))
+			skillratio += sc_data(sc, SC_CONCENTRATION)->val2;
 #endif
-		if(sc->data[SC_CRUSHSTRIKE] && skill_id == KN_AUTOCOUNTER) {
+		if(sc_data(sc, SC_CRUSHSTRIKE) && skill_id == KN_AUTOCOUNTER) {
 			if(sd) { //ATK [{Weapon Level * (Weapon Upgrade Level + 6) * 100} + (Weapon ATK) + (Weapon Weight)]%
 				short index = sd->equip_index[EQI_HAND_R];
 
@@ -3149,9 +3278,9 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 			status_change_end(src,SC_CRUSHSTRIKE,INVALID_TIMER);
 			skill_break_equip(src,src,EQP_WEAPON,2000,BCT_SELF);
 		}
-		if(sc->data[SC_P_ALTER])
-			skillratio += sc->data[SC_P_ALTER]->val2;
-		if(sc->data[SC_HEAT_BARREL])
+		if(sc_data(sc, SC_P_ALTER))
+			skillratio += sc_data(sc, SC_P_ALTER)->val2;
+		if(sc_data(sc, SC_HEAT_BARREL))
 			skillratio += 200;
 	}
 
@@ -3405,11 +3534,11 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 			break;
 		case TK_JUMPKICK:
 			skillratio += -70 + 10 * skill_lv + 10 * pc_checkskill(sd,TK_RUN);
-			if(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill_id)
+			if(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == skill_id)
 				skillratio += 10 * status_get_lv(src) / 3; //Tumble bonus
 			if(wd.miscflag) {
 				skillratio += 10 * status_get_lv(src) / 3; //Running bonus (@TODO: Check the real value?)
-				if(sc && sc->data[SC_SPURT]) //Spurt bonus
+				if(sc && sc_data(sc, SC_SPURT)) //Spurt bonus
 					skillratio *= 2;
 			}
 			break;
@@ -3569,8 +3698,8 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 		case GC_CROSSRIPPERSLASHER:
 			skillratio += 300 + 80 * skill_lv;
 			RE_LVL_DMOD(100);
-			if(sc && sc->data[SC_ROLLINGCUTTER])
-				skillratio += sc->data[SC_ROLLINGCUTTER]->val1 * sstatus->agi;
+			if(sc && sc_data(sc, SC_ROLLINGCUTTER))
+				skillratio += sc_data(sc, SC_ROLLINGCUTTER)->val1 * sstatus->agi;
 			break;
 		case GC_DARKCROW:
 			skillratio += 100 * (skill_lv - 1);
@@ -3731,11 +3860,11 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 			break;
 		case LG_HESPERUSLIT:
 			if(sc) {
-				if(sc->data[SC_INSPIRATION])
+				if(sc_data(sc, SC_INSPIRATION))
 					skillratio += 1100;
-				if(sc->data[SC_BANDING]) {
-					skillratio += -100 + 120 * skill_lv + 200 * sc->data[SC_BANDING]->val2;
-					if(sc->data[SC_BANDING]->val2 > 5)
+				if(sc_data(sc, SC_BANDING)) {
+					skillratio += -100 + 120 * skill_lv + 200 * sc_data(sc, SC_BANDING)->val2;
+					if(sc_data(sc, SC_BANDING)->val2 > 5)
 						skillratio = skillratio * 150 / 100;
 				}
 				RE_LVL_DMOD(100);
@@ -3747,16 +3876,16 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 			break;
 		case SR_SKYNETBLOW:
 			//ATK [{(Skill Level x 100) + (Caster's AGI) + 150} x Caster's Base Level / 100] %
-			if(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_DRAGONCOMBO)
+			if(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == SR_DRAGONCOMBO)
 				skillratio += 100 * skill_lv + sstatus->agi + 50;
 			else //ATK [{(Skill Level x 80) + (Caster's AGI)} x Caster's Base Level / 100] %
 				skillratio += -100 + 80 * skill_lv + sstatus->agi;
 			RE_LVL_DMOD(100);
 			break;
 		case SR_EARTHSHAKER:
-			if(tsc && (tsc->data[SC_HIDING] || tsc->data[SC_CLOAKING] ||
-				tsc->data[SC_CHASEWALK] || tsc->data[SC_CLOAKINGEXCEED] ||
-				tsc->data[SC__INVISIBILITY]))
+			if(tsc && (sc_data(tsc, SC_HIDING) || sc_data(tsc, SC_CLOAKING) ||
+				sc_data(tsc, SC_CHASEWALK) || sc_data(tsc, SC_CLOAKINGEXCEED) ||
+				sc_data(tsc, SC__INVISIBILITY)))
 			{ //[(Skill Level x 150) x (Caster's Base Level / 100) + (Caster's INT x 3)] %
 				skillratio += -100 + 150 * skill_lv;
 				RE_LVL_DMOD(100);
@@ -3784,8 +3913,8 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 			}
 			break;
 		case SR_RAMPAGEBLASTER:
-			if(sc && sc->data[SC_EXPLOSIONSPIRITS]) {
-				skillratio += -100 + (20 * sc->data[SC_EXPLOSIONSPIRITS]->val1 + 20 * skill_lv) * (sd ? sd->spiritball_old : 1);
+			if(sc && sc_data(sc, SC_EXPLOSIONSPIRITS)) {
+				skillratio += -100 + (20 * sc_data(sc, SC_EXPLOSIONSPIRITS)->val1 + 20 * skill_lv) * (sd ? sd->spiritball_old : 1);
 				RE_LVL_DMOD(120);
 			} else {
 				skillratio += -100 + (20 * skill_lv) * (sd ? sd->spiritball_old : 1);
@@ -3810,7 +3939,7 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 			RE_LVL_DMOD(100);
 			break;
 		case SR_GATEOFHELL:
-			if(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE)
+			if(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == SR_FALLENEMPIRE)
 				skillratio += -100 + 800 * skill_lv;
 			else
 				skillratio += -100 + 500 * skill_lv;
@@ -3912,7 +4041,7 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 			//ATK [{( Striking Level x 50 ) + ( Varetyr Spear Skill Level x 50 )} x Caster's Base Level / 100 ] %
 			skillratio += -100 + 50 * skill_lv + (sd ? pc_checkskill(sd,SO_STRIKING) * 50 : 0);
 			RE_LVL_DMOD(100);
-			if(sc && sc->data[SC_BLAST_OPTION])
+			if(sc && sc_data(sc, SC_BLAST_OPTION))
 				skillratio += (sd ? sd->status.job_level * 5 : 0);
 			break;
 		//Physical Elemantal Spirits Attack Skills
@@ -3946,7 +4075,7 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 		case KO_JYUMONJIKIRI:
 			skillratio += -100 + 150 * skill_lv;
 			RE_LVL_DMOD(120);
-			if(tsc && tsc->data[SC_JYUMONJIKIRI])
+			if(tsc && sc_data(tsc, SC_JYUMONJIKIRI))
 				skillratio += skill_lv * status_get_lv(src);
 			break;
 		case KO_HUUMARANKA:
@@ -3955,8 +4084,8 @@ static int battle_calc_attack_skill_ratio(struct Damage wd,struct block_list *sr
 		case KO_SETSUDAN:
 			skillratio += 100 * (skill_lv - 1);
 			RE_LVL_DMOD(100);
-			if(tsc && tsc->data[SC_SPIRIT])
-				skillratio += 200 * tsc->data[SC_SPIRIT]->val1;
+			if(tsc && sc_data(tsc, SC_SPIRIT))
+				skillratio += 200 * sc_data(tsc, SC_SPIRIT)->val1;
 			break;
 		case KO_BAKURETSU:
 			skillratio += -100 + (sd ? pc_checkskill(sd,NJ_TOBIDOUGU) : 1) * (50 + sstatus->dex / 4) * skill_lv * 4 / 10;
@@ -4143,32 +4272,32 @@ struct Damage battle_attack_sc_bonus(struct Damage wd, struct block_list *src, s
 	if(sc) { //The following are applied on top of current damage and are stackable
 		if(skill_id != CR_SHIELDBOOMERANG) {
 #ifdef RENEWAL
-			if(sc->data[SC_IMPOSITIO])
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_IMPOSITIO]->val2);
-			if(sc->data[SC_VOLCANO])
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_VOLCANO]->val2);
-			if(sc->data[SC_DRUMBATTLE])
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_DRUMBATTLE]->val2);
-			if(sc->data[SC_MADNESSCANCEL])
+			if(sc_data(sc, SC_IMPOSITIO))
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_IMPOSITIO)->val2);
+			if(sc_data(sc, SC_VOLCANO))
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_VOLCANO)->val2);
+			if(sc_data(sc, SC_DRUMBATTLE))
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_DRUMBATTLE)->val2);
+			if(sc_data(sc, SC_MADNESSCANCEL))
 				ATK_ADD(wd.equipAtk, wd.equipAtk2, 100);
-			if(sc->data[SC_GATLINGFEVER]) {
+			if(sc_data(sc, SC_GATLINGFEVER)) {
 				if(tstatus->size == SZ_SMALL) {
-					ATK_ADD(wd.equipAtk, wd.equipAtk2, 10 * sc->data[SC_GATLINGFEVER]->val1);
+					ATK_ADD(wd.equipAtk, wd.equipAtk2, 10 * sc_data(sc, SC_GATLINGFEVER)->val1);
 				} else if(tstatus->size == SZ_MEDIUM) {
-					ATK_ADD(wd.equipAtk, wd.equipAtk2, 5 * sc->data[SC_GATLINGFEVER]->val1);
+					ATK_ADD(wd.equipAtk, wd.equipAtk2, 5 * sc_data(sc, SC_GATLINGFEVER)->val1);
 				} else if(tstatus->size == SZ_BIG)
-					ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_GATLINGFEVER]->val1);
+					ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_GATLINGFEVER)->val1);
 			}
 #else
-			if(sc->data[SC_TRUESIGHT])
-				ATK_ADDRATE(wd.damage, wd.damage2, 2 * sc->data[SC_TRUESIGHT]->val1);
+			if(sc_data(sc, SC_TRUESIGHT))
+				ATK_ADDRATE(wd.damage, wd.damage2, 2 * sc_data(sc, SC_TRUESIGHT)->val1);
 #endif
 			//Sonic Blow +25% dmg on GVG, +100% dmg on non GVG
-			if(skill_id == AS_SONICBLOW && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_ASSASIN) {
+			if(skill_id == AS_SONICBLOW && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_ASSASIN) {
 				ATK_ADDRATE(wd.damage, wd.damage2, map_flag_gvg2(src->m) ? 25 : 100);
 				RE_ALLATK_ADDRATE(wd, map_flag_gvg2(src->m) ? 25 : 100);
 			}
-			if(sc->data[SC_EDP]) {
+			if(sc_data(sc, SC_EDP)) {
 				switch(skill_id) {
 					//Pre-Renewal only: Soul Breaker and Meteor Assault ignores EDP 
 					//Renewal only: Grimtooth and Venom Knife ignore EDP
@@ -4203,92 +4332,92 @@ struct Damage battle_attack_sc_bonus(struct Damage wd, struct block_list *src, s
 						//Renewal EDP formula [helvetica]
 						//Weapon atk * (1 + (edp level * .8))
 						//Equip atk * (1 + (edp level * .6))
-						ATK_RATE(wd.damage, wd.damage2, 100 + sc->data[SC_EDP]->val1 * 80);
+						ATK_RATE(wd.damage, wd.damage2, 100 + sc_data(sc, SC_EDP)->val1 * 80);
 	#ifdef RENEWAL
-						ATK_RATE(wd.weaponAtk, wd.weaponAtk2, 100 + sc->data[SC_EDP]->val1 * 80);
-						ATK_RATE(wd.equipAtk, wd.equipAtk2, 100 + sc->data[SC_EDP]->val1 * 60);
+						ATK_RATE(wd.weaponAtk, wd.weaponAtk2, 100 + sc_data(sc, SC_EDP)->val1 * 80);
+						ATK_RATE(wd.equipAtk, wd.equipAtk2, 100 + sc_data(sc, SC_EDP)->val1 * 60);
 	#endif
 #else
 					default:
-						ATK_ADDRATE(wd.damage, wd.damage2, sc->data[SC_EDP]->val3);
+						ATK_ADDRATE(wd.damage, wd.damage2, sc_data(sc, SC_EDP)->val3);
 	#ifdef RENEWAL
-						ATK_ADDRATE(wd.weaponAtk, wd.weaponAtk2, sc->data[SC_EDP]->val3);
+						ATK_ADDRATE(wd.weaponAtk, wd.weaponAtk2, sc_data(sc, SC_EDP)->val3);
 	#endif
 #endif
 						break;
 				}
 			}
-			if(sc->data[SC_FIGHTINGSPIRIT]) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_FIGHTINGSPIRIT]->val1);
+			if(sc_data(sc, SC_FIGHTINGSPIRIT)) {
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_FIGHTINGSPIRIT)->val1);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_FIGHTINGSPIRIT]->val1);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_FIGHTINGSPIRIT)->val1);
 #endif
 			}
-			if(sc->data[SC_SHIELDSPELL_DEF] && sc->data[SC_SHIELDSPELL_DEF]->val1 == 3) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_SHIELDSPELL_DEF]->val2);
+			if(sc_data(sc, SC_SHIELDSPELL_DEF) && sc_data(sc, SC_SHIELDSPELL_DEF)->val1 == 3) {
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_SHIELDSPELL_DEF)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_SHIELDSPELL_DEF]->val2);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_SHIELDSPELL_DEF)->val2);
 #endif
 			}
-			if(sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 1) {
-				ATK_ADD(wd.damage, wd.damage2, (10 + 10 * sc->data[SC_BANDING]->val1) * sc->data[SC_BANDING]->val2);
+			if(sc_data(sc, SC_BANDING) && sc_data(sc, SC_BANDING)->val2 > 1) {
+				ATK_ADD(wd.damage, wd.damage2, (10 + 10 * sc_data(sc, SC_BANDING)->val1) * sc_data(sc, SC_BANDING)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, (10 + 10 * sc->data[SC_BANDING]->val1) * sc->data[SC_BANDING]->val2);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, (10 + 10 * sc_data(sc, SC_BANDING)->val1) * sc_data(sc, SC_BANDING)->val2);
 #endif
 			}
-			if(sc->data[SC_GT_CHANGE]) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_GT_CHANGE]->val2);
+			if(sc_data(sc, SC_GT_CHANGE)) {
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_GT_CHANGE)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_GT_CHANGE]->val2);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_GT_CHANGE)->val2);
 #endif
 			}
-			if(sc->data[SC_WATER_BARRIER]) {
-				ATK_ADD(wd.damage, wd.damage2, -sc->data[SC_WATER_BARRIER]->val2);
+			if(sc_data(sc, SC_WATER_BARRIER)) {
+				ATK_ADD(wd.damage, wd.damage2, -sc_data(sc, SC_WATER_BARRIER)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, -sc->data[SC_WATER_BARRIER]->val2);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, -sc_data(sc, SC_WATER_BARRIER)->val2);
 #endif
 			}
-			if(sc->data[SC_PYROTECHNIC_OPTION]) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_PYROTECHNIC_OPTION]->val2);
+			if(sc_data(sc, SC_PYROTECHNIC_OPTION)) {
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_PYROTECHNIC_OPTION)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_PYROTECHNIC_OPTION]->val2);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_PYROTECHNIC_OPTION)->val2);
 #endif
 			}
-			if(sc->data[SC_HEATER_OPTION]) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_HEATER_OPTION]->val2);
+			if(sc_data(sc, SC_HEATER_OPTION)) {
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_HEATER_OPTION)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_HEATER_OPTION]->val2);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_HEATER_OPTION)->val2);
 #endif
 			}
-			if(sc->data[SC_TROPIC_OPTION]) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_TROPIC_OPTION]->val2);
+			if(sc_data(sc, SC_TROPIC_OPTION)) {
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_TROPIC_OPTION)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_TROPIC_OPTION]->val2);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_TROPIC_OPTION)->val2);
 #endif
 			}
-			if(sc->data[SC_DANCEWITHWUG]) {
+			if(sc_data(sc, SC_DANCEWITHWUG)) {
 				if(inf3&INF3_SC_DANCEWITHWUG) {
-					ATK_ADDRATE(wd.damage, wd.damage2, sc->data[SC_DANCEWITHWUG]->val1 * 10 * party_calc_chorusbonus(sd,1));
-					RE_ALLATK_ADDRATE(wd, sc->data[SC_DANCEWITHWUG]->val1 * 10 * party_calc_chorusbonus(sd,1));
+					ATK_ADDRATE(wd.damage, wd.damage2, sc_data(sc, SC_DANCEWITHWUG)->val1 * 10 * party_calc_chorusbonus(sd,1));
+					RE_ALLATK_ADDRATE(wd, sc_data(sc, SC_DANCEWITHWUG)->val1 * 10 * party_calc_chorusbonus(sd,1));
 				}
-				ATK_ADDRATE(wd.damage, wd.damage2, sc->data[SC_DANCEWITHWUG]->val1 * 2 * party_calc_chorusbonus(sd,1));
+				ATK_ADDRATE(wd.damage, wd.damage2, sc_data(sc, SC_DANCEWITHWUG)->val1 * 2 * party_calc_chorusbonus(sd,1));
 #ifdef RENEWAL
-				ATK_ADDRATE(wd.equipAtk, wd.equipAtk2, sc->data[SC_DANCEWITHWUG]->val1 * 2 * party_calc_chorusbonus(sd,1));
+				ATK_ADDRATE(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_DANCEWITHWUG)->val1 * 2 * party_calc_chorusbonus(sd,1));
 #endif
 			}
-			if(sc->data[SC_SATURDAYNIGHTFEVER]) {
-				ATK_ADD(wd.damage, wd.damage2, 100 * sc->data[SC_SATURDAYNIGHTFEVER]->val1);
+			if(sc_data(sc, SC_SATURDAYNIGHTFEVER)) {
+				ATK_ADD(wd.damage, wd.damage2, 100 * sc_data(sc, SC_SATURDAYNIGHTFEVER)->val1);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, 100 * sc->data[SC_SATURDAYNIGHTFEVER]->val1);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, 100 * sc_data(sc, SC_SATURDAYNIGHTFEVER)->val1);
 #endif
 			}
-			if(sc->data[SC_ZENKAI] && sstatus->rhw.ele == sc->data[SC_ZENKAI]->val2) {
+			if(sc_data(sc, SC_ZENKAI) && sstatus->rhw.ele == sc_data(sc, SC_ZENKAI)->val2) {
 				ATK_ADD(wd.damage, wd.damage2, 200);
 #ifdef RENEWAL
 				ATK_ADD(wd.equipAtk, wd.equipAtk2, 200);
 #endif
 			}
-			if(sc->data[SC_STYLE_CHANGE]) {
+			if(sc_data(sc, SC_STYLE_CHANGE)) {
 				TBL_HOM *hd = BL_CAST(BL_HOM, src);
 
 				if(hd) {
@@ -4296,37 +4425,37 @@ struct Damage battle_attack_sc_bonus(struct Damage wd, struct block_list *src, s
 					RE_ALLATK_ADD(wd, hd->homunculus.spiritball * 3);
 				}
 			}
-			if(sc->data[SC_EQC]) {
-				ATK_ADDRATE(wd.damage, wd.damage2, -sc->data[SC_EQC]->val3);
+			if(sc_data(sc, SC_EQC)) {
+				ATK_ADDRATE(wd.damage, wd.damage2, -sc_data(sc, SC_EQC)->val3);
 #ifdef RENEWAL
-				ATK_ADDRATE(wd.equipAtk, wd.equipAtk2, -sc->data[SC_EQC]->val3);
+				ATK_ADDRATE(wd.equipAtk, wd.equipAtk2, -sc_data(sc, SC_EQC)->val3);
 #endif
 			}
-			if(sc->data[SC_UNLIMIT] && (wd.flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON)) {
+			if(sc_data(sc, SC_UNLIMIT) && (wd.flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON)) {
 				switch(skill_id) {
 					case RA_WUGDASH:
 					case RA_WUGSTRIKE:
 					case RA_WUGBITE:
 						break;
 					default:
-						ATK_ADDRATE(wd.damage, wd.damage2, sc->data[SC_UNLIMIT]->val2);
-						RE_ALLATK_ADDRATE(wd, sc->data[SC_UNLIMIT]->val2);
+						ATK_ADDRATE(wd.damage, wd.damage2, sc_data(sc, SC_UNLIMIT)->val2);
+						RE_ALLATK_ADDRATE(wd, sc_data(sc, SC_UNLIMIT)->val2);
 						break;
 				}
 			}
-			if(sc->data[SC_FLASHCOMBO]) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_FLASHCOMBO]->val2);
+			if(sc_data(sc, SC_FLASHCOMBO)) {
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_FLASHCOMBO)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc->data[SC_FLASHCOMBO]->val2);
+				ATK_ADD(wd.equipAtk, wd.equipAtk2, sc_data(sc, SC_FLASHCOMBO)->val2);
 #endif
 			}
-		} else if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_CRUSADER) {
+		} else if(sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_CRUSADER) {
 			ATK_ADDRATE(wd.damage, wd.damage2, 100);
 			RE_ALLATK_ADDRATE(wd, 100);
 		}
-		if(sc->data[SC_GLOOMYDAY_SK] && (inf3&INF3_SC_GLOOMYDAY_SK)) {
-			ATK_ADDRATE(wd.damage, wd.damage2, sc->data[SC_GLOOMYDAY_SK]->val2);
-			RE_ALLATK_ADDRATE(wd, sc->data[SC_GLOOMYDAY_SK]->val2);
+		if(sc_data(sc, SC_GLOOMYDAY_SK) && (inf3&INF3_SC_GLOOMYDAY_SK)) {
+			ATK_ADDRATE(wd.damage, wd.damage2, sc_data(sc, SC_GLOOMYDAY_SK)->val2);
+			RE_ALLATK_ADDRATE(wd, sc_data(sc, SC_GLOOMYDAY_SK)->val2);
 		}
 	}
 
@@ -4374,8 +4503,8 @@ static short battle_get_defense(struct block_list *src, struct block_list *targe
 #endif
 		}
 	}
-	if(sc && sc->data[SC_EXPIATIO]) {
-		short i = 5 * sc->data[SC_EXPIATIO]->val1; //5% per level
+	if(sc && sc_data(sc, SC_EXPIATIO)) {
+		short i = 5 * sc_data(sc, SC_EXPIATIO)->val1; //5% per level
 
 		i = min(i, 100);
 		def1 = (def1 * (100 - i)) / 100;
@@ -4389,11 +4518,11 @@ static short battle_get_defense(struct block_list *src, struct block_list *targe
 		target_count = unit_counttargeted(target);
 		if(target_count >= battle_config.vit_penalty_count) {
 			if(battle_config.vit_penalty_type == 1) {
-				if(!tsc || !tsc->data[SC_STEELBODY])
+				if(!tsc || !sc_data(tsc, SC_STEELBODY))
 					def1 = (def1 * (100 - (target_count - (battle_config.vit_penalty_count - 1)) * battle_config.vit_penalty_num)) / 100;
 				def2 = (def2 * (100 - (target_count - (battle_config.vit_penalty_count - 1)) * battle_config.vit_penalty_num)) / 100;
 			} else { //Assume type 2
-				if(!tsc || !tsc->data[SC_STEELBODY])
+				if(!tsc || !sc_data(tsc, SC_STEELBODY))
 					def1 -= (target_count - (battle_config.vit_penalty_count - 1)) * battle_config.vit_penalty_num;
 				def2 -= (target_count - (battle_config.vit_penalty_count - 1)) * battle_config.vit_penalty_num;
 			}
@@ -4427,9 +4556,9 @@ static short battle_get_defense(struct block_list *src, struct block_list *targe
 		if(src->type == BL_MOB && (skill = pc_checkskill(tsd, NC_RESEARCHFE)) > 0 &&
 			(sstatus->def_ele == ELE_FIRE || sstatus->def_ele == ELE_EARTH))
 			vit_def += skill * 10;
-		if(src->type == BL_MOB && tsc && tsc->count && tsc->data[SC_P_ALTER] && //If the Platinum Alter is activated
+		if(src->type == BL_MOB && tsc && tsc->count && sc_data(tsc, SC_P_ALTER) && //If the Platinum Alter is activated
 			(battle_check_undead(sstatus->race, sstatus->def_ele) || sstatus->race == RC_UNDEAD)) //Undead attacker
-			vit_def += tsc->data[SC_P_ALTER]->val3;
+			vit_def += sc_data(tsc, SC_P_ALTER)->val3;
 	} else { //Mob-Pet vit-eq
 #ifndef RENEWAL
 		//VIT + rnd(0, [VIT / 20] ^ 2 - 1)
@@ -4528,18 +4657,18 @@ struct Damage battle_calc_attack_post_defense(struct Damage wd, struct block_lis
 	//Post skill/vit reduction damage increases
 	if(sc) { //Status change skill damages
 #ifdef RENEWAL
-		if(sc->data[SC_WATK_ELEMENT])
-			ATK_ADDRATE(wd.damage, wd.damage2, sc->data[SC_WATK_ELEMENT]->val2);
-		if(sc->data[SC_AURABLADE]) {
-			uint16 lv = sc->data[SC_AURABLADE]->val1;
+		if(sc_data(sc, SC_WATK_ELEMENT))
+			ATK_ADDRATE(wd.damage, wd.damage2, sc_data(sc, SC_WATK_ELEMENT)->val2);
+		if(sc_data(sc, SC_AURABLADE)) {
+			uint16 lv = sc_data(sc, SC_AURABLADE)->val1;
 
 			lv *= (skill_id == LK_SPIRALPIERCE || skill_id == ML_SPIRALPIERCE ? wd.div_ : 1); //+100 per hit in lv 5
 			ATK_ADD(wd.damage, wd.damage2, 20 * lv);
 		}
 #endif
-		if(sc->data[SC_NIBELUNGEN]) {
+		if(sc_data(sc, SC_NIBELUNGEN)) {
 			if(target->type != BL_PC) {
-				ATK_ADD(wd.damage, wd.damage2, sc->data[SC_NIBELUNGEN]->val2);
+				ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_NIBELUNGEN)->val2);
 			} else if(sd) {
 				short index = sd->equip_index[(sd->state.lr_flag ? EQI_HAND_L : EQI_HAND_R)];
 
@@ -4550,20 +4679,20 @@ struct Damage battle_calc_attack_post_defense(struct Damage wd, struct block_lis
 					&& sd->inventory_data[index]->wlv == 4
 #endif
 					)
-					ATK_ADD(wd.damage, wd.damage2, sc->data[SC_NIBELUNGEN]->val2);
+					ATK_ADD(wd.damage, wd.damage2, sc_data(sc, SC_NIBELUNGEN)->val2);
 			}
 		}
 		if(!skill_id) {
-			if(sc->data[SC_ENCHANTBLADE]) {
+			if(sc_data(sc, SC_ENCHANTBLADE)) {
 				//[((Skill Lv x 20) + 100) x (casterBaseLevel / 150)] + casterInt
-				int64 i = (sc->data[SC_ENCHANTBLADE]->val1 * 20 + 100) * status_get_lv(src) / 150 + status_get_int(src);
+				int64 i = (sc_data(sc, SC_ENCHANTBLADE)->val1 * 20 + 100) * status_get_lv(src) / 150 + status_get_int(src);
 				short totalmdef = tstatus->mdef + tstatus->mdef2;
 
 				i = i - totalmdef + status_get_matk(src, 2);
 				if(i)
 					ATK_ADD(wd.damage, wd.damage2, i);
 			}
-			if(sc->data[SC_GIANTGROWTH] && rnd()%100 < sc->data[SC_GIANTGROWTH]->val2)
+			if(sc_data(sc, SC_GIANTGROWTH) && rnd()%100 < sc_data(sc, SC_GIANTGROWTH)->val2)
 				ATK_ADDRATE(wd.damage, wd.damage2, 200); //Triple Damage
 		}
 	}
@@ -4629,7 +4758,7 @@ struct Damage battle_calc_attack_plant(struct Damage wd, struct block_list *src,
 		wd.dmg_lv = ATK_FLEE;
 	}
 #endif
-	if(sc && sc->data[SC_CAMOUFLAGE] && !skill_id)
+	if(sc && sc_data(sc, SC_CAMOUFLAGE) && !skill_id)
 		status_change_end(src, SC_CAMOUFLAGE, INVALID_TIMER);
 
 	return wd;
@@ -4702,8 +4831,8 @@ struct block_list *battle_check_devotion(struct block_list *bl) {
 	if(battle_config.devotion_rdamage && battle_config.devotion_rdamage > rnd()%100) {
 		struct status_change *sc = status_get_sc(bl);
 
-		if(sc && sc->data[SC_DEVOTION])
-			d_bl = map_id2bl(sc->data[SC_DEVOTION]->val1);
+		if(sc && sc_data(sc, SC_DEVOTION))
+			d_bl = map_id2bl(sc_data(sc, SC_DEVOTION)->val1);
 	}
 	return d_bl;
 }
@@ -4789,33 +4918,33 @@ struct Damage battle_calc_weapon_final_atk_modifiers(struct Damage wd, struct bl
 #endif
 
 	//Reject Sword bugreport:4493 by Daegaladh
-	if(wd.damage && tsc && tsc->data[SC_REJECTSWORD] &&
+	if(wd.damage && tsc && sc_data(tsc, SC_REJECTSWORD) &&
 		(src->type != BL_PC ||
 		(((TBL_PC *)src)->weapontype1 == W_DAGGER ||
 		((TBL_PC *)src)->weapontype1 == W_1HSWORD ||
 		((TBL_PC *)src)->status.weapon == W_2HSWORD)) &&
-		rnd()%100 < tsc->data[SC_REJECTSWORD]->val2)
+		rnd()%100 < sc_data(tsc, SC_REJECTSWORD)->val2)
 	{
 		ATK_RATER(wd.damage,50);
 		status_fix_damage(target,src,wd.damage,clif_damage(target,src,gettick(),0,0,wd.damage,0,DMG_NORMAL,0));
-		clif_skill_nodamage(target,target,ST_REJECTSWORD,tsc->data[SC_REJECTSWORD]->val1,1);
-		if(--(tsc->data[SC_REJECTSWORD]->val3) <= 0)
+		clif_skill_nodamage(target,target,ST_REJECTSWORD,sc_data(tsc, SC_REJECTSWORD)->val1,1);
+		if(--(sc_data(tsc, SC_REJECTSWORD)->val3) <= 0)
 			status_change_end(target,SC_REJECTSWORD,INVALID_TIMER);
 	}
 
-	if(tsc && tsc->data[SC_CRESCENTELBOW] && !is_boss(src) && wd.flag&BF_SHORT &&
-		rnd()%100 < tsc->data[SC_CRESCENTELBOW]->val2) {
+	if(tsc && sc_data(tsc, SC_CRESCENTELBOW) && !is_boss(src) && wd.flag&BF_SHORT &&
+		rnd()%100 < sc_data(tsc, SC_CRESCENTELBOW)->val2) {
 		//ATK [{(Target's HP / 100) x Skill Level} x Caster's Base Level / 125] % + [Received damage x {1 + (Skill Level x 0.2)}]
 		int64 rdamage = 0;
-		int ratio = (status_get_hp(src) / 100) * tsc->data[SC_CRESCENTELBOW]->val1 * status_get_lv(target) / 125;
+		int ratio = (status_get_hp(src) / 100) * sc_data(tsc, SC_CRESCENTELBOW)->val1 * status_get_lv(target) / 125;
 
 		if(ratio > 5000)
 			ratio = 5000; //Maximum of 5000% ATK
 		rdamage = battle_calc_base_damage(target,tstatus,&tstatus->rhw,tsc,sstatus->size,tsd,skill_id,0);
-		rdamage = rdamage * ratio / 100 + wd.damage * (10 + tsc->data[SC_CRESCENTELBOW]->val1 * 20 / 10) / 10;
-		skill_blown(target,src,skill_get_blewcount(SR_CRESCENTELBOW_AUTOSPELL,tsc->data[SC_CRESCENTELBOW]->val1),unit_getdir(src),0);
+		rdamage = rdamage * ratio / 100 + wd.damage * (10 + sc_data(tsc, SC_CRESCENTELBOW)->val1 * 20 / 10) / 10;
+		skill_blown(target,src,skill_get_blewcount(SR_CRESCENTELBOW_AUTOSPELL,sc_data(tsc, SC_CRESCENTELBOW)->val1),unit_getdir(src),0);
 		clif_skill_damage(target,src,gettick(),status_get_amotion(src),0,rdamage,
-			1,SR_CRESCENTELBOW_AUTOSPELL,tsc->data[SC_CRESCENTELBOW]->val1,DMG_SKILL); //This is how official does
+			1,SR_CRESCENTELBOW_AUTOSPELL,sc_data(tsc, SC_CRESCENTELBOW)->val1,DMG_SKILL); //This is how official does
 		clif_damage(src,target,gettick(),status_get_amotion(src) + 1000,0,rdamage / 10,1,DMG_NORMAL,0);
 		status_damage(target,src,rdamage,0,0,0);
 		status_damage(src,target,rdamage / 10,0,0,1);
@@ -4823,7 +4952,7 @@ struct Damage battle_calc_weapon_final_atk_modifiers(struct Damage wd, struct bl
 	}
 
 	if(sc) {
-		if(sc->data[SC_FUSION]) { //SC_FUSION hp penalty [Komurka]
+		if(sc_data(sc, SC_FUSION)) { //SC_FUSION hp penalty [Komurka]
 			int hp = sstatus->max_hp;
 
 			if(sd && tsd) {
@@ -4834,7 +4963,7 @@ struct Damage battle_calc_weapon_final_atk_modifiers(struct Damage wd, struct bl
 				hp = 2 * hp / 100; //2% hp loss per hit
 			status_zap(src,hp,0);
 		}
-		if(sc->data[SC_CAMOUFLAGE] && !skill_id)
+		if(sc_data(sc, SC_CAMOUFLAGE) && !skill_id)
 			status_change_end(src,SC_CAMOUFLAGE,INVALID_TIMER);
 	}
 
@@ -4857,7 +4986,7 @@ struct Damage battle_calc_weapon_final_atk_modifiers(struct Damage wd, struct bl
 
 	//Skill damage adjustment
 #ifdef ADJUST_SKILL_DAMAGE
-	if((skill_damage = battle_skill_damage(src,target,skill_id)) != 0)
+	if((skill_damage = battle_src_skill_damage(battle_get_src_context(src, skill_id, skill_lv), src, target)) != 0)
 		ATK_ADDRATE(wd.damage,wd.damage2,skill_damage);
 #endif
 	return wd;
@@ -4876,17 +5005,18 @@ static struct Damage initialize_weapon_data(struct block_list *src, struct block
 	struct status_data *sstatus = status_get_status_data(src);
 	struct status_data *tstatus = status_get_status_data(target);
 	struct map_session_data *sd = BL_CAST(BL_PC, src);
+	struct battle_src_context *ctx = (skill_id ? battle_get_src_context(src, skill_id, skill_lv) : NULL);
 	struct Damage wd;
 
 	wd.type = DMG_NORMAL; //Normal attack
-	wd.div_ = (skill_id ? skill_get_num(skill_id,skill_lv) : 1);
+	wd.div_ = (ctx ? ctx->div_ : 1);
 	//Amotion should be 0 for ground skills
-	wd.amotion = (skill_id && skill_get_inf(skill_id)&INF_GROUND_SKILL) ? 0 : sstatus->amotion;
+	wd.amotion = (ctx && ctx->inf&INF_GROUND_SKILL) ? 0 : sstatus->amotion;
 	//Counter attack DOES obey ASPD delay on official, uncomment if you want the old (bad) behavior [helvetica]
 	//if(skill_id == KN_AUTOCOUNTER)
 		//wd.amotion >>= 1;
 	wd.dmotion = tstatus->dmotion;
-	wd.blewcount = skill_get_blewcount(skill_id,skill_lv);
+	wd.blewcount = (ctx ? ctx->blewcount : skill_get_blewcount(skill_id,skill_lv));
 	wd.miscflag = wflag;
 	wd.flag = BF_WEAPON; //Initial Flag
 	//Baphomet card's splash damage is counted as a skill [Inkfish]
@@ -4900,7 +5030,7 @@ static struct Damage initialize_weapon_data(struct block_list *src, struct block
 
 	wd.dmg_lv = ATK_DEF; //This assumption simplifies the assignation later
 
-	if(sd)
+	if(sd && !ctx)
 		wd.blewcount += battle_blewcount_bonus(sd,skill_id);
 
 	if(skill_id) {
@@ -4953,8 +5083,8 @@ static struct Damage initialize_weapon_data(struct block_list *src, struct block
 			case LG_HESPERUSLIT: {
 					struct status_change *sc = status_get_sc(src);
 
-					if(sc && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 3)
-						wd.div_ = sc->data[SC_BANDING]->val2;
+					if(sc && sc_data(sc, SC_BANDING) && sc_data(sc, SC_BANDING)->val2 > 3)
+						wd.div_ = sc_data(sc, SC_BANDING)->val2;
 				}
 				break;
 
@@ -4999,7 +5129,7 @@ void battle_do_reflect(int attack_type, struct Damage *wd, struct block_list *sr
 			struct block_list *d_bl = battle_check_devotion(src);
 
 			if(attack_type == BF_WEAPON || attack_type == BF_MISC) {
-				if(tsc->data[SC_REFLECTDAMAGE])
+				if(sc_data(tsc, SC_REFLECTDAMAGE))
 					map_foreachinshootrange(battle_damage_area, target, skill_get_splash(LG_REFLECTDAMAGE, 1), BL_CHAR, tick, target, wd->amotion, sstatus->dmotion, rdamage, tstatus->race);
 				else {
 					rdelay = clif_damage(src, (!d_bl) ? src : d_bl, tick, wd->amotion, sstatus->dmotion, rdamage, 1, DMG_ENDURE, 0);
@@ -5130,7 +5260,7 @@ struct Damage battle_calc_weapon_attack(struct block_list *src, struct block_lis
 		ATK_ADD(wd.damage, wd.damage2, const_val);
 
 		if(sd) {
-			int i;
+			int i, skillatk, adjust;
 			uint16 skill;
 
 			switch(skill_id) {
@@ -5167,13 +5297,15 @@ struct Damage battle_calc_weapon_attack(struct block_list *src, struct block_lis
 					break;
 			}
 
+			battle_src_skill_bonus(battle_get_src_context(src, skill_id, skill_lv), sd, skill, &skillatk, &adjust);
+
 			//Add any miscellaneous player skill ATK rate bonuses
-			if((i = pc_skillatk_bonus(sd, skill))) {
+			if((i = skillatk)) {
 				ATK_ADDRATE(wd.damage, wd.damage2, i);
 				RE_ALLATK_ADDRATE(wd, i);
 			}
 
-			if((i = battle_adjust_skill_damage(src->m, skill))) {
+			if((i = adjust)) {
 				ATK_RATE(wd.damage, wd.damage2, i);
 				RE_ALLATK_RATE(wd, i);
 			}
@@ -5194,7 +5326,7 @@ struct Damage battle_calc_weapon_attack(struct block_list *src, struct block_lis
 				struct status_data *sstatus = status_get_status_data(src);
 
 				ATK_ADD(wd.damage, wd.damage2, sstatus->max_hp - status_get_hp(src));
-				if(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE) {
+				if(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == SR_FALLENEMPIRE) {
 					ATK_ADD(wd.damage, wd.damage2, (sstatus->max_sp * (1 + skill_lv * 2 / 10)) + 40 * status_get_lv(src));
 				} else
 					ATK_ADD(wd.damage, wd.damage2, (sstatus->sp * (1 + skill_lv * 2 / 10)) + 10 * status_get_lv(src));
@@ -5258,8 +5390,8 @@ struct Damage battle_calc_weapon_attack(struct block_list *src, struct block_lis
 		wd = battle_calc_element_damage(wd, src, target, skill_id, skill_lv);
 
 #ifndef RENEWAL
-	if(sc && sc->data[SC_AURABLADE] && wd.dmg_lv != ATK_FLEE && skill_id != LK_SPIRALPIERCE && skill_id != ML_SPIRALPIERCE)
-		ATK_ADD(wd.damage, wd.damage2, 20 * sc->data[SC_AURABLADE]->val1);
+	if(sc && sc_data(sc, SC_AURABLADE) && wd.dmg_lv != ATK_FLEE && skill_id != LK_SPIRALPIERCE && skill_id != ML_SPIRALPIERCE)
+		ATK_ADD(wd.damage, wd.damage2, 20 * sc_data(sc, SC_AURABLADE)->val1);
 #endif
 
 	if(skill_id == CR_GRANDCROSS || skill_id == NPC_GRANDDARKNESS)
@@ -5411,7 +5543,7 @@ struct Damage battle_calc_weapon_attack(struct block_list *src, struct block_lis
 
 	wd = battle_calc_weapon_final_atk_modifiers(wd, src, target, skill_id, skill_lv);
 
-	if(!skill_id && sc && (sc->data[SC_CRUSHSTRIKE] || sc->data[SC_EXEEDBREAK] || sc->data[SC_SPELLFIST]))
+	if(!skill_id && sc && (sc_data(sc, SC_CRUSHSTRIKE) || sc_data(sc, SC_EXEEDBREAK) || sc_data(sc, SC_SPELLFIST)))
 		return wd; //Reflected later
 	else //Skill reflect gets calculated after all attack modifier
 		battle_do_reflect(BF_WEAPON, &wd, src, target, skill_id, skill_lv); //WIP [lighta]
@@ -5438,6 +5570,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 	struct status_change *sc, *tsc;
 	struct Damage ad;
 	struct status_data *sstatus, *tstatus;
+	struct battle_src_context *ctx;
 	struct {
 		unsigned imdef : 1;
 		unsigned infdef : 1;
@@ -5453,18 +5586,19 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 
 	sstatus = status_get_status_data(src);
 	tstatus = status_get_status_data(target);
+	ctx = battle_get_src_context(src, skill_id, skill_lv);
 
 	//Initial Values
 	ad.damage = 1;
-	ad.div_ = skill_get_num(skill_id, skill_lv);
+	ad.div_ = ctx->div_;
 	//Amotion should be 0 for ground skills.
-	ad.amotion = (skill_get_inf(skill_id)&INF_GROUND_SKILL ? 0 : sstatus->amotion);
+	ad.amotion = (ctx->inf&INF_GROUND_SKILL ? 0 : sstatus->amotion);
 	ad.dmotion = tstatus->dmotion;
-	ad.blewcount = skill_get_blewcount(skill_id, skill_lv);
+	ad.blewcount = ctx->blewcount;
 	ad.miscflag = mflag;
 	ad.flag = BF_MAGIC|BF_SKILL;
 	ad.dmg_lv = ATK_DEF;
-	nk = skill_get_nk(skill_id);
+	nk = ctx->nk;
 	flag.imdef = (nk&NK_IGNORE_DEF ? 1 : 0);
 
 	sd = BL_CAST(BL_PC, src);
@@ -5495,14 +5629,14 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 			break;
 		case SO_PSYCHIC_WAVE:
 			if(sc && sc->count) {
-				if (sc->data[SC_HEATER_OPTION])
-					s_ele = sc->data[SC_HEATER_OPTION]->val4;
-				else if (sc->data[SC_COOLER_OPTION])
-					s_ele = sc->data[SC_COOLER_OPTION]->val4;
-				else if (sc->data[SC_BLAST_OPTION])
-					s_ele = sc->data[SC_BLAST_OPTION]->val3;
-				else if (sc->data[SC_CURSED_SOIL_OPTION])
-					s_ele = sc->data[SC_CURSED_SOIL_OPTION]->val4;
+				if (sc_data(sc, SC_HEATER_OPTION))
+					s_ele = sc_data(sc, SC_HEATER_OPTION)->val4;
+				else if (sc_data(sc, SC_COOLER_OPTION))
+					s_ele = sc_data(sc, SC_COOLER_OPTION)->val4;
+				else if (sc_data(sc, SC_BLAST_OPTION))
+					s_ele = sc_data(sc, SC_BLAST_OPTION)->val3;
+				else if (sc_data(sc, SC_CURSED_SOIL_OPTION))
+					s_ele = sc_data(sc, SC_CURSED_SOIL_OPTION)->val4;
 			}
 			break;
 		case KO_KAIHOU:
@@ -5512,10 +5646,8 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 	}
 
 	//Set miscellaneous data that needs be filled
-	if(sd) {
+	if(sd)
 		sd->state.arrow_atk = 0;
-		ad.blewcount += battle_blewcount_bonus(sd, skill_id);
-	}
 
 	//Skill Range Criteria
 	ad.flag |= battle_range_type(src, target, skill_id, skill_lv);
@@ -5613,7 +5745,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 				switch(skill_id) {
 					case MG_NAPALMBEAT:
 						skillratio += -30 + 10 * skill_lv;
-						if(tsc && tsc->data[SC_WHITEIMPRISON])
+						if(tsc && sc_data(tsc, SC_WHITEIMPRISON))
 							skillratio *= 2;
 						break;
 					case MG_FIREBALL:
@@ -5628,7 +5760,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case MG_SOULSTRIKE:
 						if(battle_check_undead(tstatus->race,tstatus->def_ele))
 							skillratio += 5 * skill_lv;
-						if(tsc && tsc->data[SC_WHITEIMPRISON])
+						if(tsc && sc_data(tsc, SC_WHITEIMPRISON))
 							skillratio *= 2;
 						break;
 					case MG_FIREWALL:
@@ -5637,9 +5769,9 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case MG_FIREBOLT:
 					case MG_COLDBOLT:
 					case MG_LIGHTNINGBOLT:
-						if(sc && sc->data[SC_SPELLFIST] && ad.miscflag&BF_SHORT) {
+						if(sc && sc_data(sc, SC_SPELLFIST) && ad.miscflag&BF_SHORT) {
 							//val1 = used spellfist level, val4 = used bolt level [Rytech]
-							skillratio += -100 + (sc->data[SC_SPELLFIST]->val1 * 50) + (sc->data[SC_SPELLFIST]->val4 * 100);
+							skillratio += -100 + (sc_data(sc, SC_SPELLFIST)->val1 * 50) + (sc_data(sc, SC_SPELLFIST)->val4 * 100);
 							ad.div_ = 1; //ad mods, to make it work similar to regular hits [Xazax]
 							ad.flag = BF_SHORT|BF_WEAPON;
 							ad.type = DMG_NORMAL;
@@ -5656,7 +5788,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						break;
 					case AL_HOLYLIGHT:
 						skillratio += 25;
-						if(sd && sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_PRIEST)
+						if(sd && sc_data(&sd->sc, SC_SPIRIT) && sc_data(&sd->sc, SC_SPIRIT)->val2 == SL_PRIEST)
 							skillratio *= 5; //Does 5x damage include bonuses from other skills?
 						break;
 					case AL_RUWACH:
@@ -5682,7 +5814,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						break;
 					case HW_NAPALMVULCAN:
 						skillratio += 25;
-						if(tsc && tsc->data[SC_WHITEIMPRISON])
+						if(tsc && sc_data(tsc, SC_WHITEIMPRISON))
 							skillratio *= 2;
 						break;
 					case SL_STIN: //Target size must be small (0) for full damage
@@ -5781,7 +5913,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case WL_SOULEXPANSION:
 						skillratio += -100 + (skill_lv + 4) * 100 + sstatus->int_;
 						RE_LVL_DMOD(100);
-						if(tsc && tsc->data[SC_WHITEIMPRISON])
+						if(tsc && sc_data(tsc, SC_WHITEIMPRISON))
 							skillratio *= 2;
 						break;
 					case WL_FROSTMISTY:
@@ -5789,7 +5921,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						RE_LVL_DMOD(100);
 						break;
 					case WL_JACKFROST:
-						if(tsc && tsc->data[SC_FREEZING]) {
+						if(tsc && sc_data(tsc, SC_FREEZING)) {
 							skillratio += 900 + 300 * skill_lv;
 							RE_LVL_DMOD(100);
 						} else {
@@ -5868,10 +6000,10 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						break;
 					case LG_RAYOFGENESIS:
 						if(sc) {
-							if(sc->data[SC_INSPIRATION])
+							if(sc_data(sc, SC_INSPIRATION))
 								skillratio += 1400;
-							if(sc->data[SC_BANDING])
-								skillratio += -100 + 300 * skill_lv + 200 * sc->data[SC_BANDING]->val2;
+							if(sc_data(sc, SC_BANDING))
+								skillratio += -100 + 300 * skill_lv + 200 * sc_data(sc, SC_BANDING)->val2;
 							RE_LVL_DMOD(25);
 						}
 						break;
@@ -5884,7 +6016,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case WM_METALICSOUND:
 						skillratio += -100 + 120 * skill_lv + 60 * (sd ? pc_checkskill(sd,WM_LESSON) : 1);
 						RE_LVL_DMOD(100);
-						if(tsc && (tsc->data[SC_SLEEP] || tsc->data[SC_DEEPSLEEP]))
+						if(tsc && (sc_data(tsc, SC_SLEEP) || sc_data(tsc, SC_DEEPSLEEP)))
 							skillratio += skillratio / 2;
 						break;
 					case WM_REVERBERATION_MAGIC:
@@ -5895,52 +6027,52 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case SO_FIREWALK:
 						skillratio += -100 + 60 * skill_lv;
 						RE_LVL_DMOD(100);
-						if(sc && sc->data[SC_HEATER_OPTION])
-							skillratio += sc->data[SC_HEATER_OPTION]->val3 / 2;
+						if(sc && sc_data(sc, SC_HEATER_OPTION))
+							skillratio += sc_data(sc, SC_HEATER_OPTION)->val3 / 2;
 						break;
 					case SO_ELECTRICWALK:
 						skillratio += -100 + 60 * skill_lv;
 						RE_LVL_DMOD(100);
-						if(sc && sc->data[SC_BLAST_OPTION])
-							skillratio += sc->data[SC_BLAST_OPTION]->val2 / 2;
+						if(sc && sc_data(sc, SC_BLAST_OPTION))
+							skillratio += sc_data(sc, SC_BLAST_OPTION)->val2 / 2;
 						break;
 					case SO_EARTHGRAVE:
 						skillratio += -100 + sstatus->int_ * skill_lv + (sd ? pc_checkskill(sd, SA_SEISMICWEAPON) * 200 : 0);
 						RE_LVL_DMOD(100);
-						if(sc && sc->data[SC_CURSED_SOIL_OPTION])
-							skillratio += sc->data[SC_CURSED_SOIL_OPTION]->val3 * 5;
+						if(sc && sc_data(sc, SC_CURSED_SOIL_OPTION))
+							skillratio += sc_data(sc, SC_CURSED_SOIL_OPTION)->val3 * 5;
 						break;
 					case SO_DIAMONDDUST:
 						skillratio += -100 + sstatus->int_ * skill_lv + (sd ? pc_checkskill(sd, SA_FROSTWEAPON) * 200 : 0);
 						RE_LVL_DMOD(100);
-						if(sc && sc->data[SC_COOLER_OPTION])
-							skillratio += sc->data[SC_COOLER_OPTION]->val3 * 5;
+						if(sc && sc_data(sc, SC_COOLER_OPTION))
+							skillratio += sc_data(sc, SC_COOLER_OPTION)->val3 * 5;
 						break;
 					case SO_POISON_BUSTER:
 						skillratio += 900 + 300 * skill_lv;
 						RE_LVL_DMOD(120);
-						if(sc && sc->data[SC_CURSED_SOIL_OPTION])
-							skillratio += sc->data[SC_CURSED_SOIL_OPTION]->val3 * 5;
+						if(sc && sc_data(sc, SC_CURSED_SOIL_OPTION))
+							skillratio += sc_data(sc, SC_CURSED_SOIL_OPTION)->val3 * 5;
 						break;
 					case SO_PSYCHIC_WAVE:
 						skillratio += -100 + 70 * skill_lv + 3 * sstatus->int_;
 						RE_LVL_DMOD(100);
-						if(sc && (sc->data[SC_HEATER_OPTION] || sc->data[SC_COOLER_OPTION] ||
-							sc->data[SC_BLAST_OPTION] || sc->data[SC_CURSED_SOIL_OPTION]))
+						if(sc && (sc_data(sc, SC_HEATER_OPTION) || sc_data(sc, SC_COOLER_OPTION) ||
+							sc_data(sc, SC_BLAST_OPTION) || sc_data(sc, SC_CURSED_SOIL_OPTION)))
 							skillratio += 20;
 						break;
 					case SO_CLOUD_KILL:
 						skillratio += -100 + 40 * skill_lv;
 						RE_LVL_DMOD(100);
-						if(sc && sc->data[SC_CURSED_SOIL_OPTION])
-							skillratio += sc->data[SC_CURSED_SOIL_OPTION]->val3;
+						if(sc && sc_data(sc, SC_CURSED_SOIL_OPTION))
+							skillratio += sc_data(sc, SC_CURSED_SOIL_OPTION)->val3;
 						break;
 					case SO_VARETYR_SPEAR:
 						//MATK [{( Endow Tornado skill level x 50 ) + ( Caster's INT x Varetyr Spear Skill level )} x Caster's Base Level / 100 ] %
 						skillratio += -100 + status_get_int(src) * skill_lv + (sd ? pc_checkskill(sd, SA_LIGHTNINGLOADER) * 50 : 0);
 						RE_LVL_DMOD(100);
-						if(sc && sc->data[SC_BLAST_OPTION])
-							skillratio += sc->data[SC_BLAST_OPTION]->val2 * 5;
+						if(sc && sc_data(sc, SC_BLAST_OPTION))
+							skillratio += sc_data(sc, SC_BLAST_OPTION)->val2 * 5;
 						break;
 					case GN_DEMONIC_FIRE:
 						if(skill_lv > 20) //Fire Expansion Level 2
@@ -6018,6 +6150,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 #endif
 
 		if(sd) {
+			int skillatk, adjust;
 			uint16 skill;
 
 			switch(skill_id) {
@@ -6047,11 +6180,13 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					break;
 			}
 
+			battle_src_skill_bonus(battle_get_src_context(src, skill_id, skill_lv), sd, skill, &skillatk, &adjust);
+
 			//Damage rate bonuses
-			if((i = pc_skillatk_bonus(sd, skill)))
+			if((i = skillatk))
 				ad.damage += ad.damage * i / 100;
 
-			if((i = battle_adjust_skill_damage(src->m, skill)))
+			if((i = adjust))
 				MATK_RATE(i);
 
 			//Ignore Magic Defense?
@@ -6108,22 +6243,22 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 			switch(skill_id) {
 				case MG_LIGHTNINGBOLT:
 				case MG_THUNDERSTORM:
-					if(sc->data[SC_GUST_OPTION])
+					if(sc_data(sc, SC_GUST_OPTION))
 						ad.damage += (6 + sstatus->int_ / 4) + max(sstatus->dex - 10, 0) / 30;
 					break;
 				case MG_FIREBOLT:
 				case MG_FIREWALL:
-					if(sc->data[SC_PYROTECHNIC_OPTION])
+					if(sc_data(sc, SC_PYROTECHNIC_OPTION))
 						ad.damage += (6 + sstatus->int_ / 4) + max(sstatus->dex - 10, 0) / 30;
 					break;
 				case MG_COLDBOLT:
 				case MG_FROSTDIVER:
-					if(sc->data[SC_AQUAPLAY_OPTION])
+					if(sc_data(sc, SC_AQUAPLAY_OPTION))
 						ad.damage += (6 + sstatus->int_ / 4) + max(sstatus->dex - 10, 0) / 30;
 					break;
 				case WZ_EARTHSPIKE:
 				case WZ_HEAVENDRIVE:
-					if(sc->data[SC_PETROLOGY_OPTION])
+					if(sc_data(sc, SC_PETROLOGY_OPTION))
 						ad.damage += (6 + sstatus->int_ / 4) + max(sstatus->dex - 10, 0) / 30;
 					break;
 			}
@@ -6198,6 +6333,8 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 			return ad; //Do GVG fix later
 #endif
 		default:
+			if(battle_bench_dryrun)
+				break;
 			ad.damage = battle_calc_damage(src, target, &ad, ad.damage, skill_id, skill_lv);
 			if(map_flag_gvg2(target->m))
 				ad.damage = battle_calc_gvg_damage(src, target, ad.damage, skill_id, ad.flag);
@@ -6208,7 +6345,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 
 	//Skill damage adjustment
 #ifdef ADJUST_SKILL_DAMAGE
-	if((skill_damage = battle_skill_damage(src, target, skill_id)) != 0)
+	if((skill_damage = battle_src_skill_damage(battle_get_src_context(src, skill_id, skill_lv), src, target)) != 0)
 		MATK_ADDRATE(skill_damage);
 #endif
 
@@ -6237,6 +6374,7 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 	struct map_session_data *sd, *tsd;
 	struct Damage md; //DO NOT CONFUSE with md of mob_data!
 	struct status_data *sstatus, *tstatus;
+	struct battle_src_context *ctx;
 
 	memset(&md,0,sizeof(md));
 
@@ -6247,24 +6385,23 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 
 	sstatus = status_get_status_data(src);
 	tstatus = status_get_status_data(target);
+	ctx = battle_get_src_context(src, skill_id, skill_lv);
 
 	//Some initial values
-	md.amotion = (skill_get_inf(skill_id)&INF_GROUND_SKILL ? 0 : sstatus->amotion);
+	md.amotion = (ctx->inf&INF_GROUND_SKILL ? 0 : sstatus->amotion);
 	md.dmotion = tstatus->dmotion;
-	md.div_ = skill_get_num(skill_id,skill_lv);
-	md.blewcount = skill_get_blewcount(skill_id,skill_lv);
+	md.div_ = ctx->div_;
+	md.blewcount = ctx->blewcount;
 	md.miscflag = mflag;
 	md.flag = BF_MISC|BF_SKILL;
 	md.dmg_lv = ATK_DEF;
-	nk = skill_get_nk(skill_id);
+	nk = ctx->nk;
 
 	sd = BL_CAST(BL_PC,src);
 	tsd = BL_CAST(BL_PC,target);
 
-	if(sd) {
+	if(sd)
 		sd->state.arrow_atk = 0;
-		md.blewcount += battle_blewcount_bonus(sd,skill_id);
-	}
 
 	s_ele = skill_get_ele(skill_id,skill_lv);
 	//Attack that takes weapon's element for misc attacks? Make it neutral [Skotlex]
@@ -6479,7 +6616,7 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 
 				md.damage = sstatus->hp + atk.damage * sstatus->hp * skill_lv / sstatus->max_hp;
 				//Mirror Image bonus only occurs if active
-				if(sc && sc->data[SC_BUNSINJYUTSU] && (i = sc->data[SC_BUNSINJYUTSU]->val2) > 0) {
+				if(sc && sc_data(sc, SC_BUNSINJYUTSU) && (i = sc_data(sc, SC_BUNSINJYUTSU)->val2) > 0) {
 					md.div_ = -(i + 2); //Mirror image count + 2
 					md.damage += (md.damage * (((i + 1) * 10) / 5)) / 10;
 				}
@@ -6619,6 +6756,7 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 	}
 
 	if(sd) {
+		int skillatk, adjust;
 		uint16 skill;
 
 		switch(skill_id) {
@@ -6630,10 +6768,12 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 				break;
 		}
 
-		if((i = pc_skillatk_bonus(sd,skill)))
+		battle_src_skill_bonus(battle_get_src_context(src, skill_id, skill_lv), sd, skill, &skillatk, &adjust);
+
+		if((i = skillatk))
 			md.damage += md.damage * i / 100;
 
-		if((i = battle_adjust_skill_damage(src->m,skill)))
+		if((i = adjust))
 			md.damage = md.damage * i / 100;
 	}
 
@@ -6694,6 +6834,8 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 			break; //GVG fix already done
 #endif
 		default:
+			if(battle_bench_dryrun)
+				break;
 			md.damage = battle_calc_damage(src,target,&md,md.damage,skill_id,skill_lv);
 			if(map_flag_gvg2(target->m))
 				md.damage = battle_calc_gvg_damage(src,target,md.damage,skill_id,md.flag);
@@ -6704,7 +6846,7 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 
 	//Skill damage adjustment
 #ifdef ADJUST_SKILL_DAMAGE
-	if((skill_damage = battle_skill_damage(src,target,skill_id)) != 0)
+	if((skill_damage = battle_src_skill_damage(battle_get_src_context(src, skill_id, skill_lv), src, target)) != 0)
 		md.damage += (int64)md.damage * skill_damage / 100;
 #endif
 
@@ -6712,7 +6854,8 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 		md.damage = md.damage2 = 1;
 
 	//Skill reflect gets calculated after all attack modifier
-	battle_do_reflect(BF_MISC,&md,src,target,skill_id,skill_lv); //WIP [lighta]
+	if(!battle_bench_dryrun)
+		battle_do_reflect(BF_MISC,&md,src,target,skill_id,skill_lv); //WIP [lighta]
 
 	return md;
 }
@@ -6786,11 +6929,11 @@ int64 battle_calc_return_damage(struct block_list *bl, struct block_list *src, i
 		} else if( status_reflect && sc && sc->count && !(skill_get_nk(skill_id)&NK_NO_CARDFIX_ATK) ) {
 			struct status_change_entry *sce;
 
-			if( (sce = sc->data[SC_REFLECTSHIELD]) ) {
+			if( (sce = sc_data(sc, SC_REFLECTSHIELD)) ) {
 				struct status_change_entry *sce_d;
 				struct block_list *d_bl = NULL;
 
-				if( (sce_d = sc->data[SC_DEVOTION]) && (d_bl = map_id2bl(sce_d->val1)) &&
+				if( (sce_d = sc_data(sc, SC_DEVOTION)) && (d_bl = map_id2bl(sce_d->val1)) &&
 					((d_bl->type == BL_MER && ((TBL_MER *)d_bl)->master && ((TBL_MER *)d_bl)->master->bl.id == bl->id) ||
 					(d_bl->type == BL_PC && ((TBL_PC *)d_bl)->devotion[sce_d->val2] == bl->id)) )
 				{ //Don't reflect non-skill attack if has SC_REFLECTSHIELD from Devotion bonus inheritance
@@ -6818,7 +6961,7 @@ int64 battle_calc_return_damage(struct block_list *bl, struct block_list *src, i
 				rdamage = max(rdamage,1);
 #endif
 			}
-			if( (sce = sc->data[SC_DEATHBOUND]) &&
+			if( (sce = sc_data(sc, SC_DEATHBOUND)) &&
 #ifdef RENEWAL
 				skill_id != WS_CARTTERMINATION &&
 #endif
@@ -6837,7 +6980,7 @@ int64 battle_calc_return_damage(struct block_list *bl, struct block_list *src, i
 					rdamage += rd1 * 70 / 100; //Target receives 70% of the amplified damage [Rytech]
 				}
 			}
-			if( (sce = sc->data[SC_REFLECTDAMAGE]) &&
+			if( (sce = sc_data(sc, SC_REFLECTDAMAGE)) &&
 #ifdef RENEWAL
 				skill_id != WS_CARTTERMINATION &&
 #endif
@@ -6855,7 +6998,7 @@ int64 battle_calc_return_damage(struct block_list *bl, struct block_list *src, i
 						status_change_end(bl,SC_REFLECTDAMAGE,INVALID_TIMER);
 				}
 			}
-			if( (sce = sc->data[SC_SHIELDSPELL_DEF]) && sce->val1 == 2 && !is_boss(src) ) {
+			if( (sce = sc_data(sc, SC_SHIELDSPELL_DEF)) && sce->val1 == 2 && !is_boss(src) ) {
 				rdamage += damage * sce->val2 / 100;
 #ifdef RENEWAL
 				rdamage = cap_value(rdamage,1,max_damage);
@@ -6871,7 +7014,7 @@ int64 battle_calc_return_damage(struct block_list *bl, struct block_list *src, i
 		}
 	}
 
-	if( ssc && ssc->data[SC_INSPIRATION] ) {
+	if( ssc && sc_data(ssc, SC_INSPIRATION) ) {
 		rdamage += damage / 100;
 #ifdef RENEWAL
 		rdamage = cap_value(rdamage,1,max_damage);
@@ -6880,7 +7023,7 @@ int64 battle_calc_return_damage(struct block_list *bl, struct block_list *src, i
 #endif
 	}
 
-	if( sc && sc->data[SC_KYOMU] && !sc->data[SC_DEATHBOUND] )
+	if( sc && sc_data(sc, SC_KYOMU) && !sc_data(sc, SC_DEATHBOUND) )
 		rdamage = 0; //Nullify reflecting ability
 
 	return rdamage;
@@ -7104,19 +7247,19 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 	}
 
 	if (sc && sc->count) {
-		if (sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4&2))
+		if (sc_data(sc, SC_CLOAKING) && !(sc_data(sc, SC_CLOAKING)->val4&2))
 			status_change_end(src,SC_CLOAKING,INVALID_TIMER);
-		else if (sc->data[SC_CLOAKINGEXCEED] && !(sc->data[SC_CLOAKINGEXCEED]->val4&2))
+		else if (sc_data(sc, SC_CLOAKINGEXCEED) && !(sc_data(sc, SC_CLOAKINGEXCEED)->val4&2))
 			status_change_end(src,SC_CLOAKINGEXCEED,INVALID_TIMER);
 	}
 
-	if (tsc && tsc->data[SC_AUTOCOUNTER] && status_check_skilluse(target,src,KN_AUTOCOUNTER,1)) {
+	if (tsc && sc_data(tsc, SC_AUTOCOUNTER) && status_check_skilluse(target,src,KN_AUTOCOUNTER,1)) {
 		uint8 dir = map_calc_dir(target,src->x,src->y);
 		int t_dir = unit_getdir(target);
 		int dist = distance_bl(src,target);
 
 		if (dist <= 0 || (!map_check_dir(dir,t_dir) && dist <= tstatus->rhw.range + 1)) {
-			uint16 skill_lv = tsc->data[SC_AUTOCOUNTER]->val1;
+			uint16 skill_lv = sc_data(tsc, SC_AUTOCOUNTER)->val1;
 
 			clif_skillcastcancel(target); //Remove the casting bar [Skotlex]
 			clif_damage(src,target,tick,sstatus->amotion,1,0,1,DMG_NORMAL,0); //Display MISS
@@ -7126,9 +7269,9 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 		}
 	}
 
-	if (tsc && tsc->data[SC_BLADESTOP_WAIT] && !is_boss(src) && (src->type == BL_PC || tsd == NULL ||
+	if (tsc && sc_data(tsc, SC_BLADESTOP_WAIT) && !is_boss(src) && (src->type == BL_PC || tsd == NULL ||
 		distance_bl(src,target) <= (tsd->status.weapon == W_FIST ? 1 : 2))) {
-		uint16 skill_lv = tsc->data[SC_BLADESTOP_WAIT]->val1;
+		uint16 skill_lv = sc_data(tsc, SC_BLADESTOP_WAIT)->val1;
 		int duration = skill_get_time2(MO_BLADESTOP,skill_lv);
 
 		status_change_end(target,SC_BLADESTOP_WAIT,INVALID_TIMER);
@@ -7144,8 +7287,8 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 	if (sd && (skill = pc_checkskill(sd,MO_TRIPLEATTACK)) > 0) {
 		int triple_rate = 30 - skill; //Base Rate
 
-		if (sc && sc->data[SC_SKILLRATE_UP] && sc->data[SC_SKILLRATE_UP]->val1 == MO_TRIPLEATTACK) {
-			triple_rate += triple_rate * (sc->data[SC_SKILLRATE_UP]->val2) / 100;
+		if (sc && sc_data(sc, SC_SKILLRATE_UP) && sc_data(sc, SC_SKILLRATE_UP)->val1 == MO_TRIPLEATTACK) {
+			triple_rate += triple_rate * (sc_data(sc, SC_SKILLRATE_UP)->val2) / 100;
 			status_change_end(src,SC_SKILLRATE_UP,INVALID_TIMER);
 		}
 		if (rnd()%100 < triple_rate) {
@@ -7158,11 +7301,11 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 	}
 
 	if (sc) {
-		if (sc->data[SC_SACRIFICE]) {
-			uint16 skill_lv = sc->data[SC_SACRIFICE]->val1;
+		if (sc_data(sc, SC_SACRIFICE)) {
+			uint16 skill_lv = sc_data(sc, SC_SACRIFICE)->val1;
 			damage_lv ret_val;
 
-			if (--(sc->data[SC_SACRIFICE]->val2) <= 0)
+			if (--(sc_data(sc, SC_SACRIFICE)->val2) <= 0)
 				status_change_end(src,SC_SACRIFICE,INVALID_TIMER);
 
 			/**
@@ -7176,42 +7319,42 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 				return ATK_MISS;
 			return ret_val;
 		}
-		if (sc->data[SC_MAGICALATTACK]) {
-			if (skill_attack(BF_MAGIC,src,src,target,NPC_MAGICALATTACK,sc->data[SC_MAGICALATTACK]->val1,tick,0))
+		if (sc_data(sc, SC_MAGICALATTACK)) {
+			if (skill_attack(BF_MAGIC,src,src,target,NPC_MAGICALATTACK,sc_data(sc, SC_MAGICALATTACK)->val1,tick,0))
 				return ATK_DEF;
 			return ATK_MISS;
 		}
-		if (sc->data[SC_GT_ENERGYGAIN]) {
+		if (sc_data(sc, SC_GT_ENERGYGAIN)) {
 			int spheremax = 0;
 
-			if (sc->data[SC_RAISINGDRAGON])
-				spheremax = 5 + sc->data[SC_RAISINGDRAGON]->val1;
+			if (sc_data(sc, SC_RAISINGDRAGON))
+				spheremax = 5 + sc_data(sc, SC_RAISINGDRAGON)->val1;
 			else
 				spheremax = 5;
-			if (sd && rnd()%100 < sc->data[SC_GT_ENERGYGAIN]->val2)
-				pc_addspiritball(sd,skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN,sc->data[SC_GT_ENERGYGAIN]->val1),spheremax);
+			if (sd && rnd()%100 < sc_data(sc, SC_GT_ENERGYGAIN)->val2)
+				pc_addspiritball(sd,skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN,sc_data(sc, SC_GT_ENERGYGAIN)->val1),spheremax);
 		}
 	}
 
 	if (tsc) {
-		if (tsc->data[SC_GT_ENERGYGAIN]) {
+		if (sc_data(tsc, SC_GT_ENERGYGAIN)) {
 			int spheremax = 0;
 
-			if (tsc->data[SC_RAISINGDRAGON])
-				spheremax = 5 + tsc->data[SC_RAISINGDRAGON]->val1;
+			if (sc_data(tsc, SC_RAISINGDRAGON))
+				spheremax = 5 + sc_data(tsc, SC_RAISINGDRAGON)->val1;
 			else
 				spheremax = 5;
-			if (tsd && rnd()%100 < tsc->data[SC_GT_ENERGYGAIN]->val2)
-				pc_addspiritball(tsd,skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN,tsc->data[SC_GT_ENERGYGAIN]->val1),spheremax);
+			if (tsd && rnd()%100 < sc_data(tsc, SC_GT_ENERGYGAIN)->val2)
+				pc_addspiritball(tsd,skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN,sc_data(tsc, SC_GT_ENERGYGAIN)->val1),spheremax);
 		}
-		if (tsc->data[SC_MTF_MLEATKED] && rnd()%100 < tsc->data[SC_MTF_MLEATKED]->val3)
-			clif_skill_nodamage(target,target,SM_ENDURE,tsc->data[SC_MTF_MLEATKED]->val2,
-				sc_start(target,target,SC_ENDURE,100,tsc->data[SC_MTF_MLEATKED]->val2,skill_get_time(SM_ENDURE,tsc->data[SC_MTF_MLEATKED]->val2)));
-		if (tsc->data[SC_KAAHI] && tstatus->hp < tstatus->max_hp && status_charge(target,0,tsc->data[SC_KAAHI]->val3)) {
+		if (sc_data(tsc, SC_MTF_MLEATKED) && rnd()%100 < sc_data(tsc, SC_MTF_MLEATKED)->val3)
+			clif_skill_nodamage(target,target,SM_ENDURE,sc_data(tsc, SC_MTF_MLEATKED)->val2,
+				sc_start(target,target,SC_ENDURE,100,sc_data(tsc, SC_MTF_MLEATKED)->val2,skill_get_time(SM_ENDURE,sc_data(tsc, SC_MTF_MLEATKED)->val2)));
+		if (sc_data(tsc, SC_KAAHI) && tstatus->hp < tstatus->max_hp && status_charge(target,0,sc_data(tsc, SC_KAAHI)->val3)) {
 			int hp_heal = tstatus->max_hp - tstatus->hp;
 
-			if (hp_heal > tsc->data[SC_KAAHI]->val2)
-				hp_heal = tsc->data[SC_KAAHI]->val2;
+			if (hp_heal > sc_data(tsc, SC_KAAHI)->val2)
+				hp_heal = sc_data(tsc, SC_KAAHI)->val2;
 			if (hp_heal)
 				status_heal(target,hp_heal,0,2);
 		}
@@ -7222,7 +7365,7 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 	if (sc && sc->count) { //Do a basic physical attack that consume the status if missed
 		uint16 skill_id = 0;
 
-		if (sc->data[SC_CRUSHSTRIKE]) {
+		if (sc_data(sc, SC_CRUSHSTRIKE)) {
 			struct map_session_data *sd = BL_CAST(BL_PC,src);
 
 			if (sd) {
@@ -7236,14 +7379,14 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 			skill_break_equip(src,src,EQP_WEAPON,2000,BCT_SELF);
 			status_change_end(src,SC_CRUSHSTRIKE,INVALID_TIMER);
 		}
-		if (sc->data[SC_EXEEDBREAK]) {
-			ATK_RATE(wd.damage,wd.damage2,sc->data[SC_EXEEDBREAK]->val2);
+		if (sc_data(sc, SC_EXEEDBREAK)) {
+			ATK_RATE(wd.damage,wd.damage2,sc_data(sc, SC_EXEEDBREAK)->val2);
 			battle_do_reflect(BF_WEAPON,&wd,src,target,skill_id,0);
 			status_change_end(src,SC_EXEEDBREAK,INVALID_TIMER);
 		}
-		if (sc->data[SC_SPELLFIST]) {
-			if (--(sc->data[SC_SPELLFIST]->val2) >= 0) {
-				struct Damage ad = battle_calc_attack(BF_MAGIC,src,target,sc->data[SC_SPELLFIST]->val3,sc->data[SC_SPELLFIST]->val4,flag|BF_SHORT);
+		if (sc_data(sc, SC_SPELLFIST)) {
+			if (--(sc_data(sc, SC_SPELLFIST)->val2) >= 0) {
+				struct Damage ad = battle_calc_attack(BF_MAGIC,src,target,sc_data(sc, SC_SPELLFIST)->val3,sc_data(sc, SC_SPELLFIST)->val4,flag|BF_SHORT);
 
 				wd.damage = ad.damage;
 				DAMAGE_DIV_FIX(wd.damage, wd.div_); //Double the damage for multiple hits
@@ -7254,12 +7397,12 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 	}
 
 	if (sd) {
-		if (battle_config.arrow_decrement && sc && sc->data[SC_FEARBREEZE] && sc->data[SC_FEARBREEZE]->val4 > 0) {
+		if (battle_config.arrow_decrement && sc && sc_data(sc, SC_FEARBREEZE) && sc_data(sc, SC_FEARBREEZE)->val4 > 0) {
 			short idx = sd->equip_index[EQI_AMMO];
 
-			if (idx >= 0 && sd->status.inventory[idx].amount >= sc->data[SC_FEARBREEZE]->val4) {
-				pc_delitem(sd,idx,sc->data[SC_FEARBREEZE]->val4,0,1,LOG_TYPE_CONSUME);
-				sc->data[SC_FEARBREEZE]->val4 = 0;
+			if (idx >= 0 && sd->status.inventory[idx].amount >= sc_data(sc, SC_FEARBREEZE)->val4) {
+				pc_delitem(sd,idx,sc_data(sc, SC_FEARBREEZE)->val4,0,1,LOG_TYPE_CONSUME);
+				sc_data(sc, SC_FEARBREEZE)->val4 = 0;
 			}
 		}
 		if (sd->state.arrow_atk) //Consume arrow
@@ -7269,15 +7412,15 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 	damage = wd.damage + wd.damage2;
 
 	if (damage > 0 && src != target) {
-		if (sc && sc->data[SC_DUPLELIGHT] && wd.flag&BF_SHORT &&
-			rnd()%100 <= 10 + 2 * sc->data[SC_DUPLELIGHT]->val1) { //Activates it only from melee damage
+		if (sc && sc_data(sc, SC_DUPLELIGHT) && wd.flag&BF_SHORT &&
+			rnd()%100 <= 10 + 2 * sc_data(sc, SC_DUPLELIGHT)->val1) { //Activates it only from melee damage
 			uint16 skill_id;
 
 			if (rnd()%2 == 1)
 				skill_id = AB_DUPLELIGHT_MELEE;
 			else
 				skill_id = AB_DUPLELIGHT_MAGIC;
-			skill_attack(skill_get_type(skill_id),src,src,target,skill_id,sc->data[SC_DUPLELIGHT]->val1,tick,SD_LEVEL);
+			skill_attack(skill_get_type(skill_id),src,src,target,skill_id,sc_data(sc, SC_DUPLELIGHT)->val1,tick,SD_LEVEL);
 		}
 	}
 
@@ -7308,8 +7451,8 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 		battle_delay_damage(tick,wd.amotion,src,target,wd.flag,0,0,damage,wd.dmg_lv,wd.dmotion,true);
 
 	if (tsc) {
-		if (tsc->data[SC_DEVOTION]) {
-			struct status_change_entry *sce_d = tsc->data[SC_DEVOTION];
+		if (sc_data(tsc, SC_DEVOTION)) {
+			struct status_change_entry *sce_d = sc_data(tsc, SC_DEVOTION);
 			struct block_list *d_bl = map_id2bl(sce_d->val1);
 
 			if (d_bl &&
@@ -7322,16 +7465,16 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 			} else
 				status_change_end(target,SC_DEVOTION,INVALID_TIMER);
 		}
-		if (target->type == BL_PC && (wd.flag&BF_SHORT) && tsc->data[SC_CIRCLE_OF_FIRE_OPTION]) {
+		if (target->type == BL_PC && (wd.flag&BF_SHORT) && sc_data(tsc, SC_CIRCLE_OF_FIRE_OPTION)) {
 			struct elemental_data *ed = ((TBL_PC *)target)->ed;
 
 			if (ed) {
-				clif_skill_damage(&ed->bl,target,tick,status_get_amotion(src),0,-30000,1,EL_CIRCLE_OF_FIRE,tsc->data[SC_CIRCLE_OF_FIRE_OPTION]->val1,DMG_SKILL);
-				skill_attack(BF_WEAPON,&ed->bl,&ed->bl,src,EL_CIRCLE_OF_FIRE,tsc->data[SC_CIRCLE_OF_FIRE_OPTION]->val1,tick,wd.flag);
+				clif_skill_damage(&ed->bl,target,tick,status_get_amotion(src),0,-30000,1,EL_CIRCLE_OF_FIRE,sc_data(tsc, SC_CIRCLE_OF_FIRE_OPTION)->val1,DMG_SKILL);
+				skill_attack(BF_WEAPON,&ed->bl,&ed->bl,src,EL_CIRCLE_OF_FIRE,sc_data(tsc, SC_CIRCLE_OF_FIRE_OPTION)->val1,tick,wd.flag);
 			}
 		}
-		if (tsc->data[SC_WATER_SCREEN_OPTION] && tsc->data[SC_WATER_SCREEN_OPTION]->val1) {
-			struct block_list *e_bl = map_id2bl(tsc->data[SC_WATER_SCREEN_OPTION]->val1);
+		if (sc_data(tsc, SC_WATER_SCREEN_OPTION) && sc_data(tsc, SC_WATER_SCREEN_OPTION)->val1) {
+			struct block_list *e_bl = map_id2bl(sc_data(tsc, SC_WATER_SCREEN_OPTION)->val1);
 
 			if (e_bl && !status_isdead(e_bl)) {
 				clif_damage(src,target,tick,wd.amotion,wd.dmotion,damage,wd.div_,(enum e_damage_type)wd.type,wd.damage2); //Just show damage in target
@@ -7342,12 +7485,12 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 		}
 	}
 
-	if (sc && sc->data[SC_AUTOSPELL] && rnd()%100 < sc->data[SC_AUTOSPELL]->val4) {
+	if (sc && sc_data(sc, SC_AUTOSPELL) && rnd()%100 < sc_data(sc, SC_AUTOSPELL)->val4) {
 		int sp = 0, i = rnd()%100;
-		uint16 skill_id = sc->data[SC_AUTOSPELL]->val2,
-			skill_lv = sc->data[SC_AUTOSPELL]->val3;
+		uint16 skill_id = sc_data(sc, SC_AUTOSPELL)->val2,
+			skill_lv = sc_data(sc, SC_AUTOSPELL)->val3;
 
-		if (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_SAGE)
+		if (sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_SAGE)
 			i = 0; //Max chance, no skill_lv reduction [Skotlex]
 		//Reduction only for skill_lv > 1
 		if (skill_lv > 1) {
@@ -7373,12 +7516,12 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 	}
 
 	if (sd) {
-		if (sc && sc->data[SC__AUTOSHADOWSPELL] && wd.flag&BF_SHORT && rnd()%100 < sc->data[SC__AUTOSHADOWSPELL]->val3 &&
-			sd->status.skill[sc->data[SC__AUTOSHADOWSPELL]->val1].id != 0 &&
-			sd->status.skill[sc->data[SC__AUTOSHADOWSPELL]->val1].flag == SKILL_FLAG_PLAGIARIZED)
+		if (sc && sc_data(sc, SC__AUTOSHADOWSPELL) && wd.flag&BF_SHORT && rnd()%100 < sc_data(sc, SC__AUTOSHADOWSPELL)->val3 &&
+			sd->status.skill[sc_data(sc, SC__AUTOSHADOWSPELL)->val1].id != 0 &&
+			sd->status.skill[sc_data(sc, SC__AUTOSHADOWSPELL)->val1].flag == SKILL_FLAG_PLAGIARIZED)
 		{
-			int r_skill = sd->status.skill[sc->data[SC__AUTOSHADOWSPELL]->val1].id,
-				r_lv = sc->data[SC__AUTOSHADOWSPELL]->val2, type;
+			int r_skill = sd->status.skill[sc_data(sc, SC__AUTOSHADOWSPELL)->val1].id,
+				r_lv = sc_data(sc, SC__AUTOSHADOWSPELL)->val2, type;
 
 				if ((type = skill_get_casttype(r_skill)) == CAST_GROUND) {
 					int maxcount = 0;
@@ -7432,13 +7575,13 @@ enum damage_lv battle_weapon_attack(struct block_list *src, struct block_list *t
 	}
 
 	if (tsc) {
-		if (damage > 0 && tsc->data[SC_POISONREACT] &&
-			(rnd()%100 < tsc->data[SC_POISONREACT]->val3 ||
+		if (damage > 0 && sc_data(tsc, SC_POISONREACT) &&
+			(rnd()%100 < sc_data(tsc, SC_POISONREACT)->val3 ||
 			sstatus->def_ele == ELE_POISON) &&
 			//check_distance_bl(src,target,tstatus->rhw.range + 1) && //Doesn't checks range!
 			status_check_skilluse(target,src,TF_POISON,0))
 		{ //Poison React
-			struct status_change_entry *sce = tsc->data[SC_POISONREACT];
+			struct status_change_entry *sce = sc_data(tsc, SC_POISONREACT);
 
 			if (sstatus->def_ele == ELE_POISON) {
 				sce->val2 = 0;
@@ -7580,7 +7723,7 @@ int battle_check_target(struct block_list *src, struct block_list *target, int f
 				if( (((TBL_PC *)target)->invincible_timer != INVALID_TIMER || pc_isinvisible((TBL_PC *)target)) && 
 					!(flag&BCT_NOENEMY) )
 					return -1; //Cannot be targeted yet
-				if( sc && sc->count && sc->data[SC_VOICEOFSIREN] && sc->data[SC_VOICEOFSIREN]->val2 == target->id )
+				if( sc && sc->count && sc_data(sc, SC_VOICEOFSIREN) && sc_data(sc, SC_VOICEOFSIREN)->val2 == target->id )
 					return -1;
 			}
 			break;
@@ -7675,7 +7818,7 @@ int battle_check_target(struct block_list *src, struct block_list *target, int f
 					break;
 				sd = BL_CAST(BL_PC, t_bl);
 				sc = status_get_sc(t_bl);
-				if( (sd->state.monster_ignore || (sc->data[SC_KINGS_GRACE] && s_bl->type != BL_PC)) && flag&BCT_ENEMY )
+				if( (sd->state.monster_ignore || (sc_data(sc, SC_KINGS_GRACE) && s_bl->type != BL_PC)) && flag&BCT_ENEMY )
 					return 0; //Global immunity only to attacks
 				if( sd->status.karma && s_bl->type == BL_PC && ((TBL_PC *)s_bl)->status.karma )
 					state |= BCT_ENEMY; //Characters with bad karma may fight amongst them
@@ -7718,8 +7861,8 @@ int battle_check_target(struct block_list *src, struct block_list *target, int f
 				}
 				//Status changes that prevent traps from triggering
 				if( tsc && tsc->count && skill_get_inf2(su->group->skill_id)&INF2_TRAP )
-					if( tsc->data[SC_SIGHTBLASTER] &&
-						tsc->data[SC_SIGHTBLASTER]->val2 > 0 && tsc->data[SC_SIGHTBLASTER]->val4%2 == 0 )
+					if( sc_data(tsc, SC_SIGHTBLASTER) &&
+						sc_data(tsc, SC_SIGHTBLASTER)->val2 > 0 && sc_data(tsc, SC_SIGHTBLASTER)->val4%2 == 0 )
 						return -1;
 			}
 			break;
@@ -8381,6 +8524,8 @@ static const struct _battle_data {
 	{ "max_homunculus_hp",                  &battle_config.max_homunculus_hp,               32767,  100,    INT_MAX,        },
 	{ "max_homunculus_sp",                  &battle_config.max_homunculus_sp,               32767,  100,    INT_MAX,        },
 	{ "max_homunculus_parameter",           &battle_config.max_homunculus_parameter,        150,    10,     SHRT_MAX,       },
+	{ "sc_tick_align",                      &battle_config.sc_tick_align,                   0,      0,      1000,           },
+	{ "status_calc_defer",                  &battle_config.status_calc_defer,               0,      0,      1,              },
 };
 #ifndef STATS_OPT_OUT
 /**
@@ -8665,6 +8810,92 @@ int battle_config_read(const char *cfgName)
 	return 0;
 }
 
+static int battle_aoe_bench_sub(struct block_list *bl, va_list ap)
+{
+	struct block_list **targets = va_arg(ap, struct block_list **);
+	int *count = va_arg(ap, int *);
+	int max = va_arg(ap, int);
+
+	if( *count < max && !status_isdead(bl) )
+		targets[(*count)++] = bl;
+	return 0;
+}
+
+/// Skills aoe_bench accepts, their formulas don't change the caster or the targets
+static const uint16 battle_aoe_bench_skills[] = {
+	MG_NAPALMBEAT, MG_COLDBOLT, MG_FIREBOLT, MG_LIGHTNINGBOLT, MG_FIREBALL, MG_THUNDERSTORM,
+	WZ_METEOR, WZ_STORMGUST, WZ_VERMILION, WZ_HEAVENDRIVE, WZ_EARTHSPIKE, HW_NAPALMVULCAN,
+	HT_LANDMINE, HT_BLASTMINE, HT_CLAYMORETRAP,
+};
+
+/**
+ * Console "aoe_bench:<skill_id> <skill_lv> <rounds>".
+ * Times the damage formula of an area skill from the first online player against every character
+ * in its view range, once with the attacker lookup cache and once without it.
+ * Only the skills of battle_aoe_bench_skills are accepted, and battle_calc_damage, reflection and
+ * the hp/sp vanish bonuses are skipped, since they end status changes or damage the units.
+ * @param args: Arguments given on the console
+ */
+void battle_aoe_bench(const char *args)
+{
+	struct block_list *targets[256];
+	struct s_mapiterator *iter;
+	struct map_session_data *sd;
+	int skill_id = 0, skill_lv = 1, rounds = 100, count = 0, type, i, r, pass;
+	unsigned int elapsed[2], built, reused;
+
+	if( sscanf(args, "%d %d %d", &skill_id, &skill_lv, &rounds) < 1 || !skill_get_index(skill_id) ) {
+		ShowInfo("Usage: aoe_bench:<skill_id> <skill_lv> <rounds>\n");
+		return;
+	}
+
+	ARR_FIND(0, ARRAYLENGTH(battle_aoe_bench_skills), i, battle_aoe_bench_skills[i] == skill_id);
+	if( i == ARRAYLENGTH(battle_aoe_bench_skills) ) {
+		ShowWarning("aoe_bench: Skill %d can't be benchmarked, accepted skills are:", skill_id);
+		for( i = 0; i < ARRAYLENGTH(battle_aoe_bench_skills); i++ )
+			ShowMessage(" %d", battle_aoe_bench_skills[i]);
+		ShowMessage("\n");
+		return;
+	}
+	type = skill_get_type(skill_id);
+
+	iter = mapit_getallusers();
+	sd = (TBL_PC *)mapit_first(iter);
+	mapit_free(iter);
+	if( !sd ) {
+		ShowWarning("aoe_bench: No player online to cast from.\n");
+		return;
+	}
+
+	map_foreachinrange(battle_aoe_bench_sub, &sd->bl, AREA_SIZE, BL_CHAR, targets, &count, (int)ARRAYLENGTH(targets));
+	rounds = max(rounds, 1);
+
+	battle_bench_dryrun = true;
+	for( pass = 0; pass < 2; pass++ ) {
+		unsigned int start;
+
+		battle_src_ctx_enabled = !pass;
+		battle_src_ctx.src_id = 0;
+		built = battle_src_ctx_stats.built;
+		reused = battle_src_ctx_stats.reused;
+		start = gettick_nocache();
+		for( r = 0; r < rounds; r++ ) {
+			for( i = 0; i < count; i++ ) {
+				if( type == BF_MAGIC )
+					battle_calc_magic_attack(&sd->bl, targets[i], skill_id, skill_lv, 0);
+				else
+					battle_calc_misc_attack(&sd->bl, targets[i], skill_id, skill_lv, 0);
+			}
+		}
+		elapsed[pass] = DIFF_TICK(gettick_nocache(), start);
+		ShowInfo("aoe_bench: %s: %u ms for %d rounds over %d targets (context built %u, reused %u)\n",
+			(pass ? "uncached" : "cached lookups"), elapsed[pass], rounds, count,
+			battle_src_ctx_stats.built - built, battle_src_ctx_stats.reused - reused);
+	}
+	battle_src_ctx_enabled = true;
+	battle_bench_dryrun = false;
+}
+
 /*==========================
  * Initialize battle timer
  *--------------------------*/
@@ -81,6 +81,8 @@ struct block_list;
 
 struct Damage battle_calc_attack(int attack_type,struct block_list *bl,struct block_list *target,uint16 skill_id,uint16 skill_lv,int flag);
 struct Damage battle_calc_weapon_attack(struct block_list *src, struct block_list *target, uint16 skill_id, uint16 skill_lv, int wflag);
+void battle_src_context_invalidate(int src_id);
+void battle_aoe_bench(const char *args);
 
 int64 battle_calc_return_damage(struct block_list *bl, struct block_list *src, int64 *, int flag, uint16 skill_id, bool status_reflect);
 
@@ -598,6 +600,8 @@ extern struct Battle_Config
 	int max_homunculus_hp;
 	int max_homunculus_sp;
 	int max_homunculus_parameter;
+	int sc_tick_align;
+	int status_calc_defer;
 } battle_config;
 
 void do_init_battle(void);
@@ -61,7 +61,7 @@ int8 buyingstore_setup(struct map_session_data *sd, unsigned char slots) {
 	if( !battle_config.feature_buying_store || sd->state.vending || sd->state.buyingstore || sd->state.trading || slots == 0 )
 		return 1;
 
-	if( sd->sc.data[SC_NOCHAT] && (sd->sc.data[SC_NOCHAT]->val1&MANNER_NOROOM) ) // Custom: Mute limitation
+	if( sc_data(&sd->sc, SC_NOCHAT) && (sc_data(&sd->sc, SC_NOCHAT)->val1&MANNER_NOROOM) ) // Custom: Mute limitation
 		return 2;
 
 	if( map[sd->bl.m].flag.novending ) { // Custom: No vending maps
@@ -121,7 +121,7 @@ int8 buyingstore_create(struct map_session_data *sd, int zenylimit, unsigned cha
 		return 6;
 	}
 
-	if( sd->sc.data[SC_NOCHAT] && (sd->sc.data[SC_NOCHAT]->val1&MANNER_NOROOM) ) // Custom: Mute limitation
+	if( sc_data(&sd->sc, SC_NOCHAT) && (sc_data(&sd->sc, SC_NOCHAT)->val1&MANNER_NOROOM) ) // Custom: Mute limitation
 		return 2;
 
 	if( map[sd->bl.m].flag.novending ) { // Custom: No vending maps
@@ -200,7 +200,7 @@ int8 buyingstore_create(struct map_session_data *sd, int zenylimit, unsigned cha
 		buyingstores_db, sd->buyer_id, sd->status.account_id, sd->status.char_id, (!sd->status.sex ? 'F' : 'M'), map[sd->bl.m].name, sd->bl.x, sd->bl.y, message_sql, sd->buyingstore.zenylimit, sd->state.autotrade, (at ? at->dir : sd->ud.dir), (at ? at->head_dir : sd->head_dir), (at ? at->sit : pc_issit(sd))) != SQL_SUCCESS )
 		Sql_ShowDebug(mmysql_handle);
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_Printf(&buf, "INSERT INTO `%s`(`buyingstore_id`,`index`,`item_id`,`amount`,`price`) VALUES", buyingstore_items_db);
 	for( i = 0; i < sd->buyingstore.slots; i++ ) {
 		StringBuf_Printf(&buf, "(%d,%d,%hu,%d,%d)", sd->buyer_id, i, sd->buyingstore.items[i].nameid, sd->buyingstore.items[i].amount, sd->buyingstore.items[i].price);
@@ -214,6 +214,8 @@ int8 buyingstore_create(struct map_session_data *sd, int zenylimit, unsigned cha
 	clif_buyingstore_myitemlist(sd);
 	clif_buyingstore_entry(sd);
 	idb_put(buyingstore_db, sd->status.char_id, sd);
+	for( i = 0; i < sd->buyingstore.slots; i++ )
+		searchstore_index_add(SEARCHTYPE_BUYING_STORE, sd->status.char_id, i, sd->buyingstore.items[i].nameid, sd->buyingstore.items[i].price, NULL);
 
 	return 0;
 }
@@ -223,6 +225,8 @@ int8 buyingstore_create(struct map_session_data *sd, int zenylimit, unsigned cha
  * @param sd
  */
 void buyingstore_close(struct map_session_data *sd) {
+	int i;
+
 	nullpo_retv(sd);
 
 	if( sd->state.buyingstore ) {
@@ -230,6 +234,9 @@ void buyingstore_close(struct map_session_data *sd) {
 			Sql_Query(mmysql_handle, "DELETE FROM `%s` WHERE `id` = %d;", buyingstores_db, sd->buyer_id) != SQL_SUCCESS )
 			Sql_ShowDebug(mmysql_handle);
 
+		for( i = 0; i < sd->buyingstore.slots; i++ )
+			searchstore_index_remove(SEARCHTYPE_BUYING_STORE, sd->status.char_id, i, sd->buyingstore.items[i].nameid, sd->buyingstore.items[i].price, NULL);
+
 		sd->state.buyingstore = 0;
 		sd->buyer_id = 0;
 		memset(&sd->buyingstore, 0, sizeof(sd->buyingstore));
@@ -472,40 +479,33 @@ bool buyingstore_search(struct map_session_data *sd, unsigned short nameid)
 
 // Searches for all items in a buyingstore, that match given ids, price and possible cards.
 // @return Whether or not the search should be continued.
-bool buyingstore_searchall(struct map_session_data *sd, const struct s_search_store_search *s)
+bool buyingstore_searchslot(struct map_session_data *sd, int i, unsigned short nameid, const struct s_search_store_search *s)
 {
-	unsigned int i, idx;
 	struct s_buyingstore_item* it;
 
 	nullpo_retr(false, sd);
 
-	if( !sd->state.buyingstore ) // Not buying
+	if( !sd->state.buyingstore || i < 0 || i >= sd->buyingstore.slots ) // Not buying
 		return true;
 
-	for( idx = 0; idx < s->item_count; idx++ ) {
-		ARR_FIND(0, sd->buyingstore.slots, i, sd->buyingstore.items[i].nameid == s->itemlist[idx] && sd->buyingstore.items[i].amount);
-		if( i == sd->buyingstore.slots ) // Not found
-			continue;
+	it = &sd->buyingstore.items[i];
 
-		it = &sd->buyingstore.items[i];
-
-		if( s->min_price && s->min_price > (unsigned int)it->price ) // Too low price
-			continue;
+	if( it->nameid != nameid || !it->amount ) // Index out of sync or already bought
+		return true;
 
-		if( s->max_price && s->max_price < (unsigned int)it->price ) // Too high price
-			continue;
+	if( s->min_price && s->min_price > (unsigned int)it->price ) // Too low price
+		return true;
 
-		if( s->card_count ) { // Ignore cards, as there cannot be any
-			;
-		}
+	if( s->max_price && s->max_price < (unsigned int)it->price ) // Too high price
+		return true;
 
-		// Result set full
-		if( !searchstore_result(s->search_sd, sd->buyer_id, sd->status.account_id, sd->message,
-			it->nameid, it->amount, it->price, buyingstore_blankslots, 0) )
-			return false;
+	if( s->card_count ) { // Ignore cards, as there cannot be any
+		;
 	}
 
-	return true;
+	// False if result set full
+	return searchstore_result(s->search_sd, sd->buyer_id, sd->status.account_id, sd->message,
+		it->nameid, it->amount, it->price, buyingstore_blankslots, 0);
 }
 
 /**
@@ -13,7 +13,7 @@
 #include "clif.h"
 #include "npc.h" // npc_event_do()
 #include "pc.h"
-#include "skill.h" // ext_skill_unit_onplace()
+#include "skill.h" // ext_skill_unit_onplace(), skill_unit_group_wake()
 #include "chat.h"
 
 #include <stdio.h>
@@ -209,8 +209,10 @@ int chat_leavechat(struct map_session_data *sd, bool kicked)
 
 		unit = map_find_skill_unit_oncell(&sd->bl, sd->bl.x, sd->bl.y, AL_WARP, NULL, 0);
 		group = (unit != NULL) ? unit->group : NULL;
-		if( group != NULL )
+		if( group != NULL ) {
+			skill_unit_group_wake(group); //Someone is on the cell now, let the group pick it up on its next pass
 			ext_skill_unit_onplace(unit, &sd->bl, group->tick);
+		}
 
 		return 1;
 	}
@@ -332,6 +332,7 @@ int chrif_save(struct map_session_data *sd, int flag) {
 		memcpy(WFIFOP(char_fd, 13), &sd->status, sizeof(struct mmo_charstatus));
 
 	WFIFOSET(char_fd, WFIFOW(char_fd,2));
+	pc_autosave_saved(sd); //Only once it was actually sent
 
 	if (sd->status.pet_id > 0 && sd->pd)
 		intif_save_petdata(sd->status.account_id, &sd->pd->pet);
@@ -962,7 +963,7 @@ int chrif_changedsex(int fd) {
 		int i;
 
 		for (i = 0; i < SC_MAX; i++) {
-			if (!sd->sc.data[i])
+			if (!sc_data(&sd->sc, i))
 				continue;
 			switch (i) {
 				case SC_MOONSTAR:	case SC_SUPER_STAR:
@@ -1268,10 +1269,10 @@ int chrif_save_scdata(struct map_session_data *sd) {
 	WFIFOL(char_fd,8) = sd->status.char_id;
 
 	for (i = 0; i < SC_MAX; i++) {
-		if (!sc->data[i])
+		if (!sc_data(sc, i))
 			continue;
-		if (sc->data[i]->timer != INVALID_TIMER) {
-			timer = get_timer(sc->data[i]->timer);
+		if (sc_data(sc, i)->timer != INVALID_TIMER) {
+			timer = get_timer(sc_data(sc, i)->timer);
 			if (timer == NULL || timer->func != status_change_timer)
 				continue;
 			if (DIFF_TICK(timer->tick,tick) > 0)
@@ -1281,10 +1282,10 @@ int chrif_save_scdata(struct map_session_data *sd) {
 		} else
 			data.tick = -1; //Infinite duration
 		data.type = i;
-		data.val1 = sc->data[i]->val1;
-		data.val2 = sc->data[i]->val2;
-		data.val3 = sc->data[i]->val3;
-		data.val4 = sc->data[i]->val4;
+		data.val1 = sc_data(sc, i)->val1;
+		data.val2 = sc_data(sc, i)->val2;
+		data.val3 = sc_data(sc, i)->val3;
+		data.val4 = sc_data(sc, i)->val4;
 		memcpy(WFIFOP(char_fd,14 + count * sizeof(struct status_change_data)),
 			&data, sizeof(struct status_change_data));
 		count++;
@@ -328,7 +328,7 @@ static int clif_send_sub(struct block_list *bl, va_list ap) {
 	}
 
 	if (!battle_config.update_enemy_position && ally_only && !sd->special_state.intravision &&
-		!sd->sc.data[SC_INTRAVISION] && battle_check_target(src_bl, &sd->bl, BCT_ENEMY) > 0)
+		!sc_data(&sd->sc, SC_INTRAVISION) && battle_check_target(src_bl, &sd->bl, BCT_ENEMY) > 0)
 		return 0; //Unless visible, hold it here
 
 	if (session[fd] == NULL)
@@ -3148,6 +3148,8 @@ void clif_updatestatus(struct map_session_data *sd,int type)
 				clif_hpmeter(sd);
 			if( !battle_config.party_hp_mode && sd->status.party_id )
 				clif_party_hp(sd);
+			else if( battle_config.party_hp_mode )
+				party_send_xy_mark(sd); //Sent by party_send_xy_timer
 			if( sd->bg_id )
 				clif_bg_hp(sd);
 			break;
@@ -4479,7 +4481,7 @@ static void clif_getareachar_pc(struct map_session_data *sd,struct map_session_d
 		clif_spiritcharm_single(sd->fd, dstsd);
 	for( i = 0; i < dstsd->sc_display_count; i++ ) {
 		if( (dstsd->sc.option&OPTION_INVISIBLE) ||
-			(pc_ishiding(dstsd) && !sd->special_state.intravision && !sd->sc.data[SC_INTRAVISION]) )
+			(pc_ishiding(dstsd) && !sd->special_state.intravision && !sc_data(&sd->sc, SC_INTRAVISION)) )
 			clif_efst_status_change(&sd->bl, dstsd->bl.id, SELF, SI_BLANK, 0, 0, 0);
 		else
 			clif_efst_status_change(&sd->bl, dstsd->bl.id, SELF, StatusIconChangeTable[dstsd->sc_display[i]->type], dstsd->sc_display[i]->val1, dstsd->sc_display[i]->val2, dstsd->sc_display[i]->val3);
@@ -4497,7 +4499,7 @@ static void clif_getareachar_pc(struct map_session_data *sd,struct map_session_d
 	if( i < MAX_DEVOTION )
 		clif_devotion(&dstsd->bl, sd);
 	//Display link (dstsd - crusader) to sd
-	if( dstsd->sc.data[SC_DEVOTION] && (d_bl = map_id2bl(dstsd->sc.data[SC_DEVOTION]->val1)) != NULL )
+	if( sc_data(&dstsd->sc, SC_DEVOTION) && (d_bl = map_id2bl(sc_data(&dstsd->sc, SC_DEVOTION)->val1)) != NULL )
 		clif_devotion(d_bl, sd);
 }
 
@@ -4660,13 +4662,13 @@ int clif_damage(struct block_list *src, struct block_list *dst, unsigned int tic
 
 	type = clif_calc_delay(type,div,damage + damage2,ddelay);
 	if((sc = status_get_sc(dst)) && sc->count) {
-		if(sc->data[SC_HALLUCINATION]) {
+		if(sc_data(sc, SC_HALLUCINATION)) {
 			if(damage)
-				damage = damage * sc->data[SC_HALLUCINATION]->val2 + rnd()%100;
+				damage = damage * sc_data(sc, SC_HALLUCINATION)->val2 + rnd()%100;
 			if(damage2)
-				damage2 = damage2 * sc->data[SC_HALLUCINATION]->val2 + rnd()%100;
+				damage2 = damage2 * sc_data(sc, SC_HALLUCINATION)->val2 + rnd()%100;
 		}
-		if(sc->data[SC_PYREXIA]) {
+		if(sc_data(sc, SC_PYREXIA)) {
 			if(damage != 100) { //Exclude damage from poison itself
 				if(!damage)
 					damage = rnd()%999 + 1;
@@ -5475,9 +5477,9 @@ int clif_skill_damage(struct block_list *src,struct block_list *dst,unsigned int
 #endif
 
 	if((sc = status_get_sc(dst)) && sc->count) {
-		if(sc->data[SC_HALLUCINATION] && damage)
-			damage = damage * sc->data[SC_HALLUCINATION]->val2 + rnd()%100;
-		if(sc->data[SC_PYREXIA]) {
+		if(sc_data(sc, SC_HALLUCINATION) && damage)
+			damage = damage * sc_data(sc, SC_HALLUCINATION)->val2 + rnd()%100;
+		if(sc_data(sc, SC_PYREXIA)) {
 			if(!damage)
 				damage = rnd()%9999 + 1;
 			damage = damage * 3 + rnd()%100;
@@ -5567,8 +5569,8 @@ int clif_skill_damage2(struct block_list *src,struct block_list *dst,unsigned in
 	sc = status_get_sc(dst);
 
 	if(sc && sc->count) {
-		if(sc->data[SC_HALLUCINATION] && damage)
-			damage = damage * (sc->data[SC_HALLUCINATION]->val2) + rnd()%100;
+		if(sc_data(sc, SC_HALLUCINATION) && damage)
+			damage = damage * (sc_data(sc, SC_HALLUCINATION)->val2) + rnd()%100;
 	}
 
 	WBUFW(buf,0) = 0x115;
@@ -10138,7 +10140,7 @@ void clif_parse_LoadEndAck(int fd,struct map_session_data *sd) {
 		if(sd->sc.option&OPTION_WUGRIDER)
 			clif_status_load(&sd->bl,SI_WUGRIDER,1);
 
-		if(sd->sc.data[SC_ALL_RIDING])
+		if(sc_data(&sd->sc, SC_ALL_RIDING))
 			clif_status_load(&sd->bl,SI_ALL_RIDING,1);
 
 		if(sd->status.manner < 0)
@@ -10226,9 +10228,9 @@ void clif_parse_LoadEndAck(int fd,struct map_session_data *sd) {
 		}
 
 		if(map_flag_gvg2(sd->bl.m)) {
-			if(sd->sc.data[SC_C_MARKER])
+			if(sc_data(&sd->sc, SC_C_MARKER))
 				status_change_end(&sd->bl,SC_C_MARKER,INVALID_TIMER);
-			if(sd->sc.data[SC_ANTI_M_BLAST])
+			if(sc_data(&sd->sc, SC_ANTI_M_BLAST))
 				status_change_end(&sd->bl,SC_ANTI_M_BLAST,INVALID_TIMER);
 		}
 
@@ -10279,7 +10281,7 @@ void clif_parse_LoadEndAck(int fd,struct map_session_data *sd) {
 	if(sd->sc.opt2) //Client loses these on warp
 		clif_changeoption(&sd->bl);
 
-	if(sd->sc.data[SC_MONSTER_TRANSFORM] && battle_config.mon_trans_disable_in_gvg && map_flag_gvg2(sd->bl.m)) {
+	if(sc_data(&sd->sc, SC_MONSTER_TRANSFORM) && battle_config.mon_trans_disable_in_gvg && map_flag_gvg2(sd->bl.m)) {
 		status_change_end(&sd->bl,SC_MONSTER_TRANSFORM,INVALID_TIMER);
 		clif_displaymessage(sd->fd,msg_txt(1493)); // Transforming into monster is not allowed in Guild Wars.
 	}
@@ -10459,7 +10461,7 @@ void clif_parse_WalkToXY(int fd, struct map_session_data *sd)
 	else if (pc_cant_act(sd))
 		return;
 
-	if(sd->sc.data[SC_RUN] || sd->sc.data[SC_WUGDASH])
+	if(sc_data(&sd->sc, SC_RUN) || sc_data(&sd->sc, SC_WUGDASH))
 		return;
 
 	RFIFOPOS(fd, packet_db[sd->packet_ver][RFIFOW(fd,0)].pos[0], &x, &y, NULL);
@@ -10471,8 +10473,8 @@ void clif_parse_WalkToXY(int fd, struct map_session_data *sd)
 
 	//Cloaking wall check is actually updated when you click to process next movement
 	//Not when you move each cell. This is official behaviour.
-	if (sd->sc.data[SC_CLOAKING])
-		skill_check_cloaking(&sd->bl, sd->sc.data[SC_CLOAKING]);
+	if (sc_data(&sd->sc, SC_CLOAKING))
+		skill_check_cloaking(&sd->bl, sc_data(&sd->sc, SC_CLOAKING));
 
 	pc_delinvincibletimer(sd);
 
@@ -10506,7 +10508,7 @@ void clif_parse_QuitGame(int fd, struct map_session_data *sd)
 {
 	//Rovert's prevent logout option fixed [Valaris]
 	//int type = RFIFOW(fd,packet_db[sd->packet_ver][RFIFOW(fd,0)].pos[0]);
-	if( !sd->sc.data[SC_CLOAKING] && !sd->sc.data[SC_HIDING] && !sd->sc.data[SC_CHASEWALK] && !sd->sc.data[SC_CLOAKINGEXCEED] &&
+	if( !sc_data(&sd->sc, SC_CLOAKING) && !sc_data(&sd->sc, SC_HIDING) && !sc_data(&sd->sc, SC_CHASEWALK) && !sc_data(&sd->sc, SC_CLOAKINGEXCEED) &&
 		(!battle_config.prevent_logout || DIFF_TICK(gettick(), sd->canlog_tick) > battle_config.prevent_logout) )
 	{
 		set_eof(fd);
@@ -10797,10 +10799,10 @@ void clif_parse_ActionRequest_sub(struct map_session_data *sd, int action_type,
 	//Statuses that don't let the player sit/attack/talk with NPCs(targeted)
 	//(not all are included in pc_can_attack)
 	if( sd->sc.count &&
-		(sd->sc.data[SC_TRICKDEAD] ||
-		(sd->sc.data[SC_AUTOCOUNTER] && action_type != 0x07) ||
-		sd->sc.data[SC_BLADESTOP] ||
-		sd->sc.data[SC_DEEPSLEEP]) )
+		(sc_data(&sd->sc, SC_TRICKDEAD) ||
+		(sc_data(&sd->sc, SC_AUTOCOUNTER) && action_type != 0x07) ||
+		sc_data(&sd->sc, SC_BLADESTOP) ||
+		sc_data(&sd->sc, SC_DEEPSLEEP)) )
 		return;
 
 	if( action_type != 0x00 && action_type != 0x07 )
@@ -10843,7 +10845,7 @@ void clif_parse_ActionRequest_sub(struct map_session_data *sd, int action_type,
 			}
 			if( sd->ud.skilltimer != INVALID_TIMER || (sd->sc.opt1 && sd->sc.opt1 != OPT1_BURNING && sd->sc.opt1 != OPT1_FREEZING) )
 				break;
-			if( sd->sc.count && sd->sc.data[SC_DANCING] )
+			if( sd->sc.count && sc_data(&sd->sc, SC_DANCING) )
 				break;
 			if( sd->sc.cant.move ) //No sitting during these states either
 				break;
@@ -10901,7 +10903,7 @@ void clif_parse_Restart(int fd, struct map_session_data *sd)
 			break;
 		case 0x01:
 			//Rovert's Prevent logout option - Fixed [Valaris]
-			if( !sd->sc.data[SC_CLOAKING] && !sd->sc.data[SC_HIDING] && !sd->sc.data[SC_CHASEWALK] && !sd->sc.data[SC_CLOAKINGEXCEED] &&
+			if( !sc_data(&sd->sc, SC_CLOAKING) && !sc_data(&sd->sc, SC_HIDING) && !sc_data(&sd->sc, SC_CHASEWALK) && !sc_data(&sd->sc, SC_CLOAKINGEXCEED) &&
 				(!battle_config.prevent_logout || DIFF_TICK(gettick(), sd->canlog_tick) > battle_config.prevent_logout) ) {
 				pc_damage_log_clear(sd, 0);
 				chrif_charselectreq(sd, session[fd]->client_addr); //Send to char-server for character selection
@@ -11118,9 +11120,9 @@ void clif_parse_DropItem(int fd, struct map_session_data *sd)
 			break;
 
 		if (sd->sc.count && (
-			sd->sc.data[SC_AUTOCOUNTER] ||
-			sd->sc.data[SC_BLADESTOP] ||
-			(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOITEM)
+			sc_data(&sd->sc, SC_AUTOCOUNTER) ||
+			sc_data(&sd->sc, SC_BLADESTOP) ||
+			(sc_data(&sd->sc, SC_NOCHAT) && sc_data(&sd->sc, SC_NOCHAT)->val1&MANNER_NOITEM)
 		))
 			break;
 
@@ -11381,7 +11383,7 @@ void clif_parse_CreateChatRoom(int fd, struct map_session_data *sd)
 	char s_password[CHATROOM_PASS_SIZE];
 	char s_title[CHATROOM_TITLE_SIZE];
 
-	if (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOROOM)
+	if (sc_data(&sd->sc, SC_NOCHAT) && sc_data(&sd->sc, SC_NOCHAT)->val1&MANNER_NOROOM)
 		return;
 	if (battle_config.basic_skill_check && pc_checkskill(sd,NV_BASIC) < 4) {
 		clif_skill_fail(sd,1,USESKILL_FAIL_LEVEL,3,0);
@@ -11604,7 +11606,7 @@ void clif_parse_RemoveOption(int fd,struct map_session_data *sd)
 {
 	if( !(sd->sc.option&(OPTION_RIDING|OPTION_FALCON|OPTION_DRAGON|OPTION_MADOGEAR))
 #ifdef NEW_CARTS
-		&& sd->sc.data[SC_PUSH_CART] )
+		&& sc_data(&sd->sc, SC_PUSH_CART) )
 		pc_setcart(sd,0);
 #else
 		)
@@ -11720,7 +11722,7 @@ static void clif_parse_UseSkillToPos_homun(struct homun_data *hd, struct map_ses
 			clif_skill_fail(hd->master, skill_id, USESKILL_FAIL_SKILLINTERVAL, 0, 0);
 		return;
 	}
-	if( hd->sc.data[SC_BASILICA] )
+	if( sc_data(&hd->sc, SC_BASILICA) )
 		return;
 	lv = hom_checkskill(hd, skill_id);
 	if( skill_lv > lv )
@@ -11766,7 +11768,7 @@ static void clif_parse_UseSkillToPos_mercenary(struct mercenary_data *md, struct
 		return;
 	}
 
-	if( md->sc.data[SC_BASILICA] )
+	if( sc_data(&md->sc, SC_BASILICA) )
 		return;
 	lv = mercenary_checkskill(md, skill_id);
 	if( skill_lv > lv )
@@ -11851,7 +11853,7 @@ void clif_parse_UseSkillToId(int fd, struct map_session_data *sd)
 	if( sd->sc.option&OPTION_COSTUME )
 		return;
 
-	if( sd->sc.data[SC_BASILICA] && (skill_id != HP_BASILICA || sd->sc.data[SC_BASILICA]->val4 != sd->bl.id) )
+	if( sc_data(&sd->sc, SC_BASILICA) && (skill_id != HP_BASILICA || sc_data(&sd->sc, SC_BASILICA)->val4 != sd->bl.id) )
 		return; //On basilica only caster can use Basilica again to stop it
 
 	if( sd->menuskill_id ) {
@@ -11936,7 +11938,7 @@ static void clif_parse_UseSkillToPosSub(int fd, struct map_session_data *sd, uin
 	if( sd->sc.option&OPTION_COSTUME )
 		return;
 
-	if( sd->sc.data[SC_BASILICA] && (skill_id != HP_BASILICA || sd->sc.data[SC_BASILICA]->val4 != sd->bl.id) )
+	if( sc_data(&sd->sc, SC_BASILICA) && (skill_id != HP_BASILICA || sc_data(&sd->sc, SC_BASILICA)->val4 != sd->bl.id) )
 		return; //On basilica only caster can use Basilica again to stop it
 
 	if( sd->menuskill_id ) {
@@ -12982,7 +12984,7 @@ void clif_parse_OpenVending(int fd, struct map_session_data *sd)
 			sd->state.prevend = 0;
 	}
 
-	if( sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOROOM )
+	if( sc_data(&sd->sc, SC_NOCHAT) && sc_data(&sd->sc, SC_NOCHAT)->val1&MANNER_NOROOM )
 		return;
 	if( map[sd->bl.m].flag.novending ) {
 		clif_displaymessage(sd->fd, msg_txt(276)); // "You can't open a shop on this map"
@@ -14649,14 +14651,14 @@ void clif_parse_AutoRevive(int fd, struct map_session_data *sd)
 	uint8 hp = 100, sp = 100;
 
 	if (item_position == INDEX_NOT_FOUND) {
-		if (sd->sc.data[SC_LIGHT_OF_REGENE]) {
-			hp = sd->sc.data[SC_LIGHT_OF_REGENE]->val2;
+		if (sc_data(&sd->sc, SC_LIGHT_OF_REGENE)) {
+			hp = sc_data(&sd->sc, SC_LIGHT_OF_REGENE)->val2;
 			sp = 0;
 		} else
 			return;
 	}
 
-	if (sd->sc.data[SC_HELLPOWER])
+	if (sc_data(&sd->sc, SC_HELLPOWER))
 		return; //Cannot res while under the effect of SC_HELLPOWER
 
 	if (!status_revive(&sd->bl, hp, sp))
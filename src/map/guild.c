@@ -66,6 +66,10 @@ struct{
 int guild_payexp_timer(int tid, unsigned int tick, int id, intptr_t data);
 static int guild_send_xy_timer(int tid, unsigned int tick, int id, intptr_t data);
 
+//Account ids of members whose position may have changed since the last guild_send_xy_timer
+static int *guild_xy_dirty = NULL;
+static int guild_xy_dirty_count = 0, guild_xy_dirty_max = 0;
+
 /* guild flags cache */
 struct npc_data **guild_flags;
 unsigned short guild_flags_count;
@@ -318,35 +322,57 @@ int guild_payexp_timer(int tid, unsigned int tick, int id, intptr_t data)
 }
 
 /**
- * Taken from party_send_xy_timer_sub. [Skotlex]
- * @see DBApply
+ * Queues a guild member for the next guild_send_xy_timer.
+ * Called whenever the member moves or gets attached to its guild data,
+ * so the timer only visits members that may need an update.
+ * @param sd
  */
-int guild_send_xy_timer_sub(DBKey key, DBData *data, va_list ap)
+void guild_send_xy_mark(struct map_session_data *sd)
 {
-	struct guild *g = db_data2ptr(data);
-	int i;
-
-	nullpo_ret(g);
-
-	if( !g->connect_member ) { // no members connected to this guild so do not iterate
-		return 0;
-	}
+	if( !sd || !sd->status.guild_id || sd->state.guild_xy_dirty )
+		return;
 
-	for(i=0;i<g->max_member;i++) {
-		struct map_session_data *sd = g->member[i].sd;
-		if( sd != NULL && sd->fd && (sd->guild_x != sd->bl.x || sd->guild_y != sd->bl.y) && !sd->bg_id ) {
-			clif_guild_xy(sd);
-			sd->guild_x = sd->bl.x;
-			sd->guild_y = sd->bl.y;
-		}
+	if( guild_xy_dirty_count == guild_xy_dirty_max ) {
+		guild_xy_dirty_max = max(guild_xy_dirty_max * 2, 64);
+		RECREATE(guild_xy_dirty, int, guild_xy_dirty_max);
 	}
-	return 0;
+	guild_xy_dirty[guild_xy_dirty_count++] = sd->bl.id;
+	sd->state.guild_xy_dirty = 1;
 }
 
 //Code from party_send_xy_timer [Skotlex]
 static int guild_send_xy_timer(int tid, unsigned int tick, int id, intptr_t data)
 {
-	guild_db->foreach(guild_db,guild_send_xy_timer_sub,tick);
+	int i, count = guild_xy_dirty_count;
+
+	//For each queued member
+	for( i = 0; i < count; i++ ) {
+		struct map_session_data *sd = map_id2sd(guild_xy_dirty[i]);
+		struct guild *g;
+		int j;
+
+		if( !sd || !sd->state.guild_xy_dirty )
+			continue; //Logged out or already handled
+		sd->state.guild_xy_dirty = 0;
+
+		if( !sd->fd || sd->bg_id || (sd->guild_x == sd->bl.x && sd->guild_y == sd->bl.y) )
+			continue;
+		if( !(g = guild_search(sd->status.guild_id)) || !g->connect_member )
+			continue;
+		ARR_FIND(0, g->max_member, j, g->member[j].sd == sd);
+		if( j == g->max_member )
+			continue;
+
+		clif_guild_xy(sd);
+		sd->guild_x = sd->bl.x;
+		sd->guild_y = sd->bl.y;
+	}
+
+	//Keep anything queued while sending
+	guild_xy_dirty_count -= count;
+	if( guild_xy_dirty_count > 0 )
+		memmove(guild_xy_dirty, guild_xy_dirty + count, guild_xy_dirty_count * sizeof(*guild_xy_dirty));
+
 	return 0;
 }
 
@@ -539,8 +565,10 @@ int guild_recv_info(struct guild *sg)
 	for( i = bm = m = 0; i < g->max_member; i++ ) {
 		if( g->member[i].account_id > 0 ) {
 			sd = g->member[i].sd = guild_sd_check(g->guild_id,g->member[i].account_id,g->member[i].char_id);
-			if( sd )
+			if( sd ) {
 				clif_charnameupdate(sd); // [LuzZza]
+				guild_send_xy_mark(sd);
+			}
 			m++;
 		} else
 			g->member[i].sd = NULL;
@@ -712,6 +740,7 @@ void guild_member_joined(struct map_session_data *sd)
 	else {
 		g->member[i].sd = sd;
 		sd->guild = g;
+		guild_send_xy_mark(sd);
 
 		if( channel_config.ally_enable && channel_config.ally_autojoin )
 			channel_gjoin(sd,3);
@@ -1010,6 +1039,7 @@ int guild_recv_memberinfoshort(int guild_id,int account_id,int char_id,int onlin
 
 	//Ensure validity of pointer (ie: player logs in/out, changes map-server)
 	g->member[idx].sd = guild_sd_check(guild_id, account_id, char_id);
+	guild_send_xy_mark(g->member[idx].sd);
 
 	if(oldonline!=online)
 		clif_guild_memberlogin_notice(g, idx, online);
@@ -1374,7 +1404,7 @@ void guild_guildaura_refresh(struct map_session_data *sd, uint16 skill_id, uint1
 		return;
 	if( !skill_lv )
 		return;
-	if( sd->sc.data[type] && (group = skill_id2group(sd->sc.data[type]->val4)) ) {
+	if( sc_data(&sd->sc, type) && (group = skill_id2group(sc_data(&sd->sc, type)->val4)) ) {
 		skill_delunitgroup(group);
 		status_change_end(&sd->bl,type,INVALID_TIMER);
 	}
@@ -2290,4 +2320,7 @@ void do_final_guild(void) {
 	ers_destroy(expcache_ers);
 
 	aFree(guild_flags); //Never empty; Created on boot
+	aFree(guild_xy_dirty);
+	guild_xy_dirty = NULL;
+	guild_xy_dirty_count = guild_xy_dirty_max = 0;
 }
@@ -35,7 +35,7 @@
 
 static const int packet_len_table[] = {
 	-1,-1,27,-1, -1, 0,37, -1,  0, 0, 0, 0,  0, 0,  0, 0, //0x3800-0x380f
-	 0, 0, 0, 0,  0, 0, 0, 0, -1,11, 0, 0,  0, 0,  0, 0, //0x3810
+	 0, 0, 0, 0,  0, 0, 0, 0, -1,15, 0, 0,  0, 0,  0, 0, //0x3810
 	39,-1,15,15, 14,19, 7,-1,  0, 0, 0, 0,  0, 0,  0, 0, //0x3820
 	10,-1,15, 0, 79,19, 7,-1,  0,-1,-1,-1, 14,67,186,-1, //0x3830
 	-1, 0, 0,14,  0, 0, 0, 0, -1,74,-1,11, 11,-1,  0, 0, //0x3840
@@ -512,6 +512,46 @@ int intif_send_guild_storage(int account_id,struct guild_storage *gstor)
 	return 1;
 }
 
+/**
+ * Request to save the guild storage slots changed since the last save
+ * ZI 0x3057 <size>.W <account_id>.L <guild_id>.L <version>.L <count>.W { <slot>.W <item>.?B }*count
+ * @param account_id : account requesting the save
+ * @param gstor : Guild storage struct to save
+ * @return 0 = char-server down, 1 = sent
+ */
+int intif_send_guild_storage_delta(int account_id, struct guild_storage *gstor)
+{
+	const int entry = 2 + sizeof(struct item);
+	int i, count = 0, len;
+
+	if (CheckForCharServer())
+		return 0;
+
+	for (i = 0; i < MAX_GUILD_STORAGE; i++) {
+		if (gstor->dirty_slots[i/32]&(1U<<(i%32)))
+			count++;
+	}
+
+	len = 18 + count * entry;
+	WFIFOHEAD(inter_fd,len);
+	WFIFOW(inter_fd,0) = 0x3057;
+	WFIFOW(inter_fd,2) = len;
+	WFIFOL(inter_fd,4) = account_id;
+	WFIFOL(inter_fd,8) = gstor->guild_id;
+	WFIFOL(inter_fd,12) = gstor->version;
+	WFIFOW(inter_fd,16) = count;
+	for (i = 0, count = 0; i < MAX_GUILD_STORAGE; i++) {
+		if (!(gstor->dirty_slots[i/32]&(1U<<(i%32))))
+			continue;
+		WFIFOW(inter_fd,18 + count * entry) = i;
+		memcpy(WFIFOP(inter_fd,18 + count * entry + 2), &gstor->items[i], sizeof(struct item));
+		count++;
+	}
+	WFIFOSET(inter_fd,len);
+
+	return 1;
+}
+
 /**
  * Party creation request
  * @param member : Struct of 1 party member
@@ -1470,7 +1510,7 @@ int intif_parse_LoadGuildStorage(int fd)
  */
 int intif_parse_SaveGuildStorage(int fd)
 {
-	gstorage_storagesaved(/*RFIFOL(fd,2), */RFIFOL(fd,6));
+	gstorage_storagesaved(RFIFOL(fd,2), RFIFOL(fd,6), RFIFOB(fd,10), RFIFOL(fd,11));
 	return 1;
 }
 
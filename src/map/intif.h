@@ -29,6 +29,7 @@ int intif_request_registry(struct map_session_data *sd, int flag);
 
 int intif_request_guild_storage(int account_id, int guild_id);
 int intif_send_guild_storage(int account_id, struct guild_storage *gstor);
+int intif_send_guild_storage_delta(int account_id, struct guild_storage *gstor);
 
 
 int intif_create_party(struct party_member *member,char *name,int item,int item2);
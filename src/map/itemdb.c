@@ -1667,7 +1667,7 @@ void do_final_itemdb(void) {
  * Initializing Item DB
  */
 void do_init_itemdb(void) {
-	itemdb = uidb_alloc(DB_OPT_BASE);
+	itemdb = uidb_alloc_sized(DB_OPT_BASE, 32768);
 	itemdb_combo = uidb_alloc(DB_OPT_BASE);
 	itemdb_group = uidb_alloc(DB_OPT_BASE);
 	itemdb_create_dummy();
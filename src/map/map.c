@@ -2,6 +2,7 @@
 // For more information, see LICENCE in the main folder
 
 #include "../common/cbasetypes.h"
+#include "../common/arena.h"
 #include "../common/core.h"
 #include "../common/timer.h"
 #include "../common/ers.h"
@@ -104,7 +105,6 @@ static DBMap *bossid_db = NULL; // int id -> struct mob_data* (MVP db)
 static DBMap *map_db = NULL; // unsigned int mapindex -> struct map_data*
 static DBMap *nick_db = NULL; // int char_id -> struct charid2nick* (requested names of offline characters)
 static DBMap *charid_db = NULL; // int char_id -> struct map_session_data*
-static DBMap *regen_db = NULL; // int id -> struct block_list* (status_natural_heal processing)
 
 static int map_users = 0;
 
@@ -285,6 +285,17 @@ static void map_delblcell(struct block_list *bl)
 }
 #endif
 
+/*==========================================
+ * Queues a player's minimap dot for the next party/guild position sync.
+ *------------------------------------------*/
+static inline void map_mark_xy_dirty(struct block_list *bl)
+{
+	if( bl->type == BL_PC ) {
+		party_send_xy_mark((TBL_PC *)bl);
+		guild_send_xy_mark((TBL_PC *)bl);
+	}
+}
+
 /*==========================================
  * Adds a block to the map.
  * Returns 0 on success, 1 on failure (illegal coordinates).
@@ -315,6 +326,9 @@ int map_addblock(struct block_list *bl)
 
 	pos = x / BLOCK_SIZE + (y / BLOCK_SIZE) * map[m].bxs;
 
+	if( bl->type == BL_SKILL )
+		map[m].block_skill_count[pos]++;
+
 	if( bl->type == BL_MOB ) {
 		bl->next = map[m].block_mob[pos];
 		bl->prev = &bl_head;
@@ -332,6 +346,7 @@ int map_addblock(struct block_list *bl)
 #ifdef CELL_NOSTACK
 	map_addblcell(bl);
 #endif
+	map_mark_xy_dirty(bl);
 
 	return 0;
 }
@@ -357,6 +372,9 @@ int map_delblock(struct block_list *bl)
 	
 	pos = bl->x / BLOCK_SIZE + (bl->y / BLOCK_SIZE) * map[bl->m].bxs;
 
+	if (bl->type == BL_SKILL)
+		map[bl->m].block_skill_count[pos]--;
+
 	if (bl->next)
 		bl->next->prev = bl->prev;
 	if (bl->prev == &bl_head) {
@@ -406,11 +424,11 @@ int map_moveblock(struct block_list *bl, int x1, int y1, unsigned int tick)
 		status_change_end(bl, SC_MAGICROD, INVALID_TIMER);
 		if (sc) {
 #ifdef RENEWAL //3x3 AoE ranged damage protection
-			if (sc->data[SC_TATAMIGAESHI] && sc->data[SC_TATAMIGAESHI]->val2 >= 1)
+			if (sc_data(sc, SC_TATAMIGAESHI) && sc_data(sc, SC_TATAMIGAESHI)->val2 >= 1)
 #endif
 				status_change_end(bl, SC_TATAMIGAESHI, INVALID_TIMER);
-			if (sc->data[SC_PROPERTYWALK] &&
-				sc->data[SC_PROPERTYWALK]->val3 >= skill_get_maxcount(sc->data[SC_PROPERTYWALK]->val1, sc->data[SC_PROPERTYWALK]->val2) )
+			if (sc_data(sc, SC_PROPERTYWALK) &&
+				sc_data(sc, SC_PROPERTYWALK)->val3 >= skill_get_maxcount(sc_data(sc, SC_PROPERTYWALK)->val1, sc_data(sc, SC_PROPERTYWALK)->val2) )
 				status_change_end(bl, SC_PROPERTYWALK, INVALID_TIMER);
 		}
 	} else if (bl->type == BL_NPC)
@@ -424,6 +442,7 @@ int map_moveblock(struct block_list *bl, int x1, int y1, unsigned int tick)
 #endif
 	bl->x = x1;
 	bl->y = y1;
+	map_mark_xy_dirty(bl);
 
 	if (moveblock) {
 		if (map_addblock(bl))
@@ -446,47 +465,47 @@ int map_moveblock(struct block_list *bl, int x1, int y1, unsigned int tick)
 			}
 		}
 		if (sc && sc->count) {
-			if (sc->data[SC_DANCING])
-				skill_unit_move_unit_group(skill_id2group(sc->data[SC_DANCING]->val2), bl->m, x1 - x0, y1 - y0);
+			if (sc_data(sc, SC_DANCING))
+				skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_DANCING)->val2), bl->m, x1 - x0, y1 - y0);
 			else {
-				if (sc->data[SC_CLOAKING] && sc->data[SC_CLOAKING]->val1 < 3 && !skill_check_cloaking(bl, NULL))
+				if (sc_data(sc, SC_CLOAKING) && sc_data(sc, SC_CLOAKING)->val1 < 3 && !skill_check_cloaking(bl, NULL))
 					status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
-				if (sc->data[SC_WARM])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_WARM]->val4), bl->m, x1 - x0, y1 - y0);
+				if (sc_data(sc, SC_WARM))
+					skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_WARM)->val4), bl->m, x1 - x0, y1 - y0);
 #ifdef RENEWAL
-				if (sc->data[SC_TATAMIGAESHI])
-					sc->data[SC_TATAMIGAESHI]->val2++;
+				if (sc_data(sc, SC_TATAMIGAESHI))
+					sc_data(sc, SC_TATAMIGAESHI)->val2++;
 #endif
-				if (sc->data[SC_BANDING])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_BANDING]->val4), bl->m, x1 - x0, y1 - y0);
-				if (sc->data[SC_NEUTRALBARRIER_MASTER])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_NEUTRALBARRIER_MASTER]->val2), bl->m, x1 - x0, y1 - y0);
-				else if (sc->data[SC_STEALTHFIELD_MASTER])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_STEALTHFIELD_MASTER]->val2), bl->m, x1 - x0, y1 - y0);
-				if (sc->data[SC__SHADOWFORM]) { //Shadow Form Caster Moving
+				if (sc_data(sc, SC_BANDING))
+					skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_BANDING)->val4), bl->m, x1 - x0, y1 - y0);
+				if (sc_data(sc, SC_NEUTRALBARRIER_MASTER))
+					skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_NEUTRALBARRIER_MASTER)->val2), bl->m, x1 - x0, y1 - y0);
+				else if (sc_data(sc, SC_STEALTHFIELD_MASTER))
+					skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_STEALTHFIELD_MASTER)->val2), bl->m, x1 - x0, y1 - y0);
+				if (sc_data(sc, SC__SHADOWFORM)) { //Shadow Form Caster Moving
 					struct block_list *d_bl;
 
-					if ((d_bl = map_id2bl(sc->data[SC__SHADOWFORM]->val2)) == NULL || !check_distance_bl(bl, d_bl, 10))
+					if ((d_bl = map_id2bl(sc_data(sc, SC__SHADOWFORM)->val2)) == NULL || !check_distance_bl(bl, d_bl, 10))
 						status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 				}
-				if (sc->data[SC_PROPERTYWALK] &&
-					sc->data[SC_PROPERTYWALK]->val3 < skill_get_maxcount(sc->data[SC_PROPERTYWALK]->val1, sc->data[SC_PROPERTYWALK]->val2) &&
+				if (sc_data(sc, SC_PROPERTYWALK) &&
+					sc_data(sc, SC_PROPERTYWALK)->val3 < skill_get_maxcount(sc_data(sc, SC_PROPERTYWALK)->val1, sc_data(sc, SC_PROPERTYWALK)->val2) &&
 					map_find_skill_unit_oncell(bl, bl->x, bl->y, SO_ELECTRICWALK, NULL, 0) == NULL &&
 					map_find_skill_unit_oncell(bl, bl->x, bl->y, SO_FIREWALK, NULL, 0) == NULL &&
-					skill_unitsetting(bl, sc->data[SC_PROPERTYWALK]->val1, sc->data[SC_PROPERTYWALK]->val2, x0,  y0, 0)) {
-						sc->data[SC_PROPERTYWALK]->val3++;
+					skill_unitsetting(bl, sc_data(sc, SC_PROPERTYWALK)->val1, sc_data(sc, SC_PROPERTYWALK)->val2, x0,  y0, 0)) {
+						sc_data(sc, SC_PROPERTYWALK)->val3++;
 				}
 			}
 			//Guild Aura Moving
 			if (bl->type == BL_PC && ((TBL_PC *)bl)->state.gmaster_flag) {
-				if (sc->data[SC_LEADERSHIP])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_LEADERSHIP]->val4), bl->m, x1 - x0, y1 - y0);
-				if (sc->data[SC_GLORYWOUNDS])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_GLORYWOUNDS]->val4), bl->m, x1 - x0, y1 - y0);
-				if (sc->data[SC_SOULCOLD])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_SOULCOLD]->val4), bl->m, x1 - x0, y1 - y0);
-				if (sc->data[SC_HAWKEYES])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_HAWKEYES]->val4), bl->m, x1 - x0, y1 - y0);
+				if (sc_data(sc, SC_LEADERSHIP))
+					skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_LEADERSHIP)->val4), bl->m, x1 - x0, y1 - y0);
+				if (sc_data(sc, SC_GLORYWOUNDS))
+					skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_GLORYWOUNDS)->val4), bl->m, x1 - x0, y1 - y0);
+				if (sc_data(sc, SC_SOULCOLD))
+					skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_SOULCOLD)->val4), bl->m, x1 - x0, y1 - y0);
+				if (sc_data(sc, SC_HAWKEYES))
+					skill_unit_move_unit_group(skill_id2group(sc_data(sc, SC_HAWKEYES)->val4), bl->m, x1 - x0, y1 - y0);
 			}
 		}
 	} else if (bl->type == BL_NPC)
@@ -495,6 +514,17 @@ int map_moveblock(struct block_list *bl, int x1, int y1, unsigned int tick)
 	return 0;
 }
 	
+/*==========================================
+ * Number of skill units in the block holding the given cell.
+ * Zero means no skill unit can be on that cell.
+ *------------------------------------------*/
+unsigned short map_block_skillunits(int16 m, int16 x, int16 y)
+{
+	if( x < 0 || y < 0 || x >= map[m].xs || y >= map[m].ys )
+		return 0;
+	return map[m].block_skill_count[x / BLOCK_SIZE + (y / BLOCK_SIZE) * map[m].bxs];
+}
+
 /*==========================================
  * Counts specified number of objects on given cell.
  * flag:
@@ -1735,6 +1765,7 @@ void map_addiddb(struct block_list *bl)
 		TBL_PC* sd = (TBL_PC *)bl;
 		idb_put(pc_db,sd->bl.id,sd);
 		idb_put(charid_db,sd->status.char_id,sd);
+		pc_autosave_link(sd);
 	}
 	else if( bl->type == BL_MOB )
 	{
@@ -1746,7 +1777,7 @@ void map_addiddb(struct block_list *bl)
 	}
 
 	if( bl->type & BL_REGEN )
-		idb_put(regen_db, bl->id, bl);
+		status_regen_add(bl);
 
 	idb_put(id_db,bl->id,bl);
 }
@@ -1762,13 +1793,14 @@ void map_deliddb(struct block_list *bl)
 		TBL_PC* sd = (TBL_PC *)bl;
 		idb_remove(pc_db,sd->bl.id);
 		idb_remove(charid_db,sd->status.char_id);
+		pc_autosave_unlink(sd);
 	} else if( bl->type == BL_MOB ) {
 		idb_remove(mobid_db,bl->id);
 		idb_remove(bossid_db,bl->id);
 	}
 
 	if( bl->type & BL_REGEN )
-		idb_remove(regen_db,bl->id);
+		status_regen_remove(bl);
 
 	idb_remove(id_db,bl->id);
 }
@@ -1828,8 +1860,8 @@ int map_quit(struct map_session_data *sd) {
 		status_change_end(&sd->bl,SC_SOULCOLD,INVALID_TIMER);
 		status_change_end(&sd->bl,SC_HAWKEYES,INVALID_TIMER);
 		status_change_end(&sd->bl,SC_CHASEWALK2,INVALID_TIMER);
-		if (sd->sc.data[SC_ENDURE] && sd->sc.data[SC_ENDURE]->val4) {
-			sd->sc.data[SC_ENDURE]->val4 = 0; //No need to save infinite endure
+		if (sc_data(&sd->sc, SC_ENDURE) && sc_data(&sd->sc, SC_ENDURE)->val4) {
+			sc_data(&sd->sc, SC_ENDURE)->val4 = 0; //No need to save infinite endure
 			status_change_end(&sd->bl,SC_ENDURE,INVALID_TIMER);
 		}
 		status_change_end(&sd->bl,SC_WEIGHT50,INVALID_TIMER);
@@ -1845,7 +1877,7 @@ int map_quit(struct map_session_data *sd) {
 			status_change_end(&sd->bl,SC_EXTREMITYFIST,INVALID_TIMER);
 #endif
 			status_change_end(&sd->bl,SC_EXPLOSIONSPIRITS,INVALID_TIMER);
-			if (sd->sc.data[SC_REGENERATION] && sd->sc.data[SC_REGENERATION]->val4)
+			if (sc_data(&sd->sc, SC_REGENERATION) && sc_data(&sd->sc, SC_REGENERATION)->val4)
 				status_change_end(&sd->bl,SC_REGENERATION,INVALID_TIMER);
 			//@TODO: Probably there are way more NPC_type negative status that are removed
 			status_change_end(&sd->bl,SC_CHANGEUNDEAD,INVALID_TIMER);
@@ -2159,28 +2191,6 @@ void map_foreachnpc(int (*func)(struct npc_data* nd, va_list args), ...)
 	dbi_destroy(iter);
 }
 
-/// Applies func to everything in the db.
-/// Stops iterating if func returns -1.
-void map_foreachregen(int (*func)(struct block_list *bl, va_list args), ...)
-{
-	DBIterator *iter;
-	struct block_list *bl;
-
-	iter = db_iterator(regen_db);
-	for( bl = (struct block_list *)dbi_first(iter); dbi_exists(iter); bl = (struct block_list *)dbi_next(iter) )
-	{
-		va_list args;
-		int ret;
-
-		va_start(args, func);
-		ret = func(bl, args);
-		va_end(args);
-		if( ret == -1 )
-			break;// stop iterating
-	}
-	dbi_destroy(iter);
-}
-
 /// Applies func to everything in the db.
 /// Stops iterating if func returns -1.
 void map_foreachiddb(int (*func)(struct block_list *bl, va_list args), ...)
@@ -2234,7 +2244,8 @@ struct s_mapiterator* mapit_alloc(enum e_mapitflags flags, enum bl_type types)
 {
 	struct s_mapiterator* mapit;
 
-	CREATE(mapit, struct s_mapiterator, 1);
+	mapit = (struct s_mapiterator*)arena_alloc(sizeof(struct s_mapiterator)); // only lives in the current callback
+	memset(mapit, 0, sizeof(struct s_mapiterator));
 	mapit->flags = flags;
 	mapit->types = types;
 	if( types == BL_PC )       mapit->dbi = db_iterator(pc_db);
@@ -2251,7 +2262,7 @@ void mapit_free(struct s_mapiterator* mapit)
 	nullpo_retv(mapit);
 
 	dbi_destroy(mapit->dbi);
-	aFree(mapit);
+	arena_free(mapit, sizeof(struct s_mapiterator));
 }
 
 /// Returns the first block_list that matches the description.
@@ -2428,10 +2439,12 @@ int map_addinstancemap(const char *name, int id)
 	num_cell = map[dst_m].xs * map[dst_m].ys;
 	CREATE(map[dst_m].cell, struct mapcell, num_cell);
 	memcpy(map[dst_m].cell, map[src_m].cell, num_cell * sizeof(struct mapcell));
+	path_cache_clear(); //Map slot may have held another instance
 
 	size = map[dst_m].bxs * map[dst_m].bys * sizeof(struct block_list *);
 	map[dst_m].block = (struct block_list **)aCalloc(1,size);
 	map[dst_m].block_mob = (struct block_list **)aCalloc(1,size);
+	map[dst_m].block_skill_count = (unsigned short *)aCalloc(map[dst_m].bxs * map[dst_m].bys, sizeof(unsigned short));
 
 	map[dst_m].index = mapindex_addmap(-1, map[dst_m].name);
 	map[dst_m].channel = NULL;
@@ -2508,8 +2521,10 @@ int map_delinstancemap(int m)
 
 	// Free memory
 	aFree(map[m].cell);
+	path_cache_clear();
 	aFree(map[m].block);
 	aFree(map[m].block_mob);
+	aFree(map[m].block_skill_count);
 
 	map_removemapdb(&map[m]);
 	memset(&map[m], 0x00, sizeof(map[0]));
@@ -2946,8 +2961,10 @@ void map_setcell(int16 m, int16 x, int16 y, cell_t cell, bool flag)
 
 		default:
 			ShowWarning("map_setcell: invalid cell type '%d'\n", (int)cell);
-			break;
+			return;
 	}
+
+	path_cache_clear(); //Cached walk paths may cross this cell
 }
 
 void map_setgatcell(int16 m, int16 x, int16 y, int gat)
@@ -2964,6 +2981,8 @@ void map_setgatcell(int16 m, int16 x, int16 y, int gat)
 	map[m].cell[j].walkable = cell.walkable;
 	map[m].cell[j].shootable = cell.shootable;
 	map[m].cell[j].water = cell.water;
+
+	path_cache_clear(); //Cached walk paths may cross this cell
 }
 
 /*==========================================
@@ -3307,6 +3326,9 @@ void do_final_maps(void) {
 		if( map[i].block_mob )
 			aFree(map[i].block_mob);
 
+		if( map[i].block_skill_count )
+			aFree(map[i].block_skill_count);
+
 		if( battle_config.dynamic_mobs ) { //Dynamic mobs flag by [random]
 			int j;
 
@@ -3558,6 +3580,7 @@ int map_readallmaps (void)
 		size = map[i].bxs * map[i].bys * sizeof(struct block_list *);
 		map[i].block = (struct block_list**)aCalloc(size, 1);
 		map[i].block_mob = (struct block_list**)aCalloc(size, 1);
+		map[i].block_skill_count = (unsigned short *)aCalloc(map[i].bxs * map[i].bys, sizeof(unsigned short));
 	}
 
 	//Intialization and configuration-dependent adjustments of mapflags
@@ -3584,6 +3607,45 @@ int map_readallmaps (void)
 static int map_ip_set = 0;
 static int char_ip_set = 0;
 
+/// Subsystem statistics shown by the "stats" console command
+static const struct {
+	const char *name;
+	void (*report)(void);
+	const char *desc;
+} map_stats[] = {
+	{ "ers",        ers_report,             "database usage" },
+	{ "script",     script_pool_report,     "script state pool usage" },
+	{ "mapreg",     mapreg_report,          "global variable write-behind statistics" },
+	{ "sc",         status_sc_report,       "status change storage usage and periodic tick alignment" },
+	{ "statuscalc", status_calc_report,     "how many status recalculations were merged" },
+	{ "skillunit",  skill_unit_move_report, "how many skill unit cell checks were skipped" },
+	{ "path",       path_cache_report,      "how many walk path searches were answered from the path cache" },
+	{ "autosave",   pc_autosave_report,     "the autosave cycle, oldest save and save rate" },
+};
+
+/**
+ * Displays the statistics of one subsystem, or of all of them.
+ * @param name: Subsystem name, NULL or empty for all
+ */
+static void map_stats_report(const char *name)
+{
+	int i;
+
+	for( i = 0; i < ARRAYLENGTH(map_stats); i++ ) {
+		if( name && *name && strcmpi(name, map_stats[i].name) != 0 )
+			continue;
+		map_stats[i].report();
+		if( name && *name )
+			return;
+	}
+	if( name && *name ) {
+		ShowInfo("Unknown statistics '%s', available:", name);
+		for( i = 0; i < ARRAYLENGTH(map_stats); i++ )
+			ShowMessage(" %s", map_stats[i].name);
+		ShowMessage("\n");
+	}
+}
+
 /*==========================================
  * Console Command Parser [Wizputer]
  *------------------------------------------*/
@@ -3640,12 +3702,26 @@ int parse_console(const char *buf) {
 		}
 	} else if( strcmpi("ers_report", type) == 0 ) {
 		ers_report();
+	} else if( strcmpi("stats", type) == 0 ) {
+		map_stats_report(n >= 2 ? command : NULL);
+	} else if( strcmpi("path_bench", type) == 0 ) {
+		path_bench(n >= 2 ? command : "");
+	} else if( strcmpi("drop_sim", type) == 0 ) {
+		mob_drop_sim(n >= 2 ? command : "");
+	} else if( strcmpi("aoe_bench", type) == 0 ) {
+		battle_aoe_bench(n >= 2 ? command : "");
 	} else if( strcmpi("help", type) == 0 ) {
 		ShowInfo("Available commands:\n");
 		ShowInfo("\t admin:@<atcommand> => Uses an atcommand. Do NOT use commands requiring an attached player.\n");
 		ShowInfo("\t admin:map:<map> <x> <y> => Changes the map from which console commands are executed.\n");
 		ShowInfo("\t server:shutdown => Stops the server.\n");
 		ShowInfo("\t ers_report => Displays database usage.\n");
+		ShowInfo("\t stats{:<name>} => Displays the statistics of all subsystems, or of one of them:\n");
+		for( n = 0; n < ARRAYLENGTH(map_stats); n++ )
+			ShowInfo("\t\t %s => %s\n", map_stats[n].name, map_stats[n].desc);
+		ShowInfo("\t aoe_bench:<skill_id> <skill_lv> <rounds> => Times the damage formula of an area skill on the characters around the first online player.\n");
+		ShowInfo("\t path_bench:<map name> <queries> => Times walk path searches (with and without the path cache) and line of sight checks between random cells of a map.\n");
+		ShowInfo("\t drop_sim:<mob_id> <kills> => Simulates the drops of a monster and compares them to the configured rates.\n");
 	}
 
 	return 0;
@@ -4170,6 +4246,7 @@ void do_final(void)
 	do_final_skill();
 	do_final_status();
 	do_final_unit();
+	do_final_path();
 	do_final_battleground();
 	do_final_duel();
 	do_final_elemental();
@@ -4177,6 +4254,7 @@ void do_final(void)
 	do_final_channel(); // Should be called after final guild
 	do_final_vending();
 	do_final_buyingstore();
+	do_final_searchstore();
 	do_final_maps();
 
 	map_db->destroy(map_db, map_db_final);
@@ -4192,7 +4270,6 @@ void do_final(void)
 	nick_db->destroy(nick_db, nick_db_final);
 	charid_db->destroy(charid_db, NULL);
 	iwall_db->destroy(iwall_db, NULL);
-	regen_db->destroy(regen_db, NULL);
 
 #ifdef ADJUST_SKILL_DAMAGE
 	ers_destroy(map_skill_damage_ers);
@@ -4340,14 +4417,13 @@ int do_init(int argc, char *argv[])
 	inter_config_read(INTER_CONF_NAME);
 	log_config_read(LOG_CONF_NAME);
 
-	id_db = idb_alloc(DB_OPT_BASE);
+	id_db = idb_alloc_sized(DB_OPT_BASE, 65536); // Every npc, mob and player, sized so it doesn't grow while loading
 	pc_db = idb_alloc(DB_OPT_BASE);	//Added for reliable map_id2sd() use. [Skotlex]
-	mobid_db = idb_alloc(DB_OPT_BASE);	//Added to lower the load of the lazy mob ai. [Skotlex]
+	mobid_db = idb_alloc_sized(DB_OPT_BASE, 32768);	//Added to lower the load of the lazy mob ai. [Skotlex]
 	bossid_db = idb_alloc(DB_OPT_BASE); // Used for Convex Mirror quick MVP search
 	map_db = uidb_alloc(DB_OPT_BASE);
 	nick_db = idb_alloc(DB_OPT_BASE);
 	charid_db = idb_alloc(DB_OPT_BASE);
-	regen_db = idb_alloc(DB_OPT_BASE); // efficient status_natural_heal processing
 
 	iwall_db = strdb_alloc(DB_OPT_RELEASE_DATA, 2 * NAME_LENGTH + 2 + 1); // [Zephyrus] Invisible Walls
 
@@ -4395,6 +4471,7 @@ int do_init(int argc, char *argv[])
 	do_init_unit();
 	do_init_battleground();
 	do_init_duel();
+	do_init_searchstore();
 	do_init_vending();
 	do_init_buyingstore();
 
@@ -4409,6 +4486,7 @@ int do_init(int argc, char *argv[])
 
 	if (runflag != CORE_ST_STOP) {
 		shutdown_callback = do_shutdown;
+		step_callback = status_calc_flush;
 		runflag = MAPSERVER_ST_RUNNING;
 	}
 #if defined(BUILDBOT)
@@ -578,6 +578,7 @@ struct map_data {
 	struct mapcell* cell; // Holds the information of each map cell (NULL if the map is not on this map-server).
 	struct block_list **block;
 	struct block_list **block_mob;
+	unsigned short *block_skill_count; // Number of skill units in each block, lets walking on clean ground skip the cell scan
 	int16 m;
 	int16 xs,ys; // map dimensions (in cells)
 	int16 bxs,bys; // map dimensions (in blocks)
@@ -760,6 +761,7 @@ int map_foreachinpath(int (*func)(struct block_list *, va_list), int16 m, int16
 int map_foreachinmap(int (*func)(struct block_list *, va_list), int16 m, int type, ...);
 // Blocklist nb in one cell
 int map_count_oncell(int16 m, int16 x, int16 y, int type, int flag);
+unsigned short map_block_skillunits(int16 m, int16 x, int16 y);
 struct skill_unit *map_find_skill_unit_oncell(struct block_list *, int16 x, int16 y, uint16 skill_id, struct skill_unit *, int flag);
 // search and creation
 int map_get_new_object_id(void);
@@ -811,7 +813,6 @@ void map_deliddb(struct block_list *bl);
 void map_foreachpc(int (*func)(struct map_session_data *sd, va_list args), ...);
 void map_foreachmob(int (*func)(struct mob_data *md, va_list args), ...);
 void map_foreachnpc(int (*func)(struct npc_data* nd, va_list args), ...);
-void map_foreachregen(int (*func)(struct block_list *bl, va_list args), ...);
 void map_foreachiddb(int (*func)(struct block_list *bl, va_list args), ...);
 struct map_session_data *map_nick2sd(const char *);
 struct mob_data * map_getmob_boss(int16 m);
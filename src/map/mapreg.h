@@ -10,17 +10,18 @@ struct mapreg_save {
 		int i;
 		char *str;
 	} u;
-	bool save;
 };
 
 void mapreg_reload(void);
 void mapreg_final(void);
 void mapreg_init(void);
 bool mapreg_config_read(const char *w1, const char *w2);
+void mapreg_report(void);
 
 int mapreg_readreg(int uid);
 char *mapreg_readregstr(int uid);
 bool mapreg_setreg(int uid, int val);
 bool mapreg_setregstr(int uid, const char *str);
+struct script_array *mapreg_getarray(int id);
 
 #endif /* _MAPREG_H_ */
@@ -17,13 +17,39 @@
 
 static DBMap *mapreg_db = NULL; // int var_id -> int value
 static DBMap *mapregstr_db = NULL; // int var_id -> char *value
+static DBMap *mapreg_array_db = NULL; // int var_id -> struct script_array *
+static DBMap *mapreg_dirty_db = NULL; // int var_id -> 1, permanent variables waiting to be written
 static struct eri *mapreg_ers; //[Ind]
 
 static char mapreg_table[32] = "mapreg";
-static bool mapreg_i_dirty = false;
-static bool mapreg_str_dirty = false;
-
-#define MAPREG_AUTOSAVE_INTERVAL (300*1000)
+static int mapreg_save_interval = 300*1000; // Autosave interval in ms
+static int mapreg_save_threshold = 1000; // Flush early once this many keys are dirty (0 = only on autosave)
+
+#define MAPREG_FLUSH_CHUNK 100 // Keys per batched DELETE/INSERT statement
+
+/// Write-behind statistics, shown by the "stats" console command.
+static struct {
+	unsigned int writes; // Writes to permanent variables
+	unsigned int coalesced; // Writes absorbed by a key that was already dirty
+	unsigned int rows; // Rows written to the database
+	unsigned int statements; // Queries sent to the database
+	unsigned int flushes; // Non-empty flushes
+} mapreg_stats;
+
+static void script_save_mapreg(void);
+
+/// Marks a permanent variable as needing to be written on the next flush.
+/// Repeated writes to the same key before the flush are coalesced.
+static void mapreg_mark_dirty(int uid) {
+	mapreg_stats.writes++;
+	if( idb_exists(mapreg_dirty_db, uid) ) {
+		mapreg_stats.coalesced++;
+		return;
+	}
+	idb_iput(mapreg_dirty_db, uid, 1);
+	if( mapreg_save_threshold > 0 && db_size(mapreg_dirty_db) >= (unsigned int)mapreg_save_threshold )
+		script_save_mapreg();
+}
 
 
 /// Looks up the value of an integer variable using its uid.
@@ -38,96 +64,72 @@ char *mapreg_readregstr(int uid) {
 	return m?m->u.str:NULL;
 }
 
+/// Looks up the array bookkeeping of a variable.
+struct script_array *mapreg_getarray(int id) {
+	return script_array_get(mapreg_array_db, id);
+}
+
 /// Modifies the value of an integer variable.
 bool mapreg_setreg(int uid, int val) {
 	struct mapreg_save *m;
-	int num = (uid & 0x00ffffff);
-	int i   = (uid & 0xff000000) >> 24;
-	const char *name = get_str(num);
+	const char *name = get_str(uid & 0x00ffffff);
 
 	if( val != 0 ) {
 		if( (m = idb_get(mapreg_db,uid)) ) {
 			m->u.i = val;
-			if(name[1] != '@') {
-				m->save = true;
-				mapreg_i_dirty = true;
-			}
 		} else {
 			m = ers_alloc(mapreg_ers, struct mapreg_save);
 
 			m->u.i = val;
 			m->uid = uid;
-			m->save = false;
-
-			if(name[1] != '@') {// write new variable to database
-				char tmp_str[32*2+1];
-				Sql_EscapeStringLen(mmysql_handle, tmp_str, name, strnlen(name, 32));
-				if( SQL_ERROR == Sql_Query(mmysql_handle, "INSERT INTO `%s`(`varname`,`index`,`value`) VALUES ('%s','%d','%d')", mapreg_table, tmp_str, i, val) )
-					Sql_ShowDebug(mmysql_handle);
-			}
 			idb_put(mapreg_db, uid, m);
 		}
+		script_array_update(&mapreg_array_db, uid, false);
 	} else { // val == 0
 		if( (m = idb_get(mapreg_db,uid)) ) {
 			ers_free(mapreg_ers, m);
 		}
 		idb_remove(mapreg_db,uid);
-
-		if( name[1] != '@' ) {// Remove from database because it is unused.
-			if( SQL_ERROR == Sql_Query(mmysql_handle, "DELETE FROM `%s` WHERE `varname`='%s' AND `index`='%d'", mapreg_table, name, i) )
-				Sql_ShowDebug(mmysql_handle);
-		}
+		script_array_update(&mapreg_array_db, uid, true);
 	}
 
+	if( name[1] != '@' )
+		mapreg_mark_dirty(uid);
+
 	return true;
 }
 
 /// Modifies the value of a string variable.
 bool mapreg_setregstr(int uid, const char *str) {
 	struct mapreg_save *m;
-	int num = (uid & 0x00ffffff);
-	int i   = (uid & 0xff000000) >> 24;
-	const char *name = get_str(num);
+	const char *name = get_str(uid & 0x00ffffff);
 	
 	if( str == NULL || *str == 0 ) {
-		if(name[1] != '@') {
-			if( SQL_ERROR == Sql_Query(mmysql_handle, "DELETE FROM `%s` WHERE `varname`='%s' AND `index`='%d'", mapreg_table, name, i) )
-				Sql_ShowDebug(mmysql_handle);
-		}
 		if( (m = idb_get(mapregstr_db,uid)) ) {
 			if( m->u.str != NULL )
 				aFree(m->u.str);
 			ers_free(mapreg_ers, m);
 		}
 		idb_remove(mapregstr_db,uid);
+		script_array_update(&mapreg_array_db, uid, true);
 	} else {
 		if( (m = idb_get(mapregstr_db,uid)) ) {
 			if( m->u.str != NULL )
 				aFree(m->u.str);
 			m->u.str = aStrdup(str);
-			if(name[1] != '@') {
-				mapreg_str_dirty = true;
-				m->save = true;
-			}
 		} else {
 			m = ers_alloc(mapreg_ers, struct mapreg_save);
 
 			m->uid = uid;
 			m->u.str = aStrdup(str);
-			m->save = false;
-			
-			if(name[1] != '@') { //put returned null, so we must insert.
-				char tmp_str[32*2+1];
-				char tmp_str2[255*2+1];
-				Sql_EscapeStringLen(mmysql_handle, tmp_str, name, strnlen(name, 32));
-				Sql_EscapeStringLen(mmysql_handle, tmp_str2, str, strnlen(str, 255));
-				if( SQL_ERROR == Sql_Query(mmysql_handle, "INSERT INTO `%s`(`varname`,`index`,`value`) VALUES ('%s','%d','%s')", mapreg_table, tmp_str, i, tmp_str2) )
-					Sql_ShowDebug(mmysql_handle);
-			}
 			idb_put(mapregstr_db, uid, m);
 		}
+		script_array_update(&mapreg_array_db, uid, false);
 	}
 
+	if( name[1] != '@' )
+		mapreg_mark_dirty(uid);
+
 	return true;
 }
 
@@ -176,7 +178,6 @@ static void script_load_mapreg(void) {
 		
 		m = ers_alloc(mapreg_ers, struct mapreg_save);
 		m->uid = (i<<24)|s;
-		m->save = false;
 		if( varname[length-1] == '$' ) {
 			m->u.str = aStrdup(value);
 			idb_put(mapregstr_db, m->uid, m);
@@ -184,54 +185,114 @@ static void script_load_mapreg(void) {
 			m->u.i = atoi(value);
 			idb_put(mapreg_db, m->uid, m);
 		}
+		script_array_update(&mapreg_array_db, m->uid, (varname[length-1] == '$' ? !value[0] : !m->u.i));
 	}
 	
 	SqlStmt_Free(stmt);
+}
+
+/// Writes a batch of dirty variables.
+/// The rows are removed in one statement and the ones that still hold a value
+/// are inserted back in another, so a key costs the same whether it was added,
+/// changed or cleared since the last flush.
+/// Both statements run in one transaction.
+static void mapreg_flush_chunk(const int *uids, int count) {
+	StringBuf buf;
+	char esc_name[32*2+1];
+	char esc_value[255*2+1];
+	int n, rows = 0;
+	bool result = false;
+
+	StringBuf_InitArena(&buf);
+	StringBuf_Printf(&buf, "DELETE FROM `%s` WHERE (`varname`,`index`) IN (", mapreg_table);
+	for( n = 0; n < count; n++ ) {
+		const char *name = get_str(uids[n] & 0x00ffffff);
+
+		Sql_EscapeStringLen(mmysql_handle, esc_name, name, strnlen(name, 32));
+		if( n )
+			StringBuf_AppendStr(&buf, ",");
+		StringBuf_Printf(&buf, "('%s','%d')", esc_name, (uids[n] & 0xff000000) >> 24);
+	}
+	StringBuf_AppendStr(&buf, ")");
+
+	//The DELETE and the INSERT must apply together, or an interrupted flush would lose the variables
+	if( SQL_SUCCESS != Sql_QueryStr(mmysql_handle, "START TRANSACTION")
+	||  SQL_SUCCESS != Sql_QueryStr(mmysql_handle, StringBuf_Value(&buf)) ) {
+		Sql_ShowDebug(mmysql_handle);
+		Sql_QueryStr(mmysql_handle, "ROLLBACK");
+		StringBuf_Destroy(&buf);
+		return;
+	}
+	mapreg_stats.statements++;
+
+	StringBuf_Clear(&buf);
+	StringBuf_Printf(&buf, "INSERT INTO `%s`(`varname`,`index`,`value`) VALUES ", mapreg_table);
+	for( n = 0; n < count; n++ ) {
+		const char *name = get_str(uids[n] & 0x00ffffff);
+		size_t len = strnlen(name, 32);
+		struct mapreg_save *m;
+
+		if( len && name[len - 1] == '$' ) {
+			if( (m = idb_get(mapregstr_db, uids[n])) == NULL )
+				continue;
+			Sql_EscapeStringLen(mmysql_handle, esc_value, m->u.str, safestrnlen(m->u.str, 255));
+		} else {
+			if( (m = idb_get(mapreg_db, uids[n])) == NULL )
+				continue;
+			safesnprintf(esc_value, sizeof(esc_value), "%d", m->u.i);
+		}
+		Sql_EscapeStringLen(mmysql_handle, esc_name, name, len);
+		if( rows++ )
+			StringBuf_AppendStr(&buf, ",");
+		StringBuf_Printf(&buf, "('%s','%d','%s')", esc_name, (uids[n] & 0xff000000) >> 24, esc_value);
+	}
+	if( !rows || SQL_SUCCESS == Sql_QueryStr(mmysql_handle, StringBuf_Value(&buf)) )
+		result = true;
+	else
+		Sql_ShowDebug(mmysql_handle);
+	if( rows ) {
+		mapreg_stats.statements++;
+		if( result )
+			mapreg_stats.rows += rows;
+	}
 
-	mapreg_i_dirty = false;
-	mapreg_str_dirty = false;
+	if( SQL_SUCCESS != Sql_QueryStr(mmysql_handle, (result == true) ? "COMMIT" : "ROLLBACK") )
+		Sql_ShowDebug(mmysql_handle);
+	StringBuf_Destroy(&buf);
 }
 
 /// Saves permanent variables to database
 static void script_save_mapreg(void) {
 	DBIterator *iter;
-	struct mapreg_save *m = NULL;
+	DBKey key;
+	int uids[MAPREG_FLUSH_CHUNK];
+	int count = 0;
 
-	if( mapreg_i_dirty ) {
-		iter = db_iterator(mapreg_db);
-		for( m = dbi_first(iter); dbi_exists(iter); m = dbi_next(iter) ) {
-			if( m->save ) {
-				int num = (m->uid & 0x00ffffff);
-				int i   = (m->uid & 0xff000000) >> 24;
-				const char *name = get_str(num);
-
-				if( SQL_ERROR == Sql_Query(mmysql_handle, "UPDATE `%s` SET `value`='%d' WHERE `varname`='%s' AND `index`='%d' LIMIT 1", mapreg_table, m->u.i, name, i) )
-					Sql_ShowDebug(mmysql_handle);
-				m->save = false;
-			}
-		}
-		dbi_destroy(iter);
-		mapreg_i_dirty = false;
-	}
+	if( db_size(mapreg_dirty_db) == 0 )
+		return;
 
-	if( mapreg_str_dirty ) {
-		iter = db_iterator(mapregstr_db);
-		for( m = dbi_first(iter); dbi_exists(iter); m = dbi_next(iter) ) {
-			if( m->save ) {
-				int num = (m->uid & 0x00ffffff);
-				int i   = (m->uid & 0xff000000) >> 24;
-				const char *name = get_str(num);
-				char tmp_str2[2*255+1];
-
-				Sql_EscapeStringLen(mmysql_handle, tmp_str2, m->u.str, safestrnlen(m->u.str, 255));
-				if( SQL_ERROR == Sql_Query(mmysql_handle, "UPDATE `%s` SET `value`='%s' WHERE `varname`='%s' AND `index`='%d' LIMIT 1", mapreg_table, tmp_str2, name, i) )
-					Sql_ShowDebug(mmysql_handle);
-				m->save = false;
-			}
+	iter = db_iterator(mapreg_dirty_db);
+	for( iter->first(iter, &key); dbi_exists(iter); iter->next(iter, &key) ) {
+		uids[count++] = key.i;
+		if( count == MAPREG_FLUSH_CHUNK ) {
+			mapreg_flush_chunk(uids, count);
+			count = 0;
 		}
-		dbi_destroy(iter);
-		mapreg_str_dirty = false;
 	}
+	dbi_destroy(iter);
+	if( count )
+		mapreg_flush_chunk(uids, count);
+
+	db_clear(mapreg_dirty_db);
+	mapreg_stats.flushes++;
+}
+
+/// Displays write-behind statistics.
+void mapreg_report(void) {
+	ShowMessage(CL_BOLD"[Mapreg write-behind report]\n"CL_NORMAL);
+	ShowMessage("\tpending keys: %u (threshold %d, interval %dms)\n", db_size(mapreg_dirty_db), mapreg_save_threshold, mapreg_save_interval);
+	ShowMessage("\twrites: %u, coalesced: %u\n", mapreg_stats.writes, mapreg_stats.coalesced);
+	ShowMessage("\tflushes: %u, rows: %u, statements: %u\n", mapreg_stats.flushes, mapreg_stats.rows, mapreg_stats.statements);
 }
 
 static int script_autosave_mapreg(int tid, unsigned int tick, int id, intptr_t data) {
@@ -263,6 +324,7 @@ void mapreg_reload(void) {
 	
 	db_clear(mapreg_db);
 	db_clear(mapregstr_db);
+	db_clear(mapreg_array_db);
 
 	script_load_mapreg();
 }
@@ -290,6 +352,8 @@ void mapreg_final(void) {
 		
 	db_destroy(mapreg_db);
 	db_destroy(mapregstr_db);
+	db_destroy(mapreg_array_db);
+	db_destroy(mapreg_dirty_db);
 	
 	ers_destroy(mapreg_ers);
 }
@@ -297,17 +361,23 @@ void mapreg_final(void) {
 void mapreg_init(void) {
 	mapreg_db = idb_alloc(DB_OPT_BASE);
 	mapregstr_db = idb_alloc(DB_OPT_BASE);
+	mapreg_array_db = idb_alloc(DB_OPT_RELEASE_DATA);
+	mapreg_dirty_db = idb_alloc(DB_OPT_BASE);
 	mapreg_ers = ers_new(sizeof(struct mapreg_save), "mapreg_sql.c::mapreg_ers", ERS_OPT_NONE);
 
 	script_load_mapreg();
 
 	add_timer_func_list(script_autosave_mapreg, "script_autosave_mapreg");
-	add_timer_interval(gettick() + MAPREG_AUTOSAVE_INTERVAL, script_autosave_mapreg, 0, 0, MAPREG_AUTOSAVE_INTERVAL);
+	add_timer_interval(gettick() + mapreg_save_interval, script_autosave_mapreg, 0, 0, mapreg_save_interval);
 }
 
 bool mapreg_config_read(const char *w1, const char *w2) {
 	if(!strcmpi(w1, "mapreg_db"))
 		safestrncpy(mapreg_table, w2, sizeof(mapreg_table));
+	else if(!strcmpi(w1, "mapreg_save_interval"))
+		mapreg_save_interval = max(atoi(w2), 1000);
+	else if(!strcmpi(w1, "mapreg_save_threshold"))
+		mapreg_save_threshold = max(atoi(w2), 0);
 	else
 		return false;
 
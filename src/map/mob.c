@@ -395,7 +395,7 @@ bool mob_ksprotected(struct block_list *src, struct block_list *target)
 		if( md->db->mexp || md->master_id )
 			return false; // MVP, Slaves mobs ignores KS
 
-		if( (sce = md->sc.data[SC_KSPROTECTED]) == NULL )
+		if( (sce = sc_data(&md->sc, SC_KSPROTECTED)) == NULL )
 			break; // No KS Protected
 
 		if( sd->bl.id == sce->val1 || // Same Owner
@@ -1411,12 +1411,12 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 
 	//Abnormalities
 	if((md->sc.opt1 && md->sc.opt1 != OPT1_STONEWAIT && md->sc.opt1 != OPT1_BURNING && md->sc.opt1 != OPT1_FREEZING) ||
-		md->sc.data[SC_BLADESTOP] || md->sc.data[SC__MANHOLE] || md->sc.data[SC_CURSEDCIRCLE_TARGET]) { //Should reset targets
+		sc_data(&md->sc, SC_BLADESTOP) || sc_data(&md->sc, SC__MANHOLE) || sc_data(&md->sc, SC_CURSEDCIRCLE_TARGET)) { //Should reset targets
 		md->target_id = md->attacked_id = 0;
 		return false;
 	}
 
-	if(md->sc.count && md->sc.data[SC_BLIND])
+	if(md->sc.count && sc_data(&md->sc, SC_BLIND))
 		view_range = chase_range = 3;
 	else {
 		view_range = md->db->range2;
@@ -1449,9 +1449,9 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 		if(md->attacked_id == md->target_id) { //Rude attacked check
 			if(!battle_check_range(&md->bl, tbl, md->status.rhw.range)
 			&& ( //Can't attack back and can't reach back
-					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1)
-						|| md->sc.data[SC_BITE] || md->sc.data[SC_VACUUM_EXTREME] || md->sc.data[SC_THORNSTRAP]
-						|| md->sc.data[SC__MANHOLE] //Not yet confirmed if boss will teleport once it can't reach target
+					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (sc_data(&md->sc, SC_SPIDERWEB) && sc_data(&md->sc, SC_SPIDERWEB)->val1)
+						|| sc_data(&md->sc, SC_BITE) || sc_data(&md->sc, SC_VACUUM_EXTREME) || sc_data(&md->sc, SC_THORNSTRAP)
+						|| sc_data(&md->sc, SC__MANHOLE) //Not yet confirmed if boss will teleport once it can't reach target
 						|| md->walktoxy_fail_count > 0)
 					)
 					|| !mob_can_reach(md, tbl, chase_range, MSS_RUSH)
@@ -1464,7 +1464,7 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 				return true;
 			}
 		} else if((abl = map_id2bl(md->attacked_id)) && ((!tbl || mob_can_changetarget(md, abl, mode)) ||
-			(md->sc.count && md->sc.data[SC_CONFUSION] && md->sc.data[SC_CONFUSION]->val4))) {
+			(md->sc.count && sc_data(&md->sc, SC_CONFUSION) && sc_data(&md->sc, SC_CONFUSION)->val4))) {
 			int dist;
 
 			if(md->bl.m != abl->m || abl->prev == NULL
@@ -1473,9 +1473,9 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 				|| (battle_config.mob_ai&0x2 && !status_check_skilluse(&md->bl, abl, 0, 0)) //Cannot normal attack back to attacker
 				|| (!battle_check_range(&md->bl, abl, md->status.rhw.range) //Not on melee range
 				&& ( //Reach check
-						(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1)
-							|| md->sc.data[SC_BITE] || md->sc.data[SC_VACUUM_EXTREME] || md->sc.data[SC_THORNSTRAP]
-							|| md->sc.data[SC__MANHOLE] //Not yet confirmed if boss will teleport once it can't reach target
+						(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (sc_data(&md->sc, SC_SPIDERWEB) && sc_data(&md->sc, SC_SPIDERWEB)->val1)
+							|| sc_data(&md->sc, SC_BITE) || sc_data(&md->sc, SC_VACUUM_EXTREME) || sc_data(&md->sc, SC_THORNSTRAP)
+							|| sc_data(&md->sc, SC__MANHOLE) //Not yet confirmed if boss will teleport once it can't reach target
 							|| md->walktoxy_fail_count > 0)
 						)
 						|| !mob_can_reach(md, abl, dist + md->db->range3, MSS_RUSH)
@@ -1519,7 +1519,7 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 	if((!tbl && (mode&MD_AGGRESSIVE)) || md->state.skillstate == MSS_FOLLOW)
 		map_foreachinrange(mob_ai_sub_hard_activesearch, &md->bl, view_range, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
 	else if((mode&MD_CHANGECHASE) && (md->state.skillstate == MSS_RUSH || md->state.skillstate == MSS_FOLLOW ||
-		(md->sc.count && md->sc.data[SC_CONFUSION] && md->sc.data[SC_CONFUSION]->val4))) {
+		(md->sc.count && sc_data(&md->sc, SC_CONFUSION) && sc_data(&md->sc, SC_CONFUSION)->val4))) {
 		int search_size = (view_range < md->status.rhw.range ? view_range : md->status.rhw.range);
 
 		map_foreachinrange(mob_ai_sub_hard_changechase, &md->bl, search_size, DEFAULT_ENEMY_TYPE(md), md, &tbl);
@@ -2062,6 +2062,177 @@ void mob_damage(struct mob_data *md, struct block_list *src, int damage)
 #endif
 }
 
+/// Killer dependent drop rate modifiers, looked up once per kill instead of once per drop
+struct s_mob_drop_bonus {
+	bool has_src; //Killed by a unit, not by a script or command
+	int luk; //Luk of the killer
+	bool pk_bonus; //pk_mode bonus for a 20 level difference
+	int itemboost; //SC_ITEMBOOST rate of the killer, 0 if none
+	bool vip; //Killer is a VIP player
+#ifdef RENEWAL_DROP
+	int modifier; //Level penalty modifier, 100 if none
+#endif
+};
+
+/**
+ * Calculates the final chance of a normal drop.
+ * @param base: Drop rate from the mob db (already adjusted by the item rate configs)
+ * @param size: Size of the monster (special_state.size)
+ * @param bonus: Killer dependent modifiers
+ * @return Drop chance in 1/10000, or 0 if the item can't drop
+ */
+static int mob_getdroprate(int base, int size, const struct s_mob_drop_bonus *bonus)
+{
+	int drop_rate = base;
+
+	if(drop_rate <= 0) {
+		if (battle_config.drop_rate0item)
+			return 0;
+		drop_rate = 1;
+	}
+
+	//Change drops depending on monsters size [Valaris]
+	if(battle_config.mob_size_influence) {
+		if(size == SZ_MEDIUM && drop_rate >= 2)
+			drop_rate /= 2;
+		else if(size == SZ_BIG)
+			drop_rate *= 2;
+	}
+
+	if(bonus->has_src) {
+		//Drops affected by luk as a fixed increase [Valaris]
+		if(battle_config.drops_by_luk)
+			drop_rate += bonus->luk * battle_config.drops_by_luk / 100;
+		//Drops affected by luk as a % increase [Skotlex]
+		if(battle_config.drops_by_luk2)
+			drop_rate += (int)(0.5 + drop_rate * bonus->luk * battle_config.drops_by_luk2 / 10000.);
+	}
+	if(bonus->pk_bonus)
+		drop_rate = (int)(drop_rate * 1.25); //pk_mode increase drops if 20 level difference [Valaris]
+
+	//Increase drop rate if user has SC_ITEMBOOST
+	if(bonus->itemboost) //Now rig the drop rate to never be over 90% unless it is originally > 90%
+		drop_rate = max(drop_rate, (int)cap_value(0.5 + drop_rate * bonus->itemboost / 100., 0, 9000));
+	//Increase item drop rate for VIP.
+	if (bonus->vip) {
+		drop_rate += (int)(0.5 + (drop_rate * battle_config.vip_drop_increase) / 10000.);
+		drop_rate = min(drop_rate, 10000); //Cap it to 100%
+	}
+#ifdef RENEWAL_DROP
+	if(bonus->modifier != 100) {
+		drop_rate = apply_rate(drop_rate, bonus->modifier);
+		if(drop_rate < 1)
+			drop_rate = 1;
+	}
+#endif
+
+	return drop_rate;
+}
+
+/// A normal drop that passed its roll
+struct s_mob_drop_roll {
+	int index; //Index in the mob's dropitem list
+	int rate; //Final drop chance it was rolled with
+	struct item_data *it;
+};
+
+/**
+ * Rolls every normal drop of a monster once.
+ * @param db: Monster
+ * @param size: Size of the monster (special_state.size)
+ * @param bonus: Killer dependent modifiers
+ * @param rolls: Receives the drops that passed their roll, in dropitem order
+ * @return Number of drops
+ */
+static int mob_rolldrops(struct mob_db *db, int size, const struct s_mob_drop_bonus *bonus, struct s_mob_drop_roll rolls[MAX_MOB_DROP])
+{
+	int i, drop_rate, count = 0;
+	struct item_data *it;
+
+	for(i = 0; i < MAX_MOB_DROP; i++) {
+		if(db->dropitem[i].nameid <= 0)
+			continue;
+		if(!(drop_rate = mob_getdroprate(db->dropitem[i].p, size, bonus)))
+			continue;
+
+		//Attempt to drop the item
+		if(rnd()%10000 >= drop_rate)
+			continue;
+
+		//Only look the item up once it actually drops
+		if(!(it = itemdb_exists(db->dropitem[i].nameid)))
+			continue;
+
+		rolls[count].index = i;
+		rolls[count].rate = drop_rate;
+		rolls[count].it = it;
+		count++;
+	}
+
+	return count;
+}
+
+/**
+ * Simulates the normal drops of a monster killed by a player without any drop bonus,
+ * and compares the observed drop rates against the configured ones.
+ * The drops are rolled by mob_rolldrops, the same code mob_dead uses.
+ * @param args: "<mob_id> <kills>"
+ */
+void mob_drop_sim(const char *args)
+{
+	struct s_mob_drop_bonus bonus;
+	struct s_mob_drop_roll rolls[MAX_MOB_DROP];
+	struct mob_db *db;
+	unsigned int start, hits[MAX_MOB_DROP];
+	int mob_id = 0, kills = 100000, rate[MAX_MOB_DROP], i, k, suspicious = 0;
+
+	if( sscanf(args, "%d %d", &mob_id, &kills) < 1 || mobdb_checkid(mob_id) == 0 ) {
+		ShowInfo("Usage: drop_sim:<mob_id> <kills>\n");
+		return;
+	}
+
+	db = mob_db(mob_id);
+	kills = cap_value(kills, 1, 100000000);
+	memset(&bonus, 0, sizeof(bonus));
+	bonus.has_src = true;
+#ifdef RENEWAL_DROP
+	bonus.modifier = 100;
+#endif
+
+	for( i = 0; i < MAX_MOB_DROP; i++ ) {
+		rate[i] = (db->dropitem[i].nameid > 0 ? mob_getdroprate(db->dropitem[i].p, SZ_SMALL, &bonus) : 0);
+		hits[i] = 0;
+	}
+
+	start = gettick_nocache();
+	for( k = 0; k < kills; k++ ) {
+		int count = mob_rolldrops(db, SZ_SMALL, &bonus, rolls);
+
+		for( i = 0; i < count; i++ )
+			hits[rolls[i].index]++;
+	}
+
+	ShowInfo("drop_sim: %d kills of '%s' (%d) in %u ms\n", kills, db->jname, mob_id, (unsigned int)DIFF_TICK(gettick_nocache(), start));
+	for( i = 0; i < MAX_MOB_DROP; i++ ) {
+		struct item_data *id;
+		double p, expected, sigma, deviation;
+
+		if( !rate[i] )
+			continue;
+		id = itemdb_exists(db->dropitem[i].nameid);
+		p = rate[i] / 10000.;
+		expected = kills * p;
+		sigma = sqrt(kills * p * (1 - p));
+		deviation = (sigma > 0 ? (hits[i] - expected) / sigma : 0);
+		if( fabs(deviation) > 4 ) //Should practically never happen with a correct roll
+			suspicious++;
+		ShowMessage("\t%5d %-24s rate %6.2f%%, observed %6.2f%% (%+.2f sigma)\n", db->dropitem[i].nameid, (id ? id->jname : "Unknown item"),
+			p * 100, hits[i] * 100. / kills, deviation);
+	}
+	if( suspicious )
+		ShowWarning("drop_sim: %d drop(s) deviate by more than 4 sigma from their configured rate.\n", suspicious);
+}
+
 /*==========================================
  * Signals death of mob.
  * type&1 -> no drops, type&2 -> no exp
@@ -2158,11 +2329,11 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 		int bonus = 100; //Bonus on top of your share (common to all attackers)
 		int pnum = 0;
 
-		if(md->sc.data[SC_RICHMANKIM])
-			bonus += md->sc.data[SC_RICHMANKIM]->val2;
+		if(sc_data(&md->sc, SC_RICHMANKIM))
+			bonus += sc_data(&md->sc, SC_RICHMANKIM)->val2;
 		if(sd) {
 			temp = status_get_class(&md->bl);
-			if(sd->sc.data[SC_MIRACLE])
+			if(sc_data(&sd->sc, SC_MIRACLE))
 				i = 2; //All mobs are Star Targets
 			else
 				ARR_FIND(0, MAX_PC_FEELHATE, i, temp == sd->hate_mob[i] &&
@@ -2310,12 +2481,21 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 		struct item_drop_list *dlist = ers_alloc(item_drop_list_ers, struct item_drop_list);
 		struct item_drop *ditem;
 		struct item_data* it = NULL;
-		int drop_rate;
+		struct s_mob_drop_bonus bonus;
+		struct s_mob_drop_roll rolls[MAX_MOB_DROP];
+		int drop_rate, drops, k;
+
+		memset(&bonus, 0, sizeof(bonus));
+		bonus.has_src = (src != NULL);
+		bonus.luk = (src ? status_get_luk(src) : 0);
+		bonus.pk_bonus = (sd && battle_config.pk_mode && (int)(md->level - sd->status.base_level) >= 20);
+		bonus.itemboost = (sd && sc_data(&sd->sc, SC_ITEMBOOST) ? sc_data(&sd->sc, SC_ITEMBOOST)->val1 : 0);
+		bonus.vip = (battle_config.vip_drop_increase && sd && pc_isvip(sd));
 #ifdef RENEWAL_DROP
-		int drop_modifier = mvp_sd    ? pc_level_penalty_mod(mvp_sd, md->level, md->status.class_, 2)   :
-							second_sd ? pc_level_penalty_mod(second_sd, md->level, md->status.class_, 2):
-							third_sd  ? pc_level_penalty_mod(third_sd, md->level, md->status.class_, 2) :
-							100; /* No player was attached, we dont use any modifier (100 = rates are not touched) */
+		bonus.modifier = mvp_sd    ? pc_level_penalty_mod(mvp_sd, md->level, md->status.class_, 2)   :
+						 second_sd ? pc_level_penalty_mod(second_sd, md->level, md->status.class_, 2):
+						 third_sd  ? pc_level_penalty_mod(third_sd, md->level, md->status.class_, 2) :
+						 100; /* No player was attached, we dont use any modifier (100 = rates are not touched) */
 #endif
 		dlist->m = md->bl.m;
 		dlist->x = md->bl.x;
@@ -2325,57 +2505,11 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 		dlist->third_charid = (third_sd ? third_sd->status.char_id : 0);
 		dlist->item = NULL;
 
-		for(i = 0; i < MAX_MOB_DROP; i++) {
-			if(md->db->dropitem[i].nameid <= 0)
-				continue;
-			if(!(it = itemdb_exists(md->db->dropitem[i].nameid)))
-				continue;
-			drop_rate = md->db->dropitem[i].p;
-			if(drop_rate <= 0) {
-				if (battle_config.drop_rate0item)
-					continue;
-				drop_rate = 1;
-			}
-
-			//Change drops depending on monsters size [Valaris]
-			if(battle_config.mob_size_influence) {
-				if(md->special_state.size == SZ_MEDIUM && drop_rate >= 2)
-					drop_rate /= 2;
-				else if(md->special_state.size == SZ_BIG)
-					drop_rate *= 2;
-			}
-
-			if(src) {
-				//Drops affected by luk as a fixed increase [Valaris]
-				if(battle_config.drops_by_luk)
-					drop_rate += status_get_luk(src) * battle_config.drops_by_luk / 100;
-				//Drops affected by luk as a % increase [Skotlex]
-				if(battle_config.drops_by_luk2)
-					drop_rate += (int)(0.5 + drop_rate * status_get_luk(src) * battle_config.drops_by_luk2 / 10000.);
-			}
-			if(sd && battle_config.pk_mode &&
-				(int)(md->level - sd->status.base_level) >= 20)
-				drop_rate = (int)(drop_rate * 1.25); //pk_mode increase drops if 20 level difference [Valaris]
-
-			//Increase drop rate if user has SC_ITEMBOOST
-			if(sd && sd->sc.data[SC_ITEMBOOST]) //Now rig the drop rate to never be over 90% unless it is originally > 90%
-				drop_rate = max(drop_rate, (int)cap_value(0.5 + drop_rate * sd->sc.data[SC_ITEMBOOST]->val1 / 100., 0, 9000));
-			//Increase item drop rate for VIP.
-			if (battle_config.vip_drop_increase && (sd && pc_isvip(sd))) {
-				drop_rate += (int)(0.5 + (drop_rate * battle_config.vip_drop_increase) / 10000.);
-				drop_rate = min(drop_rate, 10000); //Cap it to 100%
-			}
-#ifdef RENEWAL_DROP
-			if(drop_modifier != 100) {
-				drop_rate = apply_rate(drop_rate, drop_modifier);
-				if(drop_rate < 1)
-					drop_rate = 1;
-			}
-#endif
-
-			//Attempt to drop the item
-			if(rnd()%10000 >= drop_rate)
-				continue;
+		drops = mob_rolldrops(md->db, md->special_state.size, &bonus, rolls);
+		for(k = 0; k < drops; k++) {
+			i = rolls[k].index;
+			drop_rate = rolls[k].rate;
+			it = rolls[k].it;
 
 			if(mvp_sd && it->type == IT_PETEGG) {
 				pet_create_egg(mvp_sd, md->db->dropitem[i].nameid);
@@ -2557,7 +2691,7 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 	if(type&2 && !sd && md->mob_id == MOBID_EMPERIUM && md->guardian_data)
 		mvp_sd = NULL;
 
-	rebirth = (md->sc.data[SC_KAIZEL] || (md->sc.data[SC_REBIRTH] && !md->state.rebirth));
+	rebirth = (sc_data(&md->sc, SC_KAIZEL) || (sc_data(&md->sc, SC_REBIRTH) && !md->state.rebirth));
 	if(!rebirth) { //Only trigger event on final kill
 		if(src) {
 			switch(src->type) {
@@ -3078,11 +3212,11 @@ int mob_getfriendstatus_sub(struct block_list *bl,va_list ap)
 		int j;
 
 		for( j = SC_COMMON_MIN; j <= SC_COMMON_MAX && !flag; j++ ) {
-			if( (flag = (md->sc.data[j] != NULL)) ) //Once an effect was found, break out [Skotlex]
+			if( (flag = (sc_data(&md->sc, j) != NULL)) ) //Once an effect was found, break out [Skotlex]
 				break;
 		}
 	} else
-		flag = (md->sc.data[cond2] != NULL);
+		flag = (sc_data(&md->sc, cond2) != NULL);
 	if( flag^(cond1 == MSC_FRIENDSTATUSOFF) )
 		(*fr) = md;
 
@@ -3169,10 +3303,10 @@ int mobskill_use(struct mob_data *md, unsigned int tick, int event)
 						flag = 0;
 					} else if (ms[i].cond2 == -1) {
 						for (j = SC_COMMON_MIN; j <= SC_COMMON_MAX; j++)
-							if ((flag = (md->sc.data[j] != NULL)) != 0)
+							if ((flag = (sc_data(&md->sc, j) != NULL)) != 0)
 								break;
 					} else
-						flag = (md->sc.data[ms[i].cond2] != NULL);
+						flag = (sc_data(&md->sc, ms[i].cond2) != NULL);
 					flag ^= (ms[i].cond1 == MSC_MYSTATUSOFF);
 					break;
 				case MSC_FRIENDHPLTMAXRATE: //Friend HP < maxhp %
@@ -332,6 +332,7 @@ int mob_parse_dataset(struct spawn_data *data);
 void mob_log_damage(struct mob_data *md, struct block_list *src, int damage);
 void mob_damage(struct mob_data *md, struct block_list *src, int damage);
 int mob_dead(struct mob_data *md, struct block_list *src, int type);
+void mob_drop_sim(const char *args);
 void mob_revive(struct mob_data *md, unsigned int hp);
 void mob_heal(struct mob_data *md, unsigned int heal);
 
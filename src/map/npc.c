@@ -11,6 +11,9 @@
 #include "../common/ers.h"
 #include "../common/db.h"
 #include "../common/socket.h"
+#include "../common/atomic.h"
+#include "../common/thread.h"
+#include "../common/mutex.h"
 #include "map.h"
 #include "mapreg.h"
 #include "log.h"
@@ -951,7 +954,7 @@ int npc_touch_areanpc(struct map_session_data *sd, int16 m, int16 x, int16 y)
 	}
 	switch( map[m].npc[i]->subtype ) {
 		case NPCTYPE_WARP:
-			if( pc_ishiding(sd) || (sd->sc.count && sd->sc.data[SC_CAMOUFLAGE]) || pc_isdead(sd) )
+			if( pc_ishiding(sd) || (sd->sc.count && sc_data(&sd->sc, SC_CAMOUFLAGE)) || pc_isdead(sd) )
 				break; //Hidden or dead chars cannot use warps
 			if( sd->count_rewarp > 10 ) {
 				ShowWarning("Prevented infinite warp loop for player (%d:%d). Please fix NPC: '%s', path: '%s'\n",sd->status.account_id,sd->status.char_id,map[m].npc[i]->exname,map[m].npc[i]->path);
@@ -967,7 +970,7 @@ int npc_touch_areanpc(struct map_session_data *sd, int16 m, int16 x, int16 y)
 
 				if( (sd->bl.x >= (map[m].npc[j]->bl.x - map[m].npc[j]->u.warp.xs) && sd->bl.x <= (map[m].npc[j]->bl.x + map[m].npc[j]->u.warp.xs)) &&
 					(sd->bl.y >= (map[m].npc[j]->bl.y - map[m].npc[j]->u.warp.ys) && sd->bl.y <= (map[m].npc[j]->bl.y + map[m].npc[j]->u.warp.ys)) ) {
-						if( pc_ishiding(sd) || (sd->sc.count && sd->sc.data[SC_CAMOUFLAGE]) || pc_isdead(sd) )
+						if( pc_ishiding(sd) || (sd->sc.count && sc_data(&sd->sc, SC_CAMOUFLAGE)) || pc_isdead(sd) )
 							break; //Hidden or dead chars cannot use warps
 					pc_setpos(sd,map[m].npc[j]->u.warp.mapindex,map[m].npc[j]->u.warp.x,map[m].npc[j]->u.warp.y,CLR_OUTSIGHT);
 					found_warp = 1;
@@ -3990,48 +3993,97 @@ static const char *npc_parse_mapflag(char *w1, char *w2, char *w3, char *w4, con
 	return strchr(start,'\n'); //Continue
 }
 
+enum e_npc_src_error {
+	NPC_SRC_OK = 0,
+	NPC_SRC_NOTFILE, // Path is not a file
+	NPC_SRC_NOTFOUND, // Could not open the file
+	NPC_SRC_READ, // Error while reading the file
+};
+
 /**
- * Read file and create npc/func/mapflag/monster... accordingly.
+ * Reads a whole npc file into a buffer.
+ * Only uses malloc/free and reports nothing, so it can run on the prefetch thread.
  * @param filepath : Relative path of file from map-serv bin
- * @param runOnInit :  should we exec OnInit when it's done ?
- * @return 0 : Error, 1 : Success
+ * @param len : Returns the length of the file
+ * @param error : Returns the cause of the error (e_npc_src_error) and errno
+ * @return Buffer (free() it) or NULL on error
  */
-int npc_parsesrcfile(const char *filepath, bool runOnInit)
+static char *npc_readsrcfile(const char *filepath, size_t *len, int error[2])
 {
-	int16 m, x, y;
-	int lines = 0;
 	FILE* fp;
-	size_t len;
 	char *buffer;
-	const char *p;
 
-	if( check_filepath(filepath) != 2 ) { //This is not a file 
-		ShowDebug("npc_parsesrcfile: Path doesn't seem to be a file skipping it : '%s'.\n", filepath);
-		return 0;
-	} 
+	error[0] = NPC_SRC_OK;
+	error[1] = 0;
+
+	if( check_filepath(filepath) != 2 ) { //This is not a file
+		error[0] = NPC_SRC_NOTFILE;
+		return NULL;
+	}
 
 	//Read whole file to buffer
 	fp = fopen(filepath, "rb");
 	if( fp == NULL ) {
-		ShowError("npc_parsesrcfile: File not found '%s'.\n", filepath);
-		return 0;
+		error[0] = NPC_SRC_NOTFOUND;
+		return NULL;
 	}
 
 	fseek(fp, 0, SEEK_END);
-	len = ftell(fp);
-	buffer = (char *)aMalloc(len + 1);
+	*len = ftell(fp);
+	buffer = (char *)malloc(*len + 1);
+	if( buffer == NULL ) {
+		error[0] = NPC_SRC_READ;
+		error[1] = ENOMEM;
+		fclose(fp);
+		return NULL;
+	}
 	fseek(fp, 0, SEEK_SET);
-	len = fread(buffer, 1, len, fp);
-	buffer[len] = '\0';
+	*len = fread(buffer, 1, *len, fp);
+	buffer[*len] = '\0';
 
 	if( ferror(fp) ) {
-		ShowError("npc_parsesrcfile: Failed to read file '%s' - %s\n", filepath, strerror(errno));
-		aFree(buffer);
+		error[0] = NPC_SRC_READ;
+		error[1] = errno;
+		free(buffer);
 		fclose(fp);
-		return 0;
+		return NULL;
 	}
 
 	fclose(fp);
+	return buffer;
+}
+
+/**
+ * Shows why npc_readsrcfile failed.
+ */
+static void npc_readsrcfile_error(const char *filepath, int error[2])
+{
+	switch( error[0] ) {
+		case NPC_SRC_NOTFILE:
+			ShowDebug("npc_parsesrcfile: Path doesn't seem to be a file skipping it : '%s'.\n", filepath);
+			break;
+		case NPC_SRC_NOTFOUND:
+			ShowError("npc_parsesrcfile: File not found '%s'.\n", filepath);
+			break;
+		case NPC_SRC_READ:
+			ShowError("npc_parsesrcfile: Failed to read file '%s' - %s\n", filepath, strerror(error[1]));
+			break;
+	}
+}
+
+/**
+ * Create npc/func/mapflag/monster... from the contents of a file.
+ * @param filepath : Relative path of file from map-serv bin
+ * @param buffer : Contents of the file
+ * @param len : Length of the contents
+ * @param runOnInit :  should we exec OnInit when it's done ?
+ * @return 0 : Error, 1 : Success
+ */
+static int npc_parsesrcbuffer(const char *filepath, char *buffer, size_t len, bool runOnInit)
+{
+	int16 m, x, y;
+	int lines = 0;
+	const char *p;
 
 	if( (unsigned char)buffer[0] == 0xEF && (unsigned char)buffer[1] == 0xBB && (unsigned char)buffer[2] == 0xBF ) {
 		//UTF-8 BOM. This is most likely an error on the user's part, because:
@@ -4040,7 +4092,6 @@ int npc_parsesrcfile(const char *filepath, bool runOnInit)
 		//- If the user really wants to use UTF-8 (instead of latin1, EUC-KR, SJIS, etc), then they can still do it <without BOM>.
 		//More info at http://unicode.org/faq/utf_bom.html#bom5 and http://en.wikipedia.org/wiki/Byte_order_mark#UTF-8
 		ShowError("npc_parsesrcfile: Detected unsupported UTF-8 BOM in file '%s'. Stopping (please consider using another character set).\n", filepath);
-		aFree(buffer);
 		return 0;
 	}
 
@@ -4143,11 +4194,80 @@ int npc_parsesrcfile(const char *filepath, bool runOnInit)
 		}
 	}
 
-	aFree(buffer);
-
 	return 1;
 }
 
+/**
+ * Read file and create npc/func/mapflag/monster... accordingly.
+ * @param filepath : Relative path of file from map-serv bin
+ * @param runOnInit :  should we exec OnInit when it's done ?
+ * @return 0 : Error, 1 : Success
+ */
+int npc_parsesrcfile(const char *filepath, bool runOnInit)
+{
+	int error[2], ret;
+	size_t len = 0;
+	char *buffer = npc_readsrcfile(filepath, &len, error);
+
+	if( buffer == NULL ) {
+		npc_readsrcfile_error(filepath, error);
+		return 0;
+	}
+	ret = npc_parsesrcbuffer(filepath, buffer, len, runOnInit);
+	free(buffer);
+	return ret;
+}
+
+/**
+ * Npc file prefetching.
+ * While the main thread parses a file, a reader thread loads the next ones from disk.
+ * Only the file I/O runs on that thread. Lexing, parse_script and the npc parsers
+ * stay single threaded on the main thread, since they share str_data/str_buf, the
+ * syntax stack and the error longjmp, register npcs and labels in the global tables
+ * and allocate through the memory manager, which is not thread-safe.
+ * There is no parallel parsing with thread-local string tables here.
+ */
+#define NPC_PREFETCH_MAX 8 // Max files read ahead of the parser
+#define NPC_PARSE_SLOWEST 5 // Number of slowest files shown after loading
+
+struct npc_src_buffer {
+	struct npc_src_list *file;
+	char *buffer; // Contents (malloc'd) or NULL on error
+	size_t len;
+	int error[2]; // See npc_readsrcfile
+	volatile int32 ready; // Set by the reader thread
+};
+
+static struct {
+	struct npc_src_buffer *list;
+	int count;
+	volatile int32 parsed; // Files consumed by the main thread
+	ramutex lock;
+	racond wake;
+} npc_prefetch;
+
+static void *npc_prefetch_main(void *param)
+{
+	int i;
+
+	for( i = 0; i < npc_prefetch.count; i++ ) {
+		struct npc_src_buffer *entry = &npc_prefetch.list[i];
+
+		ramutex_lock(npc_prefetch.lock);
+		while( i - InterlockedExchangeAdd(&npc_prefetch.parsed, 0) >= NPC_PREFETCH_MAX )
+			racond_wait(npc_prefetch.wake, npc_prefetch.lock, -1);
+		ramutex_unlock(npc_prefetch.lock);
+
+		entry->buffer = npc_readsrcfile(entry->file->name, &entry->len, entry->error);
+
+		ramutex_lock(npc_prefetch.lock);
+		InterlockedExchange(&entry->ready, 1);
+		racond_broadcast(npc_prefetch.wake);
+		ramutex_unlock(npc_prefetch.lock);
+	}
+	return NULL;
+}
+
 int npc_script_event(struct map_session_data *sd, enum npce_event type)
 {
 	int i;
@@ -4230,16 +4350,77 @@ void npc_clear_pathlist(void) {
 
 /**
  * Main npc file processing
+ * Files are read ahead by the prefetch thread and parsed one after another on the main thread.
  * @param npc_min Minimum npc id - used to know how many NPCs were loaded
  */
 void npc_process_files(int npc_min) {
 	struct npc_src_list *file; // Current file
+	struct {
+		const char *name;
+		unsigned int tick;
+	} slowest[NPC_PARSE_SLOWEST];
+	rAthread reader;
+	unsigned int total = gettick_nocache();
+	int i, j;
+
+	memset(slowest, 0, sizeof(slowest));
+	npc_prefetch.count = 0;
+	for( file = npc_src_files; file != NULL; file = file->next )
+		npc_prefetch.count++;
+	CREATE(npc_prefetch.list, struct npc_src_buffer, max(npc_prefetch.count, 1));
+	for( i = 0, file = npc_src_files; file != NULL; file = file->next, i++ )
+		npc_prefetch.list[i].file = file;
+	npc_prefetch.parsed = 0;
+	npc_prefetch.lock = ramutex_create();
+	npc_prefetch.wake = racond_create();
+	reader = rathread_create(npc_prefetch_main, NULL);
 
 	ShowStatus("Loading NPCs...\r");
-	for( file = npc_src_files; file != NULL; file = file->next ) {
-		ShowStatus("Loading NPC file: %s"CL_CLL"\r", file->name);
-		npc_parsesrcfile(file->name, false);
+	for( i = 0; i < npc_prefetch.count; i++ ) {
+		struct npc_src_buffer *entry = &npc_prefetch.list[i];
+		unsigned int tick;
+
+		if( reader == NULL ) // No thread, read in place
+			entry->buffer = npc_readsrcfile(entry->file->name, &entry->len, entry->error);
+		else {
+			ramutex_lock(npc_prefetch.lock);
+			while( !InterlockedExchangeAdd(&entry->ready, 0) )
+				racond_wait(npc_prefetch.wake, npc_prefetch.lock, -1);
+			ramutex_unlock(npc_prefetch.lock);
+		}
+
+		ShowStatus("Loading NPC file: %s"CL_CLL"\r", entry->file->name);
+		tick = gettick_nocache();
+		if( entry->buffer == NULL )
+			npc_readsrcfile_error(entry->file->name, entry->error);
+		else {
+			npc_parsesrcbuffer(entry->file->name, entry->buffer, entry->len, false);
+			free(entry->buffer);
+			entry->buffer = NULL;
+		}
+		tick = DIFF_TICK(gettick_nocache(), tick);
+		ShowDebug("Parsed NPC file '%s' in %u ms.\n", entry->file->name, tick);
+
+		ARR_FIND(0, NPC_PARSE_SLOWEST, j, slowest[j].tick < tick);
+		if( j < NPC_PARSE_SLOWEST ) {
+			memmove(&slowest[j + 1], &slowest[j], (NPC_PARSE_SLOWEST - j - 1) * sizeof(slowest[0]));
+			slowest[j].name = entry->file->name;
+			slowest[j].tick = tick;
+		}
+
+		ramutex_lock(npc_prefetch.lock);
+		InterlockedIncrement(&npc_prefetch.parsed);
+		racond_broadcast(npc_prefetch.wake);
+		ramutex_unlock(npc_prefetch.lock);
 	}
+
+	if( reader != NULL )
+		rathread_wait(reader, NULL);
+	racond_destroy(npc_prefetch.wake);
+	ramutex_destroy(npc_prefetch.lock);
+	aFree(npc_prefetch.list);
+	npc_prefetch.list = NULL;
+	npc_prefetch.count = 0;
 	ShowInfo("Done loading '"CL_WHITE"%d"CL_RESET"' NPCs:"CL_CLL"\n"
 		"\t-'"CL_WHITE"%d"CL_RESET"' Warps\n"
 		"\t-'"CL_WHITE"%d"CL_RESET"' Shops\n"
@@ -4248,6 +4429,9 @@ void npc_process_files(int npc_min) {
 		"\t-'"CL_WHITE"%d"CL_RESET"' Mobs Cached\n"
 		"\t-'"CL_WHITE"%d"CL_RESET"' Mobs Not Cached\n",
 		npc_id - npc_min, npc_warp, npc_shop, npc_script, npc_mob, npc_cache_mob, npc_delay_mob);
+	ShowInfo("NPC files parsed in '"CL_WHITE"%u"CL_RESET"' ms, slowest:\n", DIFF_TICK(gettick_nocache(), total));
+	for( i = 0; i < NPC_PARSE_SLOWEST && slowest[i].name; i++ )
+		ShowInfo("\t-'"CL_WHITE"%u"CL_RESET"' ms %s\n", slowest[i].tick, slowest[i].name);
 }
 
 //Clear then reload npcs files
@@ -4435,8 +4619,8 @@ void do_init_npc(void)
 	for (i = MAX_NPC_CLASS2_START; i < MAX_NPC_CLASS2_END; i++)
 		npc_viewdb2[i - MAX_NPC_CLASS2_START].class_ = i;
 
-	ev_db = strdb_alloc((DBOptions)(DB_OPT_DUP_KEY|DB_OPT_RELEASE_DATA),2 * NAME_LENGTH + 2 + 1);
-	npcname_db = strdb_alloc(DB_OPT_BASE,NAME_LENGTH);
+	ev_db = strdb_alloc_sized((DBOptions)(DB_OPT_DUP_KEY|DB_OPT_RELEASE_DATA),2 * NAME_LENGTH + 2 + 1,16384);
+	npcname_db = strdb_alloc_sized(DB_OPT_BASE,NAME_LENGTH,8192);
 	npc_path_db = strdb_alloc(DB_OPT_BASE|DB_OPT_DUP_KEY|DB_OPT_RELEASE_DATA,80);
 #if PACKETVER >= 20131223
 	NPCMarketDB = strdb_alloc(DB_OPT_BASE, NAME_LENGTH+1);
@@ -35,9 +35,26 @@ static DBMap *party_db; // int party_id -> struct party_data* (releases data)
 static DBMap *party_booking_db; // int char_id -> struct party_booking_ad_info* (releases data) // Party Booking [Spiria]
 static unsigned long party_booking_nextid = 1;
 
+#define PARTY_BOOKING_LEVEL_BUCKET 16 //Levels covered by each party_booking_level_db entry
+
+/// Party booking ads ordered by index, used as secondary indexes of party_booking_db
+struct party_booking_list {
+	struct party_booking_ad_info **ads;
+	int count, max;
+};
+static struct party_booking_list party_booking_all; // All ads
+static DBMap *party_booking_map_db; // int mapid -> struct party_booking_list* (releases data)
+static DBMap *party_booking_job_db; // int job -> struct party_booking_list* (releases data)
+static DBMap *party_booking_level_db; // int level / PARTY_BOOKING_LEVEL_BUCKET -> struct party_booking_list* (releases data)
+static int party_booking_list_final(DBKey key, DBData *data, va_list ap);
+
 int party_send_xy_timer(int tid, unsigned int tick, int id, intptr_t data);
 int party_create_byscript;
 
+//Account ids of members whose position or hp may have changed since the last party_send_xy_timer
+static int *party_xy_dirty = NULL;
+static int party_xy_dirty_count = 0, party_xy_dirty_max = 0;
+
 /*==========================================
  * Fills the given party_member structure according to the sd provided.
  * Used when creating/adding people to a party. [Skotlex]
@@ -113,12 +130,23 @@ void do_final_party(void)
 {
 	party_db->destroy(party_db,NULL);
 	party_booking_db->destroy(party_booking_db,NULL); // Party Booking [Spiria]
+	party_booking_map_db->destroy(party_booking_map_db,party_booking_list_final);
+	party_booking_job_db->destroy(party_booking_job_db,party_booking_list_final);
+	party_booking_level_db->destroy(party_booking_level_db,party_booking_list_final);
+	aFree(party_booking_all.ads);
+	memset(&party_booking_all, 0, sizeof(party_booking_all));
+	aFree(party_xy_dirty);
+	party_xy_dirty = NULL;
+	party_xy_dirty_count = party_xy_dirty_max = 0;
 }
 // Constructor, init vars
 void do_init_party(void)
 {
 	party_db = idb_alloc(DB_OPT_RELEASE_DATA);
 	party_booking_db = idb_alloc(DB_OPT_RELEASE_DATA); // Party Booking [Spiria]
+	party_booking_map_db = idb_alloc(DB_OPT_RELEASE_DATA);
+	party_booking_job_db = idb_alloc(DB_OPT_RELEASE_DATA);
+	party_booking_level_db = idb_alloc(DB_OPT_RELEASE_DATA);
 	add_timer_func_list(party_send_xy_timer, "party_send_xy_timer");
 	add_timer_interval(gettick()+battle_config.party_update_interval, party_send_xy_timer, 0, 0, battle_config.party_update_interval);
 }
@@ -322,6 +350,7 @@ int party_recv_info(struct party* sp, int char_id)
 		if ( member->char_id == 0 )
 			continue; // Empty
 		p->data[member_id].sd = party_sd_check(sp->party_id, member->account_id, member->char_id);
+		party_send_xy_mark(p->data[member_id].sd); //Position was reset above
 	}
 	party_check_state(p);
 	while( added_count > 0 ) { // New in party
@@ -452,6 +481,7 @@ void party_member_joined(struct map_session_data *sd)
 	ARR_FIND(0, MAX_PARTY, i, p->party.member[i].account_id == sd->status.account_id && p->party.member[i].char_id == sd->status.char_id);
 	if (i < MAX_PARTY) {
 		p->data[i].sd = sd;
+		party_send_xy_mark(sd);
 		if( p->instance_id )
 			instance_reqinfo(sd, p->instance_id);
 	} else
@@ -791,6 +821,7 @@ int party_recv_movemap(int party_id, int account_id, int char_id, unsigned short
 	m->lv = lv;
 	//Check if they still exist on this map server
 	p->data[i].sd = party_sd_check(party_id,account_id,char_id);
+	party_send_xy_mark(p->data[i].sd);
 	
 	clif_party_info(p,NULL);
 	return 0;
@@ -921,7 +952,7 @@ int party_skill_check(struct map_session_data *sd, int party_id, uint16 skill_id
 				}
 				break;
 			case MO_COMBOFINISH: //Increase Counter rate of Star Gladiators
-				if( (p_sd->class_&MAPID_UPPERMASK) == MAPID_STAR_GLADIATOR && sd->sc.data[SC_READYCOUNTER] &&
+				if( (p_sd->class_&MAPID_UPPERMASK) == MAPID_STAR_GLADIATOR && sc_data(&sd->sc, SC_READYCOUNTER) &&
 					pc_checkskill(p_sd,SG_FRIEND) ) {
 					sc_start4(&p_sd->bl,&p_sd->bl,SC_SKILLRATE_UP,100,TK_COUNTER,
 						50 + 50 * pc_checkskill(p_sd,SG_FRIEND), //+100/150/200% rate
@@ -933,37 +964,60 @@ int party_skill_check(struct map_session_data *sd, int party_id, uint16 skill_id
 	return 0;
 }
 
-int party_send_xy_timer(int tid, unsigned int tick, int id, intptr_t data)
+/**
+ * Queues a party member for the next party_send_xy_timer.
+ * Called whenever the member moves, its hp changes or its party data is reset,
+ * so the timer only visits members that may need an update.
+ * @param sd
+ */
+void party_send_xy_mark(struct map_session_data *sd)
 {
-	struct party_data *p;
+	if( !sd || !sd->status.party_id || sd->state.party_xy_dirty )
+		return;
 
-	DBIterator *iter = db_iterator(party_db);
-	//For each existing party
-	for( p = (struct party_data *)dbi_first(iter); dbi_exists(iter); p = (struct party_data *)dbi_next(iter) ) {
-		int i;
+	if( party_xy_dirty_count == party_xy_dirty_max ) {
+		party_xy_dirty_max = max(party_xy_dirty_max * 2, 64);
+		RECREATE(party_xy_dirty, int, party_xy_dirty_max);
+	}
+	party_xy_dirty[party_xy_dirty_count++] = sd->bl.id;
+	sd->state.party_xy_dirty = 1;
+}
 
-		if( !p->party.count ) //No online party members so do not iterate
-			continue;
+int party_send_xy_timer(int tid, unsigned int tick, int id, intptr_t data)
+{
+	int i, count = party_xy_dirty_count;
 
-		//For each member of this party
-		for( i = 0; i < MAX_PARTY; i++ ) {
-			struct map_session_data *sd = p->data[i].sd;
+	//For each queued member
+	for( i = 0; i < count; i++ ) {
+		struct map_session_data *sd = map_id2sd(party_xy_dirty[i]);
+		struct party_data *p;
+		int j;
 
-			if( !sd )
-				continue;
+		if( !sd || !sd->state.party_xy_dirty )
+			continue; //Logged out or already handled
+		sd->state.party_xy_dirty = 0;
 
-			if( p->data[i].x != sd->bl.x || p->data[i].y != sd->bl.y ) { //Perform position update
-				clif_party_xy(sd);
-				p->data[i].x = sd->bl.x;
-				p->data[i].y = sd->bl.y;
-			}
-			if( battle_config.party_hp_mode && p->data[i].hp != sd->battle_status.hp ) { //Perform hp update
-				clif_party_hp(sd);
-				p->data[i].hp = sd->battle_status.hp;
-			}
+		if( !(p = party_search(sd->status.party_id)) )
+			continue;
+		ARR_FIND(0, MAX_PARTY, j, p->data[j].sd == sd);
+		if( j == MAX_PARTY )
+			continue;
+
+		if( p->data[j].x != sd->bl.x || p->data[j].y != sd->bl.y ) { //Perform position update
+			clif_party_xy(sd);
+			p->data[j].x = sd->bl.x;
+			p->data[j].y = sd->bl.y;
+		}
+		if( battle_config.party_hp_mode && p->data[j].hp != sd->battle_status.hp ) { //Perform hp update
+			clif_party_hp(sd);
+			p->data[j].hp = sd->battle_status.hp;
 		}
 	}
-	dbi_destroy(iter);
+
+	//Keep anything queued while sending
+	party_xy_dirty_count -= count;
+	if( party_xy_dirty_count > 0 )
+		memmove(party_xy_dirty, party_xy_dirty + count, party_xy_dirty_count * sizeof(*party_xy_dirty));
 
 	return 0;
 }
@@ -980,6 +1034,7 @@ int party_send_xy_clear(struct party_data *p)
 		p->data[i].hp = 0;
 		p->data[i].x = 0;
 		p->data[i].y = 0;
+		party_send_xy_mark(p->data[i].sd);
 	}
 	return 0;
 }
@@ -1233,6 +1288,118 @@ static struct party_booking_ad_info* create_party_booking_data(void)
 	return pb_ad;
 }
 
+/// Returns the position of the first ad in list with an index >= index.
+static int party_booking_list_lower(struct party_booking_list *list, unsigned long index)
+{
+	int lo = 0, hi = list->count;
+
+	while( lo < hi ) {
+		int mid = (lo + hi) / 2;
+
+		if( list->ads[mid]->index < index )
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+static void party_booking_list_add(struct party_booking_list *list, struct party_booking_ad_info *pb_ad)
+{
+	int i = party_booking_list_lower(list, pb_ad->index);
+
+	if( i < list->count && list->ads[i] == pb_ad )
+		return; //Already listed (same job requested twice)
+	if( list->count == list->max ) {
+		list->max = max(list->max * 2, 16);
+		RECREATE(list->ads, struct party_booking_ad_info *, list->max);
+	}
+	memmove(&list->ads[i + 1], &list->ads[i], (list->count - i) * sizeof(list->ads[0]));
+	list->ads[i] = pb_ad;
+	list->count++;
+}
+
+static void party_booking_list_remove(struct party_booking_list *list, struct party_booking_ad_info *pb_ad)
+{
+	int i = party_booking_list_lower(list, pb_ad->index);
+
+	if( i >= list->count || list->ads[i] != pb_ad )
+		return;
+	list->count--;
+	memmove(&list->ads[i], &list->ads[i + 1], (list->count - i) * sizeof(list->ads[0]));
+}
+
+static DBData party_booking_list_create(DBKey key, va_list args)
+{
+	struct party_booking_list *list;
+
+	CREATE(list, struct party_booking_list, 1);
+	return db_ptr2data(list);
+}
+
+/// @see DBApply
+static int party_booking_list_final(DBKey key, DBData *data, va_list ap)
+{
+	struct party_booking_list *list = db_data2ptr(data);
+
+	aFree(list->ads);
+	return 0;
+}
+
+/// Adds or removes the ad from the job indexes.
+static void party_booking_index_jobs(struct party_booking_ad_info *pb_ad, bool add)
+{
+	int i;
+
+	for( i = 0; i < PARTY_BOOKING_JOBS; i++ ) {
+		struct party_booking_list *list;
+
+		if( pb_ad->p_detail.job[i] == -1 )
+			continue;
+		list = idb_ensure(party_booking_job_db, pb_ad->p_detail.job[i], party_booking_list_create);
+		if( add )
+			party_booking_list_add(list, pb_ad);
+		else
+			party_booking_list_remove(list, pb_ad);
+	}
+}
+
+/// Adds or removes the ad from all secondary indexes.
+static void party_booking_index(struct party_booking_ad_info *pb_ad, bool add)
+{
+	struct party_booking_list *lists[3];
+	int i;
+
+	lists[0] = &party_booking_all;
+	lists[1] = idb_ensure(party_booking_map_db, pb_ad->p_detail.mapid, party_booking_list_create);
+	lists[2] = idb_ensure(party_booking_level_db, pb_ad->p_detail.level / PARTY_BOOKING_LEVEL_BUCKET, party_booking_list_create);
+	for( i = 0; i < ARRAYLENGTH(lists); i++ ) {
+		if( add )
+			party_booking_list_add(lists[i], pb_ad);
+		else
+			party_booking_list_remove(lists[i], pb_ad);
+	}
+	party_booking_index_jobs(pb_ad, add);
+}
+
+/// Checks the ad against the search filters.
+static bool party_booking_match(struct party_booking_ad_info *pb_ad, short level, short mapid, short job)
+{
+	int i;
+
+	if( level && (pb_ad->p_detail.level < level - 15 || pb_ad->p_detail.level > level) )
+		return false;
+	if( mapid == 0 && job == -1 )
+		return true;
+	if( mapid == 0 ) {
+		ARR_FIND(0, PARTY_BOOKING_JOBS, i, pb_ad->p_detail.job[i] == job);
+		return (i < PARTY_BOOKING_JOBS);
+	}
+	if( job == -1 )
+		return (pb_ad->p_detail.mapid == mapid);
+	return false; //Searching by both map and job never matches
+}
+
 void party_booking_register(struct map_session_data *sd, short level, short mapid, short* job)
 {
 	struct party_booking_ad_info *pb_ad;
@@ -1258,6 +1425,7 @@ void party_booking_register(struct map_session_data *sd, short level, short mapi
 			pb_ad->p_detail.job[i] = job[i];
 		else pb_ad->p_detail.job[i] = -1;
 
+	party_booking_index(pb_ad, true);
 	clif_PartyBookingRegisterAck(sd, 0);
 	clif_PartyBookingInsertNotify(sd, pb_ad); //Notice
 }
@@ -1274,45 +1442,77 @@ void party_booking_update(struct map_session_data *sd, short* job)
 	
 	pb_ad->starttime = (int)time(NULL); //Update time.
 
+	party_booking_index_jobs(pb_ad, false);
 	for (i = 0; i < PARTY_BOOKING_JOBS; i++)
 		if (job[i] != 0xFF)
 			pb_ad->p_detail.job[i] = job[i];
 		else pb_ad->p_detail.job[i] = -1;
+	party_booking_index_jobs(pb_ad, true);
 
 	clif_PartyBookingUpdateNotify(sd, pb_ad);
 }
 
+/**
+ * Searches ads with an index >= lastindex, in index order.
+ * Walks the smallest secondary index that holds every possible match,
+ * so the cost follows the number of candidates rather than all ads.
+ */
 void party_booking_search(struct map_session_data *sd, short level, short mapid, short job, unsigned long lastindex, short resultcount)
 {
-	struct party_booking_ad_info *pb_ad;
+	struct party_booking_list *source[2] = { NULL, NULL };
+	int pos[2] = { 0, 0 };
 	int i, count = 0;
 	struct party_booking_ad_info* result_list[PARTY_BOOKING_RESULTS];
 	bool more_result = false;
-	DBIterator *iter = db_iterator(party_booking_db);
 
 	memset(result_list, 0, sizeof(result_list));
 
-	for (pb_ad = dbi_first(iter); dbi_exists(iter); pb_ad = dbi_next(iter)) {
-		if (pb_ad->index < lastindex || (level && (pb_ad->p_detail.level < level - 15 || pb_ad->p_detail.level > level)))
+	if( mapid != 0 && job != -1 )
+		source[0] = NULL; //Searching by both map and job never matches
+	else if( mapid != 0 )
+		source[0] = (struct party_booking_list *)idb_get(party_booking_map_db, mapid);
+	else if( job != -1 )
+		source[0] = (struct party_booking_list *)idb_get(party_booking_job_db, job);
+	else
+		source[0] = &party_booking_all;
+
+	if( source[0] && level ) { //Level band spans at most two buckets
+		struct party_booking_list *lo = (struct party_booking_list *)idb_get(party_booking_level_db, (level - 15) / PARTY_BOOKING_LEVEL_BUCKET);
+		struct party_booking_list *hi = (struct party_booking_list *)idb_get(party_booking_level_db, level / PARTY_BOOKING_LEVEL_BUCKET);
+
+		if( hi == lo )
+			hi = NULL;
+		if( (lo ? lo->count : 0) + (hi ? hi->count : 0) < source[0]->count ) {
+			source[0] = lo;
+			source[1] = hi;
+		}
+	}
+
+	for( i = 0; i < ARRAYLENGTH(source); i++ )
+		if( source[i] )
+			pos[i] = party_booking_list_lower(source[i], lastindex);
+
+	for( ;; ) { //Merge the sources in index order
+		struct party_booking_ad_info *pb_ad;
+		int s = -1;
+
+		for( i = 0; i < ARRAYLENGTH(source); i++ ) {
+			if( !source[i] || pos[i] >= source[i]->count )
+				continue;
+			if( s == -1 || source[i]->ads[pos[i]]->index < source[s]->ads[pos[s]]->index )
+				s = i;
+		}
+		if( s == -1 )
+			break;
+		pb_ad = source[s]->ads[pos[s]++];
+		if( !party_booking_match(pb_ad, level, mapid, job) )
 			continue;
-		if (count >= PARTY_BOOKING_RESULTS) {
+		if( count >= PARTY_BOOKING_RESULTS ) {
 			more_result = true;
 			break;
 		}
-		if (mapid == 0 && job == -1)
-			result_list[count] = pb_ad;
-		else if (mapid == 0) {
-			for(i = 0; i < PARTY_BOOKING_JOBS; i++)
-				if (pb_ad->p_detail.job[i] == job && job != -1)
-					result_list[count] = pb_ad;
-		} else if (job == -1) {
-			if (pb_ad->p_detail.mapid == mapid)
-				result_list[count] = pb_ad;
-		}
-		if (result_list[count])
-			count++;
+		result_list[count++] = pb_ad;
 	}
-	dbi_destroy(iter);
 	clif_PartyBookingSearchAck(sd->fd, result_list, count, more_result);
 }
 
@@ -1322,6 +1522,7 @@ bool party_booking_delete(struct map_session_data *sd)
 
 	if ((pb_ad = (struct party_booking_ad_info*)idb_get(party_booking_db, sd->status.char_id)) != NULL) {
 		clif_PartyBookingDeleteNotify(sd, pb_ad->index);
+		party_booking_index(pb_ad, false);
 		idb_remove(party_booking_db,sd->status.char_id);
 	}
 	return true;
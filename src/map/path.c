@@ -7,6 +7,8 @@
 #include "../common/nullpo.h"
 #include "../common/random.h"
 #include "../common/showmsg.h"
+#include "../common/timer.h"
+#include "../common/utils.h"
 #include "map.h"
 #include "battle.h"
 #include "path.h"
@@ -35,6 +37,7 @@ struct path_node {
 	short g_cost; ///< Actual cost from start to this node
 	short f_cost; ///< g_cost + heuristic(this, goal)
 	short flag; ///< SET_OPEN / SET_CLOSED
+	unsigned int search; ///< Search the node was last used by, stale if not the current one
 };
 
 /// Binary heap of path nodes
@@ -48,8 +51,97 @@ BHEAP_STRUCT_DECL(node_heap, struct path_node*);
 /// Estimates the cost from (x0,y0) to (x1,y1).
 /// This is inadmissible (overestimating) heuristic used by game client.
 #define heuristic(x0, y0, x1, y1)	(MOVE_COST * (abs((x1) - (x0)) + abs((y1) - (y0)))) // Manhattan distance
+
+/// Node array reused by all searches.
+/// Nodes are invalidated by bumping tp_search instead of clearing the array.
+/// FIXME: This array is too small to ensure all paths shorter than MAX_WALKPATH
+/// can be found without node collision: calc_index(node1) = calc_index(node2)
+/// Figure out more proper size or another way to keep track of known nodes
+static struct path_node tp[MAX_WALKPATH * MAX_WALKPATH];
+static unsigned int tp_search = 0;
+/// 'Open' set of the A* search, storage is kept between searches
+static BHEAP_STRUCT_VAR(node_heap, open_set);
+/// @}
+
+/// @name Cache of A* results
+/// Results only depend on the map cells, which are versioned by path_cache_clear.
+/// Entries are keyed per cell check on purpose: CELL_CHKNOREACH (reachability checks like
+/// unit_can_reach_bl) lets paths run along the last row and column of a map and CELL_CHKNOPASS
+/// (unit_walktoxy) doesn't, so a path found for one check isn't always a valid or identical
+/// answer for the other. Hits come from the same query being repeated with the same check,
+/// e.g. mobs chasing the same target or a unit retrying a walk.
+/// @{
+#define PATH_CACHE_SIZE 64 // Must be a power of 2
+
+struct path_cache_entry {
+	unsigned int version; ///< path_cache_version the entry was stored at
+	int16 m, x0, y0, x1, y1;
+	cell_chk cell;
+	bool found;
+	struct walkpath_data wpd;
+};
+
+static struct path_cache_entry path_cache[PATH_CACHE_SIZE];
+static unsigned int path_cache_version = 1;
+static bool path_cache_enabled = true;
+
+static struct {
+	unsigned int searches; ///< A* searches requested
+	unsigned int hits; ///< Searches answered from the cache
+} path_cache_stats;
+
+#define path_cache_hash(m,x0,y0,x1,y1) ((((m) * 31 + (x0)) * 31 + (y0) + ((x1) * 31 + (y1)) * 17) & (PATH_CACHE_SIZE - 1))
 /// @}
 
+/// Checks if a cell is an obstacle for a walk or shoot path.
+/// Same as map_getcellp(md, x, y, cell) but reads the terrain flags directly
+/// for the checks that only depend on them.
+static inline bool path_cell_blocked(struct map_data *md, int16 x, int16 y, cell_chk cell)
+{
+	struct mapcell *c;
+
+	switch (cell) {
+#ifndef CELL_NOSTACK
+		case CELL_CHKNOPASS:
+#endif
+		case CELL_CHKNOREACH:
+		case CELL_CHKWALL:
+			break;
+		default:
+			return map_getcellp(md, x, y, cell) != 0;
+	}
+
+	//NOTE: this intentionally overrides the last row and column, like map_getcellp
+	if (x < 0 || x >= md->xs - 1 || y < 0 || y >= md->ys - 1)
+		return (cell == CELL_CHKNOPASS);
+
+	c = &md->cell[x + y * md->xs];
+	if (cell == CELL_CHKWALL)
+		return (!c->walkable && !c->shootable);
+	return !c->walkable;
+}
+
+/// Invalidates all cached walk paths.
+/// Called whenever map cells change.
+void path_cache_clear(void)
+{
+	if (++path_cache_version == 0) { // Wrapped, old entries could look valid again
+		memset(path_cache, 0, sizeof(path_cache));
+		path_cache_version = 1;
+	}
+}
+
+/// Checks if the result of a walk path search can be cached.
+/// Cell stacking changes with every unit movement and is not versioned.
+static bool path_cache_allowed(cell_chk cell)
+{
+#ifdef CELL_NOSTACK
+	if (cell == CELL_CHKPASS || cell == CELL_CHKNOPASS || cell == CELL_CHKSTACK)
+		return false;
+#endif
+	return path_cache_enabled;
+}
+
 // Translates dx,dy into walking direction
 static const unsigned char walk_choices [3][3] =
 {
@@ -121,10 +213,6 @@ bool path_search_long(struct shootpath_data *spd,int16 m,int16 x0,int16 y0,int16
 	int wx = 0, wy = 0;
 	int weight;
 	struct map_data *md;
-	struct shootpath_data s_spd;
-
-	if( spd == NULL )
-		spd = &s_spd; // use dummy output variable
 
 	if (!map[m].cell)
 		return false;
@@ -138,17 +226,21 @@ bool path_search_long(struct shootpath_data *spd,int16 m,int16 x0,int16 y0,int16
 	}
 	dy = (y1 - y0);
 
-	spd->rx = spd->ry = 0;
-	spd->len = 1;
-	spd->x[0] = x0;
-	spd->y[0] = y0;
+	if (spd) { // Only record the path if the caller wants it
+		spd->rx = spd->ry = 0;
+		spd->len = 1;
+		spd->x[0] = x0;
+		spd->y[0] = y0;
+	}
 
 	if (dx > abs(dy)) {
 		weight = dx;
-		spd->ry = 1;
+		if (spd)
+			spd->ry = 1;
 	} else {
 		weight = abs(y1 - y0);
-		spd->rx = 1;
+		if (spd)
+			spd->rx = 1;
 	}
 
 	while (x0 != x1 || y0 != y1) {
@@ -165,12 +257,12 @@ bool path_search_long(struct shootpath_data *spd,int16 m,int16 x0,int16 y0,int16
 			wy += weight;
 			y0--;
 		}
-		if (spd->len < MAX_WALKPATH) {
+		if (spd && spd->len < MAX_WALKPATH) {
 			spd->x[spd->len] = x0;
 			spd->y[spd->len] = y0;
 			spd->len++;
 		}
-		if (map_getcellp(md,x0,y0,cell))
+		if (path_cell_blocked(md,x0,y0,cell))
 			return false;
 	}
 
@@ -205,10 +297,15 @@ static int heap_update_node(struct node_heap *heap, struct path_node *node)
 
 /// Path_node processing in A* pathfinding.
 /// Adds new node to heap and updates/re-adds old ones if necessary.
-static int add_path(struct node_heap *heap, struct path_node *tp, int16 x, int16 y, int g_cost, struct path_node *parent, int h_cost)
+static int add_path(struct node_heap *heap, int16 x, int16 y, int g_cost, struct path_node *parent, int h_cost)
 {
 	int i = calc_index(x, y);
 
+	if (tp[i].search != tp_search) { // Left over from an earlier search, clear it
+		memset(&tp[i], 0, sizeof(tp[i]));
+		tp[i].search = tp_search;
+	}
+
 	if (tp[i].x == x && tp[i].y == y) { // We processed this node before
 		if (g_cost < tp[i].g_cost) { // New path to this node is better than old one
 			// Update costs and parent
@@ -241,6 +338,107 @@ static int add_path(struct node_heap *heap, struct path_node *tp, int16 x, int16
 }
 ///@}
 
+/// A* (A-star) pathfinding from (x0,y0) to (x1,y1), see path_search.
+/// Uses the shared node array and open set, so it is not re-entrant.
+static bool path_search_astar(struct walkpath_data *wpd, struct map_data *md, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cell)
+{
+	struct path_node *current, *it;
+	int xs = md->xs - 1;
+	int ys = md->ys - 1;
+	int len = 0;
+	int i, j, x, y, dx, dy;
+
+	if (++tp_search == 0) { // Wrapped, stale nodes could look current again
+		memset(tp, 0, sizeof(tp));
+		tp_search = 1;
+	}
+	BHEAP_LENGTH(open_set) = 0;
+
+	// Start node
+	i = calc_index(x0, y0);
+	tp[i].parent = NULL;
+	tp[i].x      = x0;
+	tp[i].y      = y0;
+	tp[i].g_cost = 0;
+	tp[i].f_cost = heuristic(x0, y0, x1, y1);
+	tp[i].flag   = SET_OPEN;
+	tp[i].search = tp_search;
+
+	heap_push_node(&open_set, &tp[i]); // Put start node to 'open' set
+
+	for(;;) {
+		int e = 0; // error flag
+
+		// Saves allowed directions for the current cell. Diagonal directions
+		// are only allowed if both directions around it are allowed. This is
+		// to prevent cutting corner of nearby wall.
+		// For example, you can only go NW from the current cell, if you can
+		// go N *and* you can go W. Otherwise you need to walk around the
+		// (corner of the) non-walkable cell.
+		int allowed_dirs = 0;
+
+		int g_cost;
+
+		if (BHEAP_LENGTH(open_set) == 0)
+			return false;
+
+		current = BHEAP_PEEK(open_set); // Look for the lowest f_cost node in the 'open' set
+		BHEAP_POP2(open_set, NODE_MINTOPCMP, swap_ptr); // Remove it from 'open' set
+
+		x      = current->x;
+		y      = current->y;
+		g_cost = current->g_cost;
+
+		current->flag = SET_CLOSED; // Add current node to 'closed' set
+
+		if (x == x1 && y == y1)
+			break;
+
+		if (y < ys && !path_cell_blocked(md, x, y+1, cell)) allowed_dirs |= DIR_NORTH;
+		if (y >  0 && !path_cell_blocked(md, x, y-1, cell)) allowed_dirs |= DIR_SOUTH;
+		if (x < xs && !path_cell_blocked(md, x+1, y, cell)) allowed_dirs |= DIR_EAST;
+		if (x >  0 && !path_cell_blocked(md, x-1, y, cell)) allowed_dirs |= DIR_WEST;
+
+#define chk_dir(d) ((allowed_dirs & (d)) == (d))
+		// Process neighbors of current node
+		if (chk_dir(DIR_SOUTH|DIR_EAST) && !path_cell_blocked(md, x+1, y-1, cell))
+			e += add_path(&open_set, x+1, y-1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x+1, y-1, x1, y1)); // (x+1, y-1) 5
+		if (chk_dir(DIR_EAST))
+			e += add_path(&open_set, x+1, y, g_cost + MOVE_COST, current, heuristic(x+1, y, x1, y1)); // (x+1, y) 6
+		if (chk_dir(DIR_NORTH|DIR_EAST) && !path_cell_blocked(md, x+1, y+1, cell))
+			e += add_path(&open_set, x+1, y+1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x+1, y+1, x1, y1)); // (x+1, y+1) 7
+		if (chk_dir(DIR_NORTH))
+			e += add_path(&open_set, x, y+1, g_cost + MOVE_COST, current, heuristic(x, y+1, x1, y1)); // (x, y+1) 0
+		if (chk_dir(DIR_NORTH|DIR_WEST) && !path_cell_blocked(md, x-1, y+1, cell))
+			e += add_path(&open_set, x-1, y+1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x-1, y+1, x1, y1)); // (x-1, y+1) 1
+		if (chk_dir(DIR_WEST))
+			e += add_path(&open_set, x-1, y, g_cost + MOVE_COST, current, heuristic(x-1, y, x1, y1)); // (x-1, y) 2
+		if (chk_dir(DIR_SOUTH|DIR_WEST) && !path_cell_blocked(md, x-1, y-1, cell))
+			e += add_path(&open_set, x-1, y-1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x-1, y-1, x1, y1)); // (x-1, y-1) 3
+		if (chk_dir(DIR_SOUTH))
+			e += add_path(&open_set, x, y-1, g_cost + MOVE_COST, current, heuristic(x, y-1, x1, y1)); // (x, y-1) 4
+#undef chk_dir
+		if (e)
+			return false;
+	}
+
+	for (it = current; it->parent != NULL; it = it->parent, len++);
+	if (len > sizeof(wpd->path))
+		return false;
+
+	// Recreate path
+	wpd->path_len = len;
+	wpd->path_pos = 0;
+
+	for (it = current, j = len-1; j >= 0; it = it->parent, j--) {
+		dx = it->x - it->parent->x;
+		dy = it->y - it->parent->y;
+		wpd->path[j] = walk_choices[-dy + 1][dx + 1];
+	}
+
+	return true;
+}
+
 /*==========================================
  * path search (x0,y0)->(x1,y1)
  * wpd: path info will be written here
@@ -313,110 +511,42 @@ bool path_search(struct walkpath_data *wpd, int16 m, int16 x0, int16 y0, int16 x
 		// A* (A-star) pathfinding
 		// We always use A* for finding walkpaths because it is what game client uses
 		// Easy pathfinding cuts corners of non-walkable cells, but client always walks around it
-
-		BHEAP_STRUCT_VAR(node_heap, open_set); // 'Open' set
-
-		// FIXME: This array is too small to ensure all paths shorter than MAX_WALKPATH
-		// can be found without node collision: calc_index(node1) = calc_index(node2)
-		// Figure out more proper size or another way to keep track of known nodes
-		struct path_node tp[MAX_WALKPATH * MAX_WALKPATH];
-		struct path_node *current, *it;
-		int xs = md->xs - 1;
-		int ys = md->ys - 1;
-		int len = 0;
-		int j;
-
-		memset(tp, 0, sizeof(tp));
-
-		// Start node
-		i = calc_index(x0, y0);
-		tp[i].parent = NULL;
-		tp[i].x      = x0;
-		tp[i].y      = y0;
-		tp[i].g_cost = 0;
-		tp[i].f_cost = heuristic(x0, y0, x1, y1);
-		tp[i].flag   = SET_OPEN;
-
-		heap_push_node(&open_set, &tp[i]); // Put start node to 'open' set
-
-		for(;;) {
-			int e = 0; // error flag
-
-			// Saves allowed directions for the current cell. Diagonal directions
-			// are only allowed if both directions around it are allowed. This is
-			// to prevent cutting corner of nearby wall.
-			// For example, you can only go NW from the current cell, if you can
-			// go N *and* you can go W. Otherwise you need to walk around the
-			// (corner of the) non-walkable cell.
-			int allowed_dirs = 0;
-
-			int g_cost;
-
-			if (BHEAP_LENGTH(open_set) == 0) {
-				BHEAP_CLEAR(open_set);
-				return false;
-			}
-
-			current = BHEAP_PEEK(open_set); // Look for the lowest f_cost node in the 'open' set
-			BHEAP_POP2(open_set, NODE_MINTOPCMP, swap_ptr); // Remove it from 'open' set
-
-			x      = current->x;
-			y      = current->y;
-			g_cost = current->g_cost;
-
-			current->flag = SET_CLOSED; // Add current node to 'closed' set
-
-			if (x == x1 && y == y1) {
-				BHEAP_CLEAR(open_set);
-				break;
-			}
-
-			if (y < ys && !map_getcellp(md, x, y+1, cell)) allowed_dirs |= DIR_NORTH;
-			if (y >  0 && !map_getcellp(md, x, y-1, cell)) allowed_dirs |= DIR_SOUTH;
-			if (x < xs && !map_getcellp(md, x+1, y, cell)) allowed_dirs |= DIR_EAST;
-			if (x >  0 && !map_getcellp(md, x-1, y, cell)) allowed_dirs |= DIR_WEST;
-
-#define chk_dir(d) ((allowed_dirs & (d)) == (d))
-			// Process neighbors of current node
-			if (chk_dir(DIR_SOUTH|DIR_EAST) && !map_getcellp(md, x+1, y-1, cell))
-				e += add_path(&open_set, tp, x+1, y-1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x+1, y-1, x1, y1)); // (x+1, y-1) 5
-			if (chk_dir(DIR_EAST))
-				e += add_path(&open_set, tp, x+1, y, g_cost + MOVE_COST, current, heuristic(x+1, y, x1, y1)); // (x+1, y) 6
-			if (chk_dir(DIR_NORTH|DIR_EAST) && !map_getcellp(md, x+1, y+1, cell))
-				e += add_path(&open_set, tp, x+1, y+1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x+1, y+1, x1, y1)); // (x+1, y+1) 7
-			if (chk_dir(DIR_NORTH))
-				e += add_path(&open_set, tp, x, y+1, g_cost + MOVE_COST, current, heuristic(x, y+1, x1, y1)); // (x, y+1) 0
-			if (chk_dir(DIR_NORTH|DIR_WEST) && !map_getcellp(md, x-1, y+1, cell))
-				e += add_path(&open_set, tp, x-1, y+1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x-1, y+1, x1, y1)); // (x-1, y+1) 1
-			if (chk_dir(DIR_WEST))
-				e += add_path(&open_set, tp, x-1, y, g_cost + MOVE_COST, current, heuristic(x-1, y, x1, y1)); // (x-1, y) 2
-			if (chk_dir(DIR_SOUTH|DIR_WEST) && !map_getcellp(md, x-1, y-1, cell))
-				e += add_path(&open_set, tp, x-1, y-1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x-1, y-1, x1, y1)); // (x-1, y-1) 3
-			if (chk_dir(DIR_SOUTH))
-				e += add_path(&open_set, tp, x, y-1, g_cost + MOVE_COST, current, heuristic(x, y-1, x1, y1)); // (x, y-1) 4
-#undef chk_dir
-			if (e) {
-				BHEAP_CLEAR(open_set);
-				return false;
+		struct path_cache_entry *entry = NULL;
+		bool found;
+
+		path_cache_stats.searches++;
+		if (path_cache_allowed(cell)) {
+			entry = &path_cache[path_cache_hash(m, x0, y0, x1, y1)];
+			if (entry->version == path_cache_version && entry->m == m && entry->cell == cell &&
+				entry->x0 == x0 && entry->y0 == y0 && entry->x1 == x1 && entry->y1 == y1) {
+				path_cache_stats.hits++;
+				if (entry->found) {
+					wpd->path_len = entry->wpd.path_len;
+					wpd->path_pos = 0;
+					memcpy(wpd->path, entry->wpd.path, entry->wpd.path_len);
+				}
+				return entry->found;
 			}
 		}
 
-		for (it = current; it->parent != NULL; it = it->parent, len++);
-		if (len > sizeof(wpd->path))
-			return false;
-
-		// Recreate path
-		wpd->path_len = len;
-		wpd->path_pos = 0;
-
-		for (it = current, j = len-1; j >= 0; it = it->parent, j--) {
-			dx = it->x - it->parent->x;
-			dy = it->y - it->parent->y;
-			wpd->path[j] = walk_choices[-dy + 1][dx + 1];
+		found = path_search_astar(wpd, md, x0, y0, x1, y1, cell);
+
+		if (entry) {
+			entry->version = path_cache_version;
+			entry->m = m;
+			entry->x0 = x0;
+			entry->y0 = y0;
+			entry->x1 = x1;
+			entry->y1 = y1;
+			entry->cell = cell;
+			entry->found = found;
+			if (found) {
+				entry->wpd.path_len = wpd->path_len;
+				memcpy(entry->wpd.path, wpd->path, wpd->path_len);
+			}
 		}
-
-		return true;
-	} // A* end
+		return found;
+	}
 
 	return false;
 }
@@ -498,3 +628,87 @@ int distance_client(int dx, int dy)
 
 	return ((int)temp_dist);
 }
+
+/**
+ * Displays how many A* searches were answered from the path cache.
+ */
+void path_cache_report(void)
+{
+	ShowInfo("path_search: %u A* searches, %u cache hits (%u%%).\n", path_cache_stats.searches, path_cache_stats.hits,
+		(path_cache_stats.searches ? (unsigned int)((uint64)path_cache_stats.hits * 100 / path_cache_stats.searches) : 0));
+}
+
+/**
+ * Times A* searches between random walkable cells of a map, with and without the path cache,
+ * then line of sight checks between the same cells.
+ * Each query is searched twice in a row, like unit_can_reach_bl followed by unit_walktoxy.
+ * @param args: "<map name> <queries>"
+ */
+void path_bench(const char *args)
+{
+	char mapname[MAP_NAME_LENGTH_EXT];
+	struct walkpath_data wpd;
+	struct map_data *md;
+	int16 m, *query;
+	int queries = 1000, count = 0, tries, i, pass;
+
+	if( sscanf(args, "%15s %d", mapname, &queries) < 1 || (m = map_mapname2mapid(mapname)) < 0 || !map[m].cell ) {
+		ShowInfo("Usage: path_bench:<map name> <queries>\n");
+		return;
+	}
+
+	md = &map[m];
+	queries = cap_value(queries, 1, 100000);
+	CREATE(query, int16, queries * 4);
+
+	for( tries = 0; count < queries && tries < queries * 100; tries++ ) {
+		int16 x0 = rnd()%md->xs, y0 = rnd()%md->ys;
+		int16 x1 = x0 + rnd()%(AREA_SIZE * 2 + 1) - AREA_SIZE, y1 = y0 + rnd()%(AREA_SIZE * 2 + 1) - AREA_SIZE;
+
+		if( map_getcellp(md, x0, y0, CELL_CHKNOPASS) || map_getcellp(md, x1, y1, CELL_CHKNOPASS) )
+			continue; // Out of bounds counts as not passable
+		query[count * 4 + 0] = x0;
+		query[count * 4 + 1] = y0;
+		query[count * 4 + 2] = x1;
+		query[count * 4 + 3] = y1;
+		count++;
+	}
+
+	for( pass = 0; pass < 2; pass++ ) {
+		unsigned int start, hits = path_cache_stats.hits;
+		int found = 0;
+
+		path_cache_enabled = (pass != 0);
+		path_cache_clear();
+		start = gettick_nocache();
+		for( i = 0; i < count * 2; i++ ) {
+			int16 *q = &query[(i / 2) * 4];
+
+			if( path_search(&wpd, m, q[0], q[1], q[2], q[3], 0, CELL_CHKNOPASS) )
+				found++;
+		}
+		ShowInfo("path_bench: %s: %u ms for %d searches on %s, %d found, %u cache hits\n",
+			(pass ? "cached" : "uncached"), (unsigned int)DIFF_TICK(gettick_nocache(), start), count * 2, mapname, found, path_cache_stats.hits - hits);
+	}
+	path_cache_enabled = true;
+
+	{ // Line of sight checks between the same cells, as done by ranged attacks
+		unsigned int start = gettick_nocache();
+		int clear = 0, rounds = 10;
+
+		for( i = 0; i < count * rounds; i++ ) {
+			int16 *q = &query[(i % count) * 4];
+
+			if( path_search_long(NULL, m, q[0], q[1], q[2], q[3], CELL_CHKWALL) )
+				clear++;
+		}
+		ShowInfo("path_bench: line of sight: %u ms for %d checks on %s, %d clear\n",
+			(unsigned int)DIFF_TICK(gettick_nocache(), start), count * rounds, mapname, clear);
+	}
+	aFree(query);
+}
+
+void do_final_path(void)
+{
+	BHEAP_CLEAR(open_set);
+}
@@ -46,6 +46,11 @@ int path_blownpos(int16 m,int16 x0,int16 y0,int16 dx,int16 dy,int count);
 // tries to find a walkable path
 bool path_search(struct walkpath_data *wpd,int16 m,int16 x0,int16 y0,int16 x1,int16 y1,int flag,cell_chk cell);
 
+// invalidates cached walk paths, call when map cells change
+void path_cache_clear(void);
+void path_cache_report(void);
+void path_bench(const char *args);
+
 // tries to find a shootable path
 bool path_search_long(struct shootpath_data *spd,int16 m,int16 x0,int16 y0,int16 x1,int16 y1,cell_chk cell);
 
@@ -55,4 +60,6 @@ unsigned int distance(int dx, int dy);
 bool check_distance_client(int dx, int dy, int distance);
 int distance_client(int dx, int dy);
 
+void do_final_path(void);
+
 #endif /* _PATH_H_ */
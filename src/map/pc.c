@@ -305,7 +305,7 @@ static int pc_check_banding(struct block_list *bl, va_list ap) {
 
 	sc = status_get_sc(bl);
 
-	if( sc && sc->data[SC_BANDING] ) {
+	if( sc && sc_data(sc, SC_BANDING) ) {
 		b_sd[(*c)++] = tsd->bl.id;
 		return 1;
 	}
@@ -330,8 +330,8 @@ int pc_banding(struct map_session_data *sd, uint16 skill_lv) {
 		//No more Royal Guards in Banding found
 		struct status_change *sc;
 
-		if( (sc = status_get_sc(&sd->bl)) != NULL  && sc->data[SC_BANDING] ) {
-			sc->data[SC_BANDING]->val2 = 0; //Reset the counter
+		if( (sc = status_get_sc(&sd->bl)) != NULL  && sc_data(sc, SC_BANDING) ) {
+			sc_data(sc, SC_BANDING)->val2 = 0; //Reset the counter
 			status_calc_bl(&sd->bl,status_sc2scb_flag(SC_BANDING));
 		}
 		return 0;
@@ -373,8 +373,8 @@ int pc_banding(struct map_session_data *sd, uint16 skill_lv) {
 			struct status_change *sc;
 
 			status_set_hp(&bsd->bl,hp,0); //Set HP
-			if( (sc = status_get_sc(&bsd->bl)) != NULL && sc->data[SC_BANDING] ) {
-				sc->data[SC_BANDING]->val2 = c; //Set the counter
+			if( (sc = status_get_sc(&bsd->bl)) != NULL && sc_data(sc, SC_BANDING) ) {
+				sc_data(sc, SC_BANDING)->val2 = c; //Set the counter
 				status_calc_bl(&bsd->bl,status_sc2scb_flag(SC_BANDING)); //Set ATK and DEF
 			}
 		}
@@ -508,7 +508,7 @@ void pc_rental_expire(struct map_session_data *sd, int i)
 	//Soon to be dropped, we got plans to integrate it with item db
 	switch( nameid ) {
 		case ITEMID_BOARDING_HALTER:
-			if( sd->sc.data[SC_ALL_RIDING] )
+			if( sc_data(&sd->sc, SC_ALL_RIDING) )
 				status_change_end(&sd->bl, SC_ALL_RIDING, INVALID_TIMER);
 			break;
 		case ITEMID_LOVE_ANGEL:
@@ -649,7 +649,7 @@ void pc_makesavestatus(struct map_session_data *sd)
 #else
 	sd->status.option = sd->sc.option&(OPTION_INVISIBLE|OPTION_CART|OPTION_FALCON|OPTION_RIDING|OPTION_DRAGON|OPTION_WUG|OPTION_WUGRIDER|OPTION_MADOGEAR);
 #endif
-	if(sd->sc.data[SC_JAILED]) { //When Jailed, do not move last point
+	if(sc_data(&sd->sc, SC_JAILED)) { //When Jailed, do not move last point
 		if(pc_isdead(sd)) {
 			pc_setrestartvalue(sd,0);
 		} else {
@@ -737,6 +737,100 @@ int pc_equippoint(struct map_session_data *sd, int n)
 	return ep;
 }
 
+#define pc_inventory_bucket(nameid) ((nameid)&(INVENTORY_INDEX_BUCKETS-1))
+
+/**
+ * Links inventory slot n into the nameid index.
+ * Bucket chains are kept in ascending slot order, so lookups return the same
+ * slot a linear scan of the inventory would.
+ * @param sd
+ * @param n Item index in inventory, its nameid must be set
+ */
+static void pc_inventory_index_add(struct map_session_data *sd, short n)
+{
+	short *p = &sd->inventory_index.head[pc_inventory_bucket(sd->status.inventory[n].nameid)];
+
+	while( *p != -1 && *p < n )
+		p = &sd->inventory_index.next[*p];
+	sd->inventory_index.next[n] = *p;
+	*p = n;
+}
+
+/**
+ * Unlinks inventory slot n from the nameid index, must be called before its nameid is cleared.
+ * @param sd
+ * @param n Item index in inventory
+ */
+static void pc_inventory_index_remove(struct map_session_data *sd, short n)
+{
+	short *p = &sd->inventory_index.head[pc_inventory_bucket(sd->status.inventory[n].nameid)];
+
+	while( *p != -1 && *p != n )
+		p = &sd->inventory_index.next[*p];
+	if( *p == n )
+		*p = sd->inventory_index.next[n];
+	sd->inventory_index.next[n] = -1;
+}
+
+/**
+ * Rebuilds the nameid index from the whole inventory.
+ * @param sd
+ */
+static void pc_inventory_index_build(struct map_session_data *sd)
+{
+	short i;
+
+	for( i = 0; i < INVENTORY_INDEX_BUCKETS; i++ )
+		sd->inventory_index.head[i] = -1;
+	for( i = MAX_INVENTORY - 1; i >= 0; i-- ) { //Prepend backwards to get ascending chains
+		unsigned short nameid = sd->status.inventory[i].nameid;
+
+		if( !nameid ) {
+			sd->inventory_index.next[i] = -1;
+			continue;
+		}
+		sd->inventory_index.next[i] = sd->inventory_index.head[pc_inventory_bucket(nameid)];
+		sd->inventory_index.head[pc_inventory_bucket(nameid)] = i;
+	}
+}
+
+/**
+ * Verifies the nameid index against a linear scan of the inventory.
+ * Called after every index update in DEBUG builds.
+ * @param sd
+ * @return true if the index is consistent, false otherwise (the index is rebuilt)
+ */
+bool pc_inventory_index_check(struct map_session_data *sd)
+{
+	short i, n, linked = 0, used = 0;
+
+	nullpo_retr(false, sd);
+
+	for( i = 0; i < INVENTORY_INDEX_BUCKETS; i++ ) {
+		short prev = -1;
+
+		for( n = sd->inventory_index.head[i]; n != -1; n = sd->inventory_index.next[n] ) {
+			if( n <= prev || n >= MAX_INVENTORY || !sd->status.inventory[n].nameid ||
+				pc_inventory_bucket(sd->status.inventory[n].nameid) != i || ++linked > MAX_INVENTORY )
+			{
+				ShowError("pc_inventory_index_check: Corrupted bucket %d at slot %d (CID:%d).\n", i, n, sd->status.char_id);
+				pc_inventory_index_build(sd);
+				return false;
+			}
+			prev = n;
+		}
+	}
+	for( i = 0; i < MAX_INVENTORY; i++ )
+		if( sd->status.inventory[i].nameid )
+			used++;
+	if( linked != used ) {
+		ShowError("pc_inventory_index_check: %d slots indexed, %d slots used (CID:%d).\n", linked, used, sd->status.char_id);
+		pc_inventory_index_build(sd);
+		return false;
+	}
+	return true;
+}
+
 /**
  * Fill inventory_data with struct *item_data through inventory (fill with struct *item)
  * @param sd : player session
@@ -753,6 +847,7 @@ void pc_setinventorydata(struct map_session_data *sd)
 
 		sd->inventory_data[i] = (id ? itemdb_search(id) : NULL);
 	}
+	pc_inventory_index_build(sd);
 }
 
 /**
@@ -1080,20 +1175,20 @@ uint8 pc_isequip(struct map_session_data *sd, int n)
 	}
 
 	if(sd->sc.count) {
-		if((item->equip&EQP_ARMS) && item->type == IT_WEAPON && sd->sc.data[SC_STRIPWEAPON])
+		if((item->equip&EQP_ARMS) && item->type == IT_WEAPON && sc_data(&sd->sc, SC_STRIPWEAPON))
 			return ITEM_EQUIP_ACK_FAIL; //Also works with left-hand weapons [DracoRPG]
-		if((item->equip&EQP_SHIELD) && item->type == IT_ARMOR && sd->sc.data[SC_STRIPSHIELD])
+		if((item->equip&EQP_SHIELD) && item->type == IT_ARMOR && sc_data(&sd->sc, SC_STRIPSHIELD))
 			return ITEM_EQUIP_ACK_FAIL;
-		if((item->equip&EQP_ARMOR) && sd->sc.data[SC_STRIPARMOR])
+		if((item->equip&EQP_ARMOR) && sc_data(&sd->sc, SC_STRIPARMOR))
 			return ITEM_EQUIP_ACK_FAIL;
-		if((item->equip&EQP_HEAD_TOP) && sd->sc.data[SC_STRIPHELM])
+		if((item->equip&EQP_HEAD_TOP) && sc_data(&sd->sc, SC_STRIPHELM))
 			return ITEM_EQUIP_ACK_FAIL;
-		if((item->equip&EQP_ACC) && sd->sc.data[SC__STRIPACCESSORY])
+		if((item->equip&EQP_ACC) && sc_data(&sd->sc, SC__STRIPACCESSORY))
 			return ITEM_EQUIP_ACK_FAIL;
-		if(item->equip && sd->sc.data[SC_KYOUGAKU])
+		if(item->equip && sc_data(&sd->sc, SC_KYOUGAKU))
 			return ITEM_EQUIP_ACK_FAIL;
 		//Spirit of Super Novice equip bonuses [Skotlex]
-		if(sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SUPERNOVICE) {
+		if(sc_data(&sd->sc, SC_SPIRIT) && sc_data(&sd->sc, SC_SPIRIT)->val2 == SL_SUPERNOVICE) {
 			if(sd->status.base_level > 90 && item->equip&EQP_HELM)
 				return ITEM_EQUIP_ACK_OK; //Can equip all helms
 			if(sd->status.base_level > 96 && item->equip&EQP_ARMS && item->type == IT_WEAPON && item->wlv == 4)
@@ -1576,8 +1671,8 @@ void pc_calc_skilltree(struct map_session_data *sd)
 			sd->status.skill[i].flag = SKILL_FLAG_PERMANENT;
 		}
 
-		if( sd->sc.count && sd->sc.data[SC_SPIRIT] &&
-			sd->sc.data[SC_SPIRIT]->val2 == SL_BARDDANCER && i >= DC_HUMMING && i<= DC_SERVICEFORYOU ) { //Enable Bard/Dancer spirit linked skills
+		if( sd->sc.count && sc_data(&sd->sc, SC_SPIRIT) &&
+			sc_data(&sd->sc, SC_SPIRIT)->val2 == SL_BARDDANCER && i >= DC_HUMMING && i<= DC_SERVICEFORYOU ) { //Enable Bard/Dancer spirit linked skills
 			if( sd->status.sex ) { //Link dancer skills to bard.
 				if( sd->status.skill[i - 8].lv < 10 )
 					continue;
@@ -1689,7 +1784,7 @@ void pc_calc_skilltree(struct map_session_data *sd)
 				if( !sd->status.skill[id].lv && (
 					(inf2&INF2_QUEST_SKILL && !battle_config.quest_skill_learn) ||
 					inf2&INF2_WEDDING_SKILL ||
-					(inf2&INF2_SPIRIT_SKILL && !sd->sc.data[SC_SPIRIT])
+					(inf2&INF2_SPIRIT_SKILL && !sc_data(&sd->sc, SC_SPIRIT))
 				) )
 					continue; //Cannot be learned via normal means. Note this check DOES allows raising already known skills.
 
@@ -1774,7 +1869,7 @@ static void pc_check_skilltree(struct map_session_data *sd, int skill)
 			if( !sd->status.skill[id].lv &&
 				((j&INF2_QUEST_SKILL && !battle_config.quest_skill_learn) ||
 				j&INF2_WEDDING_SKILL ||
-				(j&INF2_SPIRIT_SKILL && !sd->sc.data[SC_SPIRIT])) )
+				(j&INF2_SPIRIT_SKILL && !sc_data(&sd->sc, SC_SPIRIT))) )
 				continue; //Cannot be learned via normal means
 			sd->status.skill[id].id = id;
 			flag = 1;
@@ -1876,7 +1971,7 @@ void pc_updateweightstatus(struct map_session_data *sd)
 
 	nullpo_retv(sd);
 
-	old_overweight = (sd->sc.data[SC_WEIGHT90]) ? 2 : (sd->sc.data[SC_WEIGHT50]) ? 1 : 0;
+	old_overweight = (sc_data(&sd->sc, SC_WEIGHT90)) ? 2 : (sc_data(&sd->sc, SC_WEIGHT50)) ? 1 : 0;
 	new_overweight = (pc_is90overweight(sd)) ? 2 : (pc_is50overweight(sd)) ? 1 : 0;
 
 	if( old_overweight == new_overweight )
@@ -4011,14 +4106,12 @@ char pc_checkadditem(struct map_session_data *sd, unsigned short nameid, int amo
 	if(data->stack.inventory && amount > data->stack.amount)
 		return CHKADDITEM_OVERAMOUNT;
 
-	for(i = 0; i < MAX_INVENTORY; i++) {
-		//FIXME: This does not consider the checked item's cards, thus could check a wrong slot for stackability.
-		if(sd->status.inventory[i].nameid == nameid) {
-			if(amount > MAX_AMOUNT - sd->status.inventory[i].amount ||
-				(data->stack.inventory && amount > data->stack.amount - sd->status.inventory[i].amount))
-				return CHKADDITEM_OVERAMOUNT;
-			return CHKADDITEM_EXIST;
-		}
+	//FIXME: This does not consider the checked item's cards, thus could check a wrong slot for stackability.
+	if( (i = pc_search_inventory(sd, nameid)) != INDEX_NOT_FOUND ) {
+		if(amount > MAX_AMOUNT - sd->status.inventory[i].amount ||
+			(data->stack.inventory && amount > data->stack.amount - sd->status.inventory[i].amount))
+			return CHKADDITEM_OVERAMOUNT;
+		return CHKADDITEM_EXIST;
 	}
 
 	return CHKADDITEM_NEW;
@@ -4066,6 +4159,8 @@ char pc_payzeny(struct map_session_data *sd, int zeny, enum e_log_pick_type type
 
 	sd->status.zeny -= zeny;
 	clif_updatestatus(sd, SP_ZENY);
+	if( zeny > 0 )
+		pc_autosave_dirty(sd, 1 + zeny / PC_AUTOSAVE_DIRTY_ZENY_STEP);
 	if( !tsd )
 		tsd = sd;
 
@@ -4103,6 +4198,8 @@ char pc_getzeny(struct map_session_data *sd,int zeny, enum e_log_pick_type type,
 
 	sd->status.zeny += zeny;
 	clif_updatestatus(sd, SP_ZENY);
+	if( zeny > 0 )
+		pc_autosave_dirty(sd, 1 + zeny / PC_AUTOSAVE_DIRTY_ZENY_STEP);
 
 	if( !tsd )
 		tsd = sd;
@@ -4233,10 +4330,33 @@ short pc_search_inventory(struct map_session_data *sd, unsigned short nameid)
 
 	nullpo_retr(INDEX_NOT_FOUND, sd);
 
-	ARR_FIND(0, MAX_INVENTORY, i, sd->status.inventory[i].nameid == nameid && (sd->status.inventory[i].amount > 0 || nameid == 0));
+	if( nameid ) //Use the nameid index
+		return pc_search_inventory_next(sd, nameid, INDEX_NOT_FOUND);
+
+	ARR_FIND(0, MAX_INVENTORY, i, sd->status.inventory[i].nameid == 0);
 	return (i < MAX_INVENTORY) ? i : INDEX_NOT_FOUND;
 }
 
+/**
+ * Search for the next inventory slot holding the given item, used to walk all its stacks.
+ * @param sd      Character to search on.
+ * @param nameid  The item ID to search, must not be 0.
+ * @param prev    Slot returned by the previous call, or INDEX_NOT_FOUND to start.
+ * @return the inventory index of the next instance after prev.
+ * @return INDEX_NOT_FOUND if there are no more instances.
+ */
+short pc_search_inventory_next(struct map_session_data *sd, unsigned short nameid, short prev)
+{
+	short i;
+
+	nullpo_retr(INDEX_NOT_FOUND, sd);
+
+	for( i = sd->inventory_index.head[pc_inventory_bucket(nameid)]; i != -1; i = sd->inventory_index.next[i] )
+		if( i > prev && sd->status.inventory[i].nameid == nameid && sd->status.inventory[i].amount > 0 )
+			return i;
+	return INDEX_NOT_FOUND;
+}
+
 /** Attempt to add a new item to player inventory
  * @param sd
  * @param item
@@ -4283,9 +4403,8 @@ char pc_additem(struct map_session_data *sd,struct item *item,int amount,e_log_p
 #endif
 
 	if( itemdb_isstackable2(id) && item->expire_time == 0 ) { //Stackable | Non Rental
-		for( i = 0; i < MAX_INVENTORY; i++ ) {
-			if( sd->status.inventory[i].nameid == item->nameid &&
-				sd->status.inventory[i].bound == item->bound &&
+		for( i = pc_search_inventory(sd, item->nameid); i != INDEX_NOT_FOUND; i = pc_search_inventory_next(sd, item->nameid, i) ) {
+			if( sd->status.inventory[i].bound == item->bound &&
 				sd->status.inventory[i].expire_time == 0 &&
 #ifdef ENABLE_ITEM_GUID
 				sd->status.inventory[i].unique_id == item->unique_id &&
@@ -4300,6 +4419,8 @@ char pc_additem(struct map_session_data *sd,struct item *item,int amount,e_log_p
 				break;
 			}
 		}
+		if( i == INDEX_NOT_FOUND )
+			i = MAX_INVENTORY;
 	}
 
 	if( i >= MAX_INVENTORY ) {
@@ -4317,6 +4438,10 @@ char pc_additem(struct map_session_data *sd,struct item *item,int amount,e_log_p
 		sd->status.inventory[i].amount = amount;
 		sd->inventory_data[i] = id;
 		sd->last_addeditem_index = i;
+		pc_inventory_index_add(sd, i);
+#if defined(DEBUG)
+		pc_inventory_index_check(sd);
+#endif
 		clif_additem(sd, i, amount, 0);
 	}
 
@@ -4371,8 +4496,12 @@ char pc_delitem(struct map_session_data *sd, int n, int amount, int type, short
 	if(sd->status.inventory[n].amount <= 0) {
 		if(sd->status.inventory[n].equip)
 			pc_unequipitem(sd, n, 3);
+		pc_inventory_index_remove(sd, n);
 		memset(&sd->status.inventory[n], 0, sizeof(sd->status.inventory[0]));
 		sd->inventory_data[n] = NULL;
+#if defined(DEBUG)
+		pc_inventory_index_check(sd);
+#endif
 	}
 	if(!(type&1))
 		clif_delitem(sd, n, amount, reason);
@@ -4573,7 +4702,7 @@ bool pc_isUseitem(struct map_session_data *sd, int n)
 			break;
 		case ITEMID_BUBBLE_GUM:
 		case ITEMID_COMP_BUBBLE_GUM:
-			if( sd->sc.data[SC_ITEMBOOST] )
+			if( sc_data(&sd->sc, SC_ITEMBOOST) )
 				return false;
 			break;
 		case ITEMID_BATTLE_MANUAL:
@@ -4583,11 +4712,11 @@ bool pc_isUseitem(struct map_session_data *sd, int n)
 		case ITEMID_BATTLE_MANUAL25:
 		case ITEMID_BATTLE_MANUAL100:
 		case ITEMID_BATTLE_MANUAL300:
-			if( sd->sc.data[SC_EXPBOOST] )
+			if( sc_data(&sd->sc, SC_EXPBOOST) )
 				return false;
 			break;
 		case ITEMID_JOB_MANUAL50:
-			if( sd->sc.data[SC_JEXPBOOST] )
+			if( sc_data(&sd->sc, SC_JEXPBOOST) )
 				return false;
 			break;
 		case ITEMID_MERCENARY_RED_POTION:
@@ -4597,7 +4726,7 @@ bool pc_isUseitem(struct map_session_data *sd, int n)
 		case ITEMID_M_BERSERK_POTION:
 			if( sd->md == NULL || sd->md->db == NULL )
 				return false;
-			if( sd->md->sc.data[SC_BERSERK] )
+			if( sc_data(&sd->md->sc, SC_BERSERK) )
 				return false;
 			if( nameid == ITEMID_M_AWAKENING_POTION && sd->md->db->lv < 40 )
 				return false;
@@ -4609,7 +4738,7 @@ bool pc_isUseitem(struct map_session_data *sd, int n)
 				return false;
 			break;
 		case ITEMID_SQUID_BBQ:
-			if( sd->sc.data[SC_JP_EVENT04] )
+			if( sc_data(&sd->sc, SC_JP_EVENT04) )
 				return false;
 			break;
 	}
@@ -4648,18 +4777,18 @@ bool pc_isUseitem(struct map_session_data *sd, int n)
 
 	//Statuses that don't let the player use items
 	if( sd->sc.count &&
-		(sd->sc.data[SC_BERSERK] ||
-		sd->sc.data[SC_SATURDAYNIGHTFEVER] ||
-		(sd->sc.data[SC_GRAVITATION] && sd->sc.data[SC_GRAVITATION]->val3 == BCT_SELF) ||
-		sd->sc.data[SC_TRICKDEAD] ||
-		sd->sc.data[SC_HIDING] ||
-		sd->sc.data[SC__SHADOWFORM] ||
-		sd->sc.data[SC__INVISIBILITY] ||
-		sd->sc.data[SC__MANHOLE] ||
-		sd->sc.data[SC_KAGEHUMI] ||
-		(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOITEM) ||
-		sd->sc.data[SC_HEAT_BARREL_AFTER] ||
-		sd->sc.data[SC_KINGS_GRACE]) )
+		(sc_data(&sd->sc, SC_BERSERK) ||
+		sc_data(&sd->sc, SC_SATURDAYNIGHTFEVER) ||
+		(sc_data(&sd->sc, SC_GRAVITATION) && sc_data(&sd->sc, SC_GRAVITATION)->val3 == BCT_SELF) ||
+		sc_data(&sd->sc, SC_TRICKDEAD) ||
+		sc_data(&sd->sc, SC_HIDING) ||
+		sc_data(&sd->sc, SC__SHADOWFORM) ||
+		sc_data(&sd->sc, SC__INVISIBILITY) ||
+		sc_data(&sd->sc, SC__MANHOLE) ||
+		sc_data(&sd->sc, SC_KAGEHUMI) ||
+		(sc_data(&sd->sc, SC_NOCHAT) && sc_data(&sd->sc, SC_NOCHAT)->val1&MANNER_NOITEM) ||
+		sc_data(&sd->sc, SC_HEAT_BARREL_AFTER) ||
+		sc_data(&sd->sc, SC_KINGS_GRACE)) )
 		return false;
 
 	if( !pc_isItemClass(sd,item) )
@@ -4715,7 +4844,7 @@ int pc_useitem(struct map_session_data *sd, int n)
 
 	//Items with delayed consume are not meant to work while in mounts except ITEMID_BOARDING_HALTER
 	if( id->flag.delay_consume ) {
-		if( sd->sc.data[SC_ALL_RIDING] && nameid != ITEMID_BOARDING_HALTER )
+		if( sc_data(&sd->sc, SC_ALL_RIDING) && nameid != ITEMID_BOARDING_HALTER )
 			return 0;
 		else if( pc_issit(sd) )
 			return 0;
@@ -4794,7 +4923,7 @@ int pc_useitem(struct map_session_data *sd, int n)
 	}
 	if( item.card[0] == CARD0_CREATE && pc_famerank(MakeDWord(item.card[2],item.card[3]), MAPID_ALCHEMIST) ) {
 	    potion_flag = 2; //Famous player's potions have 50% more efficiency
-		 if( sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_ROGUE )
+		 if( sc_data(&sd->sc, SC_SPIRIT) && sc_data(&sd->sc, SC_SPIRIT)->val2 == SL_ROGUE )
 			 potion_flag = 3; //Even more effective potions
 	}
 
@@ -5134,7 +5263,7 @@ int pc_steal_coin(struct map_session_data *sd,struct block_list *target)
 		return 0;
 
 	md = (TBL_MOB *)target;
-	if( md->state.steal_coin_flag || md->sc.data[SC_STONE] || md->sc.data[SC_FREEZE] || md->status.mode&MD_BOSS )
+	if( md->state.steal_coin_flag || sc_data(&md->sc, SC_STONE) || sc_data(&md->sc, SC_FREEZE) || md->status.mode&MD_BOSS )
 		return 0;
 
 	if( mob_is_treasure(md) )
@@ -5198,7 +5327,7 @@ char pc_setpos(struct map_session_data *sd, unsigned short mapindex, int x, int
 
 		sd->state.pmap = sd->bl.m;
 		if( sd->sc.count ) { // Cancel some map related stuff
-			if( sd->sc.data[SC_JAILED] )
+			if( sc_data(&sd->sc, SC_JAILED) )
 				return 1; // You may not get out!
 			status_change_end(&sd->bl, SC_BOSSMAPINFO, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_CLOAKING, INVALID_TIMER);
@@ -5207,8 +5336,8 @@ char pc_setpos(struct map_session_data *sd, unsigned short mapindex, int x, int
 			status_change_end(&sd->bl, SC_MOON_COMFORT, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_STAR_COMFORT, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_MIRACLE, INVALID_TIMER);
-			if( sd->sc.data[SC_KNOWLEDGE] ) {
-				struct status_change_entry *sce = sd->sc.data[SC_KNOWLEDGE];
+			if( sc_data(&sd->sc, SC_KNOWLEDGE) ) {
+				struct status_change_entry *sce = sc_data(&sd->sc, SC_KNOWLEDGE);
 
 				if( sce->timer != INVALID_TIMER )
 					delete_timer(sce->timer, status_change_timer);
@@ -5483,12 +5612,12 @@ static void pc_checkallowskill(struct map_session_data *sd)
 	for(i = 0; i < ARRAYLENGTH(scw_list); i++) { //Skills requiring specific weapon types
 		if(scw_list[i] == SC_DANCING && !battle_config.dancing_weaponswitch_fix)
 			continue;
-		if(sd->sc.data[scw_list[i]] && !pc_check_weapontype(sd,skill_get_weapontype(status_sc2skill(scw_list[i]))))
+		if(sc_data(&sd->sc, scw_list[i]) && !pc_check_weapontype(sd,skill_get_weapontype(status_sc2skill(scw_list[i]))))
 			status_change_end(&sd->bl, scw_list[i], INVALID_TIMER);
 	}
 
 	//Spurt requires bare hands
-	if(sd->sc.data[SC_SPURT] && sd->status.weapon)
+	if(sc_data(&sd->sc, SC_SPURT) && sd->status.weapon)
 		status_change_end(&sd->bl, SC_SPURT, INVALID_TIMER);
 
 	if(sd->status.shield <= 0) { //Skills requiring a shield
@@ -5500,7 +5629,7 @@ static void pc_checkallowskill(struct map_session_data *sd)
 		};
 
 		for(i = 0; i < ARRAYLENGTH(scs_list); i++)
-			if(sd->sc.data[scs_list[i]])
+			if(sc_data(&sd->sc, scs_list[i]))
 				status_change_end(&sd->bl, scs_list[i], INVALID_TIMER);
 	}
 }
@@ -6254,20 +6383,20 @@ static void pc_calcexp(struct map_session_data *sd, unsigned int *base_exp, unsi
 			vip_bonus_job = battle_config.vip_job_exp_increase;
 		}
 #endif
-		if (sd->sc.data[SC_JP_EVENT04] && status->race == RC_FISH)
-			bonus += sd->sc.data[SC_JP_EVENT04]->val1;
+		if (sc_data(&sd->sc, SC_JP_EVENT04) && status->race == RC_FISH)
+			bonus += sc_data(&sd->sc, SC_JP_EVENT04)->val1;
 	}
 
-	if (sd->sc.data[SC_EXPBOOST]) {
-		bonus += sd->sc.data[SC_EXPBOOST]->val1;
+	if (sc_data(&sd->sc, SC_EXPBOOST)) {
+		bonus += sc_data(&sd->sc, SC_EXPBOOST)->val1;
 		if (battle_config.vip_bm_increase && pc_isvip(sd)) //Increase Battle Manual EXP rate for VIP
-			bonus += (sd->sc.data[SC_EXPBOOST]->val1 / battle_config.vip_bm_increase);
+			bonus += (sc_data(&sd->sc, SC_EXPBOOST)->val1 / battle_config.vip_bm_increase);
 	}
 
 	*base_exp = (unsigned int)cap_value(*base_exp + (double)*base_exp * (bonus + vip_bonus_base) / 100., 1, UINT_MAX);
 
-	if (sd->sc.data[SC_JEXPBOOST])
-		bonus += sd->sc.data[SC_JEXPBOOST]->val1;
+	if (sc_data(&sd->sc, SC_JEXPBOOST))
+		bonus += sc_data(&sd->sc, SC_JEXPBOOST)->val1;
 
 	*job_exp = (unsigned int)cap_value(*job_exp + (double)*job_exp * (bonus + vip_bonus_job) / 100., 1, UINT_MAX);
 
@@ -6913,7 +7042,7 @@ int pc_resetskill(struct map_session_data *sd, int flag)
 		if( i&OPTION_CART && pc_checkskill(sd, MC_PUSHCART) )
 			i &= ~OPTION_CART;
 #else
-		if( sd->sc.data[SC_PUSH_CART] )
+		if( sc_data(&sd->sc, SC_PUSH_CART) )
 			pc_setcart(sd, 0);
 #endif
 		if( i != sd->sc.option )
@@ -6965,15 +7094,15 @@ int pc_resetskill(struct map_session_data *sd, int flag)
 		return skill_point;
 	sd->status.skill_point += skill_point;
 	if( !(flag&2) ) { //Remove all statuses that can't be inactivated without a skill
-		if( sd->sc.data[SC_READYSTORM] )
+		if( sc_data(&sd->sc, SC_READYSTORM) )
 			status_change_end(&sd->bl, SC_READYSTORM, INVALID_TIMER);
-		if( sd->sc.data[SC_READYDOWN] )
+		if( sc_data(&sd->sc, SC_READYDOWN) )
 			status_change_end(&sd->bl, SC_READYDOWN, INVALID_TIMER);
-		if( sd->sc.data[SC_READYTURN] )
+		if( sc_data(&sd->sc, SC_READYTURN) )
 			status_change_end(&sd->bl, SC_READYTURN, INVALID_TIMER);
-		if( sd->sc.data[SC_READYCOUNTER] )
+		if( sc_data(&sd->sc, SC_READYCOUNTER) )
 			status_change_end(&sd->bl, SC_READYCOUNTER, INVALID_TIMER);
-		if( sd->sc.data[SC_DODGE] )
+		if( sc_data(&sd->sc, SC_DODGE) )
 			status_change_end(&sd->bl, SC_DODGE, INVALID_TIMER);
 	}
 	if( flag&1 ) {
@@ -7342,7 +7471,7 @@ int pc_dead(struct map_session_data *sd,struct block_list *src)
 	if( battle_config.death_penalty_type &&
 		(sd->class_&MAPID_UPPERMASK) != MAPID_NOVICE && //Only novices will receive no penalty
 		!map[sd->bl.m].flag.noexppenalty && !map_flag_gvg2(sd->bl.m) &&
-		!sd->sc.data[SC_BABY] && !sd->sc.data[SC_LIFEINSURANCE] )
+		!sc_data(&sd->sc, SC_BABY) && !sc_data(&sd->sc, SC_LIFEINSURANCE) )
 	{
 		uint32 base_penalty = battle_config.death_penalty_base;
 		uint32 job_penalty = battle_config.death_penalty_job;
@@ -7885,11 +8014,11 @@ int pc_itemheal(struct map_session_data *sd,int itemid, int hp,int sp)
 		if(bonus != 100 && tmp > hp)
 			hp = tmp;
 		//Recovery Potion
-		if(sd->sc.data[SC_INCHEALRATE])
-			hp += (int)(hp * sd->sc.data[SC_INCHEALRATE]->val1 / 100.);
+		if(sc_data(&sd->sc, SC_INCHEALRATE))
+			hp += (int)(hp * sc_data(&sd->sc, SC_INCHEALRATE)->val1 / 100.);
 		//2014 Halloween Event : Pumpkin Bonus
-		if(sd->sc.data[SC_MTF_PUMPKIN] && itemid == ITEMID_PUMPKIN)
-			hp += (int)(hp * sd->sc.data[SC_MTF_PUMPKIN]->val1 / 100.);
+		if(sc_data(&sd->sc, SC_MTF_PUMPKIN) && itemid == ITEMID_PUMPKIN)
+			hp += (int)(hp * sc_data(&sd->sc, SC_MTF_PUMPKIN)->val1 / 100.);
 	}
 	if(sp) {
 		bonus = 100 + (sd->battle_status.int_<<1)
@@ -7901,23 +8030,23 @@ int pc_itemheal(struct map_session_data *sd,int itemid, int hp,int sp)
 		if(bonus != 100 && tmp > sp)
 			sp = tmp;
 	}
-	if(sd->sc.data[SC_VITALITYACTIVATION]) {
+	if(sc_data(&sd->sc, SC_VITALITYACTIVATION)) {
 		hp += hp * 50 / 100;
 		sp -= sp * 50 / 100;
 	}
-	if(sd->sc.data[SC_EXTRACT_WHITE_POTION_Z])
-		hp += hp * sd->sc.data[SC_EXTRACT_WHITE_POTION_Z]->val1 / 100;
-	if(sd->sc.data[SC_VITATA_500])
-		sp += sp * sd->sc.data[SC_VITATA_500]->val1 / 100;
-	if(sd->sc.data[SC_WATER_INSIGNIA] && sd->sc.data[SC_WATER_INSIGNIA]->val1 == 2) {
+	if(sc_data(&sd->sc, SC_EXTRACT_WHITE_POTION_Z))
+		hp += hp * sc_data(&sd->sc, SC_EXTRACT_WHITE_POTION_Z)->val1 / 100;
+	if(sc_data(&sd->sc, SC_VITATA_500))
+		sp += sp * sc_data(&sd->sc, SC_VITATA_500)->val1 / 100;
+	if(sc_data(&sd->sc, SC_WATER_INSIGNIA) && sc_data(&sd->sc, SC_WATER_INSIGNIA)->val1 == 2) {
 		hp += hp / 10;
 		sp += sp / 10;
 	}
 	//Critical Wound and Death Hurt stacks with each other
 	penalty = 0;
-	if(sd->sc.data[SC_CRITICALWOUND])
-		penalty += sd->sc.data[SC_CRITICALWOUND]->val2;
-	if(sd->sc.data[SC_DEATHHURT])
+	if(sc_data(&sd->sc, SC_CRITICALWOUND))
+		penalty += sc_data(&sd->sc, SC_CRITICALWOUND)->val2;
+	if(sc_data(&sd->sc, SC_DEATHHURT))
 		penalty += 20;
 	//Apply a penalty to recovery if there is one
 	if(penalty > 0) {
@@ -7925,7 +8054,7 @@ int pc_itemheal(struct map_session_data *sd,int itemid, int hp,int sp)
 		sp -= sp * penalty / 100;
 	}
 #ifdef RENEWAL
-	if(sd->sc.data[SC_EXTREMITYFIST2])
+	if(sc_data(&sd->sc, SC_EXTREMITYFIST2))
 		sp = 0;
 #endif
 	return status_heal(&sd->bl,hp,sp,1);
@@ -8082,7 +8211,7 @@ bool pc_jobchange(struct map_session_data *sd,int job, char upper)
 			enum sc_type sc = status_skill2sc(id);
 
 			//Remove status specific to your current tree skills
-			if (sc > SC_COMMON_MAX && sd->sc.data[sc])
+			if (sc > SC_COMMON_MAX && sc_data(&sd->sc, sc))
 				status_change_end(&sd->bl,sc,INVALID_TIMER);
 		}
 	}
@@ -8156,7 +8285,7 @@ bool pc_jobchange(struct map_session_data *sd,int job, char upper)
 	if (i&OPTION_CART && !pc_checkskill(sd,MC_PUSHCART))
 		i &= ~OPTION_CART;
 #else
-	if (sd->sc.data[SC_PUSH_CART] && !pc_checkskill(sd,MC_PUSHCART))
+	if (sc_data(&sd->sc, SC_PUSH_CART) && !pc_checkskill(sd,MC_PUSHCART))
 		pc_setcart(sd, 0);
 #endif
 	if (i != sd->sc.option)
@@ -8389,7 +8518,7 @@ bool pc_setcart(struct map_session_data *sd,int type) {
 #ifdef NEW_CARTS
 	switch( type ) {
 		case 0:
-			if( !sd->sc.data[SC_PUSH_CART] )
+			if( !sc_data(&sd->sc, SC_PUSH_CART) )
 				return true;
 			status_change_end(&sd->bl,SC_PUSH_CART,INVALID_TIMER);
 			clif_clearcart(sd->fd);
@@ -8398,13 +8527,13 @@ bool pc_setcart(struct map_session_data *sd,int type) {
 				pc_unequipitem(sd,sd->equip_index[EQI_AMMO],2);
 			break;
 		default: //Everything else is an allowed ID so we can move on
-			if( !sd->sc.data[SC_PUSH_CART] ) //First time, so fill cart data
+			if( !sc_data(&sd->sc, SC_PUSH_CART) ) //First time, so fill cart data
 				clif_cartlist(sd);
 			clif_updatestatus(sd,SP_CARTINFO);
 			sc_start(&sd->bl,&sd->bl,SC_PUSH_CART,100,type,INVALID_TIMER);
 			clif_efst_status_change(&sd->bl,sd->bl.id,AREA,SI_ON_PUSH_CART,type,0,0);
-			if( sd->sc.data[SC_PUSH_CART] ) //Forcefully update
-				sd->sc.data[SC_PUSH_CART]->val1 = type;
+			if( sc_data(&sd->sc, SC_PUSH_CART) ) //Forcefully update
+				sc_data(&sd->sc, SC_PUSH_CART)->val1 = type;
 			break;
 	}
 
@@ -8438,7 +8567,7 @@ void pc_setfalcon(TBL_PC* sd, int flag)
  *------------------------------------------*/
 void pc_setriding(TBL_PC* sd, int flag)
 {
-	if( sd->sc.data[SC_ALL_RIDING] )
+	if( sc_data(&sd->sc, SC_ALL_RIDING) )
 		return;
 	if( flag ) {
 		if( pc_checkskill(sd,KN_RIDING) > 0 ) //Add peco
@@ -8473,18 +8602,18 @@ bool pc_can_attack(struct map_session_data *sd, int target_id)
 	nullpo_retr(false, sd);
 
 	if( sd->sc.count &&
-		(sd->sc.data[SC_TRICKDEAD] ||
-		sd->sc.data[SC_BLADESTOP] ||
-		sd->sc.data[SC_BASILICA] ||
-		(sd->sc.data[SC_GRAVITATION] && sd->sc.data[SC_GRAVITATION]->val3 == BCT_SELF) ||
-		sd->sc.data[SC__SHADOWFORM] ||
-		sd->sc.data[SC__MANHOLE] ||
-		sd->sc.data[SC_CURSEDCIRCLE_ATKER] ||
-		sd->sc.data[SC_CURSEDCIRCLE_TARGET] ||
-		sd->sc.data[SC_FALLENEMPIRE] ||
-		(sd->sc.data[SC_VOICEOFSIREN] && sd->sc.data[SC_VOICEOFSIREN]->val2 == target_id) ||
-		sd->sc.data[SC_ALL_RIDING] || //The client doesn't let you, this is to make cheat-safe
-		sd->sc.data[SC_KINGS_GRACE]) )
+		(sc_data(&sd->sc, SC_TRICKDEAD) ||
+		sc_data(&sd->sc, SC_BLADESTOP) ||
+		sc_data(&sd->sc, SC_BASILICA) ||
+		(sc_data(&sd->sc, SC_GRAVITATION) && sc_data(&sd->sc, SC_GRAVITATION)->val3 == BCT_SELF) ||
+		sc_data(&sd->sc, SC__SHADOWFORM) ||
+		sc_data(&sd->sc, SC__MANHOLE) ||
+		sc_data(&sd->sc, SC_CURSEDCIRCLE_ATKER) ||
+		sc_data(&sd->sc, SC_CURSEDCIRCLE_TARGET) ||
+		sc_data(&sd->sc, SC_FALLENEMPIRE) ||
+		(sc_data(&sd->sc, SC_VOICEOFSIREN) && sc_data(&sd->sc, SC_VOICEOFSIREN)->val2 == target_id) ||
+		sc_data(&sd->sc, SC_ALL_RIDING) || //The client doesn't let you, this is to make cheat-safe
+		sc_data(&sd->sc, SC_KINGS_GRACE)) )
 		return false;
 
 	return true;
@@ -8526,6 +8655,8 @@ bool pc_setreg(struct map_session_data *sd, int reg, int val)
 
 	nullpo_retr(false,sd);
 
+	script_array_update(&sd->regarray, reg, val == 0);
+
 	ARR_FIND(0, sd->reg_num, i, sd->reg[i].index == reg);
 	if( i < sd->reg_num ) { //Overwrite existing entry
 		sd->reg[i].data = val;
@@ -8567,6 +8698,8 @@ bool pc_setregstr(struct map_session_data *sd, int reg, const char *str)
 
 	nullpo_retr(false,sd);
 
+	script_array_update(&sd->regarray, reg, (str == NULL || *str == '\0'));
+
 	ARR_FIND(0, sd->regstr_num, i, sd->regstr[i].index == reg);
 	if( i < sd->regstr_num ) { //Found entry, update
 		if( str == NULL || *str == '\0' ) { //Empty string
@@ -9247,8 +9380,8 @@ bool pc_equipitem(struct map_session_data *sd, short n, int req_pos)
 		clif_equipitemack(sd,n,0,ITEM_EQUIP_ACK_FAIL);
 		return false;
 	}
-	if( sd->sc.count && (sd->sc.data[SC_BERSERK] || sd->sc.data[SC_SATURDAYNIGHTFEVER] ||
-		sd->sc.data[SC_KYOUGAKU] || (sd->sc.data[SC_PYROCLASTIC] && sd->inventory_data[n]->type == IT_WEAPON)) ) {
+	if( sd->sc.count && (sc_data(&sd->sc, SC_BERSERK) || sc_data(&sd->sc, SC_SATURDAYNIGHTFEVER) ||
+		sc_data(&sd->sc, SC_KYOUGAKU) || (sc_data(&sd->sc, SC_PYROCLASTIC) && sd->inventory_data[n]->type == IT_WEAPON)) ) {
 		clif_equipitemack(sd,n,0,ITEM_EQUIP_ACK_FAIL);
 		return false;
 	}
@@ -9423,10 +9556,10 @@ bool pc_unequipitem(struct map_session_data *sd,int n,int flag) {
 		return false; //Nothing to unequip
 	}
 	if( !(flag&2) && sd->sc.count &&
-		(sd->sc.data[SC_BERSERK] ||
-		sd->sc.data[SC_SATURDAYNIGHTFEVER] ||
-		sd->sc.data[SC_KYOUGAKU] ||
-		(sd->sc.data[SC_PYROCLASTIC] &&
+		(sc_data(&sd->sc, SC_BERSERK) ||
+		sc_data(&sd->sc, SC_SATURDAYNIGHTFEVER) ||
+		sc_data(&sd->sc, SC_KYOUGAKU) ||
+		(sc_data(&sd->sc, SC_PYROCLASTIC) &&
 		(sd->status.inventory[n].equip&EQP_ARMS) && sd->inventory_data[n]->type == IT_WEAPON)) )
 	{
 		clif_unequipitemack(sd,n,0,0);
@@ -9493,7 +9626,7 @@ bool pc_unequipitem(struct map_session_data *sd,int n,int flag) {
 	status_change_end(&sd->bl,SC_HEAT_BARREL,INVALID_TIMER);
 	//On weapon change (right and left hand)
 	if( (sd->status.inventory[n].equip&EQP_ARMS) && sd->inventory_data[n]->type == IT_WEAPON ) {
-		if( (!sd->sc.data[SC_SEVENWIND] || sd->sc.data[SC_ASPERSIO]) ) //Check for seven wind
+		if( (!sc_data(&sd->sc, SC_SEVENWIND) || sc_data(&sd->sc, SC_ASPERSIO)) ) //Check for seven wind
 			skill_enchant_elemental_end(&sd->bl,SC_NONE);
 		status_change_end(&sd->bl,SC_FEARBREEZE,INVALID_TIMER);
 		status_change_end(&sd->bl,SC_EXEEDBREAK,INVALID_TIMER);
@@ -9907,42 +10040,192 @@ void pc_setsavepoint(struct map_session_data *sd, short mapindex,int x,int y)
 	sd->status.save_point.y = y;
 }
 
+/// Online characters in autosave order, pc_autosave saves the one at the cursor and moves on
+static struct map_session_data *pc_autosave_cursor = NULL;
+
+#define PC_AUTOSAVE_SKIP_MAX 8 //Characters looked at per autosave before saving one anyway
+#define PC_AUTOSAVE_DIRTY_EVERY 4 //Every this many autosaves one is taken from the dirty queue instead of the cycle
+#define PC_AUTOSAVE_DIRTY_QUEUE 256 //Size of the dirty queue
+
+/// Characters that reached PC_AUTOSAVE_DIRTY_PULL, by char id, saved ahead of their turn.
+/// Interleaved with the cycle so the cycle keeps advancing however many characters get dirty.
+static struct {
+	int char_id[PC_AUTOSAVE_DIRTY_QUEUE];
+	int head, count;
+	unsigned int turn; //Autosaves since the last one taken from the queue
+} pc_autosave_queue;
+
+static struct {
+	unsigned int autosaves; //Saves done by pc_autosave
+	unsigned int skipped; //Characters skipped because they were saved recently by something else
+	unsigned int pulled; //Saves taken from the dirty queue
+	unsigned int overflows; //Characters not queued because the dirty queue was full
+	unsigned int saves; //All character saves sent to the char-server
+	unsigned int report_tick, report_saves; //State at the last report, for the save rate
+} pc_autosave_stats;
+
+/**
+ * Adds a character to the end of the autosave cycle.
+ * @param sd: Character that just came online
+ */
+void pc_autosave_link(struct map_session_data *sd)
+{
+	nullpo_retv(sd);
+
+	if( sd->autosave_next ) //Already linked
+		return;
+
+	sd->last_save_tick = gettick();
+	if( !pc_autosave_cursor ) {
+		sd->autosave_prev = sd->autosave_next = sd;
+		pc_autosave_cursor = sd;
+		return;
+	}
+	//The cursor is the start of the cycle, so its predecessor is the end
+	sd->autosave_next = pc_autosave_cursor;
+	sd->autosave_prev = pc_autosave_cursor->autosave_prev;
+	sd->autosave_prev->autosave_next = sd;
+	pc_autosave_cursor->autosave_prev = sd;
+}
+
+/**
+ * Removes a character from the autosave cycle.
+ * @param sd: Character going offline
+ */
+void pc_autosave_unlink(struct map_session_data *sd)
+{
+	nullpo_retv(sd);
+
+	if( !sd->autosave_next ) //Not linked
+		return;
+
+	if( sd->autosave_next == sd ) //Last one
+		pc_autosave_cursor = NULL;
+	else {
+		if( pc_autosave_cursor == sd )
+			pc_autosave_cursor = sd->autosave_next;
+		sd->autosave_prev->autosave_next = sd->autosave_next;
+		sd->autosave_next->autosave_prev = sd->autosave_prev;
+	}
+	sd->autosave_prev = sd->autosave_next = NULL;
+}
+
+/**
+ * Notes that a character was sent to the char-server.
+ * @param sd: Character saved
+ */
+void pc_autosave_saved(struct map_session_data *sd)
+{
+	sd->last_save_tick = gettick();
+	sd->autosave_dirty = 0;
+	pc_autosave_stats.saves++;
+}
+
+/**
+ * Adds to the unsaved weight of a character.
+ * Once it reaches PC_AUTOSAVE_DIRTY_PULL, the character is queued to be saved ahead of its turn.
+ * @param sd: Character that traded, used its storage or gained/paid zeny
+ * @param weight: Weight of the change
+ */
+void pc_autosave_dirty(struct map_session_data *sd, unsigned int weight)
+{
+	nullpo_retv(sd);
+
+	sd->autosave_dirty += weight;
+	if( sd->autosave_dirty < PC_AUTOSAVE_DIRTY_PULL || sd->state.autosave_queued || !sd->autosave_next )
+		return;
+
+	if( pc_autosave_queue.count == PC_AUTOSAVE_DIRTY_QUEUE ) { //Saved in its normal turn then
+		pc_autosave_stats.overflows++;
+		return;
+	}
+	pc_autosave_queue.char_id[(pc_autosave_queue.head + pc_autosave_queue.count) % PC_AUTOSAVE_DIRTY_QUEUE] = sd->status.char_id;
+	pc_autosave_queue.count++;
+	sd->state.autosave_queued = 1;
+}
+
+/**
+ * Takes the next character that is still online and dirty from the dirty queue.
+ * @return Character to save, or NULL if there is none
+ */
+static struct map_session_data *pc_autosave_dequeue(void)
+{
+	while( pc_autosave_queue.count ) {
+		struct map_session_data *sd = map_charid2sd(pc_autosave_queue.char_id[pc_autosave_queue.head]);
+
+		pc_autosave_queue.head = (pc_autosave_queue.head + 1) % PC_AUTOSAVE_DIRTY_QUEUE;
+		pc_autosave_queue.count--;
+		if( !sd || !sd->state.autosave_queued ) //Gone, or an entry from a previous session
+			continue;
+		sd->state.autosave_queued = 0;
+		if( sd->autosave_dirty ) //Not saved by something else meanwhile
+			return sd;
+	}
+	return NULL;
+}
+
+/**
+ * Displays the autosave cycle state: online characters, oldest unsaved change and save rate.
+ */
+void pc_autosave_report(void)
+{
+	struct map_session_data *sd = pc_autosave_cursor, *oldest = NULL;
+	unsigned int tick = gettick(), count = 0, elapsed;
+
+	if( sd ) {
+		do {
+			if( !oldest || DIFF_TICK(sd->last_save_tick, oldest->last_save_tick) < 0 )
+				oldest = sd;
+			count++;
+		} while( (sd = sd->autosave_next) != pc_autosave_cursor );
+	}
+
+	elapsed = (pc_autosave_stats.report_tick ? DIFF_TICK(tick, pc_autosave_stats.report_tick) : 0);
+	ShowMessage(CL_BOLD"[Autosave report]\n"CL_NORMAL);
+	ShowMessage("\tcharacters in cycle: %u, autosaves: %u, skipped as recently saved: %u\n", count, pc_autosave_stats.autosaves, pc_autosave_stats.skipped);
+	ShowMessage("\tdirty queue: %d waiting, %u saved from it, %u not queued as it was full\n", pc_autosave_queue.count, pc_autosave_stats.pulled, pc_autosave_stats.overflows);
+	if( oldest )
+		ShowMessage("\toldest save: '%s', %u s ago\n", oldest->status.name, (unsigned int)(DIFF_TICK(tick, oldest->last_save_tick) / 1000));
+	if( elapsed )
+		ShowMessage("\tsaves per second since last report: %.2f\n", (pc_autosave_stats.saves - pc_autosave_stats.report_saves) * 1000. / elapsed);
+	pc_autosave_stats.report_tick = tick;
+	pc_autosave_stats.report_saves = pc_autosave_stats.saves;
+}
+
 /*==========================================
  * Save 1 player data  at autosave intervalle
  *------------------------------------------*/
 static int pc_autosave(int tid, unsigned int tick, int id, intptr_t data)
 {
-	int interval;
-	struct s_mapiterator* iter;
+	int interval, i;
 	struct map_session_data *sd;
-	static int last_save_id = 0, save_flag = 0;
 
-	if(save_flag == 2) //Someone was saved on last call, normal cycle
-		save_flag = 0;
-	else
-		save_flag = 1; //Noone was saved, so save first found char.
+	//Every few turns a dirty character goes first, the other turns keep the cycle moving
+	if( ++pc_autosave_queue.turn >= PC_AUTOSAVE_DIRTY_EVERY && (sd = pc_autosave_dequeue()) != NULL ) {
+		pc_autosave_queue.turn = 0;
+		pc_autosave_stats.pulled++;
+	} else {
+		for( i = 0, sd = pc_autosave_cursor; sd && i < PC_AUTOSAVE_SKIP_MAX; i++ ) {
+			pc_autosave_cursor = sd->autosave_next;
 
-	iter = mapit_getallusers();
-	for(sd = (TBL_PC *)mapit_first(iter); mapit_exists(iter); sd = (TBL_PC *)mapit_next(iter)) {
-		if(sd->bl.id == last_save_id && save_flag != 1) {
-			save_flag = 1;
-			continue;
+			//Saved by a trade, storage or map change less than half a cycle ago and unchanged since, give the turn to someone else
+			if( i < PC_AUTOSAVE_SKIP_MAX - 1 && sd != pc_autosave_cursor && !sd->autosave_dirty && DIFF_TICK(tick, sd->last_save_tick) < autosave_interval / 2 ) {
+				pc_autosave_stats.skipped++;
+				sd = pc_autosave_cursor;
+				continue;
+			}
+			break;
 		}
+	}
 
-		if(save_flag != 1) //Not our turn to save yet.
-			continue;
-
-		//Save char.
-		last_save_id = sd->bl.id;
-		save_flag = 2;
+	if( sd ) { //Save char.
 #ifdef VIP_ENABLE
 		if(pc_isvip(sd)) //Check if we're still vip
 			chrif_req_login_operation(sd->status.account_id,sd->status.name,CHRIF_OP_LOGIN_VIP,0,1);
 #endif
 		chrif_save(sd,0);
-		break;
+		pc_autosave_stats.autosaves++;
 	}
-	mapit_free(iter);
 
 	interval = autosave_interval / (map_usercount() + 1);
 	if(interval < minsave_interval)
@@ -10009,7 +10292,7 @@ void pc_setstand(struct map_session_data *sd)
 
 	status_change_end(&sd->bl, SC_TENSIONRELAX, INVALID_TIMER);
 
-	if (sd->sc.data[SC_SITDOWN_FORCE] || sd->sc.data[SC_BANANA_BOMB_SITDOWN])
+	if (sc_data(&sd->sc, SC_SITDOWN_FORCE) || sc_data(&sd->sc, SC_BANANA_BOMB_SITDOWN))
 		return;
 
 	clif_status_load(&sd->bl, SI_SIT, 0);
@@ -10030,12 +10313,12 @@ void pc_overheat(struct map_session_data *sd, int val)
 		limit[] = { 10,20,28,46,66 };
 	uint16 skill_lv;
 
-	if( !pc_ismadogear(sd) || sd->sc.data[SC_OVERHEAT] )
+	if( !pc_ismadogear(sd) || sc_data(&sd->sc, SC_OVERHEAT) )
 		return; // Already burning
 
 	skill_lv = min(pc_checkskill(sd,NC_MAINFRAME),4);
-	if( sd->sc.data[SC_OVERHEAT_LIMITPOINT] ) {
-		heat += sd->sc.data[SC_OVERHEAT_LIMITPOINT]->val1;
+	if( sc_data(&sd->sc, SC_OVERHEAT_LIMITPOINT) ) {
+		heat += sc_data(&sd->sc, SC_OVERHEAT_LIMITPOINT)->val1;
 		status_change_end(&sd->bl,SC_OVERHEAT_LIMITPOINT,INVALID_TIMER);
 	}
 
@@ -11305,9 +11588,9 @@ void pc_cell_basilica(struct map_session_data *sd) {
 	nullpo_retv(sd);
 
 	if (!map_getcell(sd->bl.m,sd->bl.x,sd->bl.y,CELL_CHKBASILICA)) {
-		if (sd->sc.data[SC_BASILICA])
+		if (sc_data(&sd->sc, SC_BASILICA))
 			status_change_end(&sd->bl,SC_BASILICA,INVALID_TIMER);
-	} else if (!sd->sc.data[SC_BASILICA])
+	} else if (!sc_data(&sd->sc, SC_BASILICA))
 		sc_start(&sd->bl,&sd->bl,SC_BASILICA,100,0,INVALID_TIMER);
 }
 
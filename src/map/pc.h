@@ -27,6 +27,11 @@
 #define MAX_PC_FEELHATE 3 //Max feel hate info
 #define DAMAGELOG_SIZE_PC 100 //Damage log
 #define MAX_DEVOTION 5 //Max Devotion slots
+#define INVENTORY_INDEX_BUCKETS 64 //Hash buckets of the nameid -> inventory slot index (power of 2)
+#define PC_AUTOSAVE_DIRTY_PULL 10 //Unsaved weight that queues a character for an early autosave
+#define PC_AUTOSAVE_DIRTY_TRADE PC_AUTOSAVE_DIRTY_PULL //A completed trade
+#define PC_AUTOSAVE_DIRTY_STORAGE 1 //An item moved from or to the storage
+#define PC_AUTOSAVE_DIRTY_ZENY_STEP 100000 //Zeny gained or paid per point of weight
 #define BANK_VAULT_VAR "#BANKVAULT"
 
 //Update this max as necessary. 85 is the value needed for Expanded Super Novice
@@ -215,6 +220,9 @@ struct map_session_data {
 		unsigned int noks : 3; //[Zeph Kill Steal Protection]
 		unsigned int changemap : 1;
 		unsigned int callshop : 1; //Flag to indicate that a script used callshop; on a shop
+		unsigned int party_xy_dirty : 1; //Queued for the next party position/hp sync, see party_send_xy_mark
+		unsigned int guild_xy_dirty : 1; //Queued for the next guild position sync, see guild_send_xy_mark
+		unsigned int autosave_queued : 1; //In the dirty autosave queue, see pc_autosave_dirty
 		short pmap; //Previous map on Map Change
 		unsigned short autoloot;
 		unsigned short autolootid[AUTOLOOTITEM_SIZE]; //[Zephyrus]
@@ -257,6 +265,10 @@ struct map_session_data {
 	struct registry save_reg;
 	
 	struct item_data* inventory_data[MAX_INVENTORY]; //Direct pointers to itemdb entries (faster than doing item_id lookups)
+	struct {
+		short head[INVENTORY_INDEX_BUCKETS]; //First slot of each nameid bucket, -1 if empty
+		short next[MAX_INVENTORY]; //Next slot in the same bucket (ascending order), -1 at the end
+	} inventory_index; //nameid -> slots of all non-empty inventory entries, see pc_search_inventory
 	short equip_index[EQI_MAX];
 	unsigned int weight,max_weight;
 	int cart_weight,cart_num,cart_weight_max;
@@ -299,6 +311,9 @@ struct map_session_data {
 
 	int invincible_timer;
 	unsigned int canlog_tick;
+	unsigned int last_save_tick; //Last time the character was sent to the char-server
+	struct map_session_data *autosave_prev, *autosave_next; //Autosave ring, see pc_autosave
+	unsigned int autosave_dirty; //Weight of the trades, storage moves and zeny changes since the last save, see pc_autosave_dirty
 	unsigned int canuseitem_tick; //[Skotlex]
 	unsigned int canusecashfood_tick;
 	unsigned int canequip_tick;	//[Inkfish]
@@ -462,6 +477,7 @@ struct map_session_data {
 
 	struct script_reg *reg;
 	struct script_regstr *regstr;
+	struct DBMap *regarray; //Bookkeeping of temporary array variables
 
 	int trade_partner;
 	struct s_deal {
@@ -747,7 +763,7 @@ struct {
 #endif
 
 #ifdef NEW_CARTS
-	#define pc_iscarton(sd)   ( (sd)->sc.data[SC_PUSH_CART] )
+	#define pc_iscarton(sd)   ( sc_data(&(sd)->sc, SC_PUSH_CART) )
 #else
 	#define pc_iscarton(sd)   ( (sd)->sc.option&OPTION_CART )
 #endif
@@ -818,14 +834,14 @@ short pc_maxaspd(struct map_session_data *sd);
 	#define pc_rightside_mdef(sd) ( (sd)->battle_status.mdef2 - ((sd)->battle_status.vit>>1) )
 	#define pc_leftside_matk(sd) \
 		(\
-		((sd)->sc.data[SC_MAGICPOWER] && (sd)->sc.data[SC_MAGICPOWER]->val4) \
-			?((sd)->battle_status.matk_min * 100 + 50) / ((sd)->sc.data[SC_MAGICPOWER]->val3 + 100) \
+		(sc_data(&(sd)->sc, SC_MAGICPOWER) && sc_data(&(sd)->sc, SC_MAGICPOWER)->val4) \
+			?((sd)->battle_status.matk_min * 100 + 50) / (sc_data(&(sd)->sc, SC_MAGICPOWER)->val3 + 100) \
 			:(sd)->battle_status.matk_min \
 		)
 	#define pc_rightside_matk(sd) \
 		(\
-		((sd)->sc.data[SC_MAGICPOWER] && (sd)->sc.data[SC_MAGICPOWER]->val4) \
-			?((sd)->battle_status.matk_max * 100 + 50) / ((sd)->sc.data[SC_MAGICPOWER]->val3 + 100) \
+		(sc_data(&(sd)->sc, SC_MAGICPOWER) && sc_data(&(sd)->sc, SC_MAGICPOWER)->val4) \
+			?((sd)->battle_status.matk_max * 100 + 50) / (sc_data(&(sd)->sc, SC_MAGICPOWER)->val3 + 100) \
 			:(sd)->battle_status.matk_max \
 		)
 #endif
@@ -849,6 +865,12 @@ void pc_makesavestatus(struct map_session_data *sd);
 void pc_respawn(struct map_session_data *sd, clr_type clrtype);
 void pc_setnewpc(struct map_session_data *sd, int account_id, int char_id, int login_id1, unsigned int client_tick, int sex, int fd);
 bool pc_authok(struct map_session_data *sd, int login_id2, time_t expiration_time, int group_id, struct mmo_charstatus *st, bool changing_mapservers);
+void pc_autosave_link(struct map_session_data *sd);
+void pc_autosave_unlink(struct map_session_data *sd);
+
+void pc_autosave_saved(struct map_session_data *sd);
+void pc_autosave_dirty(struct map_session_data *sd, unsigned int weight);
+void pc_autosave_report(void);
 void pc_authfail(struct map_session_data *sd);
 void pc_reg_received(struct map_session_data *sd);
 void pc_close_npc(struct map_session_data *sd,int flag);
@@ -877,6 +899,8 @@ bool pc_memo(struct map_session_data *sd, int pos);
 char pc_checkadditem(struct map_session_data *sd, unsigned short nameid, int amount);
 uint8 pc_inventoryblank(struct map_session_data *sd);
 short pc_search_inventory(struct map_session_data *sd, unsigned short nameid);
+short pc_search_inventory_next(struct map_session_data *sd, unsigned short nameid, short prev);
+bool pc_inventory_index_check(struct map_session_data *sd);
 char pc_payzeny(struct map_session_data *sd, int zeny, enum e_log_pick_type type, struct map_session_data *tsd);
 char pc_additem(struct map_session_data *sd, struct item *item, int amount, e_log_pick_type log_type);
 char pc_getzeny(struct map_session_data *sd,int zeny, enum e_log_pick_type type, struct map_session_data *tsd);
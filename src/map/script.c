@@ -8,6 +8,7 @@
 //#define DEBUG_DUMP_STACK
 
 #include "../common/cbasetypes.h"
+#include "../common/ers.h"
 #include "../common/malloc.h"
 #include "../common/md5calc.h"
 #include "../common/nullpo.h"
@@ -98,10 +99,10 @@
 #define script_lastdata(st) ( (st)->end - (st)->start - 1 )
 /// Pushes an int into the stack
 #define script_pushint(st,val) push_val((st)->stack, C_INT, (val))
-/// Pushes a string into the stack (script engine frees it automatically)
+/// Pushes a string into the stack (must come from script_str_alloc, script engine frees it automatically)
 #define script_pushstr(st,val) push_str((st)->stack, C_STR, (val))
 /// Pushes a copy of a string into the stack
-#define script_pushstrcopy(st,val) push_str((st)->stack, C_STR, aStrdup(val))
+#define script_pushstrcopy(st,val) push_str((st)->stack, C_STR, script_str_dup(val))
 /// Pushes a constant string into the stack (must never change or be freed)
 #define script_pushconststr(st,val) push_str((st)->stack, C_CONSTSTR, (val))
 /// Pushes a nil into the stack
@@ -176,7 +177,6 @@
 		if( script_hasdata(st,n) ) \
 			(t) = script_getnum(st,n);
 
-#define SCRIPT_MAX_ARRAYSIZE 128 /// Maximum amount of elements in script arrays
 #define SCRIPT_CMD_SUCCESS 0 /// When a buildin cmd was correctly done
 #define SCRIPT_CMD_FAILURE 1 /// When an errors appear in cmd, show_debug will follow
 
@@ -329,6 +329,50 @@ extern script_function buildin_func[];
 
 static struct linkdb_node* sleep_db; //int oid -> struct script_state*
 
+/// Script state pool
+/// States come from an entry manager, stacks are kept with their data block
+/// so a recycled stack needs no allocation at all.
+#define SCRIPT_STACK_SIZE 64 // Initial capacity of a stack
+#define SCRIPT_STACK_CACHE 128 // Max idle stacks kept for reuse
+static struct eri *st_ers = NULL;
+static struct script_stack *stack_cache[SCRIPT_STACK_CACHE];
+static int stack_cache_count = 0;
+
+static struct {
+	unsigned int states; // States handed out by script_alloc_state
+	unsigned int stacks_reused; // Stacks taken from the cache
+	unsigned int frames; // States plus callfunc/callsub frames, each one used to own a scope map
+	unsigned int scope_vars; // Scope maps actually created
+} script_pool_stats;
+
+static struct DBMap* script_get_var_function(struct script_state* st);
+
+/// String values (C_STR)
+/// The text is preceded by a header, so copies on the stack only take a reference.
+/// Small strings come from entry managers of fixed sizes instead of the memory manager.
+struct script_string {
+	int refcount;
+	unsigned int size; // Bytes available for the text, including the terminator
+	char str[1];
+};
+
+#define script_str_header(s) ( (struct script_string *)((s) - offsetof(struct script_string, str)) )
+#define SCRIPT_STR_CLASSES 3 // Entry managers for small strings
+#define SCRIPT_STR_INTERN 1000 // Numbers 0..SCRIPT_STR_INTERN-1 have a constant string
+static const unsigned int script_str_class_size[SCRIPT_STR_CLASSES] = { 32, 64, 128 }; // Including the header
+static struct eri *script_str_ers[SCRIPT_STR_CLASSES];
+static char script_str_int[SCRIPT_STR_INTERN][4];
+
+static struct {
+	unsigned int pooled; // Strings taken from the entry managers
+	unsigned int allocated; // Strings too big for the entry managers
+	unsigned int refs; // Copies that only took a reference
+	unsigned int interned; // Numbers converted to a constant string
+	unsigned int appended; // Concatenations done in place
+} script_str_stats;
+
+static char *script_str_dup(const char *str);
+
 #ifdef BETA_THREAD_TEST
 /**
  * MySQL Query Slave
@@ -2594,6 +2638,96 @@ struct script_code* parse_script(const char *src,const char *file,int line,int o
 	return code;
 }
 
+/// Allocates a string value with room for len characters and the terminator.
+static char *script_str_alloc(size_t len)
+{
+	struct script_string *ss;
+	size_t size = offsetof(struct script_string, str) + len + 1;
+	int i;
+
+	ARR_FIND(0, SCRIPT_STR_CLASSES, i, size <= script_str_class_size[i]);
+	if( i < SCRIPT_STR_CLASSES ) {
+		ss = ers_alloc(script_str_ers[i], struct script_string);
+		size = script_str_class_size[i];
+		script_str_stats.pooled++;
+	} else {
+		ss = (struct script_string *)aMalloc(size);
+		script_str_stats.allocated++;
+	}
+	ss->refcount = 1;
+	ss->size = (unsigned int)(size - offsetof(struct script_string, str));
+	ss->str[0] = '\0';
+	return ss->str;
+}
+
+/// Allocates a string value with a copy of str.
+static char *script_str_dup(const char *str)
+{
+	size_t len = strlen(str);
+	char *s = script_str_alloc(len);
+
+	memcpy(s, str, len + 1);
+	return s;
+}
+
+/// Takes another reference to a string value.
+static char *script_str_ref(char *str)
+{
+	script_str_header(str)->refcount++;
+	script_str_stats.refs++;
+	return str;
+}
+
+/// Releases a reference to a string value.
+static void script_str_free(char *str)
+{
+	struct script_string *ss = script_str_header(str);
+	size_t size;
+	int i;
+
+	if( --ss->refcount > 0 )
+		return;
+
+	size = offsetof(struct script_string, str) + ss->size;
+	ARR_FIND(0, SCRIPT_STR_CLASSES, i, size == script_str_class_size[i]);
+	if( i < SCRIPT_STR_CLASSES )
+		ers_free(script_str_ers[i], ss);
+	else
+		aFree(ss);
+}
+
+/// Appends str2 to a string value that is not shared.
+/// The value grows geometrically so chains of concatenations stay linear.
+/// @return The string value, possibly moved
+static char *script_str_append(char *str, const char *str2)
+{
+	struct script_string *ss = script_str_header(str);
+	size_t len = strlen(str);
+	size_t len2 = strlen(str2);
+
+	if( len + len2 + 1 > ss->size ) {
+		char *s = script_str_alloc(max(len + len2, 2 * len));
+
+		memcpy(s, str, len);
+		script_str_free(str);
+		str = s;
+	}
+	memcpy(str + len, str2, len2 + 1);
+	script_str_stats.appended++;
+	return str;
+}
+
+/// Displays the usage of string values.
+static void script_str_report(void)
+{
+	ShowMessage(CL_BOLD"[Script string report]\n"CL_NORMAL);
+	ShowMessage("\tpooled strings        : %u\n", script_str_stats.pooled);
+	ShowMessage("\tallocated strings     : %u\n", script_str_stats.allocated);
+	ShowMessage("\tcopies by reference   : %u\n", script_str_stats.refs);
+	ShowMessage("\tinterned numbers      : %u\n", script_str_stats.interned);
+	ShowMessage("\tin place concatenation: %u\n", script_str_stats.appended);
+}
+
 /// Returns the player attached to this script, identified by the rid.
 /// If there is no player attached, the script is terminated.
 TBL_PC *script_rid2sd(struct script_state *st)
@@ -2690,7 +2824,7 @@ void get_val(struct script_state* st, struct script_data* data)
 			data->u.str = "";
 		} else { // Duplicate string
 			data->type = C_STR;
-			data->u.str = aStrdup(data->u.str);
+			data->u.str = script_str_dup(data->u.str);
 		}
 
 	} else { // Integer variable
@@ -2767,6 +2901,15 @@ static int set_reg(struct script_state* st, TBL_PC* sd, int num, const char *nam
 {
 	char prefix = name[0];
 
+	if( (int)(((uint32)num) >> 24) >= SCRIPT_MAX_ARRAYSIZE ) { // Would overwrite the bookkeeping stored under SCRIPT_ARRAY_INDEX
+		ShowError("script:set_reg: index out of range for '%s' (%d)\n", name, (int)(((uint32)num) >> 24));
+		if( st != NULL ) {
+			script_reportsrc(st);
+			st->state = END;
+		}
+		return 0;
+	}
+
 	if( is_string_variable(name) ) { // String variable
 		const char *str = (const char *)value;
 
@@ -2780,12 +2923,13 @@ static int set_reg(struct script_state* st, TBL_PC* sd, int num, const char *nam
 					pc_setaccountreg2str(sd, name, str) :
 					pc_setaccountregstr(sd, name, str);
 			case '.': {
-					struct DBMap *n = (ref) ? *ref : (name[1] == '@') ? st->stack->var_function : st->script->script_vars;
+					struct DBMap *n = (ref && ref != &st->stack->var_function) ? *ref : (name[1] == '@') ? script_get_var_function(st) : st->script->script_vars;
 
 					if( n ) {
 						idb_remove(n, num);
 						if( str[0] )
 							idb_put(n, num, aStrdup(str));
+						script_array_update(&n, num, !str[0]);
 					}
 				}
 				return 1;
@@ -2796,6 +2940,7 @@ static int set_reg(struct script_state* st, TBL_PC* sd, int num, const char *nam
 						idb_remove(instance_data[instance_id].vars, num);
 						if( str[0] )
 							idb_put(instance_data[instance_id].vars, num, aStrdup(str));
+						script_array_update(&instance_data[instance_id].vars, num, !str[0]);
 					}
 				}
 				return 1;
@@ -2827,12 +2972,13 @@ static int set_reg(struct script_state* st, TBL_PC* sd, int num, const char *nam
 					pc_setaccountreg2(sd, name, val) :
 					pc_setaccountreg(sd, name, val);
 			case '.': {
-					struct DBMap *n = (ref) ? *ref : (name[1] == '@') ? st->stack->var_function : st->script->script_vars;
+					struct DBMap *n = (ref && ref != &st->stack->var_function) ? *ref : (name[1] == '@') ? script_get_var_function(st) : st->script->script_vars;
 
 					if( n ) {
 						idb_remove(n, num);
 						if( val != 0 )
 							idb_iput(n, num, val);
+						script_array_update(&n, num, val == 0);
 					}
 				}
 				return 1;
@@ -2843,6 +2989,7 @@ static int set_reg(struct script_state* st, TBL_PC* sd, int num, const char *nam
 						idb_remove(instance_data[instance_id].vars, num);
 						if( val != 0 )
 							idb_iput(instance_data[instance_id].vars, num, val);
+						script_array_update(&instance_data[instance_id].vars, num, val == 0);
 					}
 				}
 				return 1;
@@ -2871,11 +3018,16 @@ const char *conv_str(struct script_state* st, struct script_data* data)
 	if( data_isstring(data) ) {
 		// nothing to convert
 	} else if( data_isint(data) ) { // int -> string
-		CREATE(p, char, ITEM_NAME_LENGTH);
-		snprintf(p, ITEM_NAME_LENGTH, "%d", data->u.num);
-		p[ITEM_NAME_LENGTH - 1] = '\0';
-		data->type = C_STR;
-		data->u.str = p;
+		if( data->u.num >= 0 && data->u.num < SCRIPT_STR_INTERN ) {
+			data->type = C_CONSTSTR;
+			data->u.str = script_str_int[data->u.num];
+			script_str_stats.interned++;
+		} else {
+			p = script_str_alloc(11);
+			snprintf(p, 12, "%d", data->u.num);
+			data->type = C_STR;
+			data->u.str = p;
+		}
 	} else if( data_isreference(data) ) { // reference -> string
 		// @TODO: When does this happen (check get_val) [FlavioJS]
 		data->type = C_CONSTSTR;
@@ -2922,7 +3074,7 @@ int conv_num(struct script_state* st, struct script_data* data)
 			script_reportsrc(st);
 		}
 		if( data->type == C_STR )
-			aFree(p);
+			script_str_free(p);
 		data->type = C_INT;
 		data->u.num = (int)num;
 	}
@@ -3001,7 +3153,7 @@ struct script_data* push_copy(struct script_stack* stack, int pos)
 			return push_str(stack, C_CONSTSTR, stack->stack_data[pos].u.str);
 			break;
 		case C_STR:
-			return push_str(stack, C_STR, aStrdup(stack->stack_data[pos].u.str));
+			return push_str(stack, C_STR, script_str_ref(stack->stack_data[pos].u.str));
 			break;
 		case C_RETINFO:
 			ShowFatalError("script:push_copy: can't create copies of C_RETINFO. Exiting...\n");
@@ -3036,7 +3188,7 @@ void pop_stack(struct script_state* st, int start, int end)
 	for( i = start; i < end; i++ ) {
 		data = &stack->stack_data[i];
 		if( data->type == C_STR )
-			aFree(data->u.str);
+			script_str_free(data->u.str);
 		if( data->type == C_RETINFO ) {
 			struct script_retinfo* ri = data->u.ri;
 
@@ -3096,13 +3248,22 @@ void script_free_code(struct script_code* code)
 struct script_state* script_alloc_state(struct script_code* script, int pos, int rid, int oid)
 {
 	struct script_state* st;
-	CREATE(st, struct script_state, 1);
-	st->stack = (struct script_stack*)aMalloc(sizeof(struct script_stack));
+
+	st = ers_alloc(st_ers, struct script_state);
+	memset(st, 0, sizeof(struct script_state));
+	if( stack_cache_count > 0 ) { // Stack data was left as C_NOP by pop_stack
+		st->stack = stack_cache[--stack_cache_count];
+		script_pool_stats.stacks_reused++;
+	} else {
+		st->stack = (struct script_stack*)aMalloc(sizeof(struct script_stack));
+		st->stack->sp_max = SCRIPT_STACK_SIZE;
+		CREATE(st->stack->stack_data, struct script_data, st->stack->sp_max);
+	}
 	st->stack->sp = 0;
-	st->stack->sp_max = 64;
-	CREATE(st->stack->stack_data, struct script_data, st->stack->sp_max);
 	st->stack->defsp = st->stack->sp;
-	st->stack->var_function = idb_alloc(DB_OPT_RELEASE_DATA);
+	st->stack->var_function = NULL; // Created by script_get_var_function on the first write
+	script_pool_stats.states++;
+	script_pool_stats.frames++;
 	st->state = RUN;
 	st->script = script;
 	//st->scriptroot = script;
@@ -3126,11 +3287,46 @@ void script_free_state(struct script_state* st)
 		delete_timer(st->sleep.timer, run_script_timer);
 	script_free_vars(st->stack->var_function);
 	pop_stack(st, 0, st->stack->sp);
-	aFree(st->stack->stack_data);
-	aFree(st->stack);
+	if( stack_cache_count < SCRIPT_STACK_CACHE && st->stack->sp_max == SCRIPT_STACK_SIZE )
+		stack_cache[stack_cache_count++] = st->stack;
+	else {
+		aFree(st->stack->stack_data);
+		aFree(st->stack);
+	}
 	st->stack = NULL;
 	st->pos = -1;
-	aFree(st);
+	ers_free(st_ers, st);
+}
+
+/// Returns the scope variables of the running frame.
+/// Frames start without them and only pay for the map once a scope variable is written.
+///
+/// @param st Script state
+/// @return Scope variables
+static struct DBMap* script_get_var_function(struct script_state* st)
+{
+	if( !st->stack->var_function ) {
+		st->stack->var_function = idb_alloc(DB_OPT_RELEASE_DATA);
+		script_pool_stats.scope_vars++;
+	}
+	return st->stack->var_function;
+}
+
+/// Displays the usage of the script state pool.
+/// Each state used to cost 4 allocations (state, stack, stack data and scope map)
+/// and each callfunc/callsub one more (scope map).
+void script_pool_report(void)
+{
+	unsigned int avoided = script_pool_stats.states + script_pool_stats.stacks_reused * 2 + (script_pool_stats.frames - script_pool_stats.scope_vars);
+
+	ShowMessage(CL_BOLD"[Script state pool report]\n"CL_NORMAL);
+	ShowMessage("\tstates allocated      : %u\n", script_pool_stats.states);
+	ShowMessage("\tstacks reused         : %u\n", script_pool_stats.stacks_reused);
+	ShowMessage("\tidle stacks           : %d\n", stack_cache_count);
+	ShowMessage("\tframes (states+calls) : %u\n", script_pool_stats.frames);
+	ShowMessage("\tscope maps created    : %u\n", script_pool_stats.scope_vars);
+	ShowMessage("\tallocations avoided   : %u\n", avoided);
+	script_str_report();
 }
 
 //
@@ -3232,9 +3428,11 @@ void op_2str(struct script_state* st, int op, const char *s1, const char *s2)
 	case C_LE: a = (strcmp(s1,s2) <= 0); break;
 	case C_ADD:
 		{
-			char *buf = (char *)aMalloc((strlen(s1)+strlen(s2)+1)*sizeof(char));
-			strcpy(buf, s1);
-			strcat(buf, s2);
+			size_t len1 = strlen(s1), len2 = strlen(s2);
+			char *buf = script_str_alloc(len1 + len2);
+
+			memcpy(buf, s1, len1);
+			memcpy(buf + len1, s2, len2 + 1);
 			script_pushstr(st, buf);
 			return;
 		}
@@ -3340,13 +3538,16 @@ void op_2(struct script_state *st, int op)
 			break;
 	}
 
-	if( data_isstring(left) && data_isstring(right) ) { //ss => op_2str
+	if( op == C_ADD && left->type == C_STR && leftref.type == C_NOP && script_str_header(left->u.str)->refcount == 1 && data_isstring(right) ) { //Concatenate into the left value
+		left->u.str = script_str_append(left->u.str, right->u.str);
+		script_removetop(st, -1, 0);
+	} else if( data_isstring(left) && data_isstring(right) ) { //ss => op_2str
 		op_2str(st, op, left->u.str, right->u.str);
 		script_removetop(st, leftref.type == C_NOP ? -3 : -2, -1);//Pop the two values before the top one
 
 		if (leftref.type != C_NOP) {
 			if (left->type == C_STR) //Don't free C_CONSTSTR
-				aFree(left->u.str);
+				script_str_free(left->u.str);
 			*left = leftref;
 		}
 	} else if( data_isint(left) && data_isint(right) ) { //ii => op_2num
@@ -3936,10 +4137,24 @@ void script_cleararray_pc(struct map_session_data *sd, const char *varname, void
 	key = add_str(varname);
 
 	if( is_string_variable(varname) ) {
+		if( value == NULL || *(const char *)value == '\0' ) { // Only the set elements need clearing
+			struct script_array *sa;
+
+			while( (sa = script_array_get(sd->regarray, key)) != NULL )
+				pc_setregstr(sd, reference_uid(key, sa->size - 1), NULL);
+			return;
+		}
 		for( idx = 0; idx < SCRIPT_MAX_ARRAYSIZE; idx++ ) {
 			pc_setregstr(sd, reference_uid(key, idx), (const char *)value);
 		}
 	} else {
+		if( value == NULL ) { // Only the set elements need clearing
+			struct script_array *sa;
+
+			while( (sa = script_array_get(sd->regarray, key)) != NULL )
+				pc_setreg(sd, reference_uid(key, sa->size - 1), 0);
+			return;
+		}
 		for( idx = 0; idx < SCRIPT_MAX_ARRAYSIZE; idx++ ) {
 			pc_setreg(sd, reference_uid(key, idx), (int)__64BPRTSIZE(value));
 		}
@@ -4220,6 +4435,16 @@ void do_final_script(void) {
 		linkdb_final(&sleep_db);
 	}
 
+	while(stack_cache_count > 0) {
+		struct script_stack *stack = stack_cache[--stack_cache_count];
+
+		aFree(stack->stack_data);
+		aFree(stack);
+	}
+	ers_destroy(st_ers);
+	for(i = 0; i < SCRIPT_STR_CLASSES; i++)
+		ers_destroy(script_str_ers[i]);
+
 	if(str_data)
 		aFree(str_data);
 	if(str_buf)
@@ -4256,9 +4481,17 @@ void do_final_script(void) {
  * Initialization
  *------------------------------------------*/
 void do_init_script(void) {
+	int i;
+
 	userfunc_db = strdb_alloc(DB_OPT_DUP_KEY,0);
 	scriptlabel_db = strdb_alloc(DB_OPT_DUP_KEY,50);
 	autobonus_db = strdb_alloc(DB_OPT_DUP_KEY,0);
+	st_ers = ers_new(sizeof(struct script_state), "script.c::st_ers", ERS_OPT_CLEAR);
+	script_str_ers[0] = ers_new(script_str_class_size[0], "script.c::script_str_ers[0]", ERS_OPT_CLEAR);
+	script_str_ers[1] = ers_new(script_str_class_size[1], "script.c::script_str_ers[1]", ERS_OPT_CLEAR);
+	script_str_ers[2] = ers_new(script_str_class_size[2], "script.c::script_str_ers[2]", ERS_OPT_CLEAR);
+	for( i = 0; i < SCRIPT_STR_INTERN; i++ )
+		snprintf(script_str_int[i], sizeof(script_str_int[i]), "%d", i);
 
 	mapreg_init();
 #ifdef BETA_THREAD_TEST
@@ -4806,7 +5039,7 @@ BUILDIN_FUNC(callfunc)
 			if( name[0] == '.' ) {
 				if( !ref ) {
 					ref = (struct DBMap**)aCalloc(sizeof(struct DBMap*), 1);
-					ref[0] = (name[1] == '@' ? st->stack->var_function : st->script->script_vars);
+					ref[0] = (name[1] == '@' ? script_get_var_function(st) : st->script->script_vars);
 				}
 				data->ref = ref;
 			}
@@ -4825,7 +5058,8 @@ BUILDIN_FUNC(callfunc)
 	st->script = scr;
 	st->stack->defsp = st->stack->sp;
 	st->state = GOTO;
-	st->stack->var_function = idb_alloc(DB_OPT_RELEASE_DATA);
+	st->stack->var_function = NULL;
+	script_pool_stats.frames++;
 	return SCRIPT_CMD_SUCCESS;
 }
 /*==========================================
@@ -4852,7 +5086,7 @@ BUILDIN_FUNC(callsub)
 			if( name[0] == '.' && name[1] == '@' ) {
 				if ( !ref ) {
 					ref = (struct DBMap**)aCalloc(sizeof(struct DBMap*),1);
-					ref[0] = st->stack->var_function;
+					ref[0] = script_get_var_function(st);
 				}
 				data->ref = ref;
 			}
@@ -4870,7 +5104,8 @@ BUILDIN_FUNC(callsub)
 	st->pos = pos;
 	st->stack->defsp = st->stack->sp;
 	st->state = GOTO;
-	st->stack->var_function = idb_alloc(DB_OPT_RELEASE_DATA);
+	st->stack->var_function = NULL;
+	script_pool_stats.frames++;
 	return SCRIPT_CMD_SUCCESS;
 }
 
@@ -5350,7 +5585,7 @@ BUILDIN_FUNC(percentheal)
 		return 0;
 
 #ifdef RENEWAL
-	if( sd->sc.data[SC_EXTREMITYFIST2] )
+	if( sc_data(&sd->sc, SC_EXTREMITYFIST2) )
 		sp = 0;
 #endif
 
@@ -5526,29 +5761,101 @@ BUILDIN_FUNC(set)
 /// Array variables
 ///
 
-/// Returns the size of the specified array
-static int32 getarraysize(struct script_state* st, int32 id, int32 idx, int isstring, struct DBMap** ref)
+/// Updates the bookkeeping of an array after one of its elements was set or cleared.
+/// The bookkeeping lives in the same storage as the elements, so it is released with them.
+///
+/// @param src Storage of the elements, created if needed
+/// @param uid Element that changed
+/// @param empty If the element is now empty (0 or "")
+void script_array_update(struct DBMap **src, int32 uid, bool empty)
 {
-	int32 ret = idx;
+	struct script_array *sa;
+	uint32 idx = ((uint32)uid) >> 24;
+	int32 key = reference_uid(uid, SCRIPT_ARRAY_INDEX);
 
-	if( isstring ) {
-		for( ; idx < SCRIPT_MAX_ARRAYSIZE; ++idx ) {
-			char *str = (char *)get_val2(st, reference_uid(id, idx), ref);
+	if( idx >= SCRIPT_MAX_ARRAYSIZE )
+		return;
 
-			if( str && *str )
-				ret = idx + 1;
-			script_removetop(st, -1, 0);
+	if( *src == NULL ) {
+		if( empty )
+			return;
+		*src = idb_alloc(DB_OPT_RELEASE_DATA);
+	}
+
+	sa = (struct script_array *)idb_get(*src, key);
+	if( empty ) {
+		if( !sa || !(sa->members[idx / 32]&(1U<<(idx % 32))) )
+			return;
+		sa->members[idx / 32] &= ~(1U<<(idx % 32));
+		if( --sa->count == 0 ) {
+			idb_remove(*src, key);
+			return;
+		}
+		if( idx + 1 == sa->size ) { // Find the new highest element
+			while( idx > 0 && !(sa->members[(idx - 1) / 32]&(1U<<((idx - 1) % 32))) )
+				idx--;
+			sa->size = idx;
 		}
 	} else {
-		for( ; idx < SCRIPT_MAX_ARRAYSIZE; ++idx ) {
-			int32 num = (int32)__64BPRTSIZE(get_val2(st, reference_uid(id, idx), ref));
-
-			if( num )
-				ret = idx + 1;
-			script_removetop(st, -1, 0);
+		if( !sa ) {
+			CREATE(sa, struct script_array, 1);
+			idb_put(*src, key, sa);
 		}
+		if( sa->members[idx / 32]&(1U<<(idx % 32)) )
+			return;
+		sa->members[idx / 32] |= 1U<<(idx % 32);
+		sa->count++;
+		if( idx >= sa->size )
+			sa->size = idx + 1;
+	}
+}
+
+/// Returns the bookkeeping of an array variable, or NULL if no element is set.
+struct script_array *script_array_get(struct DBMap *src, int32 id)
+{
+	if( src == NULL )
+		return NULL;
+	return (struct script_array *)idb_get(src, reference_uid(id, SCRIPT_ARRAY_INDEX));
+}
+
+/// Returns the bookkeeping of an array variable in the scope of the script.
+static struct script_array *script_array_src(struct script_state* st, int32 id, struct DBMap** ref)
+{
+	const char *name = get_str(id);
+
+	switch( name[0] ) {
+		case '@': {
+				TBL_PC *sd = script_rid2sd(st);
+
+				return (sd ? script_array_get(sd->regarray, id) : NULL);
+			}
+		case '$':
+			return mapreg_getarray(id);
+		case '.': {
+				struct DBMap *n =
+					ref            ? *ref:
+					name[1] == '@' ? st->stack->var_function: // Instance/scope variable
+									 st->script->script_vars; // Npc variable
+
+				return script_array_get(n, id);
+			}
+		case '\'': {
+				int instance_id = script_instancegetid(st);
+
+				return (instance_id ? script_array_get(instance_data[instance_id].vars, id) : NULL);
+			}
 	}
-	return ret;
+	return NULL;
+}
+
+/// Returns the size of the specified array
+static int32 getarraysize(struct script_state* st, int32 id, int32 idx, int isstring, struct DBMap** ref)
+{
+	struct script_array *sa = script_array_src(st, id, ref);
+
+	if( sa && sa->size > idx )
+		return sa->size;
+	return idx;
 }
 
 /// Sets values of an array, from the starting index.
@@ -5649,6 +5956,12 @@ BUILDIN_FUNC(cleararray)
 	end = start + script_getnum(st, 4);
 	if( end > SCRIPT_MAX_ARRAYSIZE )
 		end = SCRIPT_MAX_ARRAYSIZE;
+	if( (is_string_variable(name) ? *(const char *)v == '\0' : v == NULL) ) { // Clearing, elements past the end are already empty
+		int32 size = getarraysize(st, id, start, is_string_variable(name), script_getref(st,2));
+
+		if( end > size )
+			end = size;
+	}
 
 	for( ; start < end; ++start )
 		set_reg(st, sd, reference_uid(id, start), name, v, script_getref(st,2));
@@ -5807,7 +6120,7 @@ BUILDIN_FUNC(deletearray)
 			return 0; // No player attached
 	}
 
-	end = SCRIPT_MAX_ARRAYSIZE;
+	end = getarraysize(st, id, start, is_string_variable(name), reference_getref(data));
 
 	if( start >= end )
 		return 0; // Nothing to free
@@ -5962,6 +6275,18 @@ BUILDIN_FUNC(viewpoint)
 	return SCRIPT_CMD_SUCCESS;
 }
 
+/// Returns the next slot after 'i' holding 'nameid' in the given location, or 'size' when there are none left.
+/// The inventory is walked through the player's nameid index, cart and storage are scanned.
+static int buildin_item_search_next(struct map_session_data *sd, uint8 loc, struct item *items, int size, unsigned short nameid, int i)
+{
+	if( loc == 0 ) {
+		i = pc_search_inventory_next(sd, nameid, i);
+		return (i == INDEX_NOT_FOUND) ? size : i;
+	}
+	for( i++; i < size && items[i].nameid != nameid; i++ );
+	return i;
+}
+
 /// Returns number of items in inventory/cart/storage
 /// countitem <nameID>{,<accountID>});
 /// countitem2 <nameID>,<Identified>,<Refine>,<Attribute>,<Card0>,<Card1>,<Card2>,<Card3>{,<accountID>}) [Lupus]
@@ -6031,9 +6356,8 @@ BUILDIN_FUNC(countitem)
 	if( !i ) { //For count/cart/storagecountitem function
 		unsigned short nameid = id->nameid;
 
-		for( i = 0; i < size; i++ )
-			if( &items[i] && items[i].nameid == nameid )
-				count += items[i].amount;
+		for( i = buildin_item_search_next(sd, loc, items, size, nameid, -1); i < size; i = buildin_item_search_next(sd, loc, items, size, nameid, i) )
+			count += items[i].amount;
 	} else { //For count/cart/storagecountitem2 function
 		unsigned short nameid;
 		int iden, ref, attr, c1, c2, c3, c4;
@@ -6047,9 +6371,8 @@ BUILDIN_FUNC(countitem)
 		c3 = script_getnum(st,8);
 		c4 = script_getnum(st,9);
 
-		for( i = 0; i < size; i++ )
-			if( &items[i] && items[i].nameid > 0 && items[i].nameid == nameid &&
-				items[i].amount > 0 && items[i].identify == iden &&
+		for( i = buildin_item_search_next(sd, loc, items, size, nameid, -1); i < size; i = buildin_item_search_next(sd, loc, items, size, nameid, i) )
+			if( items[i].nameid > 0 && items[i].amount > 0 && items[i].identify == iden &&
 				items[i].refine == ref && items[i].attribute == attr &&
 				items[i].card[0] == c1 && items[i].card[1] == c2 &&
 				items[i].card[2] == c3 && items[i].card[3] == c4 )
@@ -6866,10 +7189,10 @@ static bool buildin_delitem_search(struct map_session_data *sd, struct item* it,
 		amount = it->amount;
 
 		//1st pass -- less important items / exact match
-		for( i = 0; amount && i < size; i++ ) {
-			struct item *itm = NULL;
+		for( i = buildin_item_search_next(sd, loc, items, size, it->nameid, -1); amount && i < size; i = buildin_item_search_next(sd, loc, items, size, it->nameid, i) ) {
+			struct item *itm = &items[i];
 
-			if( !&items[i] || !(itm = &items[i])->nameid || itm->nameid != it->nameid ) //Wrong/invalid item
+			if( !itm->nameid ) //Invalid item
 				continue;
 
 			if( itm->equip != it->equip || itm->refine != it->refine ) { //Not matching attributes
@@ -6898,10 +7221,10 @@ static bool buildin_delitem_search(struct map_session_data *sd, struct item* it,
 		if( amount == 0 || important == 0 ) { //Either everything was already consumed or no items were skipped
 			;
 		} else
-			for( i = 0; amount && i < size; i++ ) {
-				struct item *itm = NULL;
+			for( i = buildin_item_search_next(sd, loc, items, size, it->nameid, -1); amount && i < size; i = buildin_item_search_next(sd, loc, items, size, it->nameid, i) ) {
+				struct item *itm = &items[i];
 
-				if( !&items[i] || !(itm = &items[i])->nameid || itm->nameid != it->nameid ) //Wrong/invalid item
+				if( !itm->nameid ) //Invalid item
 					continue;
 
 				//Pet which cannot be deleted
@@ -7419,25 +7742,25 @@ BUILDIN_FUNC(strnpcinfo)
 	num = script_getnum(st,2);
 	switch( num ) {
 		case 0: // Display name
-			name = aStrdup(nd->name);
+			name = script_str_dup(nd->name);
 			break;
 		case 1: // Visible part of display name
 			if( (buf = strchr(nd->name,'#')) != NULL ) {
-				name = aStrdup(nd->name);
+				name = script_str_dup(nd->name);
 				name[buf - nd->name] = 0;
 			} else // Return the name, there is no '#' present
-				name = aStrdup(nd->name);
+				name = script_str_dup(nd->name);
 			break;
 		case 2: // # Fragment
 			if( (buf = strchr(nd->name,'#')) != NULL )
-				name = aStrdup(buf + 1);
+				name = script_str_dup(buf + 1);
 			break;
 		case 3: // Unique name
-			name = aStrdup(nd->exname);
+			name = script_str_dup(nd->exname);
 			break;
 		case 4: // Map name
 			if( nd->bl.m >= 0 ) // Only valid map indexes allowed (bugreport:8034)
-				name = aStrdup(map[nd->bl.m].name);
+				name = script_str_dup(map[nd->bl.m].name);
 			break;
 	}
 
@@ -8849,7 +9172,7 @@ BUILDIN_FUNC(gettimestr)
 	fmtstr = script_getstr(st,2);
 	maxlen = script_getnum(st,3);
 
-	tmpstr = (char *)aMalloc((maxlen + 1) * sizeof(char));
+	tmpstr = script_str_alloc(maxlen);
 	strftime(tmpstr,maxlen,fmtstr,localtime(&now));
 	tmpstr[maxlen] = '\0';
 
@@ -10143,7 +10466,7 @@ BUILDIN_FUNC(sc_end)
 
 	if( type >= 0 && type < SC_MAX ) {
 		struct status_change *sc = status_get_sc(bl);
-		struct status_change_entry *sce = sc ? sc->data[type] : NULL;
+		struct status_change_entry *sce = sc ? sc_data(sc, type) : NULL;
 
 		if( !sce )
 			return 0;
@@ -10224,19 +10547,19 @@ BUILDIN_FUNC(getstatu *
 		return 0;
 	}
 
-	if( sd->sc.count == 0 || !sd->sc.data[id] ) { //No status is active
+	if( sd->sc.count == 0 || !sc_data(&sd->sc, id) ) { //No status is active
 		script_pushint(st, 0);
 		return 0;
 	}
 	
 	switch( type ) {
-		case 1:	 script_pushint(st, sd->sc.data[id]->val1);	break;
-		case 2:  script_pushint(st, sd->sc.data[id]->val2);	break;
-		case 3:  script_pushint(st, sd->sc.data[id]->val3);	break;
-		case 4:  script_pushint(st, sd->sc.data[id]->val4);	break;
+		case 1:	 script_pushint(st, sc_data(&sd->sc, id)->val1);	break;
+		case 2:  script_pushint(st, sc_data(&sd->sc, id)->val2);	break;
+		case 3:  script_pushint(st, sc_data(&sd->sc, id)->val3);	break;
+		case 4:  script_pushint(st, sc_data(&sd->sc, id)->val4);	break;
 		case 5:
 			{
-				struct TimerData* timer = (struct TimerData*)get_timer(sd->sc.data[id]->timer);
+				struct TimerData* timer = (struct TimerData*)get_timer(sc_data(&sd->sc, id)->timer);
 
 				if( timer ) { //Return the amount of time remaining
 					script_pushint(st, timer->tick - gettick());
@@ -12224,7 +12547,7 @@ BUILDIN_FUNC(getitemname)
 		script_pushconststr(st,"null");
 		return 0;
 	}
-	item_name = (char *)aMalloc(ITEM_NAME_LENGTH * sizeof(char));
+	item_name = script_str_alloc(ITEM_NAME_LENGTH);
 
 	memcpy(item_name,i_data->jname,ITEM_NAME_LENGSCRIPT_CMD_SUCCESS;
 }
@@ -13797,7 +14120,7 @@ BUILDIN_FUNC(mapid2name)
 	uint16 m = script_getnum(st,2);
 
 	if( m < 0 || m >= MAX_MAP_PER_SERVER ) {
-		script_pushstr(st,"");
+		script_pushconststr(st,"");
 		return 1;
 	}
 
@@ -14311,7 +14634,7 @@ BUILDIN_FUNC(setchar)
 	const char *str = script_getstr(st,2);
 	const char *c = script_getstr(st,3);
 	int index = script_getnum(st,4);
-	char *output = aStrdup(str);
+	char *output = script_str_dup(str);
 
 	if(index >= 0 && index < strlen(output))
 		output[index] SCRIPT_CMD_SUCCESS] ) : 0;
@@ -14336,7 +14659,7 @@ BUILDIN_FUNC(setchar)
 	else if( index > len)
 		index = len;
 
-	output = (char*)aMalloc(len + 2);
+	output = script_str_alloc(len + 1);
 
 	memcpy(output, str, index);
 	output[index] = c[0];
@@ -14359,12 +14682,12 @@ BUILDIN_FUNC(delchar)
 
 	if(index < 0 || index > len) {
 		//return original
-		output = aStrdup(str);
+		output = script_str_dup(str);
 		script_pushstr( st, output);
 		return 0;
 	}
 
-	output = (char*)aMalloc(len);
+	output = script_str_alloc(len);
 
 	memcpy(output, str, index);
 	memcpy(&output[index], &str[index+1], len - inSCRIPT_CMD_SUCCESS] ) : 0;
@@ -14379,7 +14702,7 @@ BUILDIN_FUNC(delchar)
 BUILDIN_FUNC(strtoupper)
 {
 	const char *str = script_getstr(st,2);
-	char *output = aStrdup(str);
+	char *output = script_str_dup(str);
 	char *cursor = output;
 
 	while (*cursor != '\0') {
@@ -14396,7 +14719,7 @@ BUILDIN_FUNC(strtoupper)
 BUILDIN_FUNC(strtolower)
 {
 	const char *str = script_getstr(st,2);
-	char *output = aStrdup(str);
+	char *output = script_str_dup(str);
 	char *cursor = output;
 
 	while (*cursor != '\0') {
@@ -15180,7 +15503,7 @@ BUILDIN_FUNC(md5)
 	char *md5str;
 
 	tmpstr = script_getstr(st,2);
-	md5str = (char *)aMalloc((32 + 1) * sizeof(char));
+	md5str = script_str_alloc(32);
 	MD5_String(tmpstr,md5str);
 	script_pushstr(st,md5str);
 	return SCRIPT_CMD_SUCCESS;
@@ -15198,6 +15521,13 @@ BUILDIN_FUNC(setd)
 	if( sscanf(buffer,"%99[^[][%d]",varname,&elem) < 2 )
 		elem = 0;
 
+	if( elem < 0 || elem >= SCRIPT_MAX_ARRAYSIZE ) {
+		ShowWarning("script:setd: index out of range (%d) for '%s'\n", elem, buffer);
+		script_reportsrc(st);
+		st->state = END;
+		return 1;
+	}
+
 	if( not_server_variable(*varname) ) {
 		sd = script_rid2sd(st);
 		if( sd == NULL ) {
@@ -15342,7 +15672,7 @@ BUILDIN_FUNC(escape_sql)
 
 	str = script_getstr(st,2);
 	len = strlen(str);
-	esc_str = (char *)aMalloc(len * 2 + 1);
+	esc_str = script_str_alloc(len * 2);
 	Sql_EscapeStringLen(mmysql_handle,esc_str,str,len);
 	script_pushstr(st,esc_str);
 	return SCRIPT_CMD_SUCCESS;
@@ -15359,6 +15689,13 @@ BUILDIN_FUNC(getd)
 	if(sscanf(buffer,"%99[^[][%d]",varname,&elem) < 2)
 		elem = 0;
 
+	if( elem < 0 || elem >= SCRIPT_MAX_ARRAYSIZE ) {
+		ShowWarning("script:getd: index out of range (%d) for '%s'\n", elem, buffer);
+		script_pushnil(st);
+		st->state = END;
+		return 1;
+	}
+
 	//Push the 'pointer' so it's more flexible [Lance]
 	push_val(st->stack,C_NAME,reference_uid(add_str(varname),elem));
 
@@ -18324,7 +18661,7 @@ BUILDIN_FUNC(setdragon) {
   **/
 BUILDIN_FUNC(ismounting) {
 	TBL_PC* sd;
-	if( (sd = scsd->sc.data[SC_ALL_RIDING]ULL )
+	if( (sd = sc_data(&scsd->sc, SC_ALL_RIDING)ULL )
 		return 0;
 	if( pc_isridingdragon(sd) )
 		script_pushint(sSCRIPT_CMD_SUCCESS;
@@ -18348,7 +18685,7 @@ BUILDIN_FUNC(ismounting) {
 		clif_msg(sd,ITEM_NEED_REINS_OF_MOUNT);
 		script_pushint(st,0); //Can't mount with one of these
 	} else {
-		if( sd->sc.data[SC_ALL_RIDING] )
+		if( sc_data(&sd->sc, SC_ALL_RIDING) )
 			status_change_end(&sd->bl,SC_ALL_RIDING,INVALID_TIMER);
 		else
 			sc_start(&sd->bl,&sd->bl,SC_ALL_RIDING,100,0,-1);
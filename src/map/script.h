@@ -6,6 +6,9 @@
 
 #define NUM_WHISPER_VAR 10
 
+#define SCRIPT_MAX_ARRAYSIZE 128 /// Maximum amount of elements in script arrays
+#define SCRIPT_ARRAY_INDEX 0xff /// Index under which the bookkeeping of an array variable is stored
+
 struct map_session_data;
 
 extern int potion_flag; //For use on Alchemist improved potions/Potion Pitcher. [Skotlex]
@@ -78,6 +81,15 @@ typedef enum c_op {
 	C_SUB_PP, // --a
 } c_op;
 
+/// Bookkeeping of an array variable.
+/// Stored next to the elements, under reference_uid(id, SCRIPT_ARRAY_INDEX).
+/// getd, setd and set_reg refuse indexes from SCRIPT_MAX_ARRAYSIZE on, so scripts never reach it.
+struct script_array {
+	unsigned short size; // Highest set index + 1
+	unsigned short count; // Number of set elements
+	uint32 members[SCRIPT_MAX_ARRAYSIZE / 32]; // Set elements
+};
+
 struct script_retinfo {
 	struct DBMap *var_function;// scope variables
 	struct script_code* script;// script code
@@ -174,6 +186,7 @@ void script_free_code(struct script_code* code);
 void script_free_vars(struct DBMap *storage);
 struct script_state* script_alloc_state(struct script_code* script, int pos, int rid, int oid);
 void script_free_state(struct script_state* st);
+void script_pool_report(void);
 
 struct DBMap *script_get_label_db(void);
 struct DBMap *script_get_userfunc_db(void);
@@ -183,6 +196,9 @@ bool script_get_constant(const char *name, int* value);
 void script_set_constant(const char *name, int value, bool isparameter);
 void script_hardcoded_constants(void);
 
+void script_array_update(struct DBMap **src, int32 uid, bool empty);
+struct script_array *script_array_get(struct DBMap *src, int32 id);
+
 void script_cleararray_pc(struct map_session_data *sd, const char *varname, void* value);
 void script_setarray_pc(struct map_session_data *sd, const char *varname, uint8 idx, void* value, int* refcache);
 
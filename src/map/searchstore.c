@@ -2,11 +2,13 @@
 // For more information, see LICENCE in the main folder
 
 #include "../common/cbasetypes.h"
+#include "../common/db.h"  // DBMap, ARR_FIND
 #include "../common/malloc.h"  // aMalloc, aRealloc, aFree
 #include "../common/showmsg.h"  // ShowError, ShowWarning
 #include "../common/strlib.h"  // safestrncpy
 #include "battle.h"  // battle_config.*
 #include "clif.h"  // clif_open_search_store_info, clif_search_store_info_*
+#include "itemdb.h"  // itemdb_isspecial, itemdb_slot
 #include "pc.h"  // struct map_session_data
 #include "searchstore.h"  // struct s_search_store_info
 
@@ -21,12 +23,6 @@ enum e_searchstore_failure {
 };
 
 
-enum e_searchstore_searchtype {
-	SEARCHTYPE_VENDING      = 0,
-	SEARCHTYPE_BUYING_STORE = 1,
-};
-
-
 enum e_searchstore_effecttype {
 	EFFECTTYPE_NORMAL = 0,
 	EFFECTTYPE_CASH   = 1,
@@ -36,7 +32,28 @@ enum e_searchstore_effecttype {
 
 /// type for shop search function
 typedef bool (*searchstore_search_t)(struct map_session_data *sd, unsigned short nameid);
-typedef bool (*searchstore_searchall_t)(struct map_session_data *sd, const struct s_search_store_search *s);
+typedef bool (*searchstore_searchslot_t)(struct map_session_data *sd, int slot, unsigned short nameid, const struct s_search_store_search *s);
+
+
+/// inverted index entry, a store slot dealing in an item
+struct s_search_store_index_entry {
+	unsigned int price;
+	int char_id;  // store owner, key of vending_db/buyingstore_db
+	unsigned short nameid;
+	unsigned short card[MAX_SLOTS];  // distinct searchable cards, 0-terminated
+	uint8 slot;  // index of the store slot
+};
+
+
+/// store slots of one item or card, sorted by price
+struct s_search_store_index {
+	struct s_search_store_index_entry* entries;
+	int count, max;
+};
+
+
+static DBMap* searchstore_item_db[SEARCHTYPE_MAX];  // int nameid -> struct s_search_store_index* (releases data)
+static DBMap* searchstore_card_db;  // int card id -> struct s_search_store_index* (releases data), vending only
 
 
 /// retrieves search function by type
@@ -50,17 +67,215 @@ static searchstore_search_t searchstore_getsearchfunc(unsigned char type)
 }
 
 
-/// retrieves search-all function by type
-static searchstore_searchall_t searchstore_getsearchallfunc(unsigned char type)
+/// retrieves single slot search function by type
+static searchstore_searchslot_t searchstore_getsearchslotfunc(unsigned char type)
 {
 	switch( type ) {
-		case SEARCHTYPE_VENDING:      return &vending_searchall;
-		case SEARCHTYPE_BUYING_STORE: return &buyingstore_searchall;
+		case SEARCHTYPE_VENDING:      return &vending_searchslot;
+		case SEARCHTYPE_BUYING_STORE: return &buyingstore_searchslot;
 	}
 	return NULL;
 }
 
 
+/// retrieves the store db by type
+static DBMap* searchstore_getstoredb(unsigned char type)
+{
+	switch( type ) {
+		case SEARCHTYPE_VENDING:      return vending_db;
+		case SEARCHTYPE_BUYING_STORE: return buyingstore_db;
+	}
+	return NULL;
+}
+
+
+/// returns the position of the first entry with a price >= price
+static int searchstore_index_lower(struct s_search_store_index* idx, unsigned int price)
+{
+	int lo = 0, hi = idx->count;
+
+	while( lo < hi ) {
+		int mid = (lo + hi) / 2;
+
+		if( idx->entries[mid].price < price )
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+
+static void searchstore_index_insert(struct s_search_store_index* idx, const struct s_search_store_index_entry* entry)
+{
+	int i = searchstore_index_lower(idx, entry->price);
+
+	while( i < idx->count && idx->entries[i].price == entry->price ) // keep insertion order among equal prices
+		i++;
+
+	if( idx->count == idx->max ) {
+		idx->max = max(idx->max * 2, 16);
+		RECREATE(idx->entries, struct s_search_store_index_entry, idx->max);
+	}
+	memmove(&idx->entries[i + 1], &idx->entries[i], (idx->count - i) * sizeof(idx->entries[0]));
+	memcpy(&idx->entries[i], entry, sizeof(idx->entries[0]));
+	idx->count++;
+}
+
+
+static void searchstore_index_erase(struct s_search_store_index* idx, const struct s_search_store_index_entry* entry)
+{
+	int i = searchstore_index_lower(idx, entry->price);
+
+	while( i < idx->count && idx->entries[i].price == entry->price && (idx->entries[i].char_id != entry->char_id || idx->entries[i].slot != entry->slot) )
+		i++;
+
+	if( i == idx->count || idx->entries[i].price != entry->price )
+		return;  // not indexed
+
+	idx->count--;
+	memmove(&idx->entries[i], &idx->entries[i + 1], (idx->count - i) * sizeof(idx->entries[0]));
+}
+
+
+static DBData searchstore_index_create(DBKey key, va_list args)
+{
+	struct s_search_store_index* idx;
+
+	CREATE(idx, struct s_search_store_index, 1);
+	return db_ptr2data(idx);
+}
+
+
+/// @see DBApply
+static int searchstore_index_final(DBKey key, DBData* data, va_list ap)
+{
+	struct s_search_store_index* idx = db_data2ptr(data);
+
+	aFree(idx->entries);
+	return 0;
+}
+
+
+/// checks whether an entry holds the given card
+static bool searchstore_index_hascard(const struct s_search_store_index_entry* entry, unsigned short card)
+{
+	int i;
+
+	ARR_FIND(0, MAX_SLOTS, i, entry->card[i] == card || !entry->card[i]);
+	return ( i < MAX_SLOTS && entry->card[i] == card );
+}
+
+
+/// fills an index entry, cards follow the same rules as a card search
+static void searchstore_index_entry(struct s_search_store_index_entry* entry, int char_id, int slot, unsigned short nameid, unsigned int price, const unsigned short* card)
+{
+	int c, n, slots;
+
+	memset(entry, 0, sizeof(*entry));
+	entry->price   = price;
+	entry->char_id = char_id;
+	entry->nameid  = nameid;
+	entry->slot    = (uint8)slot;
+
+	if( card == NULL || itemdb_isspecial(card[0]) )  // something, that is not a carded
+		return;
+
+	slots = min(itemdb_slot(nameid), MAX_SLOTS);
+
+	for( c = n = 0; c < slots && card[c]; c++ ) {
+		if( !searchstore_index_hascard(entry, card[c]) )
+			entry->card[n++] = card[c];
+	}
+}
+
+
+/// adds a store slot to the index, called when the store opens or its slots change
+void searchstore_index_add(unsigned char type, int char_id, int slot, unsigned short nameid, unsigned int price, const unsigned short* card)
+{
+	struct s_search_store_index_entry entry;
+	int i;
+
+	if( type >= SEARCHTYPE_MAX || !nameid )
+		return;
+
+	searchstore_index_entry(&entry, char_id, slot, nameid, price, card);
+	searchstore_index_insert(idb_ensure(searchstore_item_db[type], nameid, searchstore_index_create), &entry);
+
+	if( type != SEARCHTYPE_VENDING )
+		return;
+
+	for( i = 0; i < MAX_SLOTS && entry.card[i]; i++ )
+		searchstore_index_insert(idb_ensure(searchstore_card_db, entry.card[i], searchstore_index_create), &entry);
+}
+
+
+/// removes a store slot from the index, must be given the same data as when it was added
+void searchstore_index_remove(unsigned char type, int char_id, int slot, unsigned short nameid, unsigned int price, const unsigned short* card)
+{
+	struct s_search_store_index_entry entry;
+	struct s_search_store_index* idx;
+	int i;
+
+	if( type >= SEARCHTYPE_MAX || !nameid )
+		return;
+
+	searchstore_index_entry(&entry, char_id, slot, nameid, price, card);
+
+	if( ( idx = idb_get(searchstore_item_db[type], nameid) ) != NULL )
+		searchstore_index_erase(idx, &entry);
+
+	if( type != SEARCHTYPE_VENDING )
+		return;
+
+	for( i = 0; i < MAX_SLOTS && entry.card[i]; i++ ) {
+		if( ( idx = idb_get(searchstore_card_db, entry.card[i]) ) != NULL )
+			searchstore_index_erase(idx, &entry);
+	}
+}
+
+
+/// walks an index in price order and reports matching store slots
+/// @param card_idx position in the card list of the walked card index, -1 when walking an item index
+/// @return false when the result set is full
+static bool searchstore_query_index(struct s_search_store_index* idx, unsigned char type, const struct s_search_store_search* s, int card_idx)
+{
+	searchstore_searchslot_t store_searchslot = searchstore_getsearchslotfunc(type);
+	DBMap* store_db = searchstore_getstoredb(type);
+	int i;
+
+	if( idx == NULL )
+		return true;
+
+	for( i = searchstore_index_lower(idx, s->min_price); i < idx->count; i++ ) {
+		const struct s_search_store_index_entry* entry = &idx->entries[i];
+		struct map_session_data* pl_sd;
+		unsigned int j;
+
+		if( s->max_price && s->max_price < entry->price )
+			break;  // sorted by price, nothing else in range
+
+		if( card_idx >= 0 ) {
+			ARR_FIND(0, s->item_count, j, s->itemlist[j] == entry->nameid);
+			if( j == s->item_count )  // not a requested item
+				continue;
+
+			ARR_FIND(0, (unsigned int)card_idx, j, searchstore_index_hascard(entry, s->cardlist[j]));
+			if( j != (unsigned int)card_idx )  // already reported through an earlier card
+				continue;
+		}
+
+		if( ( pl_sd = idb_get(store_db, entry->char_id) ) == NULL || pl_sd == s->search_sd )  // skip own shop, if any
+			continue;
+
+		if( !store_searchslot(pl_sd, entry->slot, entry->nameid, s) )  // exceeded result size
+			return false;
+	}
+
+	return true;
+}
+
+
 /// checks if the player has a store by type
 static int searchstore_hasstore(struct map_session_data *sd, unsigned char type)
 {
@@ -103,11 +318,10 @@ bool searchstore_open(struct map_session_data *sd, unsigned int uses, unsigned s
 void searchstore_query(struct map_session_data *sd, unsigned char type, unsigned int min_price, unsigned int max_price, const unsigned short* itemlist, unsigned int item_count, const unsigned short* cardlist, unsigned int card_count)
 {
 	unsigned int i;
-	struct map_session_data *pl_sd;
-	struct DBIterator *iter;
 	struct s_search_store_search s;
-	searchstore_searchall_t store_searchall;
 	time_t querytime;
+	int item_cost = 0, card_cost = 0;
+	bool more = true;
 
 	if( !battle_config.feature_search_stores )
 		return;
@@ -115,7 +329,7 @@ void searchstore_query(struct map_session_data *sd, unsigned char type, unsigned
 	if( !sd->searchstore.open )
 		return;
 
-	if( ( store_searchall = searchstore_getsearchallfunc(type) ) == NULL ) {
+	if( searchstore_getsearchslotfunc(type) == NULL ) {
 		ShowError("searchstore_query: Unknown search type %u (account_id=%d).\n", (unsigned int)type, sd->bl.id);
 		return;
 	}
@@ -170,19 +384,37 @@ void searchstore_query(struct map_session_data *sd, unsigned char type, unsigned
 	s.card_count = card_count;
 	s.min_price  = min_price;
 	s.max_price  = max_price;
-	iter         = db_iterator((type == SEARCHTYPE_VENDING) ? vending_db : buyingstore_db);
 
-	for( pl_sd = dbi_first(iter); dbi_exists(iter);  pl_sd = dbi_next(iter) ) {
-		if( sd == pl_sd ) // Skip own shop, if any
-			continue;
+	// Walk whichever of the item or card indexes holds fewer candidates
+	for( i = 0; i < item_count; i++ ) {
+		struct s_search_store_index* idx = idb_get(searchstore_item_db[type], itemlist[i]);
 
-		if( !store_searchall(pl_sd, &s) ) { // Exceeded result size
-			clif_search_store_info_failed(sd, SSI_FAILED_OVER_MAXCOUNT);
-			break;
+		item_cost += idx ? idx->count : 0;
+	}
+
+	if( type == SEARCHTYPE_VENDING && card_count ) {
+		for( i = 0; i < card_count; i++ ) {
+			struct s_search_store_index* idx = idb_get(searchstore_card_db, cardlist[i]);
+
+			card_cost += idx ? idx->count : 0;
+		}
+	}
+
+	if( type == SEARCHTYPE_VENDING && card_count && card_cost < item_cost ) {
+		for( i = 0; more && i < card_count; i++ )
+			more = searchstore_query_index(idb_get(searchstore_card_db, cardlist[i]), type, &s, i);
+	} else {
+		for( i = 0; more && i < item_count; i++ ) {
+			unsigned int j;
+
+			ARR_FIND(0, i, j, itemlist[j] == itemlist[i]);
+			if( j == i ) // Skip duplicate items
+				more = searchstore_query_index(idb_get(searchstore_item_db[type], itemlist[i]), type, &s, -1);
 		}
 	}
 
-	dbi_destroy(iter);
+	if( !more ) // Exceeded result size
+		clif_search_store_info_failed(sd, SSI_FAILED_OVER_MAXCOUNT);
 
 	if( sd->searchstore.count ) {
 		// Reclaim unused memory
@@ -341,3 +573,21 @@ bool searchstore_result(struct map_session_data *sd, int store_id, int account_i
 
 	return true;
 }
+
+
+void do_init_searchstore(void) {
+	int i;
+
+	for( i = 0; i < SEARCHTYPE_MAX; i++ )
+		searchstore_item_db[i] = idb_alloc(DB_OPT_RELEASE_DATA);
+	searchstore_card_db = idb_alloc(DB_OPT_RELEASE_DATA);
+}
+
+
+void do_final_searchstore(void) {
+	int i;
+
+	for( i = 0; i < SEARCHTYPE_MAX; i++ )
+		searchstore_item_db[i]->destroy(searchstore_item_db[i], searchstore_index_final);
+	searchstore_card_db->destroy(searchstore_card_db, searchstore_index_final);
+}
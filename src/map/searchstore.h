@@ -6,6 +6,12 @@
 
 #define SEARCHSTORE_RESULTS_PER_PAGE 10
 
+enum e_searchstore_searchtype {
+	SEARCHTYPE_VENDING      = 0,
+	SEARCHTYPE_BUYING_STORE = 1,
+	SEARCHTYPE_MAX
+};
+
 /// information about the search being performed
 struct s_search_store_search {
 	struct map_session_data *search_sd;  // sd of the searching player
@@ -50,5 +56,10 @@ void searchstore_click(struct map_session_data *sd, int account_id, int store_id
 bool searchstore_queryremote(struct map_session_data *sd, int account_id);
 void searchstore_clearremote(struct map_session_data *sd);
 bool searchstore_result(struct map_session_data *sd, int store_id, int account_id, const char *store_name, unsigned short nameid, unsigned short amount, unsigned int price, const unsigned short* card, unsigned char refine);
+void searchstore_index_add(unsigned char type, int char_id, int slot, unsigned short nameid, unsigned int price, const unsigned short* card);
+void searchstore_index_remove(unsigned char type, int char_id, int slot, unsigned short nameid, unsigned int price, const unsigned short* card);
+
+void do_init_searchstore(void);
+void do_final_searchstore(void);
 
 #endif  // _SEARCHSTORE_H_
@@ -42,6 +42,8 @@
 #include <math.h>
 
 #define SKILLUNITTIMER_INTERVAL 100
+#define SKILLUNITTIMER_IDLE_MAX (60 * 60 * 1000) //Longest sleep of an idle skill unit group, keeps the tick difference in range
+#define SKILLUNIT_WAKE_RANGE 2 //Units with a larger range don't sleep, skill_unit_move only looks this far for groups to wake
 #define WATERBALL_INTERVAL 150
 
 //Ranges reserved for mapping skill ids to skilldb offsets
@@ -58,7 +60,6 @@ static struct eri *skill_unit_ers = NULL; //For handling skill_unit's [Skotlex]
 static struct eri *skill_timer_ers = NULL; //For handling skill_timerskills [Skotlex]
 static DBMap *bowling_db = NULL; //int mob_id -> struct mob_data*
 
-DBMap *skillunit_db = NULL; //int id -> struct skill_unit*
 
 /**
  * Skill Unit Persistency during endack routes (mostly for songs see bugreport:4574)
@@ -136,9 +137,15 @@ int skill_name2id(const char *name)
 	return strdb_iget(skilldb_name2id, name);
 }
 
+//Largest skill id that can map to a skill db offset, plus one
+#define SKILL_IDX_TABLE_MAX (GD_SKILLBASE + MAX_SKILL_DB - GD_SKILLRANGEMIN)
+
+static uint16 skill_idx_table[SKILL_IDX_TABLE_MAX]; //skill id -> skill db offset, 0 if invalid
+
 ///Maps skill ids to skill db offsets.
 ///Returns the skill's array index, or 0 (Unknown Skill).
-int skill_get_index(uint16 skill_id)
+///Only used to build skill_idx_table, use skill_get_index instead.
+static uint16 skill_calc_index(uint16 skill_id)
 {
 	//Avoid ranges reserved for mapping guild/homun/mercenary/elemental skills
 	if( (skill_id >= GD_SKILLRANGEMIN && skill_id <= GD_SKILLRANGEMAX) ||
@@ -164,6 +171,27 @@ int skill_get_index(uint16 skill_id)
 	return skill_id;
 }
 
+/**
+ * Fills the skill id -> skill db index table, the mapping only depends on constants.
+ */
+static void skill_init_index_table(void)
+{
+	int i;
+
+	for( i = 0; i < SKILL_IDX_TABLE_MAX; i++ )
+		skill_idx_table[i] = skill_calc_index((uint16)i);
+}
+
+/**
+ * Gets the skill db index of a skill id.
+ * @param skill_id
+ * @return Index in skill_db, or 0 if the id is invalid
+ */
+int skill_get_index(uint16 skill_id)
+{
+	return (skill_id < SKILL_IDX_TABLE_MAX ? skill_idx_table[skill_id] : 0);
+}
+
 const char *skill_get_name(uint16 skill_id)
 {
 	return skill_db[skill_get_index(skill_id)].name;
@@ -291,6 +319,7 @@ static int skill_cell_overlap(struct block_list *bl, va_list ap);
 static int skill_trap_splash(struct block_list *bl, va_list ap);
 struct skill_unit_group_tickset *skill_unitgrouptickset_search(struct block_list *bl,struct skill_unit_group *sg,int tick);
 static int skill_unit_onplace(struct skill_unit *unit,struct block_list *bl,unsigned int tick);
+static int skill_unit_group_timer(int tid, unsigned int tick, int id, intptr_t data);
 int skill_unit_onleft(uint16 skill_id, struct block_list *bl,unsigned int tick);
 static int skill_unit_effect(struct block_list *bl,va_list ap);
 static int skill_bind_trap(struct block_list *bl, va_list ap);
@@ -422,28 +451,28 @@ int skill_calc_heal(struct block_list *src, struct block_list *target, uint16 sk
 	if( tsd && (skill = pc_skillheal2_bonus(tsd, skill_id)) )
 		hp += hp * skill / 100;
 
-	if( sc && sc->data[SC_OFFERTORIUM] && (skill_id == AB_HIGHNESSHEAL || skill_id == AB_CHEAL ||
+	if( sc && sc_data(sc, SC_OFFERTORIUM) && (skill_id == AB_HIGHNESSHEAL || skill_id == AB_CHEAL ||
 		skill_id == PR_SANCTUARY || skill_id == AL_HEAL) )
-		hp += hp * sc->data[SC_OFFERTORIUM]->val2 / 100;
+		hp += hp * sc_data(sc, SC_OFFERTORIUM)->val2 / 100;
 
 	if( tsc && tsc->count ) {
 		if( skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN ) {
-			if( tsc->data[SC_INCHEALRATE] )
-				hp += hp * tsc->data[SC_INCHEALRATE]->val1 / 100;
-			if( tsc->data[SC_EXTRACT_WHITE_POTION_Z] )
-				hp += hp * tsc->data[SC_EXTRACT_WHITE_POTION_Z]->val1 / 100;
+			if( sc_data(tsc, SC_INCHEALRATE) )
+				hp += hp * sc_data(tsc, SC_INCHEALRATE)->val1 / 100;
+			if( sc_data(tsc, SC_EXTRACT_WHITE_POTION_Z) )
+				hp += hp * sc_data(tsc, SC_EXTRACT_WHITE_POTION_Z)->val1 / 100;
 		}
 		if( heal ) { //Has no effect on offensive heal [Inkfish]
 			uint8 penalty = 0;
 
-			if( tsc->data[SC_CRITICALWOUND] )
-				penalty += tsc->data[SC_CRITICALWOUND]->val2;
-			if( tsc->data[SC_DEATHHURT] )
+			if( sc_data(tsc, SC_CRITICALWOUND) )
+				penalty += sc_data(tsc, SC_CRITICALWOUND)->val2;
+			if( sc_data(tsc, SC_DEATHHURT) )
 				penalty += 20;
 			if( penalty > 0 )
 				hp -= hp * penalty / 100;
 		}
-		if( tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2)
+		if( sc_data(tsc, SC_WATER_INSIGNIA) && sc_data(tsc, SC_WATER_INSIGNIA)->val1 == 2)
 			hp += hp / 10;
 	}
 
@@ -493,10 +522,10 @@ static char skill_isCopyable(struct map_session_data *sd, uint16 skill_id) {
 		}
 	}
 
-	if( (skill_db[idx].copyable.option&1) && pc_checkskill(sd, RG_PLAGIARISM) && !sd->sc.data[SC_PRESERVE] )
+	if( (skill_db[idx].copyable.option&1) && pc_checkskill(sd, RG_PLAGIARISM) && !sc_data(&sd->sc, SC_PRESERVE) )
 		return 1; //Plagiarism only able to copy skill while SC_PRESERVE is not active and skill is copyable by Plagiarism
 
-	if( (skill_db[idx].copyable.option&2) && pc_checkskill(sd, SC_REPRODUCE) && sd->sc.data[SC__REPRODUCE] )
+	if( (skill_db[idx].copyable.option&2) && pc_checkskill(sd, SC_REPRODUCE) && sc_data(&sd->sc, SC__REPRODUCE) )
 		return 2; //Reproduce can copy skill if SC__REPRODUCE is active and the skill is copyable by Reproduce
 
 	return 0;
@@ -561,7 +590,7 @@ bool skill_isNotOk(uint16 skill_id, struct map_session_data *sd)
 			return true;
 	}
 
-	if (sd->sc.data[SC_ALL_RIDING])
+	if (sc_data(&sd->sc, SC_ALL_RIDING))
 		return true; //You can't use skills while in the new mounts (The client doesn't let you, this is to make cheat-safe)
 
 	switch (skill_id) {
@@ -660,15 +689,15 @@ bool skill_isNotOk_hom(uint16 skill_id, struct homun_data *hd)
 			}
 			break;
 		case MH_GOLDENE_FERSE: //Can't be used with angriff
-			if (hd->sc.data[SC_ANGRIFFS_MODUS])
+			if (sc_data(&hd->sc, SC_ANGRIFFS_MODUS))
 				return true;
 			break;
 		case MH_ANGRIFFS_MODUS:
-			if (hd->sc.data[SC_GOLDENE_FERSE])
+			if (sc_data(&hd->sc, SC_GOLDENE_FERSE))
 				return true;
 			break;
 		case MH_SONIC_CRAW:
-			if (!(hd->sc.data[SC_STYLE_CHANGE] && hd->sc.data[SC_STYLE_CHANGE]->val1 == MH_MD_FIGHTING) ||
+			if (!(sc_data(&hd->sc, SC_STYLE_CHANGE) && sc_data(&hd->sc, SC_STYLE_CHANGE)->val1 == MH_MD_FIGHTING) ||
 				!hd->homunculus.spiritball) { //Must be in fighting mode
 				if (hd->master)
 					clif_skill_fail(hd->master, skill_id, USESKILL_FAIL_STYLE_CHANGE_FIGHTER, 0, 0);
@@ -676,17 +705,17 @@ bool skill_isNotOk_hom(uint16 skill_id, struct homun_data *hd)
 			}
 			break;
 		case MH_SILVERVEIN_RUSH:
-			if (!(hd->sc.data[SC_COMBO] && hd->sc.data[SC_COMBO]->val1 == MH_SONIC_CRAW) ||
+			if (!(sc_data(&hd->sc, SC_COMBO) && sc_data(&hd->sc, SC_COMBO)->val1 == MH_SONIC_CRAW) ||
 				!hd->homunculus.spiritball)
 				return true;
 			break;
 		case MH_MIDNIGHT_FRENZY:
-			if (!(hd->sc.data[SC_COMBO] && hd->sc.data[SC_COMBO]->val1 == MH_SILVERVEIN_RUSH) ||
+			if (!(sc_data(&hd->sc, SC_COMBO) && sc_data(&hd->sc, SC_COMBO)->val1 == MH_SILVERVEIN_RUSH) ||
 				hd->homunculus.spiritball < 2)
 				return true;
 			break;
 		case MH_TINDER_BREAKER:
-			if (!(hd->sc.data[SC_STYLE_CHANGE] && hd->sc.data[SC_STYLE_CHANGE]->val1 == MH_MD_GRAPPLING) ||
+			if (!(sc_data(&hd->sc, SC_STYLE_CHANGE) && sc_data(&hd->sc, SC_STYLE_CHANGE)->val1 == MH_MD_GRAPPLING) ||
 				!hd->homunculus.spiritball) { //Must be in grappling mode
 				if (hd->master)
 					clif_skill_fail(hd->master, skill_id, USESKILL_FAIL_STYLE_CHANGE_GRAPPLER, 0, 0);
@@ -694,12 +723,12 @@ bool skill_isNotOk_hom(uint16 skill_id, struct homun_data *hd)
 			}
 			break;
 		case MH_CBC:
-			if (!(hd->sc.data[SC_COMBO] && hd->sc.data[SC_COMBO]->val1 == MH_TINDER_BREAKER) ||
+			if (!(sc_data(&hd->sc, SC_COMBO) && sc_data(&hd->sc, SC_COMBO)->val1 == MH_TINDER_BREAKER) ||
 				!hd->homunculus.spiritball)
 				return true;
 			break;
 		case MH_EQC:
-			if (!(hd->sc.data[SC_COMBO] && hd->sc.data[SC_COMBO]->val1 == MH_CBC) ||
+			if (!(sc_data(&hd->sc, SC_COMBO) && sc_data(&hd->sc, SC_COMBO)->val1 == MH_CBC) ||
 				hd->homunculus.spiritball < 2)
 				return true;
 			break;
@@ -925,23 +954,23 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 						else
 							clif_skill_fail(sd,RG_SNATCHER,USESKILL_FAIL_LEVEL,0,0);
 					}
-					if( !(sc && sc->data[SC_COMBO]) ) { //Chance to trigger Taekwon kicks [Dralnu]
-						if( sc->data[SC_READYSTORM] &&
+					if( !(sc && sc_data(sc, SC_COMBO)) ) { //Chance to trigger Taekwon kicks [Dralnu]
+						if( sc_data(sc, SC_READYSTORM) &&
 							sc_start4(src,src,SC_COMBO,15,TK_STORMKICK,bl->id,2,0,
 								(2000 - 4 * sstatus->agi - 2 * sstatus->dex)) )
 							; //Stance triggered
-						else if( sc->data[SC_READYDOWN] &&
+						else if( sc_data(sc, SC_READYDOWN) &&
 							sc_start4(src,src,SC_COMBO,15,TK_DOWNKICK,bl->id,2,0,
 								(2000 - 4 * sstatus->agi - 2 * sstatus->dex)) )
 							; //Stance triggered
-						else if( sc->data[SC_READYTURN] &&
+						else if( sc_data(sc, SC_READYTURN) &&
 							sc_start4(src,src,SC_COMBO,15,TK_TURNKICK,bl->id,2,0,
 								(2000 - 4 * sstatus->agi - 2 * sstatus->dex)) )
 							; //Stance triggered
-						else if( sc->data[SC_READYCOUNTER] ) { //Additional chance from SG_FRIEND [Komurka]
+						else if( sc_data(sc, SC_READYCOUNTER) ) { //Additional chance from SG_FRIEND [Komurka]
 							rate = 20;
-							if( sc->data[SC_SKILLRATE_UP] && sc->data[SC_SKILLRATE_UP]->val1 == TK_COUNTER ) {
-								rate += rate * sc->data[SC_SKILLRATE_UP]->val2 / 100;
+							if( sc_data(sc, SC_SKILLRATE_UP) && sc_data(sc, SC_SKILLRATE_UP)->val1 == TK_COUNTER ) {
+								rate += rate * sc_data(sc, SC_SKILLRATE_UP)->val2 / 100;
 								status_change_end(src,SC_SKILLRATE_UP,INVALID_TIMER);
 							}
 							sc_start4(src,src,SC_COMBO,rate,TK_COUNTER,bl->id,2,0,
@@ -949,17 +978,17 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 							; //Stance triggered
 						}
 					}
-					if( sc && sc->data[SC_PYROCLASTIC] && ((rnd()%100) <= sc->data[SC_PYROCLASTIC]->val3) )
-						skill_castend_pos2(src,bl->x,bl->y,BS_HAMMERFALL,sc->data[SC_PYROCLASTIC]->val1,tick,0);
+					if( sc && sc_data(sc, SC_PYROCLASTIC) && ((rnd()%100) <= sc_data(sc, SC_PYROCLASTIC)->val3) )
+						skill_castend_pos2(src,bl->x,bl->y,BS_HAMMERFALL,sc_data(sc, SC_PYROCLASTIC)->val1,tick,0);
 				}
 
 				if( sc ) {
 					struct status_change_entry *sce;
 
 					//Enchant Poison gives a chance to poison attacked enemies
-					if( (sce = sc->data[SC_ENCPOISON]) ) //Don't use sc_start since chance comes in 1/10000 rate
+					if( (sce = sc_data(sc, SC_ENCPOISON)) ) //Don't use sc_start since chance comes in 1/10000 rate
 						status_change_start(src,bl,SC_POISON,sce->val2,sce->val1,src->id,0,0,skill_get_time2(AS_ENCHANTPOISON,sce->val1),SCFLAG_NONE);
-					if( (sce = sc->data[SC_EDP]) ) //Enchant Deadly Poison gives a chance to deadly poison attacked enemies
+					if( (sce = sc_data(sc, SC_EDP)) ) //Enchant Deadly Poison gives a chance to deadly poison attacked enemies
 						sc_start4(src,bl,SC_DPOISON,sce->val2,sce->val1,src->id,0,0,skill_get_time2(ASC_EDP,sce->val1));
 				}
 			}
@@ -1155,7 +1184,7 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 			sc_start(src,bl,SC_AUTOCOUNTER,(skill_lv * 15),skill_lv,skill_get_time(skill_id,skill_lv));
 			break;
 		case PF_FOGWALL:
-			if( bl->id != src->id && !tsc->data[SC_DELUGE] )
+			if( bl->id != src->id && !sc_data(tsc, SC_DELUGE) )
 				sc_start(src,bl,SC_BLIND,100,skill_lv,skill_get_time2(skill_id,skill_lv));
 			break;
 		case LK_HEADCRUSH: //Headcrush has chance of causing Bleeding status, except on demon and undead element
@@ -1195,7 +1224,7 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 			sc_start(src,bl,SC_STUN,100,skill_lv,skill_get_time2(skill_id,skill_lv));
 			break;
 		case TK_JUMPKICK:
-			if( dstsd && dstsd->class_ != MAPID_SOUL_LINKER && !tsc->data[SC_PRESERVE] ) { //Debuff the following statuses
+			if( dstsd && dstsd->class_ != MAPID_SOUL_LINKER && !sc_data(tsc, SC_PRESERVE) ) { //Debuff the following statuses
 				status_change_end(bl,SC_SPIRIT,INVALID_TIMER);
 				status_change_end(bl,SC_ADRENALINE2,INVALID_TIMER);
 				status_change_end(bl,SC_KAITE,INVALID_TIMER);
@@ -1258,7 +1287,7 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 			sc_start(src,bl,SC_FREEZING,15,skill_lv,skill_get_time(skill_id,skill_lv));
 			break;
 		case AB_ADORAMUS:
-			if( !tsc->data[SC_DECREASEAGI] ) //Prevent duplicate agi-down effect
+			if( !sc_data(tsc, SC_DECREASEAGI) ) //Prevent duplicate agi-down effect
 				sc_start(src,bl,SC_ADORAMUS,skill_lv * 4 + (sd ? sd->status.job_level / 2 : 0),skill_lv,skill_get_time(skill_id,skill_lv));
 			break;
 		case WL_CRIMSONROCK:
@@ -1274,7 +1303,7 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 
 				rate = max(5,(5 + skill_lv) * skill_lv + (sstatus->dex - tstatus->dex) / 5);
 				dur = max(0,skill_get_time2(skill_id,skill_lv) + (sstatus->dex - tstatus->dex) * 500);
-				if( !tsc->data[SC_WHITEIMPRISON] )
+				if( !sc_data(tsc, SC_WHITEIMPRISON) )
 					for( i = 0; i < skill_lv; i++ )
 						skill_strip_equip(src,bl,pos[i],rate,skill_lv,dur);
 			}
@@ -1320,7 +1349,7 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 			//Status chances are applied officially through a check
 			//The skill first trys to give the frozen status to targets that are hit
 			sc_start(src,bl,SC_FREEZE,10 * skill_lv,skill_lv,skill_get_time(skill_id,skill_lv));
-			if( !tsc->data[SC_FREEZE] ) //If it fails to give the frozen status, it will attempt to give the freezing status
+			if( !sc_data(tsc, SC_FREEZE) ) //If it fails to give the frozen status, it will attempt to give the freezing status
 				sc_start(src,bl,SC_FREEZING,20 + 10 * skill_lv,skill_lv,skill_get_time2(skill_id,skill_lv));
 			break;
 		case NC_POWERSWING:
@@ -1380,10 +1409,10 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 			sc_start(src,bl,SC_EARTHDRIVE,100,skill_lv,skill_get_time(skill_id,skill_lv));
 			break;
 		case LG_HESPERUSLIT:
-			if( sc && sc->data[SC_BANDING] ) {
-				if( sc->data[SC_BANDING]->val2 > 3 )
+			if( sc && sc_data(sc, SC_BANDING) ) {
+				if( sc_data(sc, SC_BANDING)->val2 > 3 )
 					status_change_start(src,bl,SC_STUN,10000,skill_lv,0,0,0,rnd_value(4000,8000),SCFLAG_FIXEDTICK);
-				if( sd && pc_checkskill(sd,LG_PINPOINTATTACK) > 0 && sc->data[SC_BANDING]->val2 > 5 )
+				if( sd && pc_checkskill(sd,LG_PINPOINTATTACK) > 0 && sc_data(sc, SC_BANDING)->val2 > 5 )
 					skill_castend_damage_id(src,bl,LG_PINPOINTATTACK,rnd_value(1,pc_checkskill(sd,LG_PINPOINTATTACK)),tick,0);
 			}
 			break;
@@ -1413,8 +1442,8 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 			break;
 		case SO_DIAMONDDUST:
 			rate = 5 + 5 * skill_lv;
-			if( sc && sc->data[SC_COOLER_OPTION] )
-				rate += sc->data[SC_COOLER_OPTION]->val3 / 5;
+			if( sc && sc_data(sc, SC_COOLER_OPTION) )
+				rate += sc_data(sc, SC_COOLER_OPTION)->val3 / 5;
 			sc_start(src,bl,SC_CRYSTALIZE,rate,skill_lv,skill_get_time2(skill_id,skill_lv));
 			break;
 		case SO_VARETYR_SPEAR:
@@ -1482,7 +1511,7 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 			sc_start(src,bl,SC_STUN,10 * skill_lv,skill_lv,skill_get_time2(skill_id,skill_lv));
 			break;
 		case MH_LAVA_SLIDE:
-			if( !tsc->data[SC_BURNING] )
+			if( !sc_data(tsc, SC_BURNING) )
 				sc_start4(src,bl,SC_BURNING,10 * skill_lv,skill_lv,1000,src->id,0,skill_get_time(skill_id,skill_lv));
 			break;
 		case MH_STAHL_HORN:
@@ -1550,11 +1579,11 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 		if( sd && battle_config.equip_self_break_rate ) {
 			rate = battle_config.equip_natural_break_rate;
 			if( sc ) {
-				if( sc->data[SC_GIANTGROWTH] )
+				if( sc_data(sc, SC_GIANTGROWTH) )
 					rate += 10;
-				if( sc->data[SC_OVERTHRUST] )
+				if( sc_data(sc, SC_OVERTHRUST) )
 					rate += 10;
-				if( sc->data[SC_MAXOVERTHRUST] )
+				if( sc_data(sc, SC_MAXOVERTHRUST) )
 					rate += 10;
 			}
 			if( rate ) //Self weapon breaking
@@ -1566,15 +1595,15 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 			rate = 0;
 			if( sd )
 				rate += sd->bonus.break_weapon_rate;
-			if( sc && sc->data[SC_MELTDOWN] )
-				rate += sc->data[SC_MELTDOWN]->val2;
+			if( sc && sc_data(sc, SC_MELTDOWN) )
+				rate += sc_data(sc, SC_MELTDOWN)->val2;
 			if( rate ) //Target weapon breaking
 				skill_break_equip(src,bl,EQP_WEAPON,rate,BCT_ENEMY);
 			rate = 0;
 			if( sd )
 				rate += sd->bonus.break_armor_rate;
-			if( sc && sc->data[SC_MELTDOWN] )
-				rate += sc->data[SC_MELTDOWN]->val3;
+			if( sc && sc_data(sc, SC_MELTDOWN) )
+				rate += sc_data(sc, SC_MELTDOWN)->val3;
 			if( rate ) //Target armor breaking
 				skill_break_equip(src,bl,EQP_ARMOR,rate,BCT_ENEMY);
 		}
@@ -1591,14 +1620,14 @@ int skill_additional_effect(struct block_list *src, struct block_list *bl, uint1
 	if( sd && sd->ed && sc && !status_isdead(bl) && !skill_id ) {
 		struct unit_data *ud = unit_bl2ud(src);
 
-		if( sc->data[SC_WILD_STORM_OPTION] )
-			skill = sc->data[SC_WILD_STORM_OPTION]->val2;
-		else if( sc->data[SC_UPHEAVAL_OPTION] )
-			skill = sc->data[SC_UPHEAVAL_OPTION]->val2;
-		else if( sc->data[SC_TROPIC_OPTION] )
-			skill = sc->data[SC_TROPIC_OPTION]->val3;
-		else if( sc->data[SC_CHILLY_AIR_OPTION] )
-			skill = sc->data[SC_CHILLY_AIR_OPTION]->val3;
+		if( sc_data(sc, SC_WILD_STORM_OPTION) )
+			skill = sc_data(sc, SC_WILD_STORM_OPTION)->val2;
+		else if( sc_data(sc, SC_UPHEAVAL_OPTION) )
+			skill = sc_data(sc, SC_UPHEAVAL_OPTION)->val2;
+		else if( sc_data(sc, SC_TROPIC_OPTION) )
+			skill = sc_data(sc, SC_TROPIC_OPTION)->val3;
+		else if( sc_data(sc, SC_CHILLY_AIR_OPTION) )
+			skill = sc_data(sc, SC_CHILLY_AIR_OPTION)->val3;
 		else
 			skill = 0;
 
@@ -1937,12 +1966,12 @@ int skill_counter_additional_effect(struct block_list *src, struct block_list *b
 			attack_type |= BF_WEAPON;
 			break;
 		case LG_HESPERUSLIT:
-			if(sc && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 6) {
+			if(sc && sc_data(sc, SC_BANDING) && sc_data(sc, SC_BANDING)->val2 > 6) {
 				char i;
 
-				if(sd && sc->data[SC_FORCEOFVANGUARD])
-					for(i = 0; i < sc->data[SC_FORCEOFVANGUARD]->val3; i++)
-						pc_addspiritball(sd,skill_get_time(LG_FORCEOFVANGUARD,1),sc->data[SC_FORCEOFVANGUARD]->val3);
+				if(sd && sc_data(sc, SC_FORCEOFVANGUARD))
+					for(i = 0; i < sc_data(sc, SC_FORCEOFVANGUARD)->val3; i++)
+						pc_addspiritball(sd,skill_get_time(LG_FORCEOFVANGUARD,1),sc_data(sc, SC_FORCEOFVANGUARD)->val3);
 			}
 			break;
 	}
@@ -1976,10 +2005,10 @@ int skill_counter_additional_effect(struct block_list *src, struct block_list *b
 			sp += sd->bonus.magic_sp_gain_value;
 			hp += sd->bonus.magic_hp_gain_value;
 			if(skill_id == WZ_WATERBALL) { //(bugreport:5303)
-				if(sc && sc->data[SC_SPIRIT] &&
-					sc->data[SC_SPIRIT]->val2 == SL_WIZARD &&
-					sc->data[SC_SPIRIT]->val3 == WZ_WATERBALL)
-					sc->data[SC_SPIRIT]->val3 = 0; //Clear bounced spell check
+				if(sc && sc_data(sc, SC_SPIRIT) &&
+					sc_data(sc, SC_SPIRIT)->val2 == SL_WIZARD &&
+					sc_data(sc, SC_SPIRIT)->val3 == WZ_WATERBALL)
+					sc_data(sc, SC_SPIRIT)->val3 = 0; //Clear bounced spell check
 			}
 		}
 		if(hp || sp) //Updated to force healing to allow healing through berserk
@@ -2142,7 +2171,7 @@ int skill_break_equip(struct block_list *src, struct block_list *bl, unsigned sh
 	}
 	for (i = 0; i < ARRAYLENGTH(pos_list); i++) {
 		if (pos&pos_list[i]) {
-			if (sc && sc->count && sc->data[sc_def[i]])
+			if (sc && sc->count && sc_data(sc, sc_def[i]))
 				pos &= ~pos_list[i];
 			else if (rnd()%10000 >= rate)
 				pos &= ~pos_list[i];
@@ -2204,7 +2233,7 @@ int skill_strip_equip(struct block_list *src, struct block_list *bl, unsigned sh
 	if (!sc || (sc->option&OPTION_MADOGEAR) ) //Mado Gear cannot be divested [Ind]
 		return 0;
 	for (i = 0; i < ARRAYLENGTH(pos_list); i++)
-		if (pos&pos_list[i] && sc->data[sc_def[i]])
+		if (pos&pos_list[i] && sc_data(sc, sc_def[i]))
 			pos &= ~pos_list[i];
 	if (!pos)
 		return 0;
@@ -2286,7 +2315,7 @@ static int skill_magic_reflect(struct block_list *src, struct block_list *bl, in
 	struct status_change *sc = status_get_sc(bl);
 	struct map_session_data *sd = BL_CAST(BL_PC, bl);
 
-	if( sc && sc->data[SC_KYOMU] )
+	if( sc && sc_data(sc, SC_KYOMU) )
 		return 0; //Nullify reflecting ability
 
 	//Item-based reflection
@@ -2300,13 +2329,13 @@ static int skill_magic_reflect(struct block_list *src, struct block_list *bl, in
 	if( !sc || sc->count == 0 )
 		return 0;
 
-	if( sc->data[SC_MAGICMIRROR] && rnd()%100 < sc->data[SC_MAGICMIRROR]->val2 )
+	if( sc_data(sc, SC_MAGICMIRROR) && rnd()%100 < sc_data(sc, SC_MAGICMIRROR)->val2 )
 		return 1;
 
 	//Kaite only works against non-players if they are low-level
-	if( sc->data[SC_KAITE] && (src->type == BL_PC || status_get_lv(src) <= 80) ) {
+	if( sc_data(sc, SC_KAITE) && (src->type == BL_PC || status_get_lv(src) <= 80) ) {
 		clif_specialeffect(bl, 438, AREA);
-		if( --sc->data[SC_KAITE]->val2 <= 0 )
+		if( --sc_data(sc, SC_KAITE)->val2 <= 0 )
 			status_change_end(bl, SC_KAITE, INVALID_TIMER);
 		return 2;
 	}
@@ -2372,7 +2401,7 @@ void skill_combo(struct block_list *src, struct block_list *dsrc, struct block_l
 		return;
 
 	//End previous combo state after skill is invoked
-	if ((sce = sc->data[SC_COMBO]) != NULL) {
+	if ((sce = sc_data(sc, SC_COMBO)) != NULL) {
 		switch (skill_id) {
 			case TK_TURNKICK:
 			case TK_STORMKICK:
@@ -2415,7 +2444,7 @@ void skill_combo(struct block_list *src, struct block_list *dsrc, struct block_l
 				if (!duration && pc_checkskill(sd, CH_CHAINCRUSH) > 0 && sd->spiritball > 1)
 					duration = 1;
 			case CH_CHAINCRUSH:
-				if (!duration && pc_checkskill(sd, MO_EXTREMITYFIST) > 0 && sd->spiritball > 0 && sd->sc.data[SC_EXPLOSIONSPIRITS])
+				if (!duration && pc_checkskill(sd, MO_EXTREMITYFIST) > 0 && sd->spiritball > 0 && sc_data(&sd->sc, SC_EXPLOSIONSPIRITS))
 					duration = 1;
 				break;
 			case AC_DOUBLE:
@@ -2552,7 +2581,7 @@ static void skill_do_copy(struct block_list *src,struct block_list *bl, uint16 s
 
 					//Already did SC check
 					//Skill level copied depends on Reproduce skill that used
-					lv = (tsc ? tsc->data[SC__REPRODUCE]->val1 : 1);
+					lv = (tsc ? sc_data(tsc, SC__REPRODUCE)->val1 : 1);
 					if( tsd->reproduceskill_idx >= 0 && tsd->status.skill[tsd->reproduceskill_idx].flag == SKILL_FLAG_PLAGIARIZED ) {
 						tsd->status.skill[tsd->reproduceskill_idx].id = 0;
 						tsd->status.skill[tsd->reproduceskill_idx].lv = 0;
@@ -2724,11 +2753,11 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 		tsc = NULL; //Don't need it
 
 	//Trick Dead protects you from damage, but not from buffs and the like, hence it's placed here
-	if (tsc && tsc->data[SC_TRICKDEAD])
+	if (tsc && sc_data(tsc, SC_TRICKDEAD))
 		return 0;
 
 	//When Gravitational Field is active, damage can only be dealt by Gravitational Field and Autospells
-	if (sc && sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF && skill_id != HW_GRAVITATION && sd && !sd->state.autocast)
+	if (sc && sc_data(sc, SC_GRAVITATION) && sc_data(sc, SC_GRAVITATION)->val3 == BCT_SELF && skill_id != HW_GRAVITATION && sd && !sd->state.autocast)
 		return 0;
 
 	dmg = battle_calc_attack(attack_type, src, bl, skill_id, skill_lv, flag&0xFFF);
@@ -2772,7 +2801,7 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 			flag |= 2; //bugreport:2564 flag&2 disables double casting trigger
 			dmg.blewcount = 0; //bugreport:7859 magical reflect'd zeroes blewcount
 			//Spirit of Wizard blocks Kaite's reflection
-			if (type == 2 && tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_WIZARD) {
+			if (type == 2 && tsc && sc_data(tsc, SC_SPIRIT) && sc_data(tsc, SC_SPIRIT)->val2 == SL_WIZARD) {
 				//Consume one Fragment per hit of the casted skill? [Skotlex]
 				type = (tsd ? pc_search_inventory(tsd, ITEMID_FRAGMENT_OF_CRYSTAL) : INDEX_NOT_FOUND);
 				if (type != INDEX_NOT_FOUND) {
@@ -2780,8 +2809,8 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 						pc_delitem(tsd, type, 1, 0, 1, LOG_TYPE_CONSUME);
 					dmg.damage = dmg.damage2 = 0;
 					dmg.dmg_lv = ATK_MISS;
-					tsc->data[SC_SPIRIT]->val3 = skill_id;
-					tsc->data[SC_SPIRIT]->val4 = dsrc->id;
+					sc_data(tsc, SC_SPIRIT)->val3 = skill_id;
+					sc_data(tsc, SC_SPIRIT)->val4 = dsrc->id;
 				}
 			} else if (type != 2) //Kaite bypasses
 				additional_effects = false;
@@ -2801,7 +2830,7 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 					else if (s_ele == -3) //Use random element
 						s_ele = rnd()%ELE_ALL;
 					dmg.damage = battle_attr_fix(bl, bl, dmg.damage, s_ele, status_get_element(bl), status_get_element_level(bl));
-					if (tsc && tsc->data[SC_ENERGYCOAT]) {
+					if (tsc && sc_data(tsc, SC_ENERGYCOAT)) {
 						struct status_data *status = status_get_status_data(bl);
 						int per = 100 * status->sp / status->max_sp - 1; //100% should be counted as the 80~99% interval
 
@@ -2819,18 +2848,18 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 #endif
 		}
 		if (tsc) {
-			if (tsc->data[SC_MAGICROD] && src == dsrc) {
+			if (sc_data(tsc, SC_MAGICROD) && src == dsrc) {
 				int sp = skill_get_sp(skill_id, skill_lv);
 
 				dmg.damage = dmg.damage2 = 0;
 				dmg.dmg_lv = ATK_MISS; //This will prevent skill additional effect from taking effect [Skotlex]
-				sp = sp * tsc->data[SC_MAGICROD]->val2 / 100;
+				sp = sp * sc_data(tsc, SC_MAGICROD)->val2 / 100;
 				if (skill_id == WZ_WATERBALL && skill_lv > 1)
 					sp = sp / ((skill_lv|1) * (skill_lv|1)); //Estimate SP cost of a single water-ball
 				status_heal(bl, 0, sp, 2);
 			}
-			if ((dmg.damage || dmg.damage2) && tsc->data[SC_HALLUCINATIONWALK] &&
-				rnd()%100 < tsc->data[SC_HALLUCINATIONWALK]->val3) {
+			if ((dmg.damage || dmg.damage2) && sc_data(tsc, SC_HALLUCINATIONWALK) &&
+				rnd()%100 < sc_data(tsc, SC_HALLUCINATIONWALK)->val3) {
 				dmg.damage = dmg.damage2 = 0;
 				dmg.dmg_lv = ATK_MISS;
 			}
@@ -2841,10 +2870,10 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 
 	if ((skill_id == AL_INCAGI || skill_id == AL_BLESSING ||
 		skill_id == CASH_BLESSING || skill_id == CASH_INCAGI ||
-		skill_id == MER_INCAGI || skill_id == MER_BLESSING) && tsd->sc.data[SC_CHANGEUNDEAD])
+		skill_id == MER_INCAGI || skill_id == MER_BLESSING) && sc_data(&tsd->sc, SC_CHANGEUNDEAD))
 		damage = 1;
 
-	if (damage && tsc && tsc->data[SC_GENSOU] && dmg.flag&BF_MAGIC) {
+	if (damage && tsc && sc_data(tsc, SC_GENSOU) && dmg.flag&BF_MAGIC) {
 		struct block_list *nbl = battle_getenemyarea(bl, bl->x, bl->y, 2, BL_CHAR, bl->id);
 
 		if (nbl) { //Only one target is chosen
@@ -2858,7 +2887,7 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 
 	switch (skill_id) {
 		case WL_HELLINFERNO: //Hell Inferno burning status only starts if Fire part hits
-			if (dmg.dmg_lv < ATK_DEF && !(tsc && tsc->data[SC_PNEUMA]))
+			if (dmg.dmg_lv < ATK_DEF && !(tsc && sc_data(tsc, SC_PNEUMA)))
 				break;
 			if (!(flag&ELE_DARK))
 				sc_start4(src, bl, SC_BURNING, 55 + 5 * skill_lv, skill_lv, 1000, src->id, 0, skill_get_time(skill_id, skill_lv));
@@ -2869,7 +2898,7 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 			break;
 		default:
 			if (damage < dmg.div_) {
-				if (tsc && tsc->data[SC_PNEUMA])
+				if (tsc && sc_data(tsc, SC_PNEUMA))
 					break; //Keep retaining its knockback ability
 				else if (skill_id != CH_PALMSTRIKE)
 					dmg.blewcount = 0; //Only pushback when it hit for other
@@ -2903,7 +2932,7 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 			if (skill_lv >= 7) {
 				struct status_change *sc = status_get_sc(src);
 
-				if (!(sc && sc->data[SC_SMA]))
+				if (!(sc && sc_data(sc, SC_SMA)))
 					sc_start(src, src, SC_SMA, 100, skill_lv, skill_get_time(SL_SMA, skill_lv));
 			}
 			break;
@@ -3079,7 +3108,7 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 	shadow_flag = skill_check_shadowform(bl, damage, dmg.div_);
 
 	if (!dmg.amotion) { //Instant damage
-		if ((!tsc || (!tsc->data[SC_DEVOTION] && skill_id != CR_REFLECTSHIELD) || skill_id == HW_GRAVITATION) && !shadow_flag)
+		if ((!tsc || (!sc_data(tsc, SC_DEVOTION) && skill_id != CR_REFLECTSHIELD) || skill_id == HW_GRAVITATION) && !shadow_flag)
 			status_fix_damage(src, bl, damage, dmg.dmotion); //Deal damage before knockback to allow stuff like firewall + storm gust combo
 		if (!status_isdead(bl) && additional_effects)
 			skill_additional_effect(src, bl, skill_id, skill_lv, dmg.flag, dmg.dmg_lv, tick);
@@ -3100,8 +3129,8 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 			battle_delay_damage(tick, dmg.amotion, src, bl, dmg.flag, skill_id, skill_lv, damage, dmg.dmg_lv, dmg.dmotion, additional_effects);
 	}
 
-	if (tsc && tsc->data[SC_DEVOTION] && skill_id != PA_PRESSURE && skill_id != HW_GRAVITATION) {
-		struct status_change_entry *sce = tsc->data[SC_DEVOTION];
+	if (tsc && sc_data(tsc, SC_DEVOTION) && skill_id != PA_PRESSURE && skill_id != HW_GRAVITATION) {
+		struct status_change_entry *sce = sc_data(tsc, SC_DEVOTION);
 		struct block_list *d_bl = map_id2bl(sce->val1);
 
 		if (d_bl &&
@@ -3157,8 +3186,8 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 			case GC_VENOMPRESSURE: {
 					struct status_change *ssc = status_get_sc(src);
 
-					if (ssc && ssc->data[SC_POISONINGWEAPON] && rnd()%100 < 70 + 5 * skill_lv) {
-						sc_start(src, bl, (sc_type)ssc->data[SC_POISONINGWEAPON]->val2, 100, ssc->data[SC_POISONINGWEAPON]->val1,
+					if (ssc && sc_data(ssc, SC_POISONINGWEAPON) && rnd()%100 < 70 + 5 * skill_lv) {
+						sc_start(src, bl, (sc_type)sc_data(ssc, SC_POISONINGWEAPON)->val2, 100, sc_data(ssc, SC_POISONINGWEAPON)->val1,
 							skill_get_time2(GC_POISONINGWEAPON, 1));
 						status_change_end(src, SC_POISONINGWEAPON, INVALID_TIMER);
 						clif_skill_nodamage(src, bl, skill_id, skill_lv, 1);
@@ -3177,7 +3206,7 @@ int skill_attack(int attack_type, struct block_list *src, struct block_list *dsr
 	}
 
 	if (!(flag&2) && (skill_id == MG_COLDBOLT || skill_id == MG_FIREBOLT || skill_id == MG_LIGHTNINGBOLT) &&
-		(tsc = status_get_sc(src)) && tsc->data[SC_DOUBLECAST] && rnd() % 100 < tsc->data[SC_DOUBLECAST]->val2) {
+		(tsc = status_get_sc(src)) && sc_data(tsc, SC_DOUBLECAST) && rnd() % 100 < sc_data(tsc, SC_DOUBLECAST)->val2) {
 		//skill_addtimerskill(src, tick + dmg.div_ * dmg.amotion, bl->id, 0, 0, skill_id, skill_lv, BF_MAGIC, flag|2);
 		skill_addtimerskill(src, tick + dmg.amotion, bl->id, 0, 0, skill_id, skill_lv, BF_MAGIC, flag|2);
 	}
@@ -3531,7 +3560,7 @@ int skill_area_sub_count(struct block_list *src, struct block_list *target, uint
 				struct status_change *tsc = status_get_sc(target);
 
 				//Only counts marked target with SC_C_MARKER by caster
-				if (!tsc || !tsc->data[SC_C_MARKER] || tsc->data[SC_C_MARKER]->val2 != src->id)
+				if (!tsc || !sc_data(tsc, SC_C_MARKER) || sc_data(tsc, SC_C_MARKER)->val2 != src->id)
 					return 0;
 			}
 			break;
@@ -3625,10 +3654,10 @@ static int skill_timerskill(int tid, unsigned int tick, int id, intptr_t data)
 						struct status_change *sc = status_get_sc(src);
 
 						if (sc) {
-							if (sc->data[SC_SPIRIT] &&
-								sc->data[SC_SPIRIT]->val2 == SL_WIZARD &&
-								sc->data[SC_SPIRIT]->val3 == skl->skill_id)
-								sc->data[SC_SPIRIT]->val3 = 0; //Clear bounced spell check
+							if (sc_data(sc, SC_SPIRIT) &&
+								sc_data(sc, SC_SPIRIT)->val2 == SL_WIZARD &&
+								sc_data(sc, SC_SPIRIT)->val3 == skl->skill_id)
+								sc_data(sc, SC_SPIRIT)->val3 = 0; //Clear bounced spell check
 						}
 					}
 					break;
@@ -3881,6 +3910,7 @@ static int skill_active_reverberation(struct block_list *bl, va_list ap) {
 		map_foreachinrange(skill_trap_splash, bl, skill_get_splash(sg->skill_id, sg->skill_lv), sg->bl_flag, bl, gettick());
 		su->limit = DIFF_TICK(gettick(), sg->tick);
 		sg->unit_id = UNT_USED_TRAPS;
+		skill_unit_group_wake(sg);
 	}
 	return 0;
 }
@@ -4109,7 +4139,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 			break;
 
 		case MO_COMBOFINISH:
-			if (!(flag&1) && sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_MONK) {
+			if (!(flag&1) && sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_MONK) {
 				//Becomes a splash attack when Soul Linked
 				map_foreachinrange(skill_area_sub,bl,skill_get_splash(skill_id,skill_lv),splash_target(src),src,
 					skill_id,skill_lv,tick,flag|BCT_ENEMY|1,skill_castend_damage_id);
@@ -4322,7 +4352,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 					sflag |= SD_LEVEL; //-1 will be used in packets instead of the skill level
 				if (skill_area_temp[1] != bl->id && !(skill_get_inf2(skill_id)&INF2_NPC_SKILL))
 					sflag |= SD_ANIMATION; //Original target gets no animation (as well as all NPC skills)
-				if (tsc && tsc->data[SC_HOVERING] && (skill_id == LG_MOONSLASHER || skill_id == SR_WINDMILL))
+				if (tsc && sc_data(tsc, SC_HOVERING) && (skill_id == LG_MOONSLASHER || skill_id == SR_WINDMILL))
 					break;
 #ifdef RENEWAL
 				if (skill_id == MG_FIREBALL)
@@ -4683,7 +4713,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 		case NPC_SELFDESTRUCTION: {
 				struct status_change *tsc = status_get_sc(bl);
 
-				if (tsc && tsc->data[SC_HIDING])
+				if (tsc && sc_data(tsc, SC_HIDING))
 					break;
 			}
 		//Fall through
@@ -4801,9 +4831,9 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 					i, j = 0, k, subskill = 0;
 
 				for (i = SC_SPHERE_1; i <= SC_SPHERE_5; i++) {
-					if (sc->data[i]) {
+					if (sc_data(sc, i)) {
 						spheres[j] = i;
-						positions[j] = sc->data[i]->val2;
+						positions[j] = sc_data(sc, i)->val2;
 						j++;
 					}
 				}
@@ -4825,7 +4855,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 
 				k = 0;
 				for (i = 0; i < j; i++) { //Loop should always be 4 for regular players, but unconditional_skill could be less
-					switch (sc->data[spheres[i]]->val1) {
+					switch (sc_data(sc, spheres[i])->val1) {
 						case WLS_FIRE:  subskill = WL_TETRAVORTEX_FIRE; k |= 1; break;
 						case WLS_WATER: subskill = WL_TETRAVORTEX_WATER; k |= 2; break;
 						case WLS_WIND:  subskill = WL_TETRAVORTEX_WIND; k |= 4; break;
@@ -4842,28 +4872,28 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 				int i;
 
 				//Priority is to release Spell Book
-				if (sc && sc->data[SC_FREEZE_SP]) { //Check sealed spells
+				if (sc && sc_data(sc, SC_FREEZE_SP)) { //Check sealed spells
 					uint16 r_skill_id, r_skill_lv, point, s = 0;
 					int spell[SC_MAXSPELLBOOK - SC_SPELLBOOK1 + 1];
 
 					for (i = SC_MAXSPELLBOOK; i >= SC_SPELLBOOK1; i--) //List all available spell to be released
-						if (sc->data[i])
+						if (sc_data(sc, i))
 							spell[s++] = i;
 
 					if (s == 0)
 						break;
 
 					i = spell[(s == 1 ? 0 : rnd()%s)]; //Random select of spell to be released
-					if (sc->data[i]) { //Now extract the data from the preserved spell
-						r_skill_id = sc->data[i]->val1;
-						r_skill_lv = sc->data[i]->val2;
-						point = sc->data[i]->val3;
+					if (sc_data(sc, i)) { //Now extract the data from the preserved spell
+						r_skill_id = sc_data(sc, i)->val1;
+						r_skill_lv = sc_data(sc, i)->val2;
+						point = sc_data(sc, i)->val3;
 						status_change_end(src,(sc_type)i,INVALID_TIMER);
 					} else //Something went wrong
 						break;
 
-					if (sc->data[SC_FREEZE_SP]->val2 > point)
-						sc->data[SC_FREEZE_SP]->val2 -= point;
+					if (sc_data(sc, SC_FREEZE_SP)->val2 > point)
+						sc_data(sc, SC_FREEZE_SP)->val2 -= point;
 					else //Last spell to be released
 						status_change_end(src,SC_FREEZE_SP,INVALID_TIMER);
 
@@ -4892,10 +4922,10 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 						positions[5] = { -1,-1,-1,-1,-1 };
 
 					for (i = SC_SPHERE_1; i <= SC_SPHERE_5; i++) {
-						if (sc && sc->data[i]) {
+						if (sc && sc_data(sc, i)) {
 							spheres[j] = i;
-							positions[j] = sc->data[i]->val2;
-							sc->data[i]->val2--; //Prepares for next position
+							positions[j] = sc_data(sc, i)->val2;
+							sc_data(sc, i)->val2--; //Prepares for next position
 							j++;
 						}
 					}
@@ -4918,10 +4948,10 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 					if (skill_lv == 1)
 						j = 1; //Limit only to one ball
 					for (i = 0; i < j; i++) {
-						int skele = WL_RELEASE - 5 + sc->data[spheres[i]]->val1 - WLS_FIRE; //Convert Ball Element into Skill ATK for balls
+						int skele = WL_RELEASE - 5 + sc_data(sc, spheres[i])->val1 - WLS_FIRE; //Convert Ball Element into Skill ATK for balls
 
 						//WL_SUMMON_ATK_FIRE, WL_SUMMON_ATK_WIND, WL_SUMMON_ATK_WATER, WL_SUMMON_ATK_GROUND
-						skill_addtimerskill(src,tick + status_get_adelay(src) * i,bl->id,0,0,skele,sc->data[spheres[i]]->val3,BF_MAGIC,flag|SD_LEVEL);
+						skill_addtimerskill(src,tick + status_get_adelay(src) * i,bl->id,0,0,skele,sc_data(sc, spheres[i])->val3,BF_MAGIC,flag|SD_LEVEL);
 						status_change_end(src,(sc_type)spheres[i],INVALID_TIMER); //Eliminate ball
 					}
 					clif_skill_nodamage(src,bl,skill_id,0,1);
@@ -5064,8 +5094,8 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 			status_change_end(bl,SC_BEYONDOFWARCRY,INVALID_TIMER);
 			status_change_end(bl,SC_UNLIMITEDHUMMINGVOICE,INVALID_TIMER);
 			status_change_end(bl,SC_FRIGG_SONG,INVALID_TIMER);
-			if (tsc && tsc->data[SC_SATURDAYNIGHTFEVER]) {
-				tsc->data[SC_SATURDAYNIGHTFEVER]->val2 = 0;
+			if (tsc && sc_data(tsc, SC_SATURDAYNIGHTFEVER)) {
+				sc_data(tsc, SC_SATURDAYNIGHTFEVER)->val2 = 0;
 				status_change_end(bl,SC_SATURDAYNIGHTFEVER,INVALID_TIMER);
 			}
 			skill_attack(BF_WEAPON,src,src,bl,skill_id,skill_lv,tick,flag|SD_ANIMATION);
@@ -5094,7 +5124,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 						clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 					break;
 				}
-				if(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE)
+				if(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == SR_FALLENEMPIRE)
 					map_foreachinrange(skill_area_sub,bl,skill_get_splash(skill_id,skill_lv),splash_target(src),src,skill_id,skill_lv,tick,flag|BCT_ENEMY|SD_SPLASH|1|4,skill_castend_damage_id);
 				else
 					map_foreachinrange(skill_area_sub,bl,skill_get_splash(skill_id,skill_lv),splash_target(src),src,skill_id,skill_lv,tick,flag|BCT_ENEMY|SD_SPLASH|1,skill_castend_damage_id);
@@ -5109,13 +5139,13 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 			break;
 
 		case WM_SOUND_OF_DESTRUCTION:
-			if (tsc && (tsc->data[SC_SWINGDANCE] || tsc->data[SC_SYMPHONYOFLOVER] || tsc->data[SC_MOONLITSERENADE] ||
-				tsc->data[SC_RUSHWINDMILL] || tsc->data[SC_ECHOSONG] || tsc->data[SC_HARMONIZE] ||
-				tsc->data[SC_NETHERWORLD] || tsc->data[SC_VOICEOFSIREN] || tsc->data[SC_DEEPSLEEP] ||
-				tsc->data[SC_SIRCLEOFNATURE] || tsc->data[SC_GLOOMYDAY] || tsc->data[SC_GLOOMYDAY_SK] ||
-				tsc->data[SC_SONGOFMANA] || tsc->data[SC_DANCEWITHWUG] || tsc->data[SC_SATURDAYNIGHTFEVER] ||
-				tsc->data[SC_LERADSDEW] || tsc->data[SC_MELODYOFSINK] || tsc->data[SC_BEYONDOFWARCRY] ||
-				tsc->data[SC_UNLIMITEDHUMMINGVOICE] || tsc->data[SC_FRIGG_SONG]) &&
+			if (tsc && (sc_data(tsc, SC_SWINGDANCE) || sc_data(tsc, SC_SYMPHONYOFLOVER) || sc_data(tsc, SC_MOONLITSERENADE) ||
+				sc_data(tsc, SC_RUSHWINDMILL) || sc_data(tsc, SC_ECHOSONG) || sc_data(tsc, SC_HARMONIZE) ||
+				sc_data(tsc, SC_NETHERWORLD) || sc_data(tsc, SC_VOICEOFSIREN) || sc_data(tsc, SC_DEEPSLEEP) ||
+				sc_data(tsc, SC_SIRCLEOFNATURE) || sc_data(tsc, SC_GLOOMYDAY) || sc_data(tsc, SC_GLOOMYDAY_SK) ||
+				sc_data(tsc, SC_SONGOFMANA) || sc_data(tsc, SC_DANCEWITHWUG) || sc_data(tsc, SC_SATURDAYNIGHTFEVER) ||
+				sc_data(tsc, SC_LERADSDEW) || sc_data(tsc, SC_MELODYOFSINK) || sc_data(tsc, SC_BEYONDOFWARCRY) ||
+				sc_data(tsc, SC_UNLIMITEDHUMMINGVOICE) || sc_data(tsc, SC_FRIGG_SONG)) &&
 				rnd()%100 < 4 * skill_lv + 2 * (sd ? pc_checkskill(sd,WM_LESSON) : 1) + 10 * party_calc_chorusbonus(sd,0))
 			{
 				skill_attack(BF_MISC,src,src,bl,skill_id,skill_lv,tick,flag);
@@ -5139,8 +5169,8 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 				status_change_end(bl,SC_BEYONDOFWARCRY,INVALID_TIMER);
 				status_change_end(bl,SC_UNLIMITEDHUMMINGVOICE,INVALID_TIMER);
 				status_change_end(bl,SC_FRIGG_SONG,INVALID_TIMER);
-				if (tsc->data[SC_SATURDAYNIGHTFEVER]) {
-					tsc->data[SC_SATURDAYNIGHTFEVER]->val2 = 0;
+				if (sc_data(tsc, SC_SATURDAYNIGHTFEVER)) {
+					sc_data(tsc, SC_SATURDAYNIGHTFEVER)->val2 = 0;
 					status_change_end(bl,SC_SATURDAYNIGHTFEVER,INVALID_TIMER);
 				}
 			}
@@ -5152,7 +5182,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 				if  (flag&1) {
 					skill_attack(BF_MAGIC,src,src,bl,skill_id,skill_lv,tick,flag);
 				} else if (sd) {
-					if (tsc && tsc->data[SC_POISON]) {
+					if (tsc && sc_data(tsc, SC_POISON)) {
 						map_foreachinrange(skill_area_sub,bl,skill_get_splash(skill_id,skill_lv),splash_target(src),src,skill_id,skill_lv,tick,flag|BCT_ENEMY|SD_SPLASH|1,skill_castend_damage_id);
 						status_change_end(bl,SC_POISON,INVALID_TIMER);
 					} else
@@ -5184,12 +5214,12 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 					break;
 				}
 				//Triggered by RL_FLICKER
-				if (sd && sd->flicker && tsc && tsc->data[SC_H_MINE] && tsc->data[SC_H_MINE]->val2 == src->id) {
+				if (sd && sd->flicker && tsc && sc_data(tsc, SC_H_MINE) && sc_data(tsc, SC_H_MINE)->val2 == src->id) {
 					//Splash damage around it!
 					map_foreachinrange(skill_area_sub,bl,skill_get_splash(skill_id,skill_lv),splash_target(src),
 						src,skill_id,skill_lv,tick,flag|BCT_ENEMY|1,skill_castend_damage_id);
 					flag |= 1; //Don't consume requirement
-					tsc->data[SC_H_MINE]->val3 = 1; //Mark the SC end because not expired
+					sc_data(tsc, SC_H_MINE)->val3 = 1; //Mark the SC end because not expired
 					status_change_end(bl,SC_H_MINE,INVALID_TIMER);
 					sc_start4(src,bl,SC_BURNING,10 * skill_lv,skill_lv,1000,src->id,0,skill_get_time2(skill_id,skill_lv));
 				}
@@ -5201,7 +5231,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 
 		case RL_QD_SHOT:
 		case RL_D_TAIL:
-			if (!sd || (sd && tsc && tsc->data[SC_C_MARKER] && tsc->data[SC_C_MARKER]->val2 == src->id)) {
+			if (!sd || (sd && tsc && sc_data(tsc, SC_C_MARKER) && sc_data(tsc, SC_C_MARKER)->val2 == src->id)) {
 				int sflag = flag;
 
 				if (skill_id == RL_QD_SHOT && skill_area_temp[1] == bl->id)
@@ -5274,7 +5304,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 				type2 = (sc_type)(type - 1);
 				clif_skill_nodamage(src,battle_get_master(src),skill_id,skill_lv,1);
 				clif_skill_damage(src,bl,tick,status_get_amotion(src),0,-30000,1,skill_id,skill_lv,DMG_SKILL);
-				if ((sc && sc->data[type2]) || (tsc && tsc->data[type]))
+				if ((sc && sc_data(sc, type2)) || (tsc && sc_data(tsc, type)))
 					elemental_clean_single_effect(ele,skill_id);
 				if (rnd()%100 < 50)
 					skill_attack(skill_get_type(skill_id),src,src,bl,skill_id,skill_lv,tick,flag);
@@ -5344,7 +5374,7 @@ int skill_castend_damage_id(struct block_list *src, struct block_list *bl, uint1
 			return 1;
 	}
 
-	if (sc && sc->data[SC_CURSEDCIRCLE_ATKER]) //Should only remove after the skill has been casted
+	if (sc && sc_data(sc, SC_CURSEDCIRCLE_ATKER)) //Should only remove after the skill has been casted
 		status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 
 	if (sd && !(flag&1)) { //Ensure that the skill last-cast tick is recorded
@@ -5569,7 +5599,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 	type = status_skill2sc(skill_id);
 	tsc = status_get_sc(bl);
-	tsce = (tsc && type != -1) ? tsc->data[type] : NULL;
+	tsce = (tsc && type != -1) ? sc_data(tsc, type) : NULL;
 
 	if(bl->id != src->id && type > -1 && (i = skill_get_ele(skill_id,skill_lv)) > ELE_NEUTRAL &&
 		skill_get_inf(skill_id) != INF_SUPPORT_SKILL && battle_attr_fix(NULL,NULL,100,i,tstatus->def_ele,tstatus->ele_lv) <= 0)
@@ -5589,15 +5619,15 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 					heal = 0;
 
 				if(tsc && tsc->count) {
-					if(tsc->data[SC_KAITE] && !(sstatus->mode&MD_BOSS)) { //Bounce back heal
-						if(--tsc->data[SC_KAITE]->val2 <= 0)
+					if(sc_data(tsc, SC_KAITE) && !(sstatus->mode&MD_BOSS)) { //Bounce back heal
+						if(--sc_data(tsc, SC_KAITE)->val2 <= 0)
 							status_change_end(bl,SC_KAITE,INVALID_TIMER);
 						heal = 0; //When you try to heal under Kaite, the heal is voided
-					} else if( tsc->data[SC_BERSERK] || tsc->data[SC_SATURDAYNIGHTFEVER] )
+					} else if( sc_data(tsc, SC_BERSERK) || sc_data(tsc, SC_SATURDAYNIGHTFEVER) )
 						heal = 0; //Needed so that it actually displays 0 when healing
 				}
 
-				if(tsc && tsc->data[SC_AKAITSUKI] && heal && skill_id != HLIF_HEAL)
+				if(tsc && sc_data(tsc, SC_AKAITSUKI) && heal && skill_id != HLIF_HEAL)
 					heal = ~heal + 1;
 
 				clif_skill_nodamage(src,bl,skill_id,heal,1);
@@ -5651,7 +5681,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			{
 				int per = 0, sper = 0;
 
-				if(tsc && tsc->data[SC_HELLPOWER])
+				if(tsc && sc_data(tsc, SC_HELLPOWER))
 					break;
 				if(map[bl->m].flag.pvp && dstsd && dstsd->pvp_point < 0)
 					break;
@@ -5830,10 +5860,10 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 						SC_STRIPWEAPON,SC_STRIPSHIELD,SC_STRIPARMOR,SC_STRIPHELM,SC_BLADESTOP };
 	
 					for (i = SC_COMMON_MIN; i <= SC_COMMON_MAX; i++)
-						if (tsc->data[i])
+						if (sc_data(tsc, i))
 							status_change_end(bl,(sc_type)i,INVALID_TIMER);
 					for (i = 0; i < ARRAYLENGTH(scs); i++)
-						if (tsc->data[scs[i]])
+						if (sc_data(tsc, scs[i]))
 							status_change_end(bl,scs[i],INVALID_TIMER);
 				}
 			}
@@ -5887,12 +5917,12 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				}
 
 				if (sc && tsc) {
-					if (!sc->data[SC_MARIONETTE] && !tsc->data[SC_MARIONETTE2]) {
+					if (!sc_data(sc, SC_MARIONETTE) && !sc_data(tsc, SC_MARIONETTE2)) {
 						sc_start(src,src,SC_MARIONETTE,100,bl->id,skill_get_time(skill_id,skill_lv));
 						sc_start(src,bl,SC_MARIONETTE2,100,src->id,skill_get_time(skill_id,skill_lv));
 						clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
-					} else if (sc->data[SC_MARIONETTE ] &&  sc->data[SC_MARIONETTE ]->val1 == bl->id &&
-						tsc->data[SC_MARIONETTE2] && tsc->data[SC_MARIONETTE2]->val1 == src->id)
+					} else if (sc_data(sc, SC_MARIONETTE ) &&  sc_data(sc, SC_MARIONETTE )->val1 == bl->id &&
+						sc_data(tsc, SC_MARIONETTE2) && sc_data(tsc, SC_MARIONETTE2)->val1 == src->id)
 					{
 						status_change_end(src,SC_MARIONETTE,INVALID_TIMER);
 						status_change_end(bl,SC_MARIONETTE2,INVALID_TIMER);
@@ -5917,15 +5947,15 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 		case SA_SEISMICWEAPON:
 			if (dstsd) {
 				if (dstsd->status.weapon == W_FIST ||
-					(dstsd->sc.count && !dstsd->sc.data[type] &&
+					(dstsd->sc.count && !sc_data(&dstsd->sc, type) &&
 					( //Allow re-enchanting to lenghten time [Skotlex]
-						dstsd->sc.data[SC_FIREWEAPON] ||
-						dstsd->sc.data[SC_WATERWEAPON] ||
-						dstsd->sc.data[SC_WINDWEAPON] ||
-						dstsd->sc.data[SC_EARTHWEAPON] ||
-						dstsd->sc.data[SC_SHADOWWEAPON] ||
-						dstsd->sc.data[SC_GHOSTWEAPON] ||
-						dstsd->sc.data[SC_ENCPOISON]
+						sc_data(&dstsd->sc, SC_FIREWEAPON) ||
+						sc_data(&dstsd->sc, SC_WATERWEAPON) ||
+						sc_data(&dstsd->sc, SC_WINDWEAPON) ||
+						sc_data(&dstsd->sc, SC_EARTHWEAPON) ||
+						sc_data(&dstsd->sc, SC_SHADOWWEAPON) ||
+						sc_data(&dstsd->sc, SC_GHOSTWEAPON) ||
+						sc_data(&dstsd->sc, SC_ENCPOISON)
 					)
 					))
 				{
@@ -6011,7 +6041,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 		case AL_BLESSING:
 		case MER_INCAGI:
 		case MER_BLESSING:
-			if( dstsd != NULL && tsc->data[SC_CHANGEUNDEAD] ) {
+			if( dstsd != NULL && sc_data(tsc, SC_CHANGEUNDEAD) ) {
 				skill_attack(BF_MISC,src,src,bl,skill_id,skill_lv,tick,flag);
 				break;
 			}
@@ -6189,13 +6219,13 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 		case AS_ENCHANTPOISON: //Prevent spamming [Valaris]
 			if (sd && dstsd && dstsd->sc.count) {
-				if (dstsd->sc.data[SC_FIREWEAPON] ||
-					dstsd->sc.data[SC_WATERWEAPON] ||
-					dstsd->sc.data[SC_WINDWEAPON] ||
-					dstsd->sc.data[SC_EARTHWEAPON] ||
-					dstsd->sc.data[SC_SHADOWWEAPON] ||
-					dstsd->sc.data[SC_GHOSTWEAPON]
-					//dstsd->sc.data[SC_ENCPOISON] //People say you should be able to recast to lengthen the timer [Skotlex]
+				if (sc_data(&dstsd->sc, SC_FIREWEAPON) ||
+					sc_data(&dstsd->sc, SC_WATERWEAPON) ||
+					sc_data(&dstsd->sc, SC_WINDWEAPON) ||
+					sc_data(&dstsd->sc, SC_EARTHWEAPON) ||
+					sc_data(&dstsd->sc, SC_SHADOWWEAPON) ||
+					sc_data(&dstsd->sc, SC_GHOSTWEAPON)
+					//sc_data(&dstsd->sc, SC_ENCPOISON) //People say you should be able to recast to lengthen the timer [Skotlex]
 				) {
 						clif_skill_nodamage(src,bl,skill_id,skill_lv,0);
 						clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
@@ -6264,7 +6294,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			unit_skillcastcancel(bl,2);
 			if (tsc && tsc->count) {
 				status_change_end(bl,SC_FREEZE,INVALID_TIMER);
-				if (tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)
+				if (sc_data(tsc, SC_STONE) && tsc->opt1 == OPT1_STONE)
 					status_change_end(bl,SC_STONE,INVALID_TIMER);
 				status_change_end(bl,SC_SLEEP,INVALID_TIMER);
 				status_change_end(bl,SC_TRICKDEAD,INVALID_TIMER);
@@ -6288,10 +6318,10 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				if ((lv = status_get_lv(src) - dstsd->status.base_level) < 0)
 					lv = -lv;
 				if (lv > battle_config.devotion_level_difference || //Level difference requeriments
-					(dstsd->sc.data[type] && dstsd->sc.data[type]->val1 != src->id) || //Cannot Devote a player devoted from another source
+					(sc_data(&dstsd->sc, type) && sc_data(&dstsd->sc, type)->val1 != src->id) || //Cannot Devote a player devoted from another source
 					(skill_id == ML_DEVOTION && (!mer || mer != dstsd->md)) || //Mercenary only can devote owner
 					(dstsd->class_&MAPID_UPPERMASK) == MAPID_CRUSADER || //Crusader Cannot be devoted
-					(dstsd->sc.data[SC_HELLPOWER])) //Players affected by SC_HELLPOWERR cannot be devoted.
+					(sc_data(&dstsd->sc, SC_HELLPOWER))) //Players affected by SC_HELLPOWERR cannot be devoted.
 				{
 					if (sd)
 						clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
@@ -6322,8 +6352,8 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			if (sd) {
 				int limit = skill_lv;
 
-				if (sd->sc.data[SC_RAISINGDRAGON])
-					limit += sd->sc.data[SC_RAISINGDRAGON]->val1;
+				if (sc_data(&sd->sc, SC_RAISINGDRAGON))
+					limit += sc_data(&sd->sc, SC_RAISINGDRAGON)->val1;
 				clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 				pc_addspiritball(sd,skill_get_time(skill_id,skill_lv),limit);
 			}
@@ -6333,8 +6363,8 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			if (sd) {
 				int limit = 5;
 
-				if (sd->sc.data[SC_RAISINGDRAGON])
-					limit += sd->sc.data[SC_RAISINGDRAGON]->val1;
+				if (sc_data(&sd->sc, SC_RAISINGDRAGON))
+					limit += sc_data(&sd->sc, SC_RAISINGDRAGON)->val1;
 				clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 				for (i = 0; i < limit; i++)
 					pc_addspiritball(sd,skill_get_time(skill_id,skill_lv),limit);
@@ -6589,7 +6619,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 		case SL_KAUPE:
 			if (sd) {
 				if (!dstsd ||
-					!((sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SOULLINKER) ||
+					!((sc_data(&sd->sc, SC_SPIRIT) && sc_data(&sd->sc, SC_SPIRIT)->val2 == SL_SOULLINKER) ||
 					(dstsd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER ||
 					dstsd->status.char_id == sd->status.char_id ||
 					dstsd->status.char_id == sd->status.partner_id ||
@@ -6666,7 +6696,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			break;
 
 		case BD_ADAPTATION:
-			if (tsc && tsc->data[SC_DANCING]) {
+			if (tsc && sc_data(tsc, SC_DANCING)) {
 				clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 				status_change_end(bl,SC_DANCING,INVALID_TIMER);
 			}
@@ -6737,9 +6767,9 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				}
 				if (status_isimmune(bl) || !tsc)
 					break;
-				if (sd && sd->sc.data[SC_PETROLOGY_OPTION])
-					brate = sd->sc.data[SC_PETROLOGY_OPTION]->val3;
-				if (tsc->data[SC_STONE]) {
+				if (sd && sc_data(&sd->sc, SC_PETROLOGY_OPTION))
+					brate = sc_data(&sd->sc, SC_PETROLOGY_OPTION)->val3;
+				if (sc_data(tsc, SC_STONE)) {
 					status_change_end(bl,SC_STONE,INVALID_TIMER);
 					if (sd)
 						clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
@@ -7028,8 +7058,8 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				}
 
 				//Special message when trying to use Full Strip on FCP [Jobbie]
-				if(sd && skill_id == ST_FULLSTRIP && tsc && tsc->data[SC_CP_WEAPON] && tsc->data[SC_CP_HELM] &&
-					tsc->data[SC_CP_ARMOR] && tsc->data[SC_CP_SHIELD]) {
+				if(sd && skill_id == ST_FULLSTRIP && tsc && sc_data(tsc, SC_CP_WEAPON) && sc_data(tsc, SC_CP_HELM) &&
+					sc_data(tsc, SC_CP_ARMOR) && sc_data(tsc, SC_CP_SHIELD)) {
 					clif_gospel_info(sd,0x28);
 					break;
 				}
@@ -7080,7 +7110,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 					potion_target = bl->id;
 					run_script(sd->inventory_data[i]->script,0,sd->bl.id,0);
 					potion_flag = potion_target = 0;
-					if( sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_ALCHEMIST )
+					if( sc_data(&sd->sc, SC_SPIRIT) && sc_data(&sd->sc, SC_SPIRIT)->val2 == SL_ALCHEMIST )
 						bonus += sd->status.base_level;
 					if( potion_per_hp > 0 || potion_per_sp > 0 ) {
 						hp = tstatus->max_hp * potion_per_hp / 100;
@@ -7133,15 +7163,15 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				if( tsc && tsc->count ) {
 					uint8 penalty = 0;
 
-					if( tsc->data[SC_CRITICALWOUND] )
-						penalty += tsc->data[SC_CRITICALWOUND]->val2;
-					if( tsc->data[SC_DEATHHURT] )
+					if( sc_data(tsc, SC_CRITICALWOUND) )
+						penalty += sc_data(tsc, SC_CRITICALWOUND)->val2;
+					if( sc_data(tsc, SC_DEATHHURT) )
 						penalty += 20;
 					if( penalty > 0 ) {
 						hp -= hp * penalty / 100;
 						sp -= sp * penalty / 100;
 					}
-					if( tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2 ) {
+					if( sc_data(tsc, SC_WATER_INSIGNIA) && sc_data(tsc, SC_WATER_INSIGNIA)->val1 == 2 ) {
 						hp += hp / 10;
 						sp += sp / 10;
 					}
@@ -7152,7 +7182,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				if( sp > 0 )
 					clif_skill_nodamage(NULL,bl,MG_SRECOVERY,sp,1);
 #ifdef RENEWAL
-				if( tsc && tsc->data[SC_EXTREMITYFIST2] )
+				if( tsc && sc_data(tsc, SC_EXTREMITYFIST2) )
 					sp = 0;
 #endif
 				status_heal(bl,hp,sp,0);
@@ -7221,7 +7251,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 						break;
 					clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 					if( (dstsd && (dstsd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER) || //Soul Linkers are naturally immune
-						(tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_ROGUE) || //Rogue's spirit defends against dispel
+						(tsc && sc_data(tsc, SC_SPIRIT) && sc_data(tsc, SC_SPIRIT)->val2 == SL_ROGUE) || //Rogue's spirit defends against dispel
 						(tsc && (tsc->option&OPTION_MADOGEAR)) || //Mado Gear is immune to dispell according to bugreport:49 [Ind]
 						rnd()%100 >= 50 + 10 * skill_lv )
 					{
@@ -7235,8 +7265,9 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 						pc_bonus_script_clear(dstsd,BSF_REM_ON_DISPELL);
 					if( !tsc || !tsc->count )
 						break;
+					status_calc_defer_begin();
 					for( i = 0; i < SC_MAX; i++ ) {
-						if( !tsc->data[i] )
+						if( !sc_data(tsc, i) )
 							continue;
 						switch( i ) {
 							case SC_WEIGHT50:		case SC_WEIGHT90:		case SC_HALLUCINATION:
@@ -7371,7 +7402,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 							case SC_MTF_CRIDAMAGE:		case SC_MTF_PUMPKIN:
 								continue;
 							case SC_SILENCE:
-								if( tsc->data[i]->val4 )
+								if( sc_data(tsc, i)->val4 )
 									continue; //Silence from Silent Breeze can't be dispeled
 								break;
 							//bugreport:4888 these songs may only be dispelled if you're not in their song area anymore
@@ -7383,7 +7414,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 							case SC_DONTFORGETME:
 							case SC_FORTUNE:
 							case SC_SERVICE4U:
-								if( !tsc->data[i]->val4 )
+								if( !sc_data(tsc, i)->val4 )
 									continue; //If in song-area don't end it
 								break;
 							case SC_ASSUMPTIO:
@@ -7393,9 +7424,10 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 						}
 						//Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0
 						if( i == SC_BERSERK || i == SC_SATURDAYNIGHTFEVER )
-							tsc->data[i]->val2 = 0;
+							sc_data(tsc, i)->val2 = 0;
 						status_change_end(bl,(sc_type)i,INVALID_TIMER);
 					}
+					status_calc_defer_end();
 					break;
 				} //Affect all targets on splash area
 				map_foreachinrange(skill_area_sub,bl,splash,BL_CHAR,src,skill_id,skill_lv,tick,flag|1,skill_castend_damage_id);
@@ -7448,9 +7480,9 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 		case SA_SPELLBREAKER: {
 				int sp;
 
-				if(tsc && tsc->data[SC_MAGICROD]) {
+				if(tsc && sc_data(tsc, SC_MAGICROD)) {
 					sp = skill_get_sp(skill_id,skill_lv);
-					sp = sp * tsc->data[SC_MAGICROD]->val2 / 100;
+					sp = sp * sc_data(tsc, SC_MAGICROD)->val2 / 100;
 					if(sp < 1)
 						sp = 1;
 					status_heal(bl,0,sp,2);
@@ -7506,7 +7538,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 				if(skill_lv >= 10) {
 					spellid = MG_FROSTDIVER;
-					//if (tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SA_SAGE)
+					//if (tsc && sc_data(tsc, SC_SPIRIT) && sc_data(tsc, SC_SPIRIT)->val2 == SA_SAGE)
 						//maxlv = 10;
 					//else
 						maxlv = skill_lv - 9;
@@ -7858,6 +7890,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 							clif_changetraplook(bl,UNT_USED_TRAPS);
 							su->group->limit = DIFF_TICK(tick + 1500,su->group->tick);
 							su->limit = DIFF_TICK(tick + 1500,su->group->tick);
+							skill_unit_group_wake(su->group);
 							break;
 					}
 				}
@@ -7908,7 +7941,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				unit_skillcastcancel(bl,0);
 				if (tsc && tsc->count) {
 					status_change_end(bl,SC_FREEZE,INVALID_TIMER);
-					if (tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)
+					if (sc_data(tsc, SC_STONE) && tsc->opt1 == OPT1_STONE)
 						status_change_end(bl,SC_STONE,INVALID_TIMER);
 					status_change_end(bl,SC_SLEEP,INVALID_TIMER);
 				}
@@ -7937,7 +7970,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 #ifdef RENEWAL
 				sp1 = sp1 / 2;
 				sp2 = sp2 / 2;
-				if (tsc && tsc->data[SC_EXTREMITYFIST2])
+				if (tsc && sc_data(tsc, SC_EXTREMITYFIST2))
 					sp1 = tstatus->sp;
 #endif
 				status_set_sp(src,sp2,3);
@@ -7964,15 +7997,15 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				if (tsc && tsc->count) {
 					uint8 penalty = 0;
 
-					if( tsc->data[SC_CRITICALWOUND] )
-						penalty += tsc->data[SC_CRITICALWOUND]->val2;
-					if( tsc->data[SC_DEATHHURT] )
+					if( sc_data(tsc, SC_CRITICALWOUND) )
+						penalty += sc_data(tsc, SC_CRITICALWOUND)->val2;
+					if( sc_data(tsc, SC_DEATHHURT) )
 						penalty += 20;
 					if( penalty > 0 ) {
 						hp -= hp * penalty / 100;
 						sp -= sp * penalty / 100;
 					}
-					if (tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2) {
+					if (sc_data(tsc, SC_WATER_INSIGNIA) && sc_data(tsc, SC_WATER_INSIGNIA)->val1 == 2) {
 						hp += hp / 10;
 						sp += sp / 10;
 					}
@@ -8009,14 +8042,14 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			break;
 
 		case CG_LONGINGFREEDOM: //Can't use Longing for Freedom while under Sheltering Bliss [Skotlex]
-			if (tsc && !tsce && (tsce = tsc->data[SC_DANCING]) && tsce->val4 && (tsce->val1&0xFFFF) != CG_MOONLIT)
+			if (tsc && !tsce && (tsce = sc_data(tsc, SC_DANCING)) && tsce->val4 && (tsce->val1&0xFFFF) != CG_MOONLIT)
 				clif_skill_nodamage(src,bl,skill_id,skill_lv,sc_start(src,bl,type,100,skill_lv,skill_get_time(skill_id,skill_lv)));
 			break;
 
 		case CG_TAROTCARD: {
 				int count = -1;
 
-				if (rnd()%100 > skill_lv * 8 || (tsc && tsc->data[SC_BASILICA]) ||
+				if (rnd()%100 > skill_lv * 8 || (tsc && sc_data(tsc, SC_BASILICA)) ||
 					(dstmd && ((dstmd->guardian_data && dstmd->mob_id == MOBID_EMPERIUM) || mob_is_battleground(dstmd)))) {
 					if (sd)
 						clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
@@ -8571,17 +8604,17 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			} else if( sd ) {
 				skill_area_temp[5] = 0;
 				if( tsc && tsc->count ) {
-					if( tsc->data[SC_MILLENNIUMSHIELD] )
+					if( sc_data(tsc, SC_MILLENNIUMSHIELD) )
 						skill_area_temp[5] = 0x10;
-					else if( tsc->data[SC_REFRESH] )
+					else if( sc_data(tsc, SC_REFRESH) )
 						skill_area_temp[5] = 0x20;
-					else if( tsc->data[SC_GIANTGROWTH] )
+					else if( sc_data(tsc, SC_GIANTGROWTH) )
 						skill_area_temp[5] = 0x40;
-					else if( tsc->data[SC_STONEHARDSKIN] )
+					else if( sc_data(tsc, SC_STONEHARDSKIN) )
 						skill_area_temp[5] = 0x80;
-					else if( tsc->data[SC_VITALITYACTIVATION] )
+					else if( sc_data(tsc, SC_VITALITYACTIVATION) )
 						skill_area_temp[5] = 0x100;
-					else if( tsc->data[SC_ABUNDANCE] )
+					else if( sc_data(tsc, SC_ABUNDANCE) )
 						skill_area_temp[5] = 0x200;
 				}
 				clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
@@ -8594,9 +8627,9 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 				skill_area_temp[2] = 0;
 				map_foreachinrange(skill_area_sub,src,skill_get_splash(skill_id,skill_lv),BL_CHAR,src,skill_id,skill_lv,tick,flag|BCT_ENEMY|SD_PREAMBLE|SD_SPLASH|1,skill_castend_damage_id);
-				if( tsc && tsc->data[SC_ROLLINGCUTTER] ) {
+				if( tsc && sc_data(tsc, SC_ROLLINGCUTTER) ) {
 					//Every time the skill is casted the status change is reseted adding a counter
-					count += (short)tsc->data[SC_ROLLINGCUTTER]->val1;
+					count += (short)sc_data(tsc, SC_ROLLINGCUTTER)->val1;
 					if( count > 10 )
 						count = 10; //Max coounter
 					status_change_end(bl,SC_ROLLINGCUTTER,INVALID_TIMER);
@@ -8607,7 +8640,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			break;
 
 		case GC_WEAPONBLOCKING:
-			if( tsc && tsc->data[SC_WEAPONBLOCKING] )
+			if( tsc && sc_data(tsc, SC_WEAPONBLOCKING) )
 				status_change_end(bl,SC_WEAPONBLOCKING,INVALID_TIMER);
 			else
 				sc_start(src,bl,SC_WEAPONBLOCKING,100,skill_lv,skill_get_time(skill_id,skill_lv));
@@ -8699,7 +8732,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 		case AB_CHEAL:
 			if( sd == NULL || !sd->status.party_id || flag&1 ) {
 				if( sd && !battle_check_undead(tstatus->race,tstatus->def_ele) &&
-					!(tsc && (tsc->data[SC_BERSERK] || tsc->data[SC_SATURDAYNIGHTFEVER])) ) {
+					!(tsc && (sc_data(tsc, SC_BERSERK) || sc_data(tsc, SC_SATURDAYNIGHTFEVER))) ) {
 					i = skill_calc_heal(src,bl,AL_HEAL,pc_checkskill(sd,AL_HEAL),true);
 					if( partybonus )
 						i += i / 100 * partybonus * 10 / 4;
@@ -8707,7 +8740,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 						i = 0;
 					if( dstsd && pc_ismadogear(dstsd) )
 						break;
-					if( tsc && tsc->data[SC_AKAITSUKI] && i )
+					if( tsc && sc_data(tsc, SC_AKAITSUKI) && i )
 						i = ~i + 1;
 					clif_skill_nodamage(src,bl,skill_id,i,1);
 					status_heal(bl,i,0,0);
@@ -8729,8 +8762,8 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 		case AB_LAUDAAGNUS:
 			if( sd == NULL || !sd->status.party_id || flag&1 ) {
-				if( tsc && (tsc->data[SC_FREEZE] || tsc->data[SC_STONE] || tsc->data[SC_BLIND] ||
-					tsc->data[SC_BURNING] || tsc->data[SC_FREEZING] || tsc->data[SC_CRYSTALIZE])) {
+				if( tsc && (sc_data(tsc, SC_FREEZE) || sc_data(tsc, SC_STONE) || sc_data(tsc, SC_BLIND) ||
+					sc_data(tsc, SC_BURNING) || sc_data(tsc, SC_FREEZING) || sc_data(tsc, SC_CRYSTALIZE))) {
 					//Success Chance: (40 + 10 * Skill Level)%
 					if( rnd()%100 > 40 + 10 * skill_lv )
 						break;
@@ -8749,8 +8782,8 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 		case AB_LAUDARAMUS:
 			if( sd == NULL || !sd->status.party_id || flag&1 ) {
-				if( tsc && (tsc->data[SC_SLEEP] || tsc->data[SC_STUN] ||
-					tsc->data[SC_MANDRAGORA] || tsc->data[SC_SILENCE] || tsc->data[SC_DEEPSLEEP]) ) {
+				if( tsc && (sc_data(tsc, SC_SLEEP) || sc_data(tsc, SC_STUN) ||
+					sc_data(tsc, SC_MANDRAGORA) || sc_data(tsc, SC_SILENCE) || sc_data(tsc, SC_DEEPSLEEP)) ) {
 					if( rnd()%100 > 40 + 10 * skill_lv )
 						break;
 					status_change_end(bl,SC_SLEEP,INVALID_TIMER);
@@ -8794,8 +8827,9 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 						pc_bonus_script_clear(dstsd,BSF_REM_ON_CLEARANCE);
 					if( !tsc || !tsc->count )
 						break;
+					status_calc_defer_begin();
 					for( i = 0; i < SC_MAX; i++ ) {
-						if( !tsc->data[i] )
+						if( !sc_data(tsc, i) )
 							continue;
 						switch( i ) {
 							case SC_WEIGHT50:		case SC_WEIGHT90:		case SC_HALLUCINATION:
@@ -8923,7 +8957,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 							case SC_MTF_CRIDAMAGE:		case SC_MTF_PUMPKIN:
 								continue;
 							case SC_SILENCE:
-								if( tsc->data[i]->val4 )
+								if( sc_data(tsc, i)->val4 )
 									continue; //Silence from Silent Breeze can't be dispeled
 								break;
 							//bugreport:4888 these songs may only be dispelled if you're not in their song area anymore
@@ -8935,7 +8969,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 							case SC_DONTFORGETME:
 							case SC_FORTUNE:
 							case SC_SERVICE4U:
-								if( !tsc->data[i]->val4 )
+								if( !sc_data(tsc, i)->val4 )
 									continue; //If in song-area don't end it
 								break;
 							case SC_ASSUMPTIO:
@@ -8944,9 +8978,10 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 								break;
 						}
 						if( i == SC_BERSERK || i == SC_SATURDAYNIGHTFEVER )
-							tsc->data[i]->val2 = 0;
+							sc_data(tsc, i)->val2 = 0;
 						status_change_end(bl,(sc_type)i,INVALID_TIMER);
 					}
+					status_calc_defer_end();
 					break;
 				}
 				map_foreachinrange(skill_area_sub,bl,splash,BL_CHAR,src,skill_id,skill_lv,tick,flag|1,skill_castend_damage_id);
@@ -8964,7 +8999,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			if( !tsc || !tsc->count )
 				break;
 			for( i = 0; i < SC_MAX; i++) {
-				if( !tsc->data[i] )
+				if( !sc_data(tsc, i) )
 					continue;
 				switch( i ) {
 					case SC_BLIND:		case SC_CURSE:
@@ -9008,7 +9043,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			if( flag&1 ) {
 				if( bl->id == skill_area_temp[1] )
 					break; //Already work on this target
-				if( tsc->data[SC_STONE] )
+				if( sc_data(tsc, SC_STONE) )
 					status_change_end(bl,SC_STONE,INVALID_TIMER);
 				else
 					status_change_start(src,bl,SC_STONE,10000,skill_lv,0,0,1000,skill_get_time(skill_id,skill_lv),SCFLAG_FIXEDTICK);
@@ -9016,7 +9051,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				int rate = 45 + 5 * skill_lv + (sd ? sd->status.job_level / 4 : 0);
 
 				if( rnd()%100 < rate ) { //Success on first target
-					if( !tsc->data[SC_STONE] )
+					if( !sc_data(tsc, SC_STONE) )
 						rate = status_change_start(src,bl,SC_STONE,10000,skill_lv,0,0,1000,skill_get_time(skill_id,skill_lv),SCFLAG_FIXEDTICK);
 					else {
 						rate = 1;
@@ -9055,10 +9090,10 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 					break;
 
 				for( i = SC_SPHERE_1; i <= SC_SPHERE_5; i++ ) {
-					if( !sctype && !sc->data[i] )
+					if( !sctype && !sc_data(sc, i) )
 						sctype = i; //Take the free SC
-					if( sc->data[i] )
-						pos = max(sc->data[i]->val2,pos);
+					if( sc_data(sc, i) )
+						pos = max(sc_data(sc, i)->val2,pos);
 				}
 
 				if( !sctype ) {
@@ -9085,7 +9120,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				struct status_change *sc = status_get_sc(bl);
 
 				for( i = SC_SPELLBOOK1; i <= SC_MAXSPELLBOOK; i++ )
-					if( !(sc && sc->data[i]) )
+					if( !(sc && sc_data(sc, i)) )
 						break;
 				if( i == SC_MAXSPELLBOOK ) {
 					clif_skill_fail(sd,WL_READING_SB,USESKILL_FAIL_SPELLBOOK_READING,0,0);
@@ -9232,7 +9267,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 		case SC_BODYPAINT:
 			if( flag&1 ) {
-				if( tsc && (tsc->data[SC_HIDING] || tsc->data[SC_CLOAKING] || tsc->data[SC_CLOAKINGEXCEED]) ) {
+				if( tsc && (sc_data(tsc, SC_HIDING) || sc_data(tsc, SC_CLOAKING) || sc_data(tsc, SC_CLOAKINGEXCEED)) ) {
 					status_change_end(bl,SC_HIDING,INVALID_TIMER);
 					status_change_end(bl,SC_CLOAKING,INVALID_TIMER);
 					status_change_end(bl,SC_CLOAKINGEXCEED,INVALID_TIMER);
@@ -9271,7 +9306,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				}
 				if( tsc ) {
 					//If the target was successfully inflected with the Ignorance status, drain some of the targets SP
-					if( tsc->data[SC__IGNORANCE] && skill_id == SC_IGNORANCE ) {
+					if( sc_data(tsc, SC__IGNORANCE) && skill_id == SC_IGNORANCE ) {
 							int sp = 100 * skill_lv;
 
 							if( dstmd )
@@ -9282,7 +9317,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 					}
 					//If the target was successfully inflected with the Unlucky status, give 1 of 3 random status's
 					//Targets in the Unlucky status will be affected by one of the 3 random status's reguardless of resistance
-					if( tsc->data[SC__UNLUCKY] && skill_id == SC_UNLUCKY ) {
+					if( sc_data(tsc, SC__UNLUCKY) && skill_id == SC_UNLUCKY ) {
 						switch( rnd()%3 ) {
 							case 0:
 								status_change_start(src,bl,SC_POISON,10000,skill_lv,0,0,0,skill_get_time(skill_id,skill_lv),SCFLAG_FIXEDTICK|SCFLAG_FIXEDRATE);
@@ -9305,7 +9340,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 			break;
 
 		case LG_REFLECTDAMAGE:
-			if( tsc && tsc->data[type] )
+			if( tsc && sc_data(tsc, type) )
 				status_change_end(bl,type,INVALID_TIMER);
 			else
 				sc_start(src,bl,type,100,skill_lv,skill_get_time(skill_id,skill_lv));
@@ -9974,7 +10009,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 				struct status_change *sc = status_get_sc(src);
 
 				if( sc && sc->bs_counter < skill_get_maxcount(skill_id,skill_lv) ) {
-					if( tsc && tsc->data[type] ) {
+					if( tsc && sc_data(tsc, type) ) {
 						sc->bs_counter--;
 						status_change_end(src,type,INVALID_TIMER); //The first one cancels and the last one will take effect resetting the timer
 					}
@@ -10164,7 +10199,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 					sc_type type2 = (sc_type)(type - 1);
 
 					clif_skill_nodamage(src,src,skill_id,skill_lv,1);
-					if( (sc && sc->data[type2]) || (tsc && tsc->data[type]) )
+					if( (sc && sc_data(sc, type2)) || (tsc && sc_data(tsc, type)) )
 						elemental_clean_single_effect(ele,skill_id);
 					else {
 						clif_skill_damage(src,(skill_id == EL_GUST || skill_id == EL_BLAST || skill_id == EL_WILD_STORM) ? src : bl,tick,status_get_amotion(src),0,-30000,1,skill_id,skill_lv,DMG_SKILL);
@@ -10194,7 +10229,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 					sc_type type2 = (sc_type)(type - 1);
 
 					clif_skill_nodamage(src,src,skill_id,skill_lv,1);
-					if( (sc && sc->data[type2]) || (tsc && tsc->data[type]) )
+					if( (sc && sc_data(sc, type2)) || (tsc && sc_data(tsc, type)) )
 						elemental_clean_single_effect(ele,skill_id);
 					else { //This not heals at the end
 						clif_skill_damage(src,src,tick,status_get_amotion(src),0,-30000,1,skill_id,skill_lv,DMG_SKILL);
@@ -10243,7 +10278,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_SIEGE,0,0);
 					break;
 				}
-				if( dstsd && !(tsc && tsc->data[type]) && rnd()%100 < rate )
+				if( dstsd && !(tsc && sc_data(tsc, type)) && rnd()%100 < rate )
 					clif_skill_nodamage(src,bl,skill_id,skill_lv,sc_start(src,bl,type,100,skill_lv,skill_get_time(skill_id,skill_lv)));
 				else if( sd )
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
@@ -10253,7 +10288,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 		case KO_JYUSATSU: {
 				int rate = max(5,(45 + (10 * skill_lv) - (status_get_int(bl) / 2)));
 
-				if( dstsd && !(tsc && tsc->data[type]) && rnd()%100 < rate ) {
+				if( dstsd && !(tsc && sc_data(tsc, type)) && rnd()%100 < rate ) {
 					clif_skill_nodamage(src,bl,skill_id,skill_lv,
 						status_change_start(src,bl,type,10000,skill_lv,0,0,0,skill_get_time(skill_id,skill_lv),SCFLAG_NOAVOID));
 					status_zap(bl,tstatus->max_hp * skill_lv * 5 / 100,0);
@@ -10319,8 +10354,8 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 		case KG_KAGEHUMI:
 			if( flag&1 ) {
-				if( tsc && ((tsc->option&(OPTION_HIDE|OPTION_CLOAK)) || tsc->data[SC_CAMOUFLAGE] ||
-					tsc->data[SC__SHADOWFORM]) )
+				if( tsc && ((tsc->option&(OPTION_HIDE|OPTION_CLOAK)) || sc_data(tsc, SC_CAMOUFLAGE) ||
+					sc_data(tsc, SC__SHADOWFORM)) )
 				{
 						sc_start(src,src,type,100,skill_lv,skill_get_time(skill_id,skill_lv));
 						sc_start(src,bl,type,100,skill_lv,skill_get_time(skill_id,skill_lv));
@@ -10371,7 +10406,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 					};
 
 					for( i = 0; i < ARRAYLENGTH(scs); i++ )
-						if( tsc->data[scs[i]] )
+						if( sc_data(tsc, scs[i]) )
 							status_change_end(bl,scs[i],INVALID_TIMER);
 				}
 				heal = 5 * status_get_lv(&hd->bl) +
@@ -10404,14 +10439,14 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 
 		case MH_STYLE_CHANGE:
 			if( hd ) {
-				struct status_change_entry *sce = hd->sc.data[SC_STYLE_CHANGE];
+				struct status_change_entry *sce = sc_data(&hd->sc, SC_STYLE_CHANGE);
 
 				if( sce ) { //In preparation for other bl usage
 					if( sce->val1 == MH_MD_FIGHTING )
 						sce->val1 = MH_MD_GRAPPLING;
 					else
 						sce->val1 = MH_MD_FIGHTING;
-					if( hd->master && hd->sc.data[SC_STYLE_CHANGE] ) {
+					if( hd->master && sc_data(&hd->sc, SC_STYLE_CHANGE) ) {
 						char output[128];
 
 						safesnprintf(output,sizeof(output),msg_txt(378),(sce->val1 == MH_MD_FIGHTING ? "fighthing" : "grappling"));
@@ -10495,8 +10530,9 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 						pc_bonus_script_clear(dstsd,BSF_REM_ON_BANISHING_BUSTER);
 					if( !tsc || !tsc->count )
 						break;
+					status_calc_defer_begin();
 					for( i = 0; i < SC_MAX && n > 0; i++ ) {
-						if( !tsc->data[i] )
+						if( !sc_data(tsc, i) )
 							continue;
 						switch( i ) {
 							case SC_WEIGHT50:		case SC_WEIGHT90:		case SC_HALLUCINATION:
@@ -10631,7 +10667,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 							case SC_MTF_CRIDAMAGE:		case SC_MTF_PUMPKIN:
 								continue;
 							case SC_SILENCE:
-								if( tsc->data[i]->val4 )
+								if( sc_data(tsc, i)->val4 )
 									continue; //Silence from Silent Breeze can't be dispeled
 								break;
 							//bugreport:4888 these songs may only be dispelled if you're not in their song area anymore
@@ -10643,7 +10679,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 							case SC_DONTFORGETME:
 							case SC_FORTUNE:
 							case SC_SERVICE4U:
-								if( !tsc->data[i]->val4 )
+								if( !sc_data(tsc, i)->val4 )
 									continue; //If in song-area don't end it
 								break;
 							case SC_ASSUMPTIO:
@@ -10652,10 +10688,11 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 								break;
 						}
 						if( i == SC_BERSERK || i == SC_SATURDAYNIGHTFEVER )
-							tsc->data[i]->val2 = 0;
+							sc_data(tsc, i)->val2 = 0;
 						status_change_end(bl,(sc_type)i,INVALID_TIMER);
 						n--;
 					}
+					status_calc_defer_end();
 				} else {
 					map_foreachinrange(skill_area_sub,bl,skill_get_splash(skill_id,skill_lv),BL_CHAR,src,skill_id,skill_lv,tick,flag|BCT_ENEMY|1,skill_castend_nodamage_id);
 					clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
@@ -10753,7 +10790,7 @@ int skill_castend_nodamage_id(struct block_list *src, struct block_list *bl, uin
 	if( skill_id != SR_CURSEDCIRCLE ) {
 		struct status_change *sc = status_get_sc(src);
 
-		if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] )
+		if( sc && sc_data(sc, SC_CURSEDCIRCLE_ATKER) )
 			status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 	}
 
@@ -10897,7 +10934,7 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 
 		if( ud->skill_id == PR_LEXDIVINA || ud->skill_id == MER_LEXDIVINA ) {
 			//If it's not an enemy, and not silenced, you can't use the skill on them [Skotlex]
-			if( battle_check_target(src,target,BCT_ENEMY) <= 0 && !((sc = status_get_sc(target)) && sc->data[SC_SILENCE]) ) {
+			if( battle_check_target(src,target,BCT_ENEMY) <= 0 && !((sc = status_get_sc(target)) && sc_data(sc, SC_SILENCE)) ) {
 				clif_skill_nodamage(src,target,ud->skill_id,ud->skill_lv,0);
 				break;
 			}
@@ -10937,7 +10974,7 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 			}
 
 			//Fogwall makes all offensive-type targetted skills fail at 75%, and
-			if( (inf&BCT_ENEMY) && (sc = status_get_sc(target)) && (sc->data[SC_FOGWALL] && rnd()%100 < 75) ) {
+			if( (inf&BCT_ENEMY) && (sc = status_get_sc(target)) && (sc_data(sc, SC_FOGWALL) && rnd()%100 < 75) ) {
 				if( sd )
 					clif_skill_fail(sd,ud->skill_id,USESKILL_FAIL_LEVEL,0,0);
 				break;
@@ -11014,8 +11051,8 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 					break;
 				case CR_GRANDCROSS:
 				case NPC_GRANDDARKNESS:
-					if( (sc = status_get_sc(src)) && sc->data[SC_STRIPSHIELD] ) {
-						const struct TimerData *timer = get_timer(sc->data[SC_STRIPSHIELD]->timer);
+					if( (sc = status_get_sc(src)) && sc_data(sc, SC_STRIPSHIELD) ) {
+						const struct TimerData *timer = get_timer(sc_data(sc, SC_STRIPSHIELD)->timer);
 
 						if( timer && timer->func == status_change_timer && DIFF_TICK(timer->tick,gettick() + skill_get_time(ud->skill_id,ud->skill_lv)) > 0 )
 							break;
@@ -11046,12 +11083,12 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 		sc = status_get_sc(src);
 
 		if( sc && sc->count ) {
-			if( sc->data[SC_SPIRIT] &&
-				sc->data[SC_SPIRIT]->val2 == SL_WIZARD &&
-				sc->data[SC_SPIRIT]->val3 == ud->skill_id &&
+			if( sc_data(sc, SC_SPIRIT) &&
+				sc_data(sc, SC_SPIRIT)->val2 == SL_WIZARD &&
+				sc_data(sc, SC_SPIRIT)->val3 == ud->skill_id &&
 				ud->skill_id != WZ_WATERBALL )
-				sc->data[SC_SPIRIT]->val3 = 0; //Clear bounced spell check
-			if( sc->data[SC_DANCING] && skill_get_inf2(ud->skill_id)&INF2_SONG_DANCE && sd )
+				sc_data(sc, SC_SPIRIT)->val3 = 0; //Clear bounced spell check
+			if( sc_data(sc, SC_DANCING) && skill_get_inf2(ud->skill_id)&INF2_SONG_DANCE && sd )
 				skill_blockpc_start(sd,BD_ADAPTATION,3000);
 		}
 
@@ -11074,7 +11111,7 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 	} while( 0 );
 
 	//When Asura Strike fails (Except when it fails from Wall of Fog)
-	if( ud->skill_id == MO_EXTREMITYFIST && sd && !(sc && sc->data[SC_FOGWALL]) ) {
+	if( ud->skill_id == MO_EXTREMITYFIST && sd && !(sc && sc_data(sc, SC_FOGWALL)) ) {
 		skill_consume_requirement(sd,ud->skill_id,ud->skill_lv,1); //Consume SP/spheres
 		status_set_sp(src,0,0);
 		sc = &sd->sc;
@@ -11295,7 +11332,7 @@ int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill_id, ui
 	sd = BL_CAST(BL_PC,src);
 	sc = status_get_sc(src);
 	type = status_skill2sc(skill_id);
-	sce = (sc && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc && type != SC_NONE) ? sc_data(sc, type) : NULL;
 
 	switch (skill_id) { //Skill effect
 		case WZ_METEOR:
@@ -11356,8 +11393,10 @@ int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill_id, ui
 					if( sg->limit - DIFF_TICK(gettick(),sg->tick) > 0 ) {
 						skill_unitsetting(src,skill_id,skill_lv,x,y,0);
 						return 0; //Not to consume items
-					} else
+					} else {
 						sg->limit = 0; //Disable it
+						skill_unit_group_wake(sg);
+					}
 				}
 				skill_unitsetting(src,skill_id,skill_lv,x,y,0);
 			}
@@ -11556,7 +11595,7 @@ int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill_id, ui
 					(skill_lv >= 4) ? sd->status.memo_point[2].map : 0
 				);
 			}
-			if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] )
+			if( sc && sc_data(sc, SC_CURSEDCIRCLE_ATKER) )
 				status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 			return 0; //Not to consume items
 
@@ -11807,8 +11846,8 @@ int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill_id, ui
 			if( sd )
 				skill_consume_requirement(sd,skill_id,skill_lv,2);
 			if( sc ) {
-				if( (sc->data[SC_NEUTRALBARRIER_MASTER] && skill_id == NC_NEUTRALBARRIER) ||
-					(sc->data[SC_STEALTHFIELD_MASTER] && skill_id == NC_STEALTHFIELD) ) {
+				if( (sc_data(sc, SC_NEUTRALBARRIER_MASTER) && skill_id == NC_NEUTRALBARRIER) ||
+					(sc_data(sc, SC_STEALTHFIELD_MASTER) && skill_id == NC_STEALTHFIELD) ) {
 					skill_clear_unitgroup(src);
 					return 0;
 				}
@@ -12048,7 +12087,7 @@ int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill_id, ui
 			return 1;
 	}
 
-	if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] )
+	if( sc && sc_data(sc, SC_CURSEDCIRCLE_ATKER) )
 		status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 
 	if( sd ) { //Ensure that the skill last-cast tick is recorded
@@ -12349,7 +12388,7 @@ struct skill_unit_group *skill_unitsetting(struct block_list *src, uint16 skill_
 #endif
 			break;
 		case MG_FIREWALL:
-			if( sc && sc->data[SC_VIOLENTGALE] )
+			if( sc && sc_data(sc, SC_VIOLENTGALE) )
 				limit = limit * 3 / 2;
 		case EL_FIRE_MANTLE:
 			val2 = 4 + skill_lv;
@@ -12554,8 +12593,8 @@ struct skill_unit_group *skill_unitsetting(struct block_list *src, uint16 skill_
 				val1 = sd->status.child;
 			break;
 		case HW_GRAVITATION:
-			if( sc && sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF )
-				link_group_id = sc->data[SC_GRAVITATION]->val4;
+			if( sc && sc_data(sc, SC_GRAVITATION) && sc_data(sc, SC_GRAVITATION)->val3 == BCT_SELF )
+				link_group_id = sc_data(sc, SC_GRAVITATION)->val4;
 			break;
 		case NJ_KAENSIN:
 			skill_clear_group(src,1); //Delete previous Kaensins/Suitons
@@ -12588,10 +12627,10 @@ struct skill_unit_group *skill_unitsetting(struct block_list *src, uint16 skill_
 			}
 			break;
 		case GC_POISONSMOKE:
-			if( !(sc && sc->data[SC_POISONINGWEAPON]) )
+			if( !(sc && sc_data(sc, SC_POISONINGWEAPON)) )
 				return NULL;
-			val2 = sc->data[SC_POISONINGWEAPON]->val2; //Type of Poison
-			val3 = sc->data[SC_POISONINGWEAPON]->val1;
+			val2 = sc_data(sc, SC_POISONINGWEAPON)->val2; //Type of Poison
+			val3 = sc_data(sc, SC_POISONINGWEAPON)->val1;
 			limit = skill_get_time(skill_id,skill_lv);
 			break;
 		case GD_LEADERSHIP:
@@ -12777,7 +12816,7 @@ struct skill_unit_group *skill_unitsetting(struct block_list *src, uint16 skill_
 		if( unit_flag&UF_RANGEDSINGLEUNIT && i == (layout->count / 2) )
 			val2 |= UF_RANGEDSINGLEUNIT; //Center
 
-		if( sd && sc && sc->data[SC__MAELSTROM] ) //Does not recover SP from monster skills
+		if( sd && sc && sc_data(sc, SC__MAELSTROM) ) //Does not recover SP from monster skills
 			map_foreachincell(skill_maelstrom_suction,src->m,ux,uy,BL_SKILL,skill_id,skill_lv);
 
 		//Check active cell to failing or remove current unit
@@ -12861,7 +12900,7 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, un
 	sc = status_get_sc(bl);
 	status = status_get_status_data(bl);
 	type = status_skill2sc(skill_id);
-	sce = (sc && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc && type != SC_NONE) ? sc_data(sc, type) : NULL;
 
 	if( skill_get_type(skill_id) == BF_MAGIC &&
 		map_getcell(unit->bl.m,unit->bl.x,unit->bl.y,CELL_CHKLANDPROTECTOR) && skill_id != SA_LANDPROTECTOR )
@@ -12871,9 +12910,9 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, un
 		return 0; //Songs don't work in Basilica
 
 	if( sc ) {
-		if( sc->data[SC__MAELSTROM] )
+		if( sc_data(sc, SC__MAELSTROM) )
 			return 0;
-		if( sc->data[SC_HOVERING] ) {
+		if( sc_data(sc, SC_HOVERING) ) {
 			switch( group->unit_id ) {
 				case UNT_QUAGMIRE:
 				case UNT_GRAVITATION:
@@ -12899,8 +12938,8 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, un
 
 					time += sec;
 				}
-				if( sc && sc->data[SC_SPIDERWEB] ) {
-					uint8 val2 = sc->data[SC_SPIDERWEB]->val2;
+				if( sc && sc_data(sc, SC_SPIDERWEB) ) {
+					uint8 val2 = sc_data(sc, SC_SPIDERWEB)->val2;
 
 					val2++;
 					sc_start4(src,bl,type,100,skill_lv,val2,src->id,0,time);
@@ -13000,7 +13039,7 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, un
 		case UNT_INTOABYSS:
 		case UNT_SIEGFRIED:
 			 //Needed to check when a dancer/bard leaves their ensemble area
-			if( group->src_id == bl->id && !(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER) )
+			if( group->src_id == bl->id && !(sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_BARDDANCER) )
 				return skill_id;
 			if( !sce )
 				sc_start4(src,bl,type,100,skill_lv,group->val1,group->val2,0,group->limit);
@@ -13013,7 +13052,7 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, un
 		case UNT_DONTFORGETME:
 		case UNT_FORTUNEKISS:
 		case UNT_SERVICEFORYOU:
-			if( group->src_id == bl->id && !(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER) )
+			if( group->src_id == bl->id && !(sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_BARDDANCER) )
 				return 0;
 			if( !sce )
 				sc_start4(src,bl,type,100,skill_lv,group->val1,group->val2,0,group->limit);
@@ -13045,7 +13084,7 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, un
 			//break;
 
 		case UNT_MOONLIT:
-			if( sc && sc->data[SC_DANCING] && (sc->data[SC_DANCING]->val1&0xFFFF) == CG_MOONLIT )
+			if( sc && sc_data(sc, SC_DANCING) && (sc_data(sc, SC_DANCING)->val1&0xFFFF) == CG_MOONLIT )
 				break; //Knockback out of area if affected char isn't in Moonlit effect
 			if( bl->id == src->id )
 				break; //Also needed to prevent infinite loop crash
@@ -13128,10 +13167,10 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 	tstatus = status_get_status_data(bl);
 	type = status_skill2sc(skill_id);
 
-	if (sc && sc->data[SC_VOICEOFSIREN] && sc->data[SC_VOICEOFSIREN]->val2 == bl->id && (skill_get_inf2(skill_id)&INF2_TRAP))
+	if (sc && sc_data(sc, SC_VOICEOFSIREN) && sc_data(sc, SC_VOICEOFSIREN)->val2 == bl->id && (skill_get_inf2(skill_id)&INF2_TRAP))
 		return 0;
 
-	if (tsc && tsc->data[SC_HOVERING]) {
+	if (tsc && sc_data(tsc, SC_HOVERING)) {
 		switch (group->unit_id) {
 			case UNT_SKIDTRAP:
 			case UNT_LANDMINE:
@@ -13185,6 +13224,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 					if (ud->skillunit[i]->skill_id == GN_WALLOFTHORN) {
 						ud->skillunit[i]->unit->group->unit_id = UNT_USED_TRAPS;
 						ud->skillunit[i]->unit->group->limit = DIFF_TICK(tick,ud->skillunit[i]->unit->group->tick);
+						skill_unit_group_wake(ud->skillunit[i]->unit->group);
 						skill_unitsetting(map_id2bl(ud->skillunit[i]->unit->group->src_id),
 							ud->skillunit[i]->unit->group->skill_id,ud->skillunit[i]->unit->group->skill_lv,
 								ud->skillunit[i]->unit->group->val3>>16,ud->skillunit[i]->unit->group->val3&0xffff,1);
@@ -13296,7 +13336,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 					break;
 				if (status_isimmune(bl))
 					heal = 0;
-				if (tsc && tsc->data[SC_AKAITSUKI] && heal)
+				if (tsc && sc_data(tsc, SC_AKAITSUKI) && heal)
 					heal = ~heal + 1;
 				clif_skill_nodamage(&unit->bl,bl,AL_HEAL,heal,1);
 				status_heal(bl,heal,0,0);
@@ -13358,7 +13398,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 				int sec = skill_get_time2(skill_id,skill_lv);
 
 				if (status_change_start(src,bl,type,10000,skill_lv,group->group_id,0,0,sec,SCFLAG_FIXEDRATE)) {
-					const struct TimerData *td = (tsc && tsc->data[type] ? get_timer(tsc->data[type]->timer) : NULL);
+					const struct TimerData *td = (tsc && sc_data(tsc, type) ? get_timer(sc_data(tsc, type)->timer) : NULL);
 					int range = skill_get_unit_range(skill_id,skill_lv);
 
 					if (td)
@@ -13401,12 +13441,12 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 			break;
 
 		case UNT_VENOMDUST:
-			if (!(tsc && tsc->data[type]))
+			if (!(tsc && sc_data(tsc, type)))
 				status_change_start(src,bl,type,10000,skill_lv,group->group_id,0,0,skill_get_time2(skill_id,skill_lv),SCFLAG_NONE);
 			break;
 
 		case UNT_LANDMINE: //Land Mine only hits single target
-			if (tsc && tsc->data[SC__MANHOLE])
+			if (tsc && sc_data(tsc, SC__MANHOLE))
 				break;
 			skill_attack(skill_get_type(skill_id),src,&unit->bl,bl,skill_id,skill_lv,tick,0);
 			clif_changetraplook(&unit->bl,UNT_FIREPILLAR_ACTIVE);
@@ -13427,7 +13467,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 		case UNT_FREEZINGTRAP:
 		case UNT_FIREPILLAR_ACTIVE:
 		case UNT_CLAYMORETRAP:
-			if (tsc && tsc->data[SC__MANHOLE])
+			if (tsc && sc_data(tsc, SC__MANHOLE))
 				break;
 			map_foreachinrange(skill_trap_splash,&unit->bl,skill_get_splash(skill_id,skill_lv),group->bl_flag,&unit->bl,tick);
 			if (group->unit_id != UNT_FIREPILLAR_ACTIVE)
@@ -13439,7 +13479,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 		case UNT_FIRINGTRAP:
 			if (bl->id == src->id)
 				break;
-			if (tsc && (tsc->data[SC__MANHOLE] || tsc->data[SC_CHASEWALK]))
+			if (tsc && (sc_data(tsc, SC__MANHOLE) || sc_data(tsc, SC_CHASEWALK)))
 				break; //Firing trap won't hits stealth players/monsters
 			map_foreachinrange(skill_trap_splash,&unit->bl,skill_get_splash(skill_id,skill_lv),group->bl_flag|BL_SKILL|~BCT_SELF,&unit->bl,tick);
 			group->unit_id = UNT_USED_TRAPS;
@@ -13450,7 +13490,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 		case UNT_CLUSTERBOMB:
 			if (bl->id == src->id)
 				break;
-			if (tsc && tsc->data[SC__MANHOLE])
+			if (tsc && sc_data(tsc, SC__MANHOLE))
 				break;
 			map_foreachinrange(skill_trap_splash,&unit->bl,skill_get_splash(skill_id,skill_lv),group->bl_flag|BL_SKILL|~BCT_SELF,&unit->bl,tick);
 			group->unit_id = UNT_USED_TRAPS;
@@ -13489,11 +13529,11 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 					break;
 #endif
 				if ((bl->id == src->id &&
-					!(tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_BARDDANCER)) ||
-					(!battle_config.song_timer_reset && tsc && tsc->data[type] && tsc->data[type]->val4 == 1))
+					!(tsc && sc_data(tsc, SC_SPIRIT) && sc_data(tsc, SC_SPIRIT)->val2 == SL_BARDDANCER)) ||
+					(!battle_config.song_timer_reset && tsc && sc_data(tsc, type) && sc_data(tsc, type)->val4 == 1))
 					break;
 				heal = skill_calc_heal(src,bl,skill_id,skill_lv,true);
-				if (tsc && tsc->data[SC_AKAITSUKI] && heal)
+				if (tsc && sc_data(tsc, SC_AKAITSUKI) && heal)
 					heal = ~heal + 1;
 				clif_skill_nodamage(&unit->bl,bl,AL_HEAL,heal,1);
 				status_heal(bl,heal,0,0);
@@ -13510,8 +13550,8 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 		case UNT_FORTUNEKISS:
 		case UNT_SERVICEFORYOU:
 			if (battle_config.song_timer_reset ||
-				(!battle_config.song_timer_reset && tsc && tsc->data[type] && tsc->data[type]->val4 == 1) ||
-				(bl->id == src->id && !(tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_BARDDANCER)))
+				(!battle_config.song_timer_reset && tsc && sc_data(tsc, type) && sc_data(tsc, type)->val4 == 1) ||
+				(bl->id == src->id && !(tsc && sc_data(tsc, SC_SPIRIT) && sc_data(tsc, SC_SPIRIT)->val2 == SL_BARDDANCER)))
 				break;
 			sc_start4(src,bl,type,100,skill_lv,group->val1,group->val2,0,group->limit);
 			break;
@@ -13631,7 +13671,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 					skill_blown(&unit->bl,bl,skill_get_blewcount(skill_id,skill_lv),unit_getdir(bl),0);
 					break;
 				}
-				if (i <= 0 && (!tsc || !tsc->data[SC_BASILICA]))
+				if (i <= 0 && (!tsc || !sc_data(tsc, SC_BASILICA)))
 					sc_start4(src,bl,type,100,0,0,group->group_id,src->id,group->limit);
 			}
 			break;
@@ -13648,7 +13688,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 			break;
 
 		case UNT_POISONSMOKE:
-			if (battle_check_target(&unit->bl,bl,BCT_ENEMY) > 0 && !(tsc && tsc->data[group->val2]) && rnd()%100 < 50)
+			if (battle_check_target(&unit->bl,bl,BCT_ENEMY) > 0 && !(tsc && sc_data(tsc, group->val2)) && rnd()%100 < 50)
 				sc_start(src,bl,(sc_type)group->val2,100,group->val3,skill_get_time2(GC_POISONINGWEAPON,1));
 			break;
 
@@ -13664,7 +13704,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 					}
 					hp = tstatus->max_hp * hp / 100;
 					sp = tstatus->max_sp * sp / 100;
-					if (tsc && tsc->data[SC_AKAITSUKI] && hp)
+					if (tsc && sc_data(tsc, SC_AKAITSUKI) && hp)
 						hp = ~hp + 1;
 					if (tstatus->hp < tstatus->max_hp)
 						clif_skill_nodamage(&unit->bl,bl,AL_HEAL,hp,1);
@@ -13716,8 +13756,8 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 			if ((status_get_mode(bl)&MD_BOSS) || bl->id == src->id ||
 				(map_flag_gvg2(src->m) && battle_check_target(&unit->bl,bl,BCT_PARTY) > 0))
 				break;
-			if (!(tsc && (tsc->data[type] ||
-				tsc->data[SC_NETHERWORLD_IMMUNE]))) { //Immune for 2 secs
+			if (!(tsc && (sc_data(tsc, type) ||
+				sc_data(tsc, SC_NETHERWORLD_IMMUNE)))) { //Immune for 2 secs
 				sc_start(src,bl,type,100,skill_lv,skill_get_time2(skill_id,skill_lv));
 				group->limit = DIFF_TICK(tick,group->tick);
 				group->unit_id = UNT_USED_TRAPS;
@@ -13727,7 +13767,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 		case UNT_THORNS_TRAP:
 			if (bl->id == src->id)
 				break;
-			if (group->val2 == 0 && !(tsc && tsc->data[type])) {
+			if (group->val2 == 0 && !(tsc && sc_data(tsc, type))) {
 				int time = skill_get_time(skill_id,skill_lv) - DIFF_TICK(tick,group->tick);
 
 				sc_start4(src,bl,type,100,skill_lv,src->id,group->group_id,0,time);
@@ -13762,7 +13802,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 			break;
 
 		case UNT_CLOUD_KILL:
-			if (!(tsc && tsc->data[type]))
+			if (!(tsc && sc_data(tsc, type)))
 				status_change_start(src,bl,type,10000,skill_id,group->group_id,0,0,skill_get_time2(skill_id,skill_lv),SCFLAG_FIXEDRATE);
 			skill_attack(skill_get_type(skill_id),src,&unit->bl,bl,skill_id,skill_lv,tick,0);
 			break;
@@ -13778,11 +13818,11 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 					struct status_change *ssc = status_get_sc(src);
 					int hp = 0;
 
-					if (ssc && ssc->data[SC_HEATER_OPTION])
+					if (ssc && sc_data(ssc, SC_HEATER_OPTION))
 						hp = tstatus->max_hp * 3 * skill_lv / 100;
 					else
 						hp = tstatus->max_hp * skill_lv / 100;
-					if (tsc && tsc->data[SC_AKAITSUKI] && hp)
+					if (tsc && sc_data(tsc, SC_AKAITSUKI) && hp)
 						hp = ~hp + 1;
 					status_heal(bl,hp,0,1);
 				}
@@ -13825,20 +13865,20 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 				int sec = group->limit - DIFF_TICK(tick,group->tick);
 				int range = skill_get_unit_range(skill_id,skill_lv);
 
-				if (tsc && (tsc->data[type] || tsc->data[SC_HALLUCINATIONWALK]))
+				if (tsc && (sc_data(tsc, type) || sc_data(tsc, SC_HALLUCINATIONWALK)))
 					break;
 				if (distance_xy(unit->bl.x,unit->bl.y,bl->x,bl->y) <= range) //Don't consider outer bounderies
 					sc_start(src,bl,type,100,skill_lv,sec);
 				if (bl->type != BL_PC) {
 					if (!unit_blown_immune(bl,0x3) && distance_xy(unit->bl.x,unit->bl.y,bl->x,bl->y) <= range) {
-						if (tsc && (!tsc->data[type] || (tsc->data[type] && tsc->data[type]->val4 < 1)))
+						if (tsc && (!sc_data(tsc, type) || (sc_data(tsc, type) && sc_data(tsc, type)->val4 < 1)))
 							break;
 						if (unit_movepos(bl,unit->bl.x,unit->bl.y,0,false)) //Only snap if the target is inside the range
 							clif_blown(bl,&unit->bl);
 					}
 				} else {
 					if (unit_is_walking(bl) && //Wait until target stop walking
-						(tsc && tsc->data[type] && tsc->data[type]->val4 >= tsc->data[type]->val3 - range))
+						(tsc && sc_data(tsc, type) && sc_data(tsc, type)->val4 >= sc_data(tsc, type)->val3 - range))
 						break;
 				}
 			}
@@ -13848,7 +13888,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 				int rate = 0;
 
 				if (battle_check_target(src,bl,BCT_ENEMY) > 0 &&
-					!(status_get_mode(bl)&MD_BOSS) && !(tsc && tsc->data[SC_BANDING_DEFENCE])) {
+					!(status_get_mode(bl)&MD_BOSS) && !(tsc && sc_data(tsc, SC_BANDING_DEFENCE))) {
 					rate = status_get_lv(src) / 5 + 5 * skill_lv - tstatus->agi / 10;
 					sc_start(src,bl,SC_BANDING_DEFENCE,rate,90,skill_get_time2(skill_id,skill_lv));
 				}
@@ -13914,7 +13954,7 @@ static int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *
 			break;
 
 		case UNT_B_TRAP:
-			if (tsc && tsc->data[type])
+			if (tsc && sc_data(tsc, type))
 				break;
 			sc_start(src,bl,type,100,skill_lv,skill_get_time2(skill_id,skill_lv));
 			unit->val2++; //Mark as ever been used
@@ -13954,7 +13994,7 @@ static int skill_unit_onout(struct skill_unit *unit, struct block_list *bl, unsi
 	group = unit->group;
 	sc = status_get_sc(bl);
 	type = status_skill2sc(group->skill_id);
-	sce = (sc && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc && type != SC_NONE) ? sc_data(sc, type) : NULL;
 
 	if( bl->prev == NULL || (status_isdead(bl) &&
 		group->unit_id != UNT_ANKLESNARE && group->unit_id != UNT_SPIDERWEB) ) //Need to delete the trap if the source died
@@ -13986,7 +14026,7 @@ static int skill_unit_onout(struct skill_unit *unit, struct block_list *bl, unsi
 				for( i = BA_WHISTLE; i <= DC_SERVICEFORYOU; i++ ) {
 					if( skill_get_inf2(i)&(INF2_SONG_DANCE) ) {
 						type = status_skill2sc(i);
-						sce = (sc && type != SC_NONE) ? sc->data[type] : NULL;
+						sce = (sc && type != SC_NONE) ? sc_data(sc, type) : NULL;
 						if( sce )
 							return i;
 					}
@@ -14000,7 +14040,7 @@ static int skill_unit_onout(struct skill_unit *unit, struct block_list *bl, unsi
 		case UNT_DONTFORGETME:
 		case UNT_FORTUNEKISS:
 		case UNT_SERVICEFORYOU:
-			if( group->src_id == bl->id && !(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER) )
+			if( group->src_id == bl->id && !(sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_BARDDANCER) )
 				return -1;
 			break;
 	}
@@ -14025,7 +14065,7 @@ int skill_unit_onleft(uint16 skill_id, struct block_list *bl, unsigned int tick)
 		sc = NULL;
 
 	type = status_skill2sc(skill_id);
-	sce = (sc && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc && type != SC_NONE) ? sc_data(sc, type) : NULL;
 
 	switch (skill_id) {
 		case WZ_QUAGMIRE:
@@ -14049,7 +14089,7 @@ int skill_unit_onleft(uint16 skill_id, struct block_list *bl, unsigned int tick)
 			//it only checks if you are doing the same ensemble. So if there's two chars doing an ensemble
 			//which overlaps, by stepping outside of the other parther's ensemble will cause you to cancel
 			//your own. Let's pray that scenario is pretty unlikely and noone will complain too much about it
-			if (sc && sc->data[SC_DANCING] && (sc->data[SC_DANCING]->val1&0xFFFF) == skill_id)
+			if (sc && sc_data(sc, SC_DANCING) && (sc_data(sc, SC_DANCING)->val1&0xFFFF) == skill_id)
 				status_change_end(bl, SC_DANCING, INVALID_TIMER);
 		case MH_STEINWAND:
 		case MG_SAFETYWALL:
@@ -14077,7 +14117,7 @@ int skill_unit_onleft(uint16 skill_id, struct block_list *bl, unsigned int tick)
 				for (i = BA_WHISTLE; i <= DC_SERVICEFORYOU; i++) {
 					if (skill_get_inf2(i)&(INF2_SONG_DANCE)) {
 						type = status_skill2sc(i);
-						sce = (sc && type != SC_NONE) ? sc->data[type] : NULL;
+						sce = (sc && type != SC_NONE) ? sc_data(sc, type) : NULL;
 						if (sce && !sce->val4) { //We don't want dissonance updating this anymore
 							delete_timer(sce->timer, status_change_timer);
 							sce->val4 = 1; //Store the fact that this is a "reduced" duration effect
@@ -14109,7 +14149,7 @@ int skill_unit_onleft(uint16 skill_id, struct block_list *bl, unsigned int tick)
 		case PF_FOGWALL:
 			if (sce) {
 				status_change_end(bl, type, INVALID_TIMER);
-				if ((sce = sc->data[SC_BLIND])) {
+				if ((sce = sc_data(sc, SC_BLIND))) {
 					if (bl->type == BL_PC) //Players get blind ended inmediately, others have it still for 30 secs [Skotlex]
 						status_change_end(bl, SC_BLIND, INVALID_TIMER);
 					else {
@@ -14215,6 +14255,7 @@ int skill_unit_ondamaged(struct skill_unit *unit, int64 damage)
 		case UNT_WALLOFTHORN:
 		case UNT_REVERBERATION:
 			unit->val1 -= (int)cap_value(damage,INT_MIN,INT_MAX);
+			skill_unit_group_wake(group);
 			break;
 		default:
 			damage = 0;
@@ -14258,7 +14299,7 @@ int skill_check_condition_char_sub(struct block_list *bl, va_list ap)
 	if( pc_isdead(tsd) )
 		return 0;
 
-	if( tsd->sc.data[SC_SILENCE] || (tsd->sc.opt1 && tsd->sc.opt1 != OPT1_BURNING && tsd->sc.opt1 != OPT1_FREEZING) )
+	if( sc_data(&tsd->sc, SC_SILENCE) || (tsd->sc.opt1 && tsd->sc.opt1 != OPT1_BURNING && tsd->sc.opt1 != OPT1_FREEZING) )
 		return 0;
 
 	if( skill_get_inf2(skill_id)&INF2_CHORUS_SKILL ) {
@@ -14295,7 +14336,7 @@ int skill_check_condition_char_sub(struct block_list *bl, va_list ap)
 						(tsd->weapontype1 == W_MUSICAL || tsd->weapontype1 == W_WHIP) &&
 						sd->status.party_id && tsd->status.party_id &&
 						sd->status.party_id == tsd->status.party_id &&
-						!tsd->sc.data[SC_DANCING] )
+						!sc_data(&tsd->sc, SC_DANCING) )
 					{
 						p_sd[(*c)++] = tsd->bl.id;
 						return skill_lv;
@@ -14345,9 +14386,9 @@ int skill_check_pc_partner(struct map_session_data *sd, uint16 skill_id, uint16
 			default: //Warning: Assuming Ensemble skills here (for speed)
 				if (is_chorus)
 					break; //Chorus skills are not to be parsed as ensambles
-				if (c > 0 && sd->sc.data[SC_DANCING] && (tsd = map_id2sd(p_sd[0])) != NULL) {
-					sd->sc.data[SC_DANCING]->val4 = tsd->bl.id;
-					sc_start4(&sd->bl, &tsd->bl, SC_DANCING, 100, skill_id, sd->sc.data[SC_DANCING]->val2, *skill_lv, sd->bl.id, skill_get_time(skill_id, *skill_lv) + 1000);
+				if (c > 0 && sc_data(&sd->sc, SC_DANCING) && (tsd = map_id2sd(p_sd[0])) != NULL) {
+					sc_data(&sd->sc, SC_DANCING)->val4 = tsd->bl.id;
+					sc_start4(&sd->bl, &tsd->bl, SC_DANCING, 100, skill_id, sc_data(&sd->sc, SC_DANCING)->val2, *skill_lv, sd->bl.id, skill_get_time(skill_id, *skill_lv) + 1000);
 					clif_skill_nodamage(&tsd->bl, &sd->bl, skill_id, *skill_lv, 1);
 					tsd->skill_id_dance = skill_id;
 					tsd->skill_lv_dance = *skill_lv;
@@ -14455,25 +14496,25 @@ static bool skill_check_condition_sc_required(struct map_session_data *sd, unsig
 		switch( req_sc ) {
 			//Official fail msg
 			case SC_PUSH_CART:
-				if( !sc->data[SC_PUSH_CART] ) {
+				if( !sc_data(sc, SC_PUSH_CART) ) {
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_CART,0,0);
 					return false;
 				}
 				break;
 			case SC_POISONINGWEAPON:
-				if( !sc->data[SC_POISONINGWEAPON] ) {
+				if( !sc_data(sc, SC_POISONINGWEAPON) ) {
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_GC_POISONINGWEAPON,0,0);
 					return false;
 				}
 				break;
 			case SC_ROLLINGCUTTER:
-				if( !sc->data[SC_ROLLINGCUTTER] ) {
+				if( !sc_data(sc, SC_ROLLINGCUTTER) ) {
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_CONDITION,0,0);
 					return false;
 				}
 				break;
 			default:
-				if( !sc->data[req_sc] ) {
+				if( !sc_data(sc, req_sc) ) {
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 					return false;
 				}
@@ -14552,7 +14593,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 		}
 		//Consume
 		sd->itemid = sd->itemindex = -1;
-		if( skill_id == WZ_EARTHSPIKE && sc && sc->data[SC_EARTHSCROLL] && rnd()%100 > sc->data[SC_EARTHSCROLL]->val2 ) //[marquis007]
+		if( skill_id == WZ_EARTHSPIKE && sc && sc_data(sc, SC_EARTHSCROLL) && rnd()%100 > sc_data(sc, SC_EARTHSCROLL)->val2 ) //[marquis007]
 			; //Do not consume item
 		else if( sd->status.inventory[i].expire_time == 0 )
 			pc_delitem(sd,i,1,0,0,LOG_TYPE_CONSUME); //Rental usable items are not consumed until expiration
@@ -14638,8 +14679,8 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			}
 			break;
 		case MO_CALLSPIRITS:
-			if( sc && sc->data[SC_RAISINGDRAGON] )
-				skill_lv += sc->data[SC_RAISINGDRAGON]->val1;
+			if( sc && sc_data(sc, SC_RAISINGDRAGON) )
+				skill_lv += sc_data(sc, SC_RAISINGDRAGON)->val1;
 			if( sd->spiritball >= skill_lv ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
@@ -14656,34 +14697,34 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 		case MO_CHAINCOMBO:
 			if( !sc )
 				return false;
-			if( sc->data[SC_BLADESTOP] )
+			if( sc_data(sc, SC_BLADESTOP) )
 				break;
-			if( sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_TRIPLEATTACK )
+			if( sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == MO_TRIPLEATTACK )
 				break;
 			return false;
 		case MO_COMBOFINISH:
-			if( !(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_CHAINCOMBO) )
+			if( !(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == MO_CHAINCOMBO) )
 				return false;
 			break;
 		case CH_TIGERFIST:
-			if( !(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_COMBOFINISH) )
+			if( !(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == MO_COMBOFINISH) )
 				return false;
 			break;
 		case CH_CHAINCRUSH:
-			if( !(sc && sc->data[SC_COMBO]) )
+			if( !(sc && sc_data(sc, SC_COMBO)) )
 				return false;
-			if( sc->data[SC_COMBO]->val1 != MO_COMBOFINISH && sc->data[SC_COMBO]->val1 != CH_TIGERFIST )
+			if( sc_data(sc, SC_COMBO)->val1 != MO_COMBOFINISH && sc_data(sc, SC_COMBO)->val1 != CH_TIGERFIST )
 				return false;
 			break;
 		case MO_EXTREMITYFIST:
 #ifndef RENEWAL
-			//if( sc && sc->data[SC_EXTREMITYFIST] ) //To disable Asura during the 5 min skill block uncomment this
+			//if( sc && sc_data(sc, SC_EXTREMITYFIST) ) //To disable Asura during the 5 min skill block uncomment this
 				//return false;
 #endif
-			if( sc && (sc->data[SC_BLADESTOP] || sc->data[SC_CURSEDCIRCLE_ATKER]) )
+			if( sc && (sc_data(sc, SC_BLADESTOP) || sc_data(sc, SC_CURSEDCIRCLE_ATKER)) )
 				break;
-			if( sc && sc->data[SC_COMBO] ) {
-				switch( sc->data[SC_COMBO]->val1 ) {
+			if( sc && sc_data(sc, SC_COMBO) ) {
+				switch( sc_data(sc, SC_COMBO)->val1 ) {
 					case MO_COMBOFINISH:
 					case CH_TIGERFIST:
 					case CH_CHAINCRUSH:
@@ -14718,15 +14759,15 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 		case TK_COUNTER:
 			if( (sd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER )
 				return false; //Anti-Soul Linker check in case you job-changed with Stances active
-			if( !(sc && sc->data[SC_COMBO]) || sc->data[SC_COMBO]->val1 == TK_JUMPKICK )
+			if( !(sc && sc_data(sc, SC_COMBO)) || sc_data(sc, SC_COMBO)->val1 == TK_JUMPKICK )
 				return false; //Combo needs to be ready
-			if( sc->data[SC_COMBO]->val3 ) { //Kick chain
-				if( sc->data[SC_COMBO]->val3 != skill_id )
+			if( sc_data(sc, SC_COMBO)->val3 ) { //Kick chain
+				if( sc_data(sc, SC_COMBO)->val3 != skill_id )
 					break; //Do not repeat a kick
 				status_change_end(&sd->bl,SC_COMBO,INVALID_TIMER);
 				return false;
 			}
-			if( sc->data[SC_COMBO]->val1 != skill_id && !pc_is_taekwon_ranker(sd) ) { //Cancel combo wait
+			if( sc_data(sc, SC_COMBO)->val1 != skill_id && !pc_is_taekwon_ranker(sd) ) { //Cancel combo wait
 				unit_cancel_combo(&sd->bl);
 				return false;
 			}
@@ -14734,14 +14775,14 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 		case BD_ADAPTATION: {
 				int time;
 
-				if( !(sc && sc->data[SC_DANCING]) ) {
+				if( !(sc && sc_data(sc, SC_DANCING)) ) {
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 					return false;
 				}
-				time = 1000 * (sc->data[SC_DANCING]->val3>>16);
+				time = 1000 * (sc_data(sc, SC_DANCING)->val3>>16);
 				if( skill_get_time(
-					(sc->data[SC_DANCING]->val1&0xFFFF), //Dance Skill ID
-					(sc->data[SC_DANCING]->val1>>16)) //Dance Skill LV
+					(sc_data(sc, SC_DANCING)->val1&0xFFFF), //Dance Skill ID
+					(sc_data(sc, SC_DANCING)->val1>>16)) //Dance Skill LV
 					- time < skill_get_time2(skill_id,skill_lv) )
 				{
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
@@ -14756,11 +14797,11 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			}
 			break;
 		case SL_SMA:
-			if( !(sc && sc->data[SC_SMA]) )
+			if( !(sc && sc_data(sc, SC_SMA)) )
 				return false;
 			break;
 		case HT_POWER:
-			if( !(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == AC_DOUBLE) )
+			if( !(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == AC_DOUBLE) )
 				return false;
 			break;
 		case CG_HERMODE:
@@ -14795,7 +14836,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			}
 			break;
 		case HP_BASILICA:
-			if( !(sc && sc->data[SC_BASILICA]) ) {
+			if( !(sc && sc_data(sc, SC_BASILICA)) ) {
 				if( sd ) { //When castbegin, needs 7x7 clear area
 					int i, range = skill_get_unit_layout_type(skill_id,skill_lv) + 1;
 					int size = range * 2 + 1;
@@ -14826,7 +14867,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 		case SG_SUN_WARM:
 		case SG_MOON_WARM:
 		case SG_STAR_WARM:
-			if( sc && sc->data[SC_MIRACLE] )
+			if( sc && sc_data(sc, SC_MIRACLE) )
 				break;
 			i = skill_id - SG_SUN_WARM;
 			if( sd->bl.m == sd->feel_map[i].m )
@@ -14836,7 +14877,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 		case SG_SUN_COMFORT:
 		case SG_MOON_COMFORT:
 		case SG_STAR_COMFORT:
-			if( sc && sc->data[SC_MIRACLE] )
+			if( sc && sc_data(sc, SC_MIRACLE) )
 				break;
 			i = skill_id - SG_SUN_COMFORT;
 			if( sd->bl.m == sd->feel_map[i].m && (battle_config.allow_skill_without_day || sg_info[i].day_func()) )
@@ -14844,7 +14885,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 			return false;
 		case SG_FUSION:
-			if( sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_STAR )
+			if( sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_STAR )
 				break;
 			//Auron insists we should implement SP consumption when you are not Soul Linked [Skotlex]
 			//Only invoke on skill begin cast (instant cast skill) [Kevin]
@@ -14885,7 +14926,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 				return false;
 			}
 		case NJ_BUNSINJYUTSU:
-			if( !(sc && sc->data[SC_NEN]) ) {
+			if( !(sc && sc_data(sc, SC_NEN)) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
 			}
@@ -14952,7 +14993,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 		case WL_SUMMONWB:
 		case WL_SUMMONSTONE:
 			if( sc ) {
-				ARR_FIND(SC_SPHERE_1,SC_SPHERE_5 + 1,i,!sc->data[i]);
+				ARR_FIND(SC_SPHERE_1,SC_SPHERE_5 + 1,i,!sc_data(sc, i));
 				if( i == SC_SPHERE_5 + 1 ) { //No more free slots
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_SUMMON,0,0);
 					return false;
@@ -14965,7 +15006,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 				int j = 0;
 
 				for( i = SC_SPHERE_1; i <= SC_SPHERE_5; i++ )
-					if( sc->data[i] )
+					if( sc_data(sc, i) )
 						j++;
 				if( j < 4 ) { //Need 4 spheres minimum
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
@@ -14977,20 +15018,20 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			}
 			break;
 		case GC_HALLUCINATIONWALK:
-			if( sc && (sc->data[SC_HALLUCINATIONWALK] || sc->data[SC_HALLUCINATIONWALK_POSTDELAY]) ) {
+			if( sc && (sc_data(sc, SC_HALLUCINATIONWALK) || sc_data(sc, SC_HALLUCINATIONWALK_POSTDELAY)) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
 			}
 			break;
 		case GC_COUNTERSLASH:
 		case GC_WEAPONCRUSH:
-			if( !(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == GC_WEAPONBLOCKING) ) {
+			if( !(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == GC_WEAPONBLOCKING) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_GC_WEAPONBLOCKING,0,0);
 				return false;
 			}
 			break;
 		case RA_WUGMASTERY:
-			if( (pc_isfalcon(sd) && !battle_config.warg_can_falcon) || pc_isridingwug(sd) || (sc && sc->data[SC__GROOMY]) ) {
+			if( (pc_isfalcon(sd) && !battle_config.warg_can_falcon) || pc_isridingwug(sd) || (sc && sc_data(sc, SC__GROOMY)) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
 			}
@@ -15014,13 +15055,13 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			}
 			break;
 		case LG_BANDING:
-			if( sc && sc->data[SC_INSPIRATION] ) {
+			if( sc && sc_data(sc, SC_INSPIRATION) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
 			}
 			break;
 		case LG_PRESTIGE:
-			if( sc && (sc->data[SC_BANDING] || sc->data[SC_INSPIRATION]) ) {
+			if( sc && (sc_data(sc, SC_BANDING) || sc_data(sc, SC_INSPIRATION)) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
 			}
@@ -15048,22 +15089,22 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			break;
 		case LG_RAYOFGENESIS:
 		case LG_HESPERUSLIT:
-			if( sc && sc->data[SC_INSPIRATION] )
+			if( sc && sc_data(sc, SC_INSPIRATION) )
 				return true; //Don't check for partner
-			if( !(sc && sc->data[SC_BANDING]) ) {
+			if( !(sc && sc_data(sc, SC_BANDING)) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL,0,0);
 				return false;
 			}
-			if( sc->data[SC_BANDING] &&
-				sc->data[SC_BANDING]->val2 < (skill_id == LG_RAYOFGENESIS ? 2 : 3) )
+			if( sc_data(sc, SC_BANDING) &&
+				sc_data(sc, SC_BANDING)->val2 < (skill_id == LG_RAYOFGENESIS ? 2 : 3) )
 				return false; //Just fails, no msg here
 			break;
 		case SR_FALLENEMPIRE:
-			if( !(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_DRAGONCOMBO) )
+			if( !(sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == SR_DRAGONCOMBO) )
 				return false;
 			break;
 		case SR_CRESCENTELBOW:
-			if( sc && sc->data[SC_CRESCENTELBOW] ) {
+			if( sc && sc_data(sc, SC_CRESCENTELBOW) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_DUPLICATE,0,0);
 				return false;
 			}
@@ -15092,7 +15133,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			break;
 		case SC_MANHOLE:
 		case SC_DIMENSIONDOOR:
-			if( sc && sc->data[SC_MAGNETICFIELD] ) {
+			if( sc && sc_data(sc, SC_MAGNETICFIELD) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
 			}
@@ -15105,8 +15146,8 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			break;
 		case SO_FIREWALK:
 		case SO_ELECTRICWALK: //Can't be casted until you've walked all cells
-			if( sc && sc->data[SC_PROPERTYWALK] &&
-				sc->data[SC_PROPERTYWALK]->val3 < skill_get_maxcount(sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2) ) {
+			if( sc && sc_data(sc, SC_PROPERTYWALK) &&
+				sc_data(sc, SC_PROPERTYWALK)->val3 < skill_get_maxcount(sc_data(sc, SC_PROPERTYWALK)->val1,sc_data(sc, SC_PROPERTYWALK)->val2) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
 			}
@@ -15119,7 +15160,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			break;
 		case LG_REFLECTDAMAGE:
 		case CR_REFLECTSHIELD:
-			if( sc && sc->data[SC_KYOMU] && rnd()%100 < 5 * sc->data[SC_KYOMU]->val1 ) {
+			if( sc && sc_data(sc, SC_KYOMU) && rnd()%100 < 5 * sc_data(sc, SC_KYOMU)->val1 ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
 				return false;
 			}
@@ -15189,7 +15230,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			}
 			break;
 		case ST_MOVE_ENABLE:
-			if( sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill_id )
+			if( sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == skill_id )
 				sd->ud.canmove_tick = gettick(); //When using a combo, cancel the can't move delay to enable the skill [Skotlex]
 			if( !unit_can_move(&sd->bl) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0,0);
@@ -15197,7 +15238,7 @@ bool skill_check_condition_castbegin(struct map_session_data *sd, uint16 skill_i
 			}
 			break;
 		case ST_WATER:
-			if( sc && (sc->data[SC_DELUGE] || sc->data[SC_SUITON]) )
+			if( sc && (sc_data(sc, SC_DELUGE) || sc_data(sc, SC_SUITON)) )
 				break;
 			if( map_getcell(sd->bl.m,sd->bl.x,sd->bl.y,CELL_CHKWATER) )
 				break;
@@ -15616,27 +15657,27 @@ void skill_consume_requirement(struct map_session_data *sd, uint16 skill_id, uin
 				continue;
 
 			if( itemdb_is_gemstone(require.itemid[i]) && skill_id != HW_GANBANTEIN &&
-				sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_WIZARD )
+				sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_WIZARD )
 				continue; //Gemstones are checked, but not substracted from inventory
 
 			switch( skill_id ) {
 				case SA_SEISMICWEAPON:
-					if( sc && sc->data[SC_UPHEAVAL_OPTION] && rnd()%100 < 50 )
+					if( sc && sc_data(sc, SC_UPHEAVAL_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_FLAMELAUNCHER:
 				case SA_VOLCANO:
-					if( sc && sc->data[SC_TROPIC_OPTION] && rnd()%100 < 50 )
+					if( sc && sc_data(sc, SC_TROPIC_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_FROSTWEAPON:
 				case SA_DELUGE:
-					if( sc && sc->data[SC_CHILLY_AIR_OPTION] && rnd()%100 < 50 )
+					if( sc && sc_data(sc, SC_CHILLY_AIR_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_LIGHTNINGLOADER:
 				case SA_VIOLENTGALE:
-					if( sc && sc->data[SC_WILD_STORM_OPTION] && rnd()%100 < 50 )
+					if( sc && sc_data(sc, SC_WILD_STORM_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 			}
@@ -15721,23 +15762,23 @@ struct skill_condition skill_get_requirement(struct map_session_data *sd, uint16
 		req.sp += sd->skillusesp[i].val;
 
 	if( sc ) {
-		if( sc->data[SC_RECOGNIZEDSPELL] )
+		if( sc_data(sc, SC_RECOGNIZEDSPELL) )
 			req.sp += req.sp * 25 / 100;
-		if( sc->data[SC__LAZINESS] )
-			req.sp += sc->data[SC__LAZINESS]->val1 * 10;
-		if( sc->data[SC_UNLIMITEDHUMMINGVOICE] )
-			req.sp += req.sp * sc->data[SC_UNLIMITEDHUMMINGVOICE]->val3 / 100;
-		if( sc->data[SC_TELEKINESIS_INTENSE] && skill_get_ele(skill_id,skill_lv) == ELE_GHOST)
-			req.sp -= req.sp * sc->data[SC_TELEKINESIS_INTENSE]->val2 / 100;
-		if( sc->data[SC_OFFERTORIUM] )
-			req.sp += req.sp * sc->data[SC_OFFERTORIUM]->val3 / 100;
+		if( sc_data(sc, SC__LAZINESS) )
+			req.sp += sc_data(sc, SC__LAZINESS)->val1 * 10;
+		if( sc_data(sc, SC_UNLIMITEDHUMMINGVOICE) )
+			req.sp += req.sp * sc_data(sc, SC_UNLIMITEDHUMMINGVOICE)->val3 / 100;
+		if( sc_data(sc, SC_TELEKINESIS_INTENSE) && skill_get_ele(skill_id,skill_lv) == ELE_GHOST)
+			req.sp -= req.sp * sc_data(sc, SC_TELEKINESIS_INTENSE)->val2 / 100;
+		if( sc_data(sc, SC_OFFERTORIUM) )
+			req.sp += req.sp * sc_data(sc, SC_OFFERTORIUM)->val3 / 100;
 	}
 
 	req.zeny = skill_db[idx].require.zeny[skill_lv - 1];
 
-	if( sc && sc->data[SC__UNLUCKY] ) {
-		if( sc->data[SC__UNLUCKY]->val1 < 3 )
-			req.zeny += sc->data[SC__UNLUCKY]->val1 * 250;
+	if( sc && sc_data(sc, SC__UNLUCKY) ) {
+		if( sc_data(sc, SC__UNLUCKY)->val1 < 3 )
+			req.zeny += sc_data(sc, SC__UNLUCKY)->val1 * 250;
 		else
 			req.zeny += 1000;
 	}
@@ -15836,7 +15877,7 @@ struct skill_condition skill_get_requirement(struct map_session_data *sd, uint16
 							else if( --req.amount[i] < 1 )
 								req.amount[i] = 1; //Hocus Pocus always use at least 1 gem
 						}
-						if( sc && sc->data[SC_INTOABYSS] ) {
+						if( sc && sc_data(sc, SC_INTOABYSS) ) {
 							if( skill_id != SA_ABRACADABRA )
 								req.itemid[i] = req.amount[i] = 0;
 							else if( --req.amount[i] < 1 )
@@ -15855,7 +15896,7 @@ struct skill_condition skill_get_requirement(struct map_session_data *sd, uint16
 				req.zeny -= req.zeny * 10 / 100;
 			break;
 		case AL_HOLYLIGHT:
-			if( sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_PRIEST )
+			if( sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_PRIEST )
 				req.sp *= 5;
 			break;
 		case SL_SMA:
@@ -15878,19 +15919,19 @@ struct skill_condition skill_get_requirement(struct map_session_data *sd, uint16
 		case MO_COMBOFINISH:
 		case CH_TIGERFIST:
 		case CH_CHAINCRUSH:
-			if( sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_MONK )
+			if( sc && sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_MONK )
 				req.sp = 2; //Monk Spirit makes monk/champion combo skills cost 2 SP regardless of original cost
 			break;
 		case MO_BODYRELOCATION:
-			if( sc && sc->data[SC_EXPLOSIONSPIRITS] )
+			if( sc && sc_data(sc, SC_EXPLOSIONSPIRITS) )
 				req.spiritball = 0;
 			break;
 		case MO_EXTREMITYFIST:
 			if( sc ) {
-				if( sc->data[SC_BLADESTOP] )
+				if( sc_data(sc, SC_BLADESTOP) )
 					req.spiritball--;
-				else if( sc->data[SC_COMBO] ) {
-					switch( sc->data[SC_COMBO]->val1 ) {
+				else if( sc_data(sc, SC_COMBO) ) {
+					switch( sc_data(sc, SC_COMBO)->val1 ) {
 						case MO_COMBOFINISH:
 							req.spiritball = 4;
 							break;
@@ -15901,13 +15942,13 @@ struct skill_condition skill_get_requirement(struct map_session_data *sd, uint16
 							req.spiritball = (sd->spiritball ? sd->spiritball : 1);
 							break;
 					}
-				} else if( sc->data[SC_RAISINGDRAGON] && sd->spiritball > 5 )
+				} else if( sc_data(sc, SC_RAISINGDRAGON) && sd->spiritball > 5 )
 					req.spiritball = sd->spiritball; //Must consume all regardless of the amount required
 			}
 			break;
 		case GC_CROSSIMPACT:
 		case GC_COUNTERSLASH:
-			if( sc && sc->data[SC_EDP] )
+			if( sc && sc_data(sc, SC_EDP) )
 				req.sp += req.sp;
 			break;
 		case LG_RAGEBURST:
@@ -15915,7 +15956,7 @@ struct skill_condition skill_get_requirement(struct map_session_data *sd, uint16
 			req.spiritball = (sd->spiritball ? sd->spiritball : (skill_id == LG_RAGEBURST) ? 1 : 15);
 			break;
 		case SR_GATEOFHELL:
-			if( sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE )
+			if( sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == SR_FALLENEMPIRE )
 				req.sp -= req.sp * 10 / 100;
 			break;
 		case WM_GREAT_ECHO:
@@ -15933,8 +15974,8 @@ struct skill_condition skill_get_requirement(struct map_session_data *sd, uint16
 			}
 			break;
 		case SO_PSYCHIC_WAVE:
-			if( sc && (sc->data[SC_HEATER_OPTION] || sc->data[SC_COOLER_OPTION] ||
-				sc->data[SC_BLAST_OPTION] ||  sc->data[SC_CURSED_SOIL_OPTION]) )
+			if( sc && (sc_data(sc, SC_HEATER_OPTION) || sc_data(sc, SC_COOLER_OPTION) ||
+				sc_data(sc, SC_BLAST_OPTION) ||  sc_data(sc, SC_CURSED_SOIL_OPTION)) )
 				req.sp += req.sp / 2; //1.5x SP cost
 			break;
 	}
@@ -16002,13 +16043,13 @@ int skill_castfix(struct block_list *bl, uint16 skill_id, uint16 skill_lv) {
 		//NOTE: Magic Strings and Foresight are treated as separate factors in the calculation
 		//They are not added to the other modifiers [iRO Wiki]
 		if( sc && sc->count && !(skill_get_castnodex(skill_id, skill_lv)&2) ) {
-			if( sc->data[SC_MEMORIZE] ) {
+			if( sc_data(sc, SC_MEMORIZE) ) {
 				reduce_ct_r += 50;
-				if( (--sc->data[SC_MEMORIZE]->val2) <= 0 )
+				if( (--sc_data(sc, SC_MEMORIZE)->val2) <= 0 )
 					status_change_end(bl, SC_MEMORIZE, INVALID_TIMER);
 			}
-			if( sc->data[SC_POEMBRAGI] )
-				reduce_ct_r += sc->data[SC_POEMBRAGI]->val2;
+			if( sc_data(sc, SC_POEMBRAGI) )
+				reduce_ct_r += sc_data(sc, SC_POEMBRAGI)->val2;
 		}
 
 		time = time * (1 - (float)reduce_ct_r / 100);
@@ -16043,15 +16084,15 @@ int skill_castfix_sc(struct block_list *bl, double time)
 		return (int)time;
 
 	if( sc && sc->count ) {
-		if( sc->data[SC_SLOWCAST] )
-			time += time * sc->data[SC_SLOWCAST]->val2 / 100;
-		if( sc->data[SC_PARALYSIS] )
-			time += sc->data[SC_PARALYSIS]->val3;
-		if( sc->data[SC_SUFFRAGIUM] ) {
-			time -= time * sc->data[SC_SUFFRAGIUM]->val2 / 100;
+		if( sc_data(sc, SC_SLOWCAST) )
+			time += time * sc_data(sc, SC_SLOWCAST)->val2 / 100;
+		if( sc_data(sc, SC_PARALYSIS) )
+			time += sc_data(sc, SC_PARALYSIS)->val3;
+		if( sc_data(sc, SC_SUFFRAGIUM) ) {
+			time -= time * sc_data(sc, SC_SUFFRAGIUM)->val2 / 100;
 			status_change_end(bl, SC_SUFFRAGIUM, INVALID_TIMER);
 		}
-		if( sc->data[SC_IZAYOI] )
+		if( sc_data(sc, SC_IZAYOI) )
 			time -= time * 50 / 100;
 	}
 
@@ -16124,48 +16165,48 @@ int skill_vfcastfix(struct block_list *bl, double time, uint16 skill_id, uint16
 
 	if( sc && sc->count && !(skill_get_castnodex(skill_id, skill_lv)&2) ) {
 		//All variable cast additive bonuses must come first
-		if( sc->data[SC_SLOWCAST] )
-			VARCAST_REDUCTION(-sc->data[SC_SLOWCAST]->val2);
-		if( sc->data[SC__LAZINESS] )
-			VARCAST_REDUCTION(-sc->data[SC__LAZINESS]->val3);
+		if( sc_data(sc, SC_SLOWCAST) )
+			VARCAST_REDUCTION(-sc_data(sc, SC_SLOWCAST)->val2);
+		if( sc_data(sc, SC__LAZINESS) )
+			VARCAST_REDUCTION(-sc_data(sc, SC__LAZINESS)->val3);
 		//Variable cast reduction bonuses
-		if( sc->data[SC_SUFFRAGIUM] ) {
-			VARCAST_REDUCTION(sc->data[SC_SUFFRAGIUM]->val2);
+		if( sc_data(sc, SC_SUFFRAGIUM) ) {
+			VARCAST_REDUCTION(sc_data(sc, SC_SUFFRAGIUM)->val2);
 			status_change_end(bl, SC_SUFFRAGIUM, INVALID_TIMER);
 		}
-		if( sc->data[SC_MEMORIZE] ) {
+		if( sc_data(sc, SC_MEMORIZE) ) {
 			reduce_ct_r += 50;
-			if( (--sc->data[SC_MEMORIZE]->val2) <= 0 )
+			if( (--sc_data(sc, SC_MEMORIZE)->val2) <= 0 )
 				status_change_end(bl, SC_MEMORIZE, INVALID_TIMER);
 		}
-		if( sc->data[SC_POEMBRAGI] )
-			reduce_ct_r += sc->data[SC_POEMBRAGI]->val2;
-		if( sc->data[SC_IZAYOI] )
+		if( sc_data(sc, SC_POEMBRAGI) )
+			reduce_ct_r += sc_data(sc, SC_POEMBRAGI)->val2;
+		if( sc_data(sc, SC_IZAYOI) )
 			VARCAST_REDUCTION(50);
-		if( sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 3 && (skill_get_ele(skill_id, skill_lv) == ELE_WATER) )
+		if( sc_data(sc, SC_WATER_INSIGNIA) && sc_data(sc, SC_WATER_INSIGNIA)->val1 == 3 && (skill_get_ele(skill_id, skill_lv) == ELE_WATER) )
 			VARCAST_REDUCTION(30); //Reduces 30% Variable Cast Time of Water spells
-		if( sc->data[SC_TELEKINESIS_INTENSE] )
-			VARCAST_REDUCTION(sc->data[SC_TELEKINESIS_INTENSE]->val2);
+		if( sc_data(sc, SC_TELEKINESIS_INTENSE) )
+			VARCAST_REDUCTION(sc_data(sc, SC_TELEKINESIS_INTENSE)->val2);
 		//Fixed cast reduction bonuses
-		if( sc->data[SC_SECRAMENT] )
-			fixcast_r = max(fixcast_r, sc->data[SC_SECRAMENT]->val2);
+		if( sc_data(sc, SC_SECRAMENT) )
+			fixcast_r = max(fixcast_r, sc_data(sc, SC_SECRAMENT)->val2);
 		if( sd && (skill_lv = pc_checkskill(sd, WL_RADIUS)) && skill_id >= WL_WHITEIMPRISON && skill_id <= WL_FREEZE_SP  ) {
 			int reduce_fc_r = status_get_int(bl) / 15 + sd->status.base_level / 15 + 5 + skill_lv * 5;
 
 			fixcast_r = max(fixcast_r, reduce_fc_r);
 		}
-		if( sc->data[SC_DANCEWITHWUG] )
-			fixcast_r = max(fixcast_r, sc->data[SC_DANCEWITHWUG]->val4);
-		if( sc->data[SC_HEAT_BARREL] )
-			fixcast_r = max(fixcast_r, sc->data[SC_HEAT_BARREL]->val2);
+		if( sc_data(sc, SC_DANCEWITHWUG) )
+			fixcast_r = max(fixcast_r, sc_data(sc, SC_DANCEWITHWUG)->val4);
+		if( sc_data(sc, SC_HEAT_BARREL) )
+			fixcast_r = max(fixcast_r, sc_data(sc, SC_HEAT_BARREL)->val2);
 		//Fixed cast non percentage bonuses
-		if( sc->data[SC_DEATHBOUND_POSTDELAY] && skill_id == AL_TELEPORT )
+		if( sc_data(sc, SC_DEATHBOUND_POSTDELAY) && skill_id == AL_TELEPORT )
 			fixed += 1000;
-		if( sc->data[SC_MANDRAGORA] )
-			fixed += sc->data[SC_MANDRAGORA]->val1 * 500;
-		if( sc->data[SC_GUST_OPTION] || sc->data[SC_BLAST_OPTION] || sc->data[SC_WILD_STORM_OPTION] )
+		if( sc_data(sc, SC_MANDRAGORA) )
+			fixed += sc_data(sc, SC_MANDRAGORA)->val1 * 500;
+		if( sc_data(sc, SC_GUST_OPTION) || sc_data(sc, SC_BLAST_OPTION) || sc_data(sc, SC_WILD_STORM_OPTION) )
 			fixed -= 1000;
-		if( sc->data[SC_IZAYOI] )
+		if( sc_data(sc, SC_IZAYOI) )
 			fixed = 0;
 	}
 
@@ -16221,7 +16262,7 @@ int skill_delayfix(struct block_list *bl, uint16 skill_id, uint16 skill_lv)
 			time -= (4 * status_get_agi(bl) + 2 * status_get_dex(bl));
 			break;
 		case HP_BASILICA:
-			if (!(sc && sc->data[SC_BASILICA]))
+			if (!(sc && sc_data(sc, SC_BASILICA)))
 				time = 0; //There is no Delay on Basilica creation, only on cancel
 			break;
 		default:
@@ -16244,14 +16285,14 @@ int skill_delayfix(struct block_list *bl, uint16 skill_id, uint16 skill_lv)
 			break;
 	}
 
-	if (sc && sc->data[SC_SPIRIT]) {
+	if (sc && sc_data(sc, SC_SPIRIT)) {
 		switch (skill_id) {
 			case CR_SHIELDBOOMERANG:
-				if (sc->data[SC_SPIRIT]->val2 == SL_CRUSADER)
+				if (sc_data(sc, SC_SPIRIT)->val2 == SL_CRUSADER)
 					time /= 2;
 				break;
 			case AS_SONICBLOW:
-				if (!map_flag_gvg2(bl->m) && !map[bl->m].flag.battleground && sc->data[SC_SPIRIT]->val2 == SL_ASSASIN)
+				if (!map_flag_gvg2(bl->m) && !map[bl->m].flag.battleground && sc_data(sc, SC_SPIRIT)->val2 == SL_ASSASIN)
 					time /= 2;
 				break;
 		}
@@ -16259,9 +16300,9 @@ int skill_delayfix(struct block_list *bl, uint16 skill_id, uint16 skill_lv)
 
 	if (!(delaynodex&2)) {
 		if (sc && sc->count) {
-			if (sc->data[SC_POEMBRAGI])
-				time -= time * sc->data[SC_POEMBRAGI]->val3 / 100;
-			if (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 3 && (skill_get_ele(skill_id, skill_lv) == ELE_WIND))
+			if (sc_data(sc, SC_POEMBRAGI))
+				time -= time * sc_data(sc, SC_POEMBRAGI)->val3 / 100;
+			if (sc_data(sc, SC_WIND_INSIGNIA) && sc_data(sc, SC_WIND_INSIGNIA)->val1 == 3 && (skill_get_ele(skill_id, skill_lv) == ELE_WIND))
 				time /= 2; //After Delay of Wind element spells reduced by 50%
 		}
 	}
@@ -16619,7 +16660,7 @@ int skill_autospell(struct map_session_data *sd, uint16 skill_id)
 	if(skill_id == MG_NAPALMBEAT)
 		maxlv = 3;
 	else if(skill_id == MG_COLDBOLT || skill_id == MG_FIREBOLT || skill_id == MG_LIGHTNINGBOLT) {
-		if(sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SAGE)
+		if(sc_data(&sd->sc, SC_SPIRIT) && sc_data(&sd->sc, SC_SPIRIT)->val2 == SL_SAGE)
 			maxlv = 10; //Soul Linker bonus. [Skotlex]
 		else if(skill_lv == 2)
 			maxlv = 1;
@@ -17017,6 +17058,7 @@ int skill_detonator(struct block_list *bl, va_list ap)
 				unit->group->limit = DIFF_TICK(gettick(),unit->group->tick);
 			else
 				unit->group->limit = DIFF_TICK(gettick(),unit->group->tick) + 1500;
+			skill_unit_group_wake(unit->group);
 			break;
 	}
 	return 0;
@@ -17045,6 +17087,7 @@ static int skill_bind_trap(struct block_list *bl, va_list ap) {
 	clif_changetraplook(bl,UNT_USED_TRAPS);
 	su->group->unit_id = UNT_USED_TRAPS;
 	su->group->limit = DIFF_TICK(gettick(),su->group->tick) + 500;
+	skill_unit_group_wake(su->group);
 	return 1;
 }
 
@@ -17302,6 +17345,7 @@ static int skill_trap_splash(struct block_list *bl, va_list ap)
 						clif_changetraplook(bl, UNT_USED_TRAPS);
 						su->group->limit = DIFF_TICK(gettick(),su->group->tick) + 1500;
 						su->group->unit_id = UNT_USED_TRAPS;
+						skill_unit_group_wake(su->group);
 						break;
 				}
 			}
@@ -17362,7 +17406,7 @@ void skill_enchant_elemental_end(struct block_list *bl, int type)
 		return;
 
 	for (i = 0; i < ARRAYLENGTH(scs); i++)
-		if (type != scs[i] && sc->data[scs[i]])
+		if (type != scs[i] && sc_data(sc, scs[i]))
 			status_change_end(bl, scs[i], INVALID_TIMER);
 }
 
@@ -17431,7 +17475,7 @@ bool skill_can_cloak(struct map_session_data *sd)
 int skill_check_cloaking_end(struct block_list *bl, va_list ap) {
 	TBL_PC *sd = BL_CAST(BL_PC, bl);
 
-	if( sd && sd->sc.data[SC_CLOAKING] && !skill_can_cloak(sd) )
+	if( sd && sc_data(&sd->sc, SC_CLOAKING) && !skill_can_cloak(sd) )
 		status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 
 	return 0;
@@ -17483,8 +17527,8 @@ bool skill_check_shadowform(struct block_list *bl, int64 damage, int hit)
 
 	sc = status_get_sc(bl);
 
-	if( sc && sc->data[SC__SHADOWFORM] ) {
-		struct block_list *src = map_id2bl(sc->data[SC__SHADOWFORM]->val2);
+	if( sc && sc_data(sc, SC__SHADOWFORM) ) {
+		struct block_list *src = map_id2bl(sc_data(sc, SC__SHADOWFORM)->val2);
 
 		if( !src || src->m != bl->m ) { 
 			status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
@@ -17499,8 +17543,8 @@ bool skill_check_shadowform(struct block_list *bl, int64 damage, int hit)
 			return false;
 		}
 
-		if( (sc->data[SC__SHADOWFORM]->val3 -= hit) <= 0 ) {
-			int temp = sc->data[SC__SHADOWFORM]->val3 + hit;
+		if( (sc_data(sc, SC__SHADOWFORM)->val3 -= hit) <= 0 ) {
+			int temp = sc_data(sc, SC__SHADOWFORM)->val3 + hit;
 
 			status_damage(src, bl, (damage / hit) * (hit - temp), 0, 0, 0);
 			status_damage(bl, src, (damage / hit) * (hit - (hit - temp)), 0,
@@ -17535,7 +17579,7 @@ struct skill_unit *skill_initunit(struct skill_unit_group *group, int idx, int x
 	nullpo_retr(NULL, group->unit); //Crash-protection against poor coding
 	nullpo_retr(NULL, (unit =& group->unit[idx]));
 
-	if(tsc && tsc->data[SC__MAELSTROM])
+	if(tsc && sc_data(tsc, SC__MAELSTROM))
 		return unit;
 
 	if(!unit->alive)
@@ -17553,7 +17597,6 @@ struct skill_unit *skill_initunit(struct skill_unit_group *group, int idx, int x
 	unit->val3 = val3;
 
 	//Stores new skill unit
-	idb_put(skillunit_db, unit->bl.id, unit);
 	map_addiddb(&unit->bl);
 	if (map_addblock(&unit->bl))
 		return NULL;
@@ -17634,8 +17677,8 @@ int skill_delunit(struct skill_unit *unit)
 			if( group->val2 ) { //Someone Traped
 				struct status_change *tsc = status_get_sc(map_id2bl(group->val2));
 
-				if( tsc && tsc->data[SC__MANHOLE] )
-					tsc->data[SC__MANHOLE]->val4 = 0; //Remove the Unit ID
+				if( tsc && sc_data(tsc, SC__MANHOLE) )
+					sc_data(tsc, SC__MANHOLE)->val4 = 0; //Remove the Unit ID
 			}
 			break;
 	}
@@ -17644,7 +17687,6 @@ int skill_delunit(struct skill_unit *unit)
 	unit->group = NULL;
 	map_delblock(&unit->bl); //Don't free yet
 	map_deliddb(&unit->bl);
-	idb_remove(skillunit_db,unit->bl.id);
 
 	if( --group->alive_count == 0 )
 		skill_delunitgroup(group);
@@ -17750,6 +17792,7 @@ struct skill_unit_group* skill_initunitgroup(struct block_list *src, int count,
 	group->interval      = interval;
 	group->tick          = gettick();
 	group->valstr        = NULL;
+	group->timer         = add_timer(group->tick + SKILLUNITTIMER_INTERVAL, skill_unit_group_timer, group->group_id, 0);
 
 	ud->skillunit[i] = group;
 
@@ -17809,8 +17852,8 @@ int skill_delunitgroup_(struct skill_unit_group *group, const char *file, int li
 	sc = status_get_sc(src);
 
 	if( skill_get_unit_flag(group->skill_id)&(UF_DANCE|UF_SONG|UF_ENSEMBLE) ) {
-		if( sc && sc->data[SC_DANCING] ) {
-			sc->data[SC_DANCING]->val2 = 0 ; //This prevents status_change_end attempting to redelete the group [Skotlex]
+		if( sc && sc_data(sc, SC_DANCING) ) {
+			sc_data(sc, SC_DANCING)->val2 = 0 ; //This prevents status_change_end attempting to redelete the group [Skotlex]
 			status_change_end(src, SC_DANCING, INVALID_TIMER);
 		}
 	}
@@ -17822,8 +17865,8 @@ int skill_delunitgroup_(struct skill_unit_group *group, const char *file, int li
 		case UNT_BASILICA:   i = SC_BASILICA;   break;
 	}
 
-	if( i != SC_NONE && sc && sc->data[i] ) {
-		sc->data[i]->val3 = 0; //Remove reference to this group [Skotlex]
+	if( i != SC_NONE && sc && sc_data(sc, i) ) {
+		sc_data(sc, i)->val3 = 0; //Remove reference to this group [Skotlex]
 		status_change_end(src, (sc_type)i, INVALID_TIMER);
 	}
 
@@ -17831,26 +17874,26 @@ int skill_delunitgroup_(struct skill_unit_group *group, const char *file, int li
 		case SG_SUN_WARM:
 		case SG_MOON_WARM:
 		case SG_STAR_WARM:
-			if( sc && sc->data[SC_WARM] ) {
-				sc->data[SC_WARM]->val4 = 0;
+			if( sc && sc_data(sc, SC_WARM) ) {
+				sc_data(sc, SC_WARM)->val4 = 0;
 				status_change_end(src, SC_WARM, INVALID_TIMER);
 			}
 			break;
 		case NC_NEUTRALBARRIER:
-			if( sc && sc->data[SC_NEUTRALBARRIER_MASTER] ) {
-				sc->data[SC_NEUTRALBARRIER_MASTER]->val2 = 0;
+			if( sc && sc_data(sc, SC_NEUTRALBARRIER_MASTER) ) {
+				sc_data(sc, SC_NEUTRALBARRIER_MASTER)->val2 = 0;
 				status_change_end(src, SC_NEUTRALBARRIER_MASTER, INVALID_TIMER);
 			}
 			break;
 		case NC_STEALTHFIELD:
-			if( sc && sc->data[SC_STEALTHFIELD_MASTER] ) {
-				sc->data[SC_STEALTHFIELD_MASTER]->val2 = 0;
+			if( sc && sc_data(sc, SC_STEALTHFIELD_MASTER) ) {
+				sc_data(sc, SC_STEALTHFIELD_MASTER)->val2 = 0;
 				status_change_end(src, SC_STEALTHFIELD_MASTER, INVALID_TIMER);
 			}
 			break;
 		case LG_BANDING:
-			if( sc && sc->data[SC_BANDING] ) {
-				sc->data[SC_BANDING]->val4 = 0;
+			if( sc && sc_data(sc, SC_BANDING) ) {
+				sc_data(sc, SC_BANDING)->val4 = 0;
 				status_change_end(src, SC_BANDING, INVALID_TIMER);
 			}
 			break;
@@ -17872,6 +17915,11 @@ int skill_delunitgroup_(struct skill_unit_group *group, const char *file, int li
 		group->valstr = NULL;
 	}
 
+	if( group->timer != INVALID_TIMER ) {
+		delete_timer(group->timer, skill_unit_group_timer);
+		group->timer = INVALID_TIMER;
+	}
+
 	idb_remove(skillunit_group_db, group->group_id);
 	map_freeblock(&group->unit->bl); //Schedules deallocation of whole array (HACK)
 	group->unit = NULL;
@@ -17972,6 +18020,7 @@ int skill_unit_timer_sub_onplace(struct block_list *bl, va_list ap)
 	struct skill_unit *unit = va_arg(ap,struct skill_unit *);
 	struct skill_unit_group* group = NULL;
 	unsigned int tick = va_arg(ap,unsigned int);
+	int *present = va_arg(ap,int *);
 
 	if( !unit || !unit->alive || !unit->group )
 		return 0;
@@ -17979,6 +18028,8 @@ int skill_unit_timer_sub_onplace(struct block_list *bl, va_list ap)
 	if( bl->prev == NULL )
 		return 0;
 
+	(*present)++; //Keeps the group polling while something stands in range, valid target or not
+
 	group = unit->group;
 
 	if( !(skill_get_inf2(group->skill_id)&(INF2_TRAP)) && !(skill_get_inf3(group->skill_id)&(INF3_NOLP)) &&
@@ -17993,19 +18044,21 @@ int skill_unit_timer_sub_onplace(struct block_list *bl, va_list ap)
 }
 
 /**
- * @see DBApply
- * Sub function of skill_unit_timer for executing each skill unit from skillunit_db
+ * Sub function of skill_unit_group_timer for executing each skill unit of the group
+ * @param unit: Skill unit
+ * @param tick: Current tick
+ * @return True if the unit has to be processed again on the next SKILLUNITTIMER_INTERVAL,
+ *  false if nothing happens to it until it expires or is woken up
  */
-static int skill_unit_timer_sub(DBKey key, DBData *data, va_list ap)
+static bool skill_unit_timer_sub(struct skill_unit *unit, unsigned int tick)
 {
-	struct skill_unit *unit = (struct skill_unit *)db_data2ptr(data);
 	struct skill_unit_group* group = NULL;
-	unsigned int tick = va_arg(ap,unsigned int);
 	bool dissonance;
 	struct block_list *bl = &unit->bl;
+	int present = 0;
 
 	if( !unit || !unit->alive || !unit->group )
-		return 0;
+		return false;
 
 	group = unit->group;
 
@@ -18122,7 +18175,7 @@ static int skill_unit_timer_sub(DBKey key, DBData *data, va_list ap)
 					struct block_list *src = map_id2bl(group->src_id);
 					struct status_change *sc = status_get_sc(src);
 
-					if( !src || !sc || !sc->data[SC_BANDING] ) {
+					if( !src || !sc || !sc_data(sc, SC_BANDING) ) {
 						skill_delunit(unit);
 						break;
 					}
@@ -18196,15 +18249,15 @@ static int skill_unit_timer_sub(DBKey key, DBData *data, va_list ap)
 
 	//Don't continue if unit is expired and has been deleted
 	if( !unit->alive )
-		return 0;
+		return false;
 
 	dissonance = skill_dance_switch(unit,0);
 
 	if( unit->range >= 0 && group->interval != -1 ) {
 		if( battle_config.skill_wall_check )
-			map_foreachinshootrange(skill_unit_timer_sub_onplace,bl,unit->range,group->bl_flag,bl,tick);
+			map_foreachinshootrange(skill_unit_timer_sub_onplace,bl,unit->range,group->bl_flag,bl,tick,&present);
 		else
-			map_foreachinrange(skill_unit_timer_sub_onplace,bl,unit->range,group->bl_flag,bl,tick);
+			map_foreachinrange(skill_unit_timer_sub_onplace,bl,unit->range,group->bl_flag,bl,tick,&present);
 
 		if( unit->range == -1 ) //Unit disabled, but it should not be deleted yet
 			group->unit_id = UNT_USED_TRAPS;
@@ -18220,21 +18273,91 @@ static int skill_unit_timer_sub(DBKey key, DBData *data, va_list ap)
 
 	if( dissonance )
 		skill_dance_switch(unit,1);
-	return 0;
+	return (present > 0 || (unit->alive && (unit->range > SKILLUNIT_WAKE_RANGE || (unit->group && unit->group->unit_id == UNT_ICEWALL))));
 }
-/*==========================================
- * Executes on all skill units every SKILLUNITTIMER_INTERVAL miliseconds.
- *------------------------------------------*/
-int skill_unit_timer(int tid, unsigned int tick, int id, intptr_t data)
+/**
+ * Executes the units of a skill unit group.
+ * Groups with something standing in range (or with per-tick effects) run every SKILLUNITTIMER_INTERVAL,
+ * the others sleep until their earliest unit expires or skill_unit_group_wake is called on them.
+ */
+static int skill_unit_group_timer(int tid, unsigned int tick, int id, intptr_t data)
 {
-	map_freeblock_lock();
+	struct skill_unit_group *group = skill_id2group(id);
+	struct skill_unit *units;
+	unsigned int next;
+	bool busy = false;
+	int i, count, expire;
 
-	skillunit_db->foreach(skillunit_db, skill_unit_timer_sub, tick);
+	if( !group || group->timer != tid )
+		return 0;
+
+	group->timer = INVALID_TIMER;
+	units = group->unit;
+	count = group->unit_count;
+
+	map_freeblock_lock(); //Keeps the unit array around if the group gets deleted midway
+
+	for( i = 0; i < count; i++ ) {
+		if( skill_id2group(id) != group )
+			break; //Group was deleted
+		if( skill_unit_timer_sub(&units[i], tick) )
+			busy = true;
+	}
+
+	if( skill_id2group(id) == group && group->unit ) {
+		if( busy )
+			next = tick + SKILLUNITTIMER_INTERVAL;
+		else {
+			expire = (group->state.guildaura ? INT_MAX : group->limit);
+			for( i = 0; i < group->unit_count; i++ ) {
+				if( group->unit[i].alive )
+					expire = min(expire, group->unit[i].limit);
+			}
+			next = group->tick + expire;
+			if( expire == INT_MAX || DIFF_TICK(next, tick) > SKILLUNITTIMER_IDLE_MAX )
+				next = tick + SKILLUNITTIMER_IDLE_MAX;
+			else if( DIFF_TICK(next, tick) <= 0 )
+				next = tick + SKILLUNITTIMER_INTERVAL;
+		}
+		group->timer = add_timer(next, skill_unit_group_timer, id, 0);
+	}
 
 	map_freeblock_unlock();
 	return 0;
 }
 
+/**
+ * Makes a sleeping skill unit group run on the next timer pass,
+ * called when something happens to it that the group can't foresee (a target stepping in, damage, limit changes)
+ * @param group: Skill unit group
+ */
+void skill_unit_group_wake(struct skill_unit_group *group)
+{
+	const struct TimerData *td;
+	unsigned int tick = gettick();
+
+	if( !group || group->timer == INVALID_TIMER )
+		return; //Currently running, it reschedules itself
+	if( (td = get_timer(group->timer)) && DIFF_TICK(td->tick, tick) > 0 )
+		settick_timer(group->timer, tick);
+}
+
+/**
+ * Wakes the group of a unit whose range covers the target's cell
+ * @param bl: Skill unit
+ * @param ap: Target
+ */
+static int skill_unit_wake_sub(struct block_list *bl, va_list ap)
+{
+	struct skill_unit *unit = (struct skill_unit *)bl;
+	struct block_list *target = va_arg(ap,struct block_list *);
+
+	if( !unit->alive || !unit->group || unit->range <= 0 || !check_distance_bl(&unit->bl, target, unit->range) )
+		return 0;
+	skill_unit_group_wake(unit->group);
+	return 1;
+}
+
 static int skill_unit_temp[20]; //Temporary storage for tracking skill unit skill ids as players move in/out of them
 /*==========================================
  * Flag :
@@ -18267,6 +18390,9 @@ int skill_unit_move_sub(struct block_list *bl, va_list ap)
 	//Necessary in case the group is deleted after calling on_place/on_out [Skotlex]
 	skill_id = group->skill_id;
 
+	if( flag&1 ) //Something stepped in, let the group pick it up on its next pass
+		skill_unit_group_wake(group);
+
 	if( flag&1 && (skill_id == PF_SPIDERWEB || skill_id == GN_THORNS_TRAP) )
 		return 0; //Fiberlock is never supposed to trigger on skill_unit_move [Inkfish]
 
@@ -18338,6 +18464,19 @@ int skill_unit_move_sub(struct block_list *bl, va_list ap)
 	}
 }
 
+/// skill_unit_move calls, and how many of them found no skill unit in the block
+static struct {
+	unsigned int calls, skipped;
+} skill_unit_move_stats;
+
+/// Displays how often skill_unit_move could skip the cell scan.
+void skill_unit_move_report(void)
+{
+	ShowMessage(CL_BOLD"[Skill unit move report]\n"CL_NORMAL);
+	ShowMessage("\tcalls: %u, skipped: %u (%u%%)\n", skill_unit_move_stats.calls, skill_unit_move_stats.skipped,
+		(skill_unit_move_stats.calls ? (unsigned int)((uint64)skill_unit_move_stats.skipped * 100 / skill_unit_move_stats.calls) : 0));
+}
+
 /*==========================================
  * Invoked when a char has moved and unit cells must be invoked (onplace, onout, onleft)
  * Flag values:
@@ -18356,7 +18495,19 @@ int skill_unit_move(struct block_list *bl, unsigned int tick, int flag)
 	if( (flag&2) && !(flag&1) ) //Onout, clear data
 		memset(skill_unit_temp, 0, sizeof(skill_unit_temp));
 
-	map_foreachincell(skill_unit_move_sub,bl->m,bl->x,bl->y,BL_SKILL,bl,tick,flag);
+	skill_unit_move_stats.calls++;
+	if( map_block_skillunits(bl->m,bl->x,bl->y) )
+		map_foreachincell(skill_unit_move_sub,bl->m,bl->x,bl->y,BL_SKILL,bl,tick,flag);
+	else
+		skill_unit_move_stats.skipped++; //No skill unit in this block, nothing to trigger
+
+	if( flag&1 ) { //Units with a range (traps) fire on targets next to them, wake them too
+		int16 x0 = max(bl->x - SKILLUNIT_WAKE_RANGE, 0), x1 = min(bl->x + SKILLUNIT_WAKE_RANGE, map[bl->m].xs - 1);
+		int16 y0 = max(bl->y - SKILLUNIT_WAKE_RANGE, 0), y1 = min(bl->y + SKILLUNIT_WAKE_RANGE, map[bl->m].ys - 1);
+
+		if( map_block_skillunits(bl->m,x0,y0) || map_block_skillunits(bl->m,x1,y0) || map_block_skillunits(bl->m,x0,y1) || map_block_skillunits(bl->m,x1,y1) )
+			map_foreachinrange(skill_unit_wake_sub,bl,SKILLUNIT_WAKE_RANGE,BL_SKILL,bl);
+	}
 
 	if( (flag&2) && (flag&1) ) { //Onplace, check any skill units you have left
 		int i;
@@ -18467,6 +18618,7 @@ void skill_unit_move_unit_group(struct skill_unit_group *group, int16 m, int16 d
 	}
 
 	aFree(m_flag);
+	skill_unit_group_wake(group); //Cells may have landed on someone
 }
 
 /**
@@ -19252,11 +19404,11 @@ void skill_toggle_magicpower(struct block_list *bl, uint16 skill_id)
 		return;
 
 	//SC_MAGICPOWER needs to switch states before any damage is actually dealt
-	if (sc && sc->count && sc->data[SC_MAGICPOWER]) {
-		if (sc->data[SC_MAGICPOWER]->val4)
+	if (sc && sc->count && sc_data(sc, SC_MAGICPOWER)) {
+		if (sc_data(sc, SC_MAGICPOWER)->val4)
 			status_change_end(bl, SC_MAGICPOWER, INVALID_TIMER);
 		else {
-			sc->data[SC_MAGICPOWER]->val4 = 1;
+			sc_data(sc, SC_MAGICPOWER)->val4 = 1;
 			status_calc_bl(bl, status_sc2scb_flag(SC_MAGICPOWER));
 #ifndef RENEWAL
 			if (bl->type == BL_PC) { //Update current display
@@ -19333,7 +19485,7 @@ void skill_spellbook(struct map_session_data *sd, unsigned short nameid) {
 	status_change_end(&sd->bl, SC_STOP, INVALID_TIMER);
 
 	for( i = SC_SPELLBOOK1; i <= SC_MAXSPELLBOOK; i++ )
-		if( !(sc && sc->data[i]) )
+		if( !(sc && sc_data(sc, i)) )
 			break;
 
 	if( i > SC_MAXSPELLBOOK ) {
@@ -19354,14 +19506,14 @@ void skill_spellbook(struct map_session_data *sd, unsigned short nameid) {
 	max_preserve = 4 * pc_checkskill(sd, WL_FREEZE_SP) + status_get_int(&sd->bl) / 10 + sd->status.base_level / 10;
 	point = skill_spellbook_db[i].point;
 
-	if( sc && sc->data[SC_FREEZE_SP] ) {
-		if( (sc->data[SC_FREEZE_SP]->val2 + point) > max_preserve ) {
+	if( sc && sc_data(sc, SC_FREEZE_SP) ) {
+		if( (sc_data(sc, SC_FREEZE_SP)->val2 + point) > max_preserve ) {
 			clif_skill_fail(sd, WL_READING_SB, USESKILL_FAIL_SPELLBOOK_PRESERVATION_POINT, 0, 0);
 			return;
 		}
 		for( i = SC_MAXSPELLBOOK; i >= SC_SPELLBOOK1; i-- ) { //This is how official seals the spells [malufett]
-			if( !sc->data[i] ) {
-				sc->data[SC_FREEZE_SP]->val2 += point; //Increase points
+			if( !sc_data(sc, i) ) {
+				sc_data(sc, SC_FREEZE_SP)->val2 += point; //Increase points
 				sc_start4(&sd->bl, &sd->bl, (sc_type)i, 100, skill_id, pc_checkskill(sd, skill_id), point, 0, INVALID_TIMER);
 				break;
 			}
@@ -19377,8 +19529,8 @@ int skill_select_menu(struct map_session_data *sd,uint16 skill_id) {
 
 	nullpo_ret(sd);
 
-	if (sd->sc.data[SC_STOP]) {
-		aslvl = sd->sc.data[SC_STOP]->val1;
+	if (sc_data(&sd->sc, SC_STOP)) {
+		aslvl = sc_data(&sd->sc, SC_STOP)->val1;
 		status_change_end(&sd->bl,SC_STOP,INVALID_TIMER);
 	}
 
@@ -20347,16 +20499,16 @@ int skill_disable_check(struct status_change *sc, uint16 skill_id)
 		case KO_YAMIKUMO:
 		case RA_WUGDASH:
 		case RA_CAMOUFLAGE:
-			if( sc->data[status_skill2sc(skill_id)] )
+			if( sc_data(sc, status_skill2sc(skill_id)) )
 				return 1;
 			break;
 		//These 2 skills contain a master and are not correctly pulled using skill2sc
 		case NC_NEUTRALBARRIER:
-			if( sc->data[SC_NEUTRALBARRIER_MASTER] )
+			if( sc_data(sc, SC_NEUTRALBARRIER_MASTER) )
 				return 1;
 			break;
 		case NC_STEALTHFIELD:
-			if( sc->data[SC_STEALTHFIELD_MASTER] )
+			if( sc_data(sc, SC_STEALTHFIELD_MASTER) )
 				return 1;
 			break;
 	}
@@ -21046,23 +21198,22 @@ void skill_reload (void) {
  *------------------------------------------*/
 void do_init_skill(void)
 {
+	skill_init_index_table();
 	skilldb_name2id = strdb_alloc(DB_OPT_DUP_KEY|DB_OPT_RELEASE_DATA, 0);
 	skill_readdb();
 
 	skillunit_group_db = idb_alloc(DB_OPT_BASE);
-	skillunit_db = idb_alloc(DB_OPT_BASE);
 	skillusave_db = idb_alloc(DB_OPT_RELEASE_DATA);
 	bowling_db = idb_alloc(DB_OPT_BASE);
 	skill_unit_ers = ers_new(sizeof(struct skill_unit_group),"skill.c::skill_unit_ers",ERS_OPT_NONE);
 	skill_timer_ers  = ers_new(sizeof(struct skill_timerskill),"skill.c::skill_timer_ers",ERS_OPT_NONE);
 
-	add_timer_func_list(skill_unit_timer,"skill_unit_timer");
+	add_timer_func_list(skill_unit_group_timer,"skill_unit_group_timer");
 	add_timer_func_list(skill_castend_id,"skill_castend_id");
 	add_timer_func_list(skill_castend_pos,"skill_castend_pos");
 	add_timer_func_list(skill_timerskill,"skill_timerskill");
 	add_timer_func_list(skill_blockpc_end, "skill_blockpc_end");
 
-	add_timer_interval(gettick() + SKILLUNITTIMER_INTERVAL,skill_unit_timer,0,0,SKILLUNITTIMER_INTERVAL);
 }
 
 void do_final_skill(void)
@@ -21070,7 +21221,6 @@ void do_final_skill(void)
 	skill_destroy_requirement();
 	db_destroy(skilldb_name2id);
 	db_destroy(skillunit_group_db);
-	db_destroy(skillunit_db);
 	db_destroy(skillusave_db);
 	db_destroy(bowling_db);
 	ers_destroy(skill_unit_ers);
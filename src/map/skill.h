@@ -232,6 +232,7 @@ struct skill_unit_group {
 	int unit_count, //Number of unit at this group
 		alive_count; //Number of alive unit
 	int item_id; //Store item used.
+	int timer; //Next run of the group's units (skill_unit_group_timer)
 	struct skill_unit *unit; //Skill Unit
 	struct {
 		unsigned ammo_consume : 1; //Need to consume ammo
@@ -410,6 +411,8 @@ int skill_check_unit_cell(uint16 skill_id, int16 m, int16 x, int16 y, int unit_i
 int skill_unit_out_all(struct block_list *bl, unsigned int tick, int range);
 int skill_unit_move(struct block_list *bl, unsigned int tick, int flag);
 void skill_unit_move_unit_group(struct skill_unit_group *group, int16 m, int16 dx, int16 dy);
+void skill_unit_group_wake(struct skill_unit_group *group);
+void skill_unit_move_report(void);
 
 struct skill_unit_group *skill_check_dancing(struct block_list *src);
 
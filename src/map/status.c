@@ -1427,14 +1427,14 @@ int status_damage(struct block_list *src, struct block_list *target, int64 in_hp
 		//return 0; //Cannot damage a bl not on a map, except when "charging" hp/sp
 
 	sc = status_get_sc(target);
-	if (hp && battle_config.invincible_nodamage && src && sc && sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF])
+	if (hp && battle_config.invincible_nodamage && src && sc && sc_data(sc, SC_INVINCIBLE) && !sc_data(sc, SC_INVINCIBLEOFF))
 		hp = 1;
 
 	if (hp && !(flag&1)) {
 		if (sc) {
 			struct status_change_entry *sce;
 
-			if (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+			if (sc_data(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 				status_change_end(target, SC_STONE, INVALID_TIMER);
 			status_change_end(target, SC_FREEZE, INVALID_TIMER);
 			status_change_end(target, SC_SLEEP, INVALID_TIMER);
@@ -1449,10 +1449,10 @@ int status_damage(struct block_list *src, struct block_list *target, int64 in_hp
 			status_change_end(target, SC_SITDOWN_FORCE, INVALID_TIMER);
 			status_change_end(target, SC_BANANA_BOMB_SITDOWN, INVALID_TIMER);
 			//Endure count is only reduced by non-players on non-gvg maps
-			if ((sce = sc->data[SC_ENDURE]) && !sce->val4 && //val4 signals infinite endure [Skotlex]
+			if ((sce = sc_data(sc, SC_ENDURE)) && !sce->val4 && //val4 signals infinite endure [Skotlex]
 				src && src->type != BL_PC && !map_flag_gvg2(target->m) && !map[target->m].flag.battleground && --(sce->val2) < 0)
 				status_change_end(target, SC_ENDURE, INVALID_TIMER);
-			if ((sce = sc->data[SC_GRAVITATION]) && sce->val3 == BCT_SELF) {
+			if ((sce = sc_data(sc, SC_GRAVITATION)) && sce->val3 == BCT_SELF) {
 				struct skill_unit_group *sg = skill_id2group(sce->val4);
 
 				if (sg) {
@@ -1461,11 +1461,11 @@ int status_damage(struct block_list *src, struct block_list *target, int64 in_hp
 					status_change_end(target, SC_GRAVITATION, INVALID_TIMER);
 				}
 			}
-			if (sc->data[SC_DANCING] && (unsigned int)hp > (status->max_hp>>2))
+			if (sc_data(sc, SC_DANCING) && (unsigned int)hp > (status->max_hp>>2))
 				status_change_end(target, SC_DANCING, INVALID_TIMER);
-			if (sc->data[SC_CLOAKINGEXCEED] && --(sc->data[SC_CLOAKINGEXCEED]->val2) <= 0)
+			if (sc_data(sc, SC_CLOAKINGEXCEED) && --(sc_data(sc, SC_CLOAKINGEXCEED)->val2) <= 0)
 				status_change_end(target, SC_CLOAKINGEXCEED, INVALID_TIMER);
-			if (sc->data[SC_KAGEMUSYA] && --(sc->data[SC_KAGEMUSYA]->val3) <= 0)
+			if (sc_data(sc, SC_KAGEMUSYA) && --(sc_data(sc, SC_KAGEMUSYA)->val3) <= 0)
 				status_change_end(target, SC_KAGEMUSYA, INVALID_TIMER);
 		}
 
@@ -1478,13 +1478,13 @@ int status_damage(struct block_list *src, struct block_list *target, int64 in_hp
 	status->sp -= sp;
 
 	if (sc && hp && status->hp) {
-		if (sc->data[SC_AUTOBERSERK] && (!sc->data[SC_PROVOKE] || !sc->data[SC_PROVOKE]->val2) && status->hp < status->max_hp>>2)
+		if (sc_data(sc, SC_AUTOBERSERK) && (!sc_data(sc, SC_PROVOKE) || !sc_data(sc, SC_PROVOKE)->val2) && status->hp < status->max_hp>>2)
 			sc_start4(src, target, SC_PROVOKE, 100, 10, 1, 0, 0, 0);
-		if (sc->data[SC_BERSERK] && status->hp <= 100)
+		if (sc_data(sc, SC_BERSERK) && status->hp <= 100)
 			status_change_end(target, SC_BERSERK, INVALID_TIMER);
-		if (sc->data[SC_RAISINGDRAGON] && status->hp <= 1000)
+		if (sc_data(sc, SC_RAISINGDRAGON) && status->hp <= 1000)
 			status_change_end(target, SC_RAISINGDRAGON, INVALID_TIMER);
-		if (sc->data[SC_SATURDAYNIGHTFEVER] && status->hp <= 100)
+		if (sc_data(sc, SC_SATURDAYNIGHTFEVER) && status->hp <= 100)
 			status_change_end(target, SC_SATURDAYNIGHTFEVER, INVALID_TIMER);
 	}
 
@@ -1543,14 +1543,14 @@ int status_damage(struct block_list *src, struct block_list *target, int64 in_hp
 		}
 	}
    
-	if (sc && sc->data[SC_KAIZEL] && !map_flag_gvg2(target->m)) { //flag&8 = disable Kaizel
-		int time = skill_get_time2(SL_KAIZEL,sc->data[SC_KAIZEL]->val1);
+	if (sc && sc_data(sc, SC_KAIZEL) && !map_flag_gvg2(target->m)) { //flag&8 = disable Kaizel
+		int time = skill_get_time2(SL_KAIZEL,sc_data(sc, SC_KAIZEL)->val1);
 
 		//Look for Osiris Card's bonus effect on the character and revive 100% or revive normally
 		if (target->type == BL_PC && BL_CAST(BL_PC,target)->special_state.restart_full_recover)
 			status_revive(target,100,100);
 		else
-			status_revive(target,sc->data[SC_KAIZEL]->val2,0);
+			status_revive(target,sc_data(sc, SC_KAIZEL)->val2,0);
 		status_change_clear(target,0);
 		clif_skill_nodamage(target,target,ALL_RESURRECTION,1,1);
 		sc_start(src,target,status_skill2sc(PR_KYRIE),100,10,time);
@@ -1560,8 +1560,8 @@ int status_damage(struct block_list *src, struct block_list *target, int64 in_hp
 	}
 
 	//Ensure the monster has not already rebirthed before doing so
-	if (target->type == BL_MOB && sc && sc->data[SC_REBIRTH] && !((TBL_MOB*) target)->state.rebirth) {
-		status_revive(target,sc->data[SC_REBIRTH]->val2,0);
+	if (target->type == BL_MOB && sc && sc_data(sc, SC_REBIRTH) && !((TBL_MOB*) target)->state.rebirth) {
+		status_revive(target,sc_data(sc, SC_REBIRTH)->val2,0);
 		status_change_clear(target,0);
 		((TBL_MOB*)target)->state.rebirth = 1;
 		return (int)(hp + sp);
@@ -1630,7 +1630,7 @@ int status_heal(struct block_list *bl, int64 in_hp, int64 in_sp, int flag)
 	}
 
 	if (hp) {
-		if (sc && (sc->data[SC_BERSERK] || sc->data[SC_SATURDAYNIGHTFEVER])) {
+		if (sc && (sc_data(sc, SC_BERSERK) || sc_data(sc, SC_SATURDAYNIGHTFEVER))) {
 			if (flag&1)
 				flag &= ~2;
 			else
@@ -1657,9 +1657,9 @@ int status_heal(struct block_list *bl, int64 in_hp, int64 in_sp, int flag)
 	status->sp += sp;
 
 	if (hp && sc &&
-		sc->data[SC_AUTOBERSERK] &&
-		sc->data[SC_PROVOKE] &&
-		sc->data[SC_PROVOKE]->val2 == 1 &&
+		sc_data(sc, SC_AUTOBERSERK) &&
+		sc_data(sc, SC_PROVOKE) &&
+		sc_data(sc, SC_PROVOKE)->val2 == 1 &&
 		status->hp >= status->max_hp>>2) //End auto berserk
 		status_change_end(bl, SC_PROVOKE, INVALID_TIMER);
 
@@ -1840,7 +1840,7 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 		//on dead characters, said checks are left to skill.c [Skotlex]
 		if (target && status_isdead(target))
 			return false;
-		if (src && sc && sc->data[SC_CRYSTALIZE])
+		if (src && sc && sc_data(sc, SC_CRYSTALIZE))
 			return false;
 	}
 
@@ -1864,9 +1864,9 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 	}
 
 	if (sc && sc->count) {
-		if (sc->data[SC_ALL_RIDING])
+		if (sc_data(sc, SC_ALL_RIDING))
 			return false; //New mounts can't attack nor use skills in the client. This check makes it cheat-safe [Ind]
-		if (sc->data[SC_ASH] && rnd()%2 && src->type == BL_PC) { //Gain 50% of failing rate when casting skills
+		if (sc_data(sc, SC_ASH) && rnd()%2 && src->type == BL_PC) { //Gain 50% of failing rate when casting skills
 			clif_skill_fail((TBL_PC *)src, skill_id, 0, 0, 0);
 			return false;
 		}
@@ -1877,18 +1877,18 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 			if (!(skill_get_inf(skill_id)&INF_GROUND_SKILL))
 				return false; //Targetted spells can't come off
 		}
-		if ((sc->data[SC_TRICKDEAD] && skill_id != NV_TRICKDEAD) ||
-			(sc->data[SC_AUTOCOUNTER] && !flag && skill_id) ||
-			(sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF && skill_id != PA_GOSPEL))
+		if ((sc_data(sc, SC_TRICKDEAD) && skill_id != NV_TRICKDEAD) ||
+			(sc_data(sc, SC_AUTOCOUNTER) && !flag && skill_id) ||
+			(sc_data(sc, SC_GOSPEL) && sc_data(sc, SC_GOSPEL)->val4 == BCT_SELF && skill_id != PA_GOSPEL))
 			return false;
-		if (sc->data[SC_WINKCHARM] && target && !flag) { //Prevents skill usage
+		if (sc_data(sc, SC_WINKCHARM) && target && !flag) { //Prevents skill usage
 			if (unit_bl2ud(src) && (unit_bl2ud(src))->walktimer == INVALID_TIMER)
-				unit_walktobl(src, map_id2bl(sc->data[SC_WINKCHARM]->val2), 3, 1);
+				unit_walktobl(src, map_id2bl(sc_data(sc, SC_WINKCHARM)->val2), 3, 1);
 			clif_emotion(src, E_LV);
 			return false;
 		}
-		if (sc->data[SC_BLADESTOP]) {
-			switch (sc->data[SC_BLADESTOP]->val1) {
+		if (sc_data(sc, SC_BLADESTOP)) {
+			switch (sc_data(sc, SC_BLADESTOP)->val1) {
 				case 5: if (skill_id == MO_EXTREMITYFIST) break;
 				case 4: if (skill_id == MO_CHAINCOMBO) break;
 				case 3: if (skill_id == MO_INVESTIGATE) break;
@@ -1897,18 +1897,18 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 					return false;
 			}
 		}
-		if (sc->data[SC_DANCING] && flag != 2) {
+		if (sc_data(sc, SC_DANCING) && flag != 2) {
 			//Lvl 5 Lesson or higher allow you use 3rd job skills while dancing
 			if (src->type == BL_PC && ((skill_id >= WA_SWING_DANCE && skill_id <= WM_UNLIMITED_HUMMING_VOICE) ||
 				skill_id == WM_FRIGG_SONG)) {
 				if (pc_checkskill((TBL_PC *)src, WM_LESSON) < 5)
 					return false;
-			} else if (sc->data[SC_LONGING]) { //Allow everything except dancing/re-dancing [Skotlex]
+			} else if (sc_data(sc, SC_LONGING)) { //Allow everything except dancing/re-dancing [Skotlex]
 				if (skill_id == BD_ENCORE || (skill_get_inf2(skill_id)&(INF2_SONG_DANCE|INF2_ENSEMBLE_SKILL)))
 					return false;
 			} else if (!(skill_get_inf3(skill_id)&INF3_USABLE_DANCE)) //Skills that can be used in dancing state
 				return false;
-			if ((sc->data[SC_DANCING]->val1&0xFFFF) == CG_HERMODE && skill_id == BD_ADAPTATION)
+			if ((sc_data(sc, SC_DANCING)->val1&0xFFFF) == CG_HERMODE && skill_id == BD_ADAPTATION)
 				return false; //Can't amp out of Wand of Hermode [Skotlex]
 		}
 		if (skill_id &&
@@ -1916,17 +1916,17 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 		{ //Skills blocked through status changes
 			if (!flag && //Blocked only from using the skill (stuff like autospell may still go through
 				(sc->cant.cast ||
-				(sc->data[SC_BASILICA] && (sc->data[SC_BASILICA]->val4 != src->id || skill_id != HP_BASILICA)) || // Only Basilica's caster that can cast, and only Basilica to cancel it
-				(sc->data[SC_MARIONETTE] && skill_id != CG_MARIONETTE) || //Only skill you can use is marionette again to cancel it
-				(sc->data[SC_MARIONETTE2] && skill_id == CG_MARIONETTE) || //Cannot use marionette if you are being buffed by another
-				(sc->data[SC_STASIS] && skill_block_check(src, SC_STASIS, skill_id)) ||
-				(sc->data[SC_KAGEHUMI] && skill_block_check(src, SC_KAGEHUMI, skill_id))))
+				(sc_data(sc, SC_BASILICA) && (sc_data(sc, SC_BASILICA)->val4 != src->id || skill_id != HP_BASILICA)) || // Only Basilica's caster that can cast, and only Basilica to cancel it
+				(sc_data(sc, SC_MARIONETTE) && skill_id != CG_MARIONETTE) || //Only skill you can use is marionette again to cancel it
+				(sc_data(sc, SC_MARIONETTE2) && skill_id == CG_MARIONETTE) || //Cannot use marionette if you are being buffed by another
+				(sc_data(sc, SC_STASIS) && skill_block_check(src, SC_STASIS, skill_id)) ||
+				(sc_data(sc, SC_KAGEHUMI) && skill_block_check(src, SC_KAGEHUMI, skill_id))))
 				return false;
 			//Skill blocking
-			if ((sc->data[SC_VOLCANO] && skill_id == WZ_ICEWALL) ||
-				(sc->data[SC_ROKISWEIL] && skill_id != BD_ADAPTATION) ||
-				(sc->data[SC_HERMODE] && (skill_get_inf(skill_id)&INF_SUPPORT_SKILL)) ||
-				(sc->data[SC_NOCHAT] && (sc->data[SC_NOCHAT]->val1&MANNER_NOSKILL)))
+			if ((sc_data(sc, SC_VOLCANO) && skill_id == WZ_ICEWALL) ||
+				(sc_data(sc, SC_ROKISWEIL) && skill_id != BD_ADAPTATION) ||
+				(sc_data(sc, SC_HERMODE) && (skill_get_inf(skill_id)&INF_SUPPORT_SKILL)) ||
+				(sc_data(sc, SC_NOCHAT) && (sc_data(sc, SC_NOCHAT)->val1&MANNER_NOSKILL)))
 				return false;
 		}
 		if (sc->option) {
@@ -1942,15 +1942,15 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 
 	if (tsc && tsc->count) {
 		//Attacks in invincible are capped to 1 damage and handled in batte.c
-		if (tsc->data[SC_INVINCIBLE] && !tsc->data[SC_INVINCIBLEOFF] && skill_id && !(skill_id&(SA_SPELLBREAKER|SL_SKE)))
+		if (sc_data(tsc, SC_INVINCIBLE) && !sc_data(tsc, SC_INVINCIBLEOFF) && skill_id && !(skill_id&(SA_SPELLBREAKER|SL_SKE)))
 			return false; //Allow spell breaker and eske for sealed shrine GDB when in INVINCIBLE state
-		if (!skill_id && tsc->data[SC_TRICKDEAD])
+		if (!skill_id && sc_data(tsc, SC_TRICKDEAD))
 			return false;
-		if ((skill_id == WZ_STORMGUST || skill_id == WZ_FROSTNOVA || skill_id == NJ_HYOUSYOURAKU) && tsc->data[SC_FREEZE])
+		if ((skill_id == WZ_STORMGUST || skill_id == WZ_FROSTNOVA || skill_id == NJ_HYOUSYOURAKU) && sc_data(tsc, SC_FREEZE))
 			return false;
-		if (skill_id == PR_LEXAETERNA && (tsc->data[SC_FREEZE] || (tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)))
+		if (skill_id == PR_LEXAETERNA && (sc_data(tsc, SC_FREEZE) || (sc_data(tsc, SC_STONE) && tsc->opt1 == OPT1_STONE)))
 			return false;
-		if (tsc->data[SC__MANHOLE] && !(skill_get_inf3(skill_id)&INF3_USABLE_MANHOLE))
+		if (sc_data(tsc, SC__MANHOLE) && !(skill_get_inf3(skill_id)&INF3_USABLE_MANHOLE))
 			return false; //Skill that can be used to target while under Man Hole effect
 	}
 
@@ -1969,7 +1969,7 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 		}
 	}
 
-	if (tsc && tsc->data[SC_STEALTHFIELD] && !(status->mode&(MD_BOSS|MD_DETECTOR)) && (!skill_id || !flag))
+	if (tsc && sc_data(tsc, SC_STEALTHFIELD) && !(status->mode&(MD_BOSS|MD_DETECTOR)) && (!skill_id || !flag))
 		return false;
 
 	switch (target->type) {
@@ -1982,10 +1982,10 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 					if ((tsc->option&hide_flag) && !(status->mode&MD_BOSS) &&
 						(tsd->special_state.perfect_hiding || !(status->mode&MD_DETECTOR)))
 						return false;
-					if (tsc->data[SC_CLOAKINGEXCEED] && !(status->mode&MD_BOSS) &&
+					if (sc_data(tsc, SC_CLOAKINGEXCEED) && !(status->mode&MD_BOSS) &&
 						(tsd->special_state.perfect_hiding || (status->mode&MD_DETECTOR)))
 						return false;
-					if (tsc->data[SC_CAMOUFLAGE] && !(status->mode&(MD_BOSS|MD_DETECTOR)) && (!skill_id || !flag))
+					if (sc_data(tsc, SC_CAMOUFLAGE) && !(status->mode&(MD_BOSS|MD_DETECTOR)) && (!skill_id || !flag))
 						return false;
 				}
 			}
@@ -2045,20 +2045,20 @@ int status_check_visibility(struct block_list *src, struct block_list *target)
 			case BL_PC: {
 					struct map_session_data *tsd = (TBL_PC *)target;
 
-					if( ((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->data[SC_CAMOUFLAGE] ||
-						tsc->data[SC_STEALTHFIELD]) && !(status->mode&MD_BOSS) &&
+					if( ((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || sc_data(tsc, SC_CAMOUFLAGE) ||
+						sc_data(tsc, SC_STEALTHFIELD)) && !(status->mode&MD_BOSS) &&
 						(tsd->special_state.perfect_hiding || !(status->mode&MD_DETECTOR)) )
 						return 0;
-					if( tsc->data[SC_CLOAKINGEXCEED] && !(status->mode&MD_BOSS) &&
+					if( sc_data(tsc, SC_CLOAKINGEXCEED) && !(status->mode&MD_BOSS) &&
 						(tsd->special_state.perfect_hiding || (status->mode&MD_DETECTOR)) )
 						return 0;
-					if( tsc->data[SC__FEINTBOMB] )
+					if( sc_data(tsc, SC__FEINTBOMB) )
 						return 0;
 				}
 				break;
 			default:
-				if( ((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->data[SC_CAMOUFLAGE] ||
-					tsc->data[SC_STEALTHFIELD]) && !(status->mode&(MD_BOSS|MD_DETECTOR)) )
+				if( ((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || sc_data(tsc, SC_CAMOUFLAGE) ||
+					sc_data(tsc, SC_STEALTHFIELD)) && !(status->mode&(MD_BOSS|MD_DETECTOR)) )
 					return 0;
 				break;
 		}
@@ -2291,7 +2291,7 @@ void status_get_matk_sub(struct block_list *bl, int flag, unsigned short *matk_m
 	}
 
 	if( ((bl->type&BL_HOM) && (battle_config.hom_setting&HOMSET_SAME_MATK)) || //Hom Min MATK is always the same as Max MATK
-		(sc && sc->data[SC_RECOGNIZEDSPELL]) )
+		(sc && sc_data(sc, SC_RECOGNIZEDSPELL)) )
 		*matk_min = *matk_max;
 
 #ifdef RENEWAL
@@ -2806,21 +2806,21 @@ static int status_get_hpbonus(struct block_list *bl, enum e_status_bonus type) {
 		}
 
 		if (sc) { //Bonus by SC
-			if(sc->data[SC_INCMHP])
-				bonus += sc->data[SC_INCMHP]->val1;
-			if(sc->data[SC_INSPIRATION])
-				bonus += 600 * sc->data[SC_INSPIRATION]->val1;
-			if(sc->data[SC_LERADSDEW])
-				bonus += sc->data[SC_LERADSDEW]->val3;
-			if(sc->data[SC_PROMOTE_HEALTH_RESERCH])
-				bonus += sc->data[SC_PROMOTE_HEALTH_RESERCH]->val4;
-			if(sc->data[SC_SOLID_SKIN_OPTION])
+			if(sc_data(sc, SC_INCMHP))
+				bonus += sc_data(sc, SC_INCMHP)->val1;
+			if(sc_data(sc, SC_INSPIRATION))
+				bonus += 600 * sc_data(sc, SC_INSPIRATION)->val1;
+			if(sc_data(sc, SC_LERADSDEW))
+				bonus += sc_data(sc, SC_LERADSDEW)->val3;
+			if(sc_data(sc, SC_PROMOTE_HEALTH_RESERCH))
+				bonus += sc_data(sc, SC_PROMOTE_HEALTH_RESERCH)->val4;
+			if(sc_data(sc, SC_SOLID_SKIN_OPTION))
 				bonus += 2000;
-			if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2)
+			if(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 2)
 				bonus += 500;
-			if(sc->data[SC_MTF_MHP])
-				bonus += sc->data[SC_MTF_MHP]->val1;
-			if(sc->data[SC_MARIONETTE])
+			if(sc_data(sc, SC_MTF_MHP))
+				bonus += sc_data(sc, SC_MTF_MHP)->val1;
+			if(sc_data(sc, SC_MARIONETTE))
 				bonus -= 1000;
 		}
 	} else if (type == STATUS_BONUS_RATE) {
@@ -2838,54 +2838,54 @@ static int status_get_hpbonus(struct block_list *bl, enum e_status_bonus type) {
 
 		if (sc) { //Bonus by SC
 			//Increasing
-			if(sc->data[SC_INCMHPRATE])
-				bonus += sc->data[SC_INCMHPRATE]->val1;
-			if(sc->data[SC_APPLEIDUN])
-				bonus += sc->data[SC_APPLEIDUN]->val2;
-			if(sc->data[SC_DELUGE])
-				bonus += sc->data[SC_DELUGE]->val2;
-			if(sc->data[SC_BERSERK])
+			if(sc_data(sc, SC_INCMHPRATE))
+				bonus += sc_data(sc, SC_INCMHPRATE)->val1;
+			if(sc_data(sc, SC_APPLEIDUN))
+				bonus += sc_data(sc, SC_APPLEIDUN)->val2;
+			if(sc_data(sc, SC_DELUGE))
+				bonus += sc_data(sc, SC_DELUGE)->val2;
+			if(sc_data(sc, SC_BERSERK))
 				bonus += 200; //+200%
-			if(sc->data[SC_MERC_HPUP])
-				bonus += sc->data[SC_MERC_HPUP]->val2;
-			if(sc->data[SC_EPICLESIS])
-				bonus += sc->data[SC_EPICLESIS]->val2;
-			if(sc->data[SC_FORCEOFVANGUARD])
-				bonus += 3 * sc->data[SC_FORCEOFVANGUARD]->val1;
-			if(sc->data[SC_INSPIRATION])
-				bonus += 5 * sc->data[SC_INSPIRATION]->val1;
-			if(sc->data[SC_RAISINGDRAGON])
-				bonus += 2 + sc->data[SC_RAISINGDRAGON]->val1;
-			if(sc->data[SC_GT_REVITALIZE])
-				bonus += 2 * sc->data[SC_GT_REVITALIZE]->val1;
-			if(sc->data[SC_MUSTLE_M])
-				bonus += sc->data[SC_MUSTLE_M]->val1;
-			if(sc->data[SC_PETROLOGY_OPTION])
-				bonus += sc->data[SC_PETROLOGY_OPTION]->val2;
-			if(sc->data[SC_POWER_OF_GAIA])
-				bonus += sc->data[SC_POWER_OF_GAIA]->val3;
-			if(sc->data[SC_CURSED_SOIL_OPTION])
-				bonus += sc->data[SC_CURSED_SOIL_OPTION]->val2;
-			if(sc->data[SC_UPHEAVAL_OPTION])
-				bonus += sc->data[SC_UPHEAVAL_OPTION]->val3;
-			if(sc->data[SC_ANGRIFFS_MODUS])
-				bonus += 5 * sc->data[SC_ANGRIFFS_MODUS]->val1;
-			if(sc->data[SC_FRIGG_SONG])
-				bonus += sc->data[SC_FRIGG_SONG]->val2;
+			if(sc_data(sc, SC_MERC_HPUP))
+				bonus += sc_data(sc, SC_MERC_HPUP)->val2;
+			if(sc_data(sc, SC_EPICLESIS))
+				bonus += sc_data(sc, SC_EPICLESIS)->val2;
+			if(sc_data(sc, SC_FORCEOFVANGUARD))
+				bonus += 3 * sc_data(sc, SC_FORCEOFVANGUARD)->val1;
+			if(sc_data(sc, SC_INSPIRATION))
+				bonus += 5 * sc_data(sc, SC_INSPIRATION)->val1;
+			if(sc_data(sc, SC_RAISINGDRAGON))
+				bonus += 2 + sc_data(sc, SC_RAISINGDRAGON)->val1;
+			if(sc_data(sc, SC_GT_REVITALIZE))
+				bonus += 2 * sc_data(sc, SC_GT_REVITALIZE)->val1;
+			if(sc_data(sc, SC_MUSTLE_M))
+				bonus += sc_data(sc, SC_MUSTLE_M)->val1;
+			if(sc_data(sc, SC_PETROLOGY_OPTION))
+				bonus += sc_data(sc, SC_PETROLOGY_OPTION)->val2;
+			if(sc_data(sc, SC_POWER_OF_GAIA))
+				bonus += sc_data(sc, SC_POWER_OF_GAIA)->val3;
+			if(sc_data(sc, SC_CURSED_SOIL_OPTION))
+				bonus += sc_data(sc, SC_CURSED_SOIL_OPTION)->val2;
+			if(sc_data(sc, SC_UPHEAVAL_OPTION))
+				bonus += sc_data(sc, SC_UPHEAVAL_OPTION)->val3;
+			if(sc_data(sc, SC_ANGRIFFS_MODUS))
+				bonus += 5 * sc_data(sc, SC_ANGRIFFS_MODUS)->val1;
+			if(sc_data(sc, SC_FRIGG_SONG))
+				bonus += sc_data(sc, SC_FRIGG_SONG)->val2;
 
 			//Decreasing
-			if(sc->data[SC_VENOMBLEED])
+			if(sc_data(sc, SC_VENOMBLEED))
 				bonus -= 15;
-			if(sc->data[SC__WEAKNESS])
-				bonus -= sc->data[SC__WEAKNESS]->val2;
-			if(sc->data[SC_MYSTERIOUS_POWDER])
-				bonus -= sc->data[SC_MYSTERIOUS_POWDER]->val1;
-			if(sc->data[SC_GT_CHANGE]) // MaxHP decrease: [Skill Level x 4] %
-				bonus -= 4 * sc->data[SC_GT_CHANGE]->val1;
-			if(sc->data[SC_BEYONDOFWARCRY])
-				bonus -= sc->data[SC_BEYONDOFWARCRY]->val4;
-			if(sc->data[SC_EQC])
-				bonus -= sc->data[SC_EQC]->val4;
+			if(sc_data(sc, SC__WEAKNESS))
+				bonus -= sc_data(sc, SC__WEAKNESS)->val2;
+			if(sc_data(sc, SC_MYSTERIOUS_POWDER))
+				bonus -= sc_data(sc, SC_MYSTERIOUS_POWDER)->val1;
+			if(sc_data(sc, SC_GT_CHANGE)) // MaxHP decrease: [Skill Level x 4] %
+				bonus -= 4 * sc_data(sc, SC_GT_CHANGE)->val1;
+			if(sc_data(sc, SC_BEYONDOFWARCRY))
+				bonus -= sc_data(sc, SC_BEYONDOFWARCRY)->val4;
+			if(sc_data(sc, SC_EQC))
+				bonus -= sc_data(sc, SC_EQC)->val4;
 		}
 	}
 
@@ -2918,12 +2918,12 @@ static int status_get_spbonus(struct block_list *bl, enum e_status_bonus type) {
 		}
 
 		if (sc) { //Bonus by SC
-			if(sc->data[SC_INCMSP])
-				bonus += sc->data[SC_INCMSP]->val1;
-			if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3)
+			if(sc_data(sc, SC_INCMSP))
+				bonus += sc_data(sc, SC_INCMSP)->val1;
+			if(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 3)
 				bonus += 50;
-			if(sc->data[SC_MTF_MSP])
-				bonus += sc->data[SC_MTF_MSP]->val1;
+			if(sc_data(sc, SC_MTF_MSP))
+				bonus += sc_data(sc, SC_MTF_MSP)->val1;
 		}
 	} else if (type == STATUS_BONUS_RATE) {
 		struct status_change *sc = status_get_sc(bl);
@@ -2946,20 +2946,20 @@ static int status_get_spbonus(struct block_list *bl, enum e_status_bonus type) {
 		}
 
 		if (sc) { //Bonus by SC
-			if(sc->data[SC_INCMSPRATE])
-				bonus += sc->data[SC_INCMSPRATE]->val1;
-			if(sc->data[SC_SERVICE4U])
-				bonus += sc->data[SC_SERVICE4U]->val2;
-			if(sc->data[SC_MERC_SPUP])
-				bonus += sc->data[SC_MERC_SPUP]->val2;
-			if(sc->data[SC_RAISINGDRAGON])
-				bonus += 2 + sc->data[SC_RAISINGDRAGON]->val1;
-			if(sc->data[SC_ENERGY_DRINK_RESERCH])
-				bonus += sc->data[SC_ENERGY_DRINK_RESERCH]->val4;
-			if(sc->data[SC_VITATA_500])
-				bonus += sc->data[SC_VITATA_500]->val2;
-			if(sc->data[SC_LIFE_FORCE_F])
-				bonus += sc->data[SC_LIFE_FORCE_F]->val1;
+			if(sc_data(sc, SC_INCMSPRATE))
+				bonus += sc_data(sc, SC_INCMSPRATE)->val1;
+			if(sc_data(sc, SC_SERVICE4U))
+				bonus += sc_data(sc, SC_SERVICE4U)->val2;
+			if(sc_data(sc, SC_MERC_SPUP))
+				bonus += sc_data(sc, SC_MERC_SPUP)->val2;
+			if(sc_data(sc, SC_RAISINGDRAGON))
+				bonus += 2 + sc_data(sc, SC_RAISINGDRAGON)->val1;
+			if(sc_data(sc, SC_ENERGY_DRINK_RESERCH))
+				bonus += sc_data(sc, SC_ENERGY_DRINK_RESERCH)->val4;
+			if(sc_data(sc, SC_VITATA_500))
+				bonus += sc_data(sc, SC_VITATA_500)->val2;
+			if(sc_data(sc, SC_LIFE_FORCE_F))
+				bonus += sc_data(sc, SC_LIFE_FORCE_F)->val1;
 		}
 	}
 
@@ -3012,6 +3012,8 @@ int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt opt)
 	if (++calculating > 10) //Too many recursive calls!
 		return -1;
 
+	battle_src_context_invalidate(sd->bl.id); //Skill bonuses may change
+
 	//Remember player-specific values that are currently being shown to the client (for refresh purposes)
 	memcpy(b_skill, &sd->status.skill, sizeof(b_skill));
 	b_weight = sd->weight;
@@ -3098,7 +3100,7 @@ int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt opt)
 	memset(&sd->right_weapon.overrefine, 0, sizeof(sd->right_weapon) - sizeof(sd->right_weapon.atkmods));
 	memset(&sd->left_weapon.overrefine, 0, sizeof(sd->left_weapon) - sizeof(sd->left_weapon.atkmods));
 
-	if (sd->special_state.intravision && !sc->data[SC_INTRAVISION]) //Clear intravision as long as nothing else is using it
+	if (sd->special_state.intravision && !sc_data(sc, SC_INTRAVISION)) //Clear intravision as long as nothing else is using it
 		clif_status_load(&sd->bl, SI_INTRAVISION, 0);
 
 	memset(&sd->special_state, 0, sizeof(sd->special_state));
@@ -3366,8 +3368,8 @@ int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt opt)
 		}
 	}
 
-	if(sc->count && sc->data[SC_ITEMSCRIPT]) {
-		struct item_data *data = itemdb_exists(sc->data[SC_ITEMSCRIPT]->val1);
+	if(sc->count && sc_data(sc, SC_ITEMSCRIPT)) {
+		struct item_data *data = itemdb_exists(sc_data(sc, SC_ITEMSCRIPT)->val1);
 
 		if(data && data->script)
 			run_script(data->script,0,sd->bl.id,0);
@@ -3670,8 +3672,8 @@ int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt opt)
 		sd->max_weight += 10000;
 	else if(pc_isridingdragon(sd))
 		sd->max_weight += 5000 + 2000 * pc_checkskill(sd,RK_DRAGONTRAINING);
-	if(sc->data[SC_KNOWLEDGE])
-		sd->max_weight += sd->max_weight * sc->data[SC_KNOWLEDGE]->val1 / 10;
+	if(sc_data(sc, SC_KNOWLEDGE))
+		sd->max_weight += sd->max_weight * sc_data(sc, SC_KNOWLEDGE)->val1 / 10;
 	if((skill = pc_checkskill(sd,ALL_INCCARRY)) > 0)
 		sd->max_weight += 2000 * skill;
 
@@ -3686,11 +3688,11 @@ int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt opt)
 	if((skill = pc_checkskill(sd,HP_MANARECHARGE)) > 0)
 		sd->dsprate -= 4 * skill;
 
-	if(sc->data[SC_SERVICE4U])
-		sd->dsprate -= sc->data[SC_SERVICE4U]->val3;
+	if(sc_data(sc, SC_SERVICE4U))
+		sd->dsprate -= sc_data(sc, SC_SERVICE4U)->val3;
 
-	if(sc->data[SC_SPCOST_RATE])
-		sd->dsprate -= sc->data[SC_SPCOST_RATE]->val1;
+	if(sc_data(sc, SC_SPCOST_RATE))
+		sd->dsprate -= sc_data(sc, SC_SPCOST_RATE)->val1;
 
 	//Underflow protections
 	if(sd->dsprate < 0)
@@ -3733,12 +3735,12 @@ int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt opt)
 		sd->subele[ELE_DARK] += skill;
 	}
 	if(sc->count) {
-     	if(sc->data[SC_CONCENTRATE]) { //Update the card-bonus data
-			sc->data[SC_CONCENTRATE]->val3 = sd->param_bonus[1]; //Agi
-			sc->data[SC_CONCENTRATE]->val4 = sd->param_bonus[4]; //Dex
+     	if(sc_data(sc, SC_CONCENTRATE)) { //Update the card-bonus data
+			sc_data(sc, SC_CONCENTRATE)->val3 = sd->param_bonus[1]; //Agi
+			sc_data(sc, SC_CONCENTRATE)->val4 = sd->param_bonus[4]; //Dex
 		}
-     	if(sc->data[SC_SIEGFRIED]) {
-			i = sc->data[SC_SIEGFRIED]->val2;
+     	if(sc_data(sc, SC_SIEGFRIED)) {
+			i = sc_data(sc, SC_SIEGFRIED)->val2;
 			sd->subele[ELE_WATER] += i;
 			sd->subele[ELE_EARTH] += i;
 			sd->subele[ELE_FIRE] += i;
@@ -3749,58 +3751,58 @@ int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt opt)
 			sd->subele[ELE_GHOST] += i;
 			sd->subele[ELE_UNDEAD] += i;
 		}
-		if(sc->data[SC_PROVIDENCE]) {
-			i = sc->data[SC_PROVIDENCE]->val2;
+		if(sc_data(sc, SC_PROVIDENCE)) {
+			i = sc_data(sc, SC_PROVIDENCE)->val2;
 			sd->subele[ELE_HOLY] += i;
 			sd->subrace[RC_DEMON] += i;
 		}
-		if(sc->data[SC_ARMOR_ELEMENT]) { //This status change should grant card-type elemental resist
-			sd->subele[ELE_WATER] += sc->data[SC_ARMOR_ELEMENT]->val1;
-			sd->subele[ELE_EARTH] += sc->data[SC_ARMOR_ELEMENT]->val2;
-			sd->subele[ELE_FIRE] += sc->data[SC_ARMOR_ELEMENT]->val3;
-			sd->subele[ELE_WIND] += sc->data[SC_ARMOR_ELEMENT]->val4;
+		if(sc_data(sc, SC_ARMOR_ELEMENT)) { //This status change should grant card-type elemental resist
+			sd->subele[ELE_WATER] += sc_data(sc, SC_ARMOR_ELEMENT)->val1;
+			sd->subele[ELE_EARTH] += sc_data(sc, SC_ARMOR_ELEMENT)->val2;
+			sd->subele[ELE_FIRE] += sc_data(sc, SC_ARMOR_ELEMENT)->val3;
+			sd->subele[ELE_WIND] += sc_data(sc, SC_ARMOR_ELEMENT)->val4;
 		}
-		if(sc->data[SC_ARMOR_RESIST]) { //Undead Scroll
-			sd->subele[ELE_WATER] += sc->data[SC_ARMOR_RESIST]->val1;
-			sd->subele[ELE_EARTH] += sc->data[SC_ARMOR_RESIST]->val2;
-			sd->subele[ELE_FIRE] += sc->data[SC_ARMOR_RESIST]->val3;
-			sd->subele[ELE_WIND] += sc->data[SC_ARMOR_RESIST]->val4;
+		if(sc_data(sc, SC_ARMOR_RESIST)) { //Undead Scroll
+			sd->subele[ELE_WATER] += sc_data(sc, SC_ARMOR_RESIST)->val1;
+			sd->subele[ELE_EARTH] += sc_data(sc, SC_ARMOR_RESIST)->val2;
+			sd->subele[ELE_FIRE] += sc_data(sc, SC_ARMOR_RESIST)->val3;
+			sd->subele[ELE_WIND] += sc_data(sc, SC_ARMOR_RESIST)->val4;
 		}
-		if(sc->data[SC_FIRE_CLOAK_OPTION]) {
-			i = sc->data[SC_FIRE_CLOAK_OPTION]->val2;
+		if(sc_data(sc, SC_FIRE_CLOAK_OPTION)) {
+			i = sc_data(sc, SC_FIRE_CLOAK_OPTION)->val2;
 			sd->subele[ELE_FIRE] += i;
 			sd->subele[ELE_WATER] -= i;
 		}
-		if(sc->data[SC_WATER_DROP_OPTION]) {
-			i = sc->data[SC_WATER_DROP_OPTION]->val2;
+		if(sc_data(sc, SC_WATER_DROP_OPTION)) {
+			i = sc_data(sc, SC_WATER_DROP_OPTION)->val2;
 			sd->subele[ELE_WATER] += i;
 			sd->subele[ELE_WIND] -= i;
 		}
-		if(sc->data[SC_WIND_CURTAIN_OPTION]) {
-			i = sc->data[SC_WIND_CURTAIN_OPTION]->val2;
+		if(sc_data(sc, SC_WIND_CURTAIN_OPTION)) {
+			i = sc_data(sc, SC_WIND_CURTAIN_OPTION)->val2;
 			sd->subele[ELE_WIND] += i;
 			sd->subele[ELE_EARTH] -= i;
 		}
-		if(sc->data[SC_STONE_SHIELD_OPTION]) {
-			i = sc->data[SC_STONE_SHIELD_OPTION]->val2;
+		if(sc_data(sc, SC_STONE_SHIELD_OPTION)) {
+			i = sc_data(sc, SC_STONE_SHIELD_OPTION)->val2;
 			sd->subele[ELE_EARTH] += i;
 			sd->subele[ELE_FIRE] -= i;
 		}
-		if(sc->data[SC_MTF_RANGEATK])
-			sd->bonus.long_attack_atk_rate += sc->data[SC_MTF_RANGEATK]->val1;
-		if(sc->data[SC_MTF_RANGEATK2])
-			sd->bonus.long_attack_atk_rate += sc->data[SC_MTF_RANGEATK2]->val1;
-		if(sc->data[SC_MTF_MLEATKED])
-			sd->subele[ELE_NEUTRAL] += sc->data[SC_MTF_MLEATKED]->val1;
-		if(sc->data[SC_MTF_CRIDAMAGE])
-			sd->bonus.crit_atk_rate += sc->data[SC_MTF_CRIDAMAGE]->val1;
-		if(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3)
+		if(sc_data(sc, SC_MTF_RANGEATK))
+			sd->bonus.long_attack_atk_rate += sc_data(sc, SC_MTF_RANGEATK)->val1;
+		if(sc_data(sc, SC_MTF_RANGEATK2))
+			sd->bonus.long_attack_atk_rate += sc_data(sc, SC_MTF_RANGEATK2)->val1;
+		if(sc_data(sc, SC_MTF_MLEATKED))
+			sd->subele[ELE_NEUTRAL] += sc_data(sc, SC_MTF_MLEATKED)->val1;
+		if(sc_data(sc, SC_MTF_CRIDAMAGE))
+			sd->bonus.crit_atk_rate += sc_data(sc, SC_MTF_CRIDAMAGE)->val1;
+		if(sc_data(sc, SC_FIRE_INSIGNIA) && sc_data(sc, SC_FIRE_INSIGNIA)->val1 == 3)
 			sd->magic_addele[ELE_FIRE] += 25;
-		if(sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 3)
+		if(sc_data(sc, SC_WATER_INSIGNIA) && sc_data(sc, SC_WATER_INSIGNIA)->val1 == 3)
 			sd->magic_addele[ELE_WATER] += 25;
-		if(sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 3)
+		if(sc_data(sc, SC_WIND_INSIGNIA) && sc_data(sc, SC_WIND_INSIGNIA)->val1 == 3)
 			sd->magic_addele[ELE_WIND] += 25;
-		if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3)
+		if(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 3)
 			sd->magic_addele[ELE_EARTH] += 25;
 	}
 	status_cpy(&sd->battle_status,status);
@@ -4165,31 +4167,31 @@ void status_calc_regen_rate(struct block_list *bl, struct regen_data *regen, str
 	if (!sc || !sc->count)
 		return;
 
-	if ((sc->data[SC_POISON] && !sc->data[SC_SLOWPOISON]) ||
-		(sc->data[SC_DPOISON] && !sc->data[SC_SLOWPOISON]) ||
-		sc->data[SC_BERSERK] ||
-		sc->data[SC_TRICKDEAD] ||
-		sc->data[SC_BLEEDING] ||
-		sc->data[SC_SATURDAYNIGHTFEVER] ||
-		sc->data[SC_REBOUND])
+	if ((sc_data(sc, SC_POISON) && !sc_data(sc, SC_SLOWPOISON)) ||
+		(sc_data(sc, SC_DPOISON) && !sc_data(sc, SC_SLOWPOISON)) ||
+		sc_data(sc, SC_BERSERK) ||
+		sc_data(sc, SC_TRICKDEAD) ||
+		sc_data(sc, SC_BLEEDING) ||
+		sc_data(sc, SC_SATURDAYNIGHTFEVER) ||
+		sc_data(sc, SC_REBOUND))
 		regen->flag = RGN_NONE;
 
-	if (sc->data[SC_DANCING] ||
+	if (sc_data(sc, SC_DANCING) ||
 #ifdef RENEWAL
-		sc->data[SC_MAXIMIZEPOWER] ||
+		sc_data(sc, SC_MAXIMIZEPOWER) ||
 #else
 		(bl->type == BL_PC && (((TBL_PC *)bl)->class_&MAPID_UPPERMASK) == MAPID_MONK &&
-		(sc->data[SC_EXPLOSIONSPIRITS] || sc->data[SC_EXTREMITYFIST]) &&
-		(!sc->data[SC_SPIRIT] || sc->data[SC_SPIRIT]->val2 != SL_MONK)) ||
+		(sc_data(sc, SC_EXPLOSIONSPIRITS) || sc_data(sc, SC_EXTREMITYFIST)) &&
+		(!sc_data(sc, SC_SPIRIT) || sc_data(sc, SC_SPIRIT)->val2 != SL_MONK)) ||
 #endif
-		sc->data[SC_VITALITYACTIVATION] || sc->data[SC_TOXIN] || sc->data[SC_OBLIVIONCURSE])
+		sc_data(sc, SC_VITALITYACTIVATION) || sc_data(sc, SC_TOXIN) || sc_data(sc, SC_OBLIVIONCURSE))
 		regen->flag &= ~RGN_SP; //No natural SP regen
 
-	if (sc->data[SC_MAGNIFICAT])
+	if (sc_data(sc, SC_MAGNIFICAT))
 		regen->rate.sp += 100; //2x SP regen
 
-	if (sc->data[SC_TENSIONRELAX]) {
-		if (sc->data[SC_WEIGHT50] || sc->data[SC_WEIGHT90])
+	if (sc_data(sc, SC_TENSIONRELAX)) {
+		if (sc_data(sc, SC_WEIGHT50) || sc_data(sc, SC_WEIGHT90))
 			regen->state.overweight = 0; //1x HP regen
 		else {
 			regen->rate.hp += 200; //3x natural HP regen
@@ -4198,8 +4200,8 @@ void status_calc_regen_rate(struct block_list *bl, struct regen_data *regen, str
 		}
 	}
 
-	if (sc->data[SC_REGENERATION]) {
-		const struct status_change_entry *sce = sc->data[SC_REGENERATION];
+	if (sc_data(sc, SC_REGENERATION)) {
+		const struct status_change_entry *sce = sc_data(sc, SC_REGENERATION);
 
 		if (!sce->val4) {
 			regen->rate.hp += sce->val2 * 100;
@@ -4208,15 +4210,15 @@ void status_calc_regen_rate(struct block_list *bl, struct regen_data *regen, str
 			regen->flag &= ~sce->val4; //Remove regen as specified by val4
 	}
 
-	if (sc->data[SC_GT_REVITALIZE]) {
-		regen->hp += cap_value(regen->hp * sc->data[SC_GT_REVITALIZE]->val3 / 100, 1, SHRT_MAX);
+	if (sc_data(sc, SC_GT_REVITALIZE)) {
+		regen->hp += cap_value(regen->hp * sc_data(sc, SC_GT_REVITALIZE)->val3 / 100, 1, SHRT_MAX);
 		regen->state.walk = 1;
 	}
 
-	if ((sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 1) || //If insignia lvl 1
-		(sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 1) ||
-		(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 1) ||
-		(sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 1))
+	if ((sc_data(sc, SC_FIRE_INSIGNIA) && sc_data(sc, SC_FIRE_INSIGNIA)->val1 == 1) || //If insignia lvl 1
+		(sc_data(sc, SC_WATER_INSIGNIA) && sc_data(sc, SC_WATER_INSIGNIA)->val1 == 1) ||
+		(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 1) ||
+		(sc_data(sc, SC_WIND_INSIGNIA) && sc_data(sc, SC_WIND_INSIGNIA)->val1 == 1))
 		regen->rate.hp *= 2;
 }
 
@@ -4230,11 +4232,11 @@ void status_calc_state(struct block_list *bl, struct status_change *sc, enum scs
 	if( flag&SCS_NOMOVE ) { //Can move?
 		if( !(flag&SCS_NOMOVECOND) )
 			sc->cant.move += (start ? 1 : -1);
-		else if( (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF) || //Can't move while gospel is in effect
-			(sc->data[SC_BASILICA] && sc->data[SC_BASILICA]->val4 == bl->id) || //Basilica caster cannot move
-			(sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF) ||
-			(sc->data[SC_CAMOUFLAGE] && sc->data[SC_CAMOUFLAGE]->val1 < 3) ||
-			(sc->data[SC_MAGNETICFIELD] && sc->data[SC_MAGNETICFIELD]->val2 != bl->id) )
+		else if( (sc_data(sc, SC_GOSPEL) && sc_data(sc, SC_GOSPEL)->val4 == BCT_SELF) || //Can't move while gospel is in effect
+			(sc_data(sc, SC_BASILICA) && sc_data(sc, SC_BASILICA)->val4 == bl->id) || //Basilica caster cannot move
+			(sc_data(sc, SC_GRAVITATION) && sc_data(sc, SC_GRAVITATION)->val3 == BCT_SELF) ||
+			(sc_data(sc, SC_CAMOUFLAGE) && sc_data(sc, SC_CAMOUFLAGE)->val1 < 3) ||
+			(sc_data(sc, SC_MAGNETICFIELD) && sc_data(sc, SC_MAGNETICFIELD)->val2 != bl->id) )
 			sc->cant.move += (start ? 1 : -1);
 		sc->cant.move = max(sc->cant.move, 0); //Safe check
 	}
@@ -4246,7 +4248,7 @@ void status_calc_state(struct block_list *bl, struct status_change *sc, enum scs
 	if( flag&SCS_NOCHAT ) { //Can't chat
 		if( !(flag&SCS_NOCHATCOND) )
 			sc->cant.chat += (start ? 1 : -1);
-		else if( sc->data[SC_NOCHAT] && (sc->data[SC_NOCHAT]->val1&MANNER_NOCHAT) )
+		else if( sc_data(sc, SC_NOCHAT) && (sc_data(sc, SC_NOCHAT)->val1&MANNER_NOCHAT) )
 			sc->cant.chat += (start ? 1 : -1);
 	}
 
@@ -4254,13 +4256,13 @@ void status_calc_state(struct block_list *bl, struct status_change *sc, enum scs
 		if( flag&SCS_NOPICKITEM ) { //Can pick items?
 			if( !(flag&SCS_NOPICKITEMCOND) )
 				sc->cant.pickup += (start ? 1 : -1);
-			else if( sc->data[SC_NOCHAT] && (sc->data[SC_NOCHAT]->val1&MANNER_NOITEM) )
+			else if( sc_data(sc, SC_NOCHAT) && (sc_data(sc, SC_NOCHAT)->val1&MANNER_NOITEM) )
 				sc->cant.pickup += (start ? 1 : -1);
 		}
 		if( flag&SCS_NODROPITEM ) { //Can drop items?
 			if( !(flag&SCS_NODROPITEMCOND) )
 				sc->cant.drop += (start ? 1 : -1);
-			else if( sc->data[SC_NOCHAT] && (sc->data[SC_NOCHAT]->val1&MANNER_NOITEM) )
+			else if( sc_data(sc, SC_NOCHAT) && (sc_data(sc, SC_NOCHAT)->val1&MANNER_NOITEM) )
 				sc->cant.drop += (start ? 1 : -1);
 		}
 	}
@@ -4649,15 +4651,186 @@ void status_calc_bl_main(struct block_list *bl, /*enum scb_flag*/int flag)
 		status_calc_regen_rate(bl, status_get_regen_data(bl), sc);
 }
 
+/// Pending status_calc_bl requests, merged per unit while a defer scope is open
+#define STATUS_CALC_DEFER_MAX 64
+static struct s_status_calc_pending {
+	int id;
+	enum scb_flag flag;
+} status_calc_pending[STATUS_CALC_DEFER_MAX];
+static int status_calc_pending_count = 0;
+static int status_calc_defer_depth = 0;
+
+/// Units with deferred recalculations (status_calc_defer), their flags are in sc.calc_pending
+static int *status_calc_dirty = NULL;
+static int status_calc_dirty_count = 0, status_calc_dirty_max = 0;
+
+static struct {
+	unsigned int requested; //Calls to status_calc_bl_
+	unsigned int merged; //Requests folded into an already pending one
+	unsigned int executed; //Recalculations actually performed
+	unsigned int flushes; //status_calc_flush calls that had units to recalculate
+} status_calc_stats;
+
+static void status_calc_bl_sub(struct block_list *bl, enum scb_flag flag, enum e_status_calc_opt opt);
+
+/**
+ * Opens a scope in which plain status_calc_bl requests are queued instead of executed.
+ * Several requests for the same unit are merged into a single recalculation with the
+ * union of their flags, performed when the outermost scope is closed.
+ * Only wrap code that does not read the affected units' stats before the scope ends.
+ * Requests made outside of these scopes are deferred to status_calc_flush when
+ * status_calc_defer is enabled, and run right away otherwise.
+ */
+void status_calc_defer_begin(void)
+{
+	status_calc_defer_depth++;
+}
+
+/**
+ * Closes a scope opened by status_calc_defer_begin and, when it is the outermost one,
+ * runs the merged recalculations.
+ */
+void status_calc_defer_end(void)
+{
+	struct s_status_calc_pending pending[STATUS_CALC_DEFER_MAX];
+	int i, count;
+
+	if( status_calc_defer_depth <= 0 ) {
+		ShowError("status_calc_defer_end: Unbalanced call.\n");
+		return;
+	}
+	if( --status_calc_defer_depth > 0 || !status_calc_pending_count )
+		return;
+
+	//Work on a copy, a recalculation may end up opening a new scope
+	count = status_calc_pending_count;
+	memcpy(pending, status_calc_pending, count * sizeof(pending[0]));
+	status_calc_pending_count = 0;
+
+	for( i = 0; i < count; i++ ) {
+		struct block_list *bl = map_id2bl(pending[i].id);
+
+		if( bl ) //Unit may have left while the scope was open
+			status_calc_bl_sub(bl, pending[i].flag, SCO_NONE);
+	}
+}
+
+/**
+ * Queues a recalculation request while a defer scope is open.
+ * @return true if the request was queued, false if it must run now
+ */
+static bool status_calc_defer(struct block_list *bl, enum scb_flag flag)
+{
+	int i;
+
+	ARR_FIND(0, status_calc_pending_count, i, status_calc_pending[i].id == bl->id);
+	if( i < status_calc_pending_count ) {
+		status_calc_pending[i].flag = (enum scb_flag)(status_calc_pending[i].flag|flag);
+		status_calc_stats.merged++;
+		return true;
+	}
+	if( status_calc_pending_count == STATUS_CALC_DEFER_MAX )
+		return false;
+	status_calc_pending[status_calc_pending_count].id = bl->id;
+	status_calc_pending[status_calc_pending_count].flag = flag;
+	status_calc_pending_count++;
+	return true;
+}
+
+/**
+ * Adds a recalculation request to the unit's pending flags (status_calc_defer).
+ * @return true if the request was deferred, false if it must run now
+ */
+static bool status_calc_mark(struct block_list *bl, enum scb_flag flag)
+{
+	struct status_change *sc = status_get_sc(bl);
+
+	if( !sc )
+		return false;
+	if( sc->calc_pending ) {
+		sc->calc_pending = (enum scb_flag)(sc->calc_pending|flag);
+		status_calc_stats.merged++;
+		return true;
+	}
+	if( status_calc_dirty_count == status_calc_dirty_max ) {
+		status_calc_dirty_max += 256;
+		RECREATE(status_calc_dirty, int, status_calc_dirty_max);
+	}
+	status_calc_dirty[status_calc_dirty_count++] = bl->id;
+	sc->calc_pending = flag;
+	return true;
+}
+
+/**
+ * Runs the recalculations deferred by status_calc_defer, once per unit with the union of its requested flags.
+ * Called by the core after each batch of timers and of received packets.
+ */
+void status_calc_flush(void)
+{
+	int i;
+
+	if( !status_calc_dirty_count )
+		return;
+
+	status_calc_stats.flushes++;
+	//A recalculation may request new ones, they are appended and handled by this same loop
+	for( i = 0; i < status_calc_dirty_count; i++ ) {
+		struct block_list *bl = map_id2bl(status_calc_dirty[i]);
+		struct status_change *sc;
+		enum scb_flag flag;
+
+		if( !bl || !(sc = status_get_sc(bl)) || !sc->calc_pending )
+			continue; //Unit left or was already recalculated
+		flag = sc->calc_pending;
+		sc->calc_pending = SCB_NONE;
+		status_calc_bl_sub(bl, flag, SCO_NONE);
+	}
+	status_calc_dirty_count = 0;
+}
+
+/**
+ * Prints how many status_calc_bl requests were merged by defer scopes and status_calc_defer.
+ */
+void status_calc_report(void)
+{
+	ShowInfo("status_calc_bl: %u requested, %u merged, %u executed, %d pending, %d units dirty, %u flushes.\n",
+		status_calc_stats.requested, status_calc_stats.merged, status_calc_stats.executed, status_calc_pending_count,
+		status_calc_dirty_count, status_calc_stats.flushes);
+}
+
 /// Recalculates parts of an object's base status and battle status according to the specified flags.
 /// Also sends updates to the client wherever applicable.
 /// @param flag bitfield of values from enum scb_flag
 /// @param first if true, will cause status_calc_* functions to run their base status initialization code
 void status_calc_bl_(struct block_list *bl, enum scb_flag flag, enum e_status_calc_opt opt)
+{
+	status_calc_stats.requested++;
+
+	//Initial and forced calculations are expected to be visible right away
+	if( opt == SCO_NONE ) {
+		if( status_calc_defer_depth && status_calc_defer(bl, flag) )
+			return;
+		if( battle_config.status_calc_defer && status_calc_mark(bl, flag) )
+			return;
+	} else {
+		struct status_change *sc = status_get_sc(bl);
+
+		if( sc && sc->calc_pending ) { //Take the deferred flags along
+			flag = (enum scb_flag)(flag|sc->calc_pending);
+			sc->calc_pending = SCB_NONE;
+		}
+	}
+
+	status_calc_bl_sub(bl, flag, opt);
+}
+
+static void status_calc_bl_sub(struct block_list *bl, enum scb_flag flag, enum e_status_calc_opt opt)
 {
 	struct status_data b_status; //Previous battle status
 	struct status_data *status; //Pointer to current battle status
 
+	status_calc_stats.executed++;
+
 	if( bl->type == BL_PC && ((TBL_PC *)bl)->delayed_damage != 0 ) {
 		if( opt&SCO_FORCE )
 			((TBL_PC *)bl)->state.hold_recalc = 0; //Clear and move on
@@ -4843,60 +5016,60 @@ static unsigned short status_calc_str(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(str,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(sc_data(sc, SC_FULL_THROTTLE))
 		str += str * 20 / 100;
-	if(sc->data[SC_INCALLSTATUS])
-		str += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCSTR])
-		str += sc->data[SC_INCSTR]->val1;
-	if(sc->data[SC_STRFOOD])
-		str += sc->data[SC_STRFOOD]->val1;
-	if(sc->data[SC_FOOD_STR_CASH])
-		str += sc->data[SC_FOOD_STR_CASH]->val1;
+	if(sc_data(sc, SC_INCALLSTATUS))
+		str += sc_data(sc, SC_INCALLSTATUS)->val1;
+	if(sc_data(sc, SC_INCSTR))
+		str += sc_data(sc, SC_INCSTR)->val1;
+	if(sc_data(sc, SC_STRFOOD))
+		str += sc_data(sc, SC_STRFOOD)->val1;
+	if(sc_data(sc, SC_FOOD_STR_CASH))
+		str += sc_data(sc, SC_FOOD_STR_CASH)->val1;
 	if(bl->type == BL_PC) {
-		if(sc->data[SC_BATTLEORDERS])
+		if(sc_data(sc, SC_BATTLEORDERS))
 			str += 5;
-		if(sc->data[SC_LEADERSHIP])
-			str += sc->data[SC_LEADERSHIP]->val1;
+		if(sc_data(sc, SC_LEADERSHIP))
+			str += sc_data(sc, SC_LEADERSHIP)->val1;
 	}
-	if(sc->data[SC_LOUD])
+	if(sc_data(sc, SC_LOUD))
 		str += 4;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_data(sc, SC_TRUESIGHT))
 		str += 5;
-	if(sc->data[SC_SPURT])
+	if(sc_data(sc, SC_SPURT))
 		str += 10;
-	if(sc->data[SC_NEN])
-		str += sc->data[SC_NEN]->val1;
-	if(sc->data[SC_BLESSING]) {
-		if(sc->data[SC_BLESSING]->val2)
-			str += sc->data[SC_BLESSING]->val2;
+	if(sc_data(sc, SC_NEN))
+		str += sc_data(sc, SC_NEN)->val1;
+	if(sc_data(sc, SC_BLESSING)) {
+		if(sc_data(sc, SC_BLESSING)->val2)
+			str += sc_data(sc, SC_BLESSING)->val2;
 		else
 			str >>= 1;
 	}
-	if(sc->data[SC_CHASEWALK2])
-		str += sc->data[SC_CHASEWALK2]->val1;
-	if(sc->data[SC_GIANTGROWTH])
+	if(sc_data(sc, SC_CHASEWALK2))
+		str += sc_data(sc, SC_CHASEWALK2)->val1;
+	if(sc_data(sc, SC_GIANTGROWTH))
 		str += 30;
-	if(sc->data[SC_BEYONDOFWARCRY])
-		str += sc->data[SC_BEYONDOFWARCRY]->val3;
-	if(sc->data[SC_SAVAGE_STEAK])
-		str += sc->data[SC_SAVAGE_STEAK]->val1;
-	if(sc->data[SC_INSPIRATION])
-		str += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_2011RWC_SCROLL])
-		str += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_MARIONETTE2])
-		str += ((sc->data[SC_MARIONETTE2]->val3)>>16)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		str += ((sc->data[SC_SPIRIT]->val3)>>16)&0xFF;
-	if(sc->data[SC_HARMONIZE])
-		str -= sc->data[SC_HARMONIZE]->val2;
-	if(sc->data[SC_STOMACHACHE])
-		str -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		str -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_MARIONETTE])
-		str -= ((sc->data[SC_MARIONETTE]->val3)>>16)&0xFF;
+	if(sc_data(sc, SC_BEYONDOFWARCRY))
+		str += sc_data(sc, SC_BEYONDOFWARCRY)->val3;
+	if(sc_data(sc, SC_SAVAGE_STEAK))
+		str += sc_data(sc, SC_SAVAGE_STEAK)->val1;
+	if(sc_data(sc, SC_INSPIRATION))
+		str += sc_data(sc, SC_INSPIRATION)->val3;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
+		str += sc_data(sc, SC_2011RWC_SCROLL)->val1;
+	if(sc_data(sc, SC_MARIONETTE2))
+		str += ((sc_data(sc, SC_MARIONETTE2)->val3)>>16)&0xFF;
+	if(sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_HIGH)
+		str += ((sc_data(sc, SC_SPIRIT)->val3)>>16)&0xFF;
+	if(sc_data(sc, SC_HARMONIZE))
+		str -= sc_data(sc, SC_HARMONIZE)->val2;
+	if(sc_data(sc, SC_STOMACHACHE))
+		str -= sc_data(sc, SC_STOMACHACHE)->val1;
+	if(sc_data(sc, SC_KYOUGAKU))
+		str -= sc_data(sc, SC_KYOUGAKU)->val2;
+	if(sc_data(sc, SC_MARIONETTE))
+		str -= ((sc_data(sc, SC_MARIONETTE)->val3)>>16)&0xFF;
 
 	return (unsigned short)cap_value(str,0,USHRT_MAX);
 }
@@ -4906,54 +5079,54 @@ static unsigned short status_calc_agi(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(agi,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(sc_data(sc, SC_FULL_THROTTLE))
 		agi += agi * 20 / 100;
-	if(sc->data[SC_CONCENTRATE] && !sc->data[SC_QUAGMIRE])
-		agi += (agi - sc->data[SC_CONCENTRATE]->val3) * sc->data[SC_CONCENTRATE]->val2 / 100;
-	if(sc->data[SC_INCALLSTATUS])
-		agi += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCAGI])
-		agi += sc->data[SC_INCAGI]->val1;
-	if(sc->data[SC_AGIFOOD])
-		agi += sc->data[SC_AGIFOOD]->val1;
-	if(sc->data[SC_FOOD_AGI_CASH])
-		agi += sc->data[SC_FOOD_AGI_CASH]->val1;
-	if(sc->data[SC_SOULCOLD] && bl->type == BL_PC)
-		agi += sc->data[SC_SOULCOLD]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_data(sc, SC_CONCENTRATE) && !sc_data(sc, SC_QUAGMIRE))
+		agi += (agi - sc_data(sc, SC_CONCENTRATE)->val3) * sc_data(sc, SC_CONCENTRATE)->val2 / 100;
+	if(sc_data(sc, SC_INCALLSTATUS))
+		agi += sc_data(sc, SC_INCALLSTATUS)->val1;
+	if(sc_data(sc, SC_INCAGI))
+		agi += sc_data(sc, SC_INCAGI)->val1;
+	if(sc_data(sc, SC_AGIFOOD))
+		agi += sc_data(sc, SC_AGIFOOD)->val1;
+	if(sc_data(sc, SC_FOOD_AGI_CASH))
+		agi += sc_data(sc, SC_FOOD_AGI_CASH)->val1;
+	if(sc_data(sc, SC_SOULCOLD) && bl->type == BL_PC)
+		agi += sc_data(sc, SC_SOULCOLD)->val1;
+	if(sc_data(sc, SC_TRUESIGHT))
 		agi += 5;
-	if(sc->data[SC_INCREASEAGI])
-		agi += sc->data[SC_INCREASEAGI]->val2;
-	if(sc->data[SC_INCREASING])
+	if(sc_data(sc, SC_INCREASEAGI))
+		agi += sc_data(sc, SC_INCREASEAGI)->val2;
+	if(sc_data(sc, SC_INCREASING))
 		agi += 4; //Added based on skill updates [Reddozen]
-	if(sc->data[SC_DROCERA_HERB_STEAMED])
-		agi += sc->data[SC_DROCERA_HERB_STEAMED]->val1;
-	if(sc->data[SC_INSPIRATION])
-		agi += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_2011RWC_SCROLL])
-		agi += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_MARIONETTE2])
-		agi += ((sc->data[SC_MARIONETTE2]->val3)>>8)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		agi += ((sc->data[SC_SPIRIT]->val3)>>8)&0xFF;
-	if(sc->data[SC_MARSHOFABYSS])
-		agi -= agi * sc->data[SC_MARSHOFABYSS]->val2 / 100;
-	if(sc->data[SC_HARMONIZE])
-		agi -= sc->data[SC_HARMONIZE]->val2;
-	if(sc->data[SC_DECREASEAGI])
-		agi -= sc->data[SC_DECREASEAGI]->val2;
-	if(sc->data[SC_QUAGMIRE])
-		agi -= sc->data[SC_QUAGMIRE]->val2;
-	if(sc->data[SC_SUITON] && sc->data[SC_SUITON]->val2)
-		agi -= sc->data[SC_SUITON]->val2;
-	if(sc->data[SC_ADORAMUS])
-		agi -= sc->data[SC_ADORAMUS]->val2;
-	if(sc->data[SC_STOMACHACHE])
-		agi -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		agi -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_MARIONETTE])
-		agi -= ((sc->data[SC_MARIONETTE]->val3)>>8)&0xFF;
+	if(sc_data(sc, SC_DROCERA_HERB_STEAMED))
+		agi += sc_data(sc, SC_DROCERA_HERB_STEAMED)->val1;
+	if(sc_data(sc, SC_INSPIRATION))
+		agi += sc_data(sc, SC_INSPIRATION)->val3;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
+		agi += sc_data(sc, SC_2011RWC_SCROLL)->val1;
+	if(sc_data(sc, SC_MARIONETTE2))
+		agi += ((sc_data(sc, SC_MARIONETTE2)->val3)>>8)&0xFF;
+	if(sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_HIGH)
+		agi += ((sc_data(sc, SC_SPIRIT)->val3)>>8)&0xFF;
+	if(sc_data(sc, SC_MARSHOFABYSS))
+		agi -= agi * sc_data(sc, SC_MARSHOFABYSS)->val2 / 100;
+	if(sc_data(sc, SC_HARMONIZE))
+		agi -= sc_data(sc, SC_HARMONIZE)->val2;
+	if(sc_data(sc, SC_DECREASEAGI))
+		agi -= sc_data(sc, SC_DECREASEAGI)->val2;
+	if(sc_data(sc, SC_QUAGMIRE))
+		agi -= sc_data(sc, SC_QUAGMIRE)->val2;
+	if(sc_data(sc, SC_SUITON) && sc_data(sc, SC_SUITON)->val2)
+		agi -= sc_data(sc, SC_SUITON)->val2;
+	if(sc_data(sc, SC_ADORAMUS))
+		agi -= sc_data(sc, SC_ADORAMUS)->val2;
+	if(sc_data(sc, SC_STOMACHACHE))
+		agi -= sc_data(sc, SC_STOMACHACHE)->val1;
+	if(sc_data(sc, SC_KYOUGAKU))
+		agi -= sc_data(sc, SC_KYOUGAKU)->val2;
+	if(sc_data(sc, SC_MARIONETTE))
+		agi -= ((sc_data(sc, SC_MARIONETTE)->val3)>>8)&0xFF;
 
 	return (unsigned short)cap_value(agi,0,USHRT_MAX);
 }
@@ -4963,48 +5136,48 @@ static unsigned short status_calc_vit(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(vit,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(sc_data(sc, SC_FULL_THROTTLE))
 		vit += vit * 20 / 100;
-	if(sc->data[SC_INCALLSTATUS])
-		vit += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCVIT])
-		vit += sc->data[SC_INCVIT]->val1;
-	if(sc->data[SC_VITFOOD])
-		vit += sc->data[SC_VITFOOD]->val1;
-	if(sc->data[SC_FOOD_VIT_CASH])
-		vit += sc->data[SC_FOOD_VIT_CASH]->val1;
-	if(sc->data[SC_CHANGE])
-		vit += sc->data[SC_CHANGE]->val2;
-	if(sc->data[SC_GLORYWOUNDS] && bl->type == BL_PC)
-		vit += sc->data[SC_GLORYWOUNDS]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_data(sc, SC_INCALLSTATUS))
+		vit += sc_data(sc, SC_INCALLSTATUS)->val1;
+	if(sc_data(sc, SC_INCVIT))
+		vit += sc_data(sc, SC_INCVIT)->val1;
+	if(sc_data(sc, SC_VITFOOD))
+		vit += sc_data(sc, SC_VITFOOD)->val1;
+	if(sc_data(sc, SC_FOOD_VIT_CASH))
+		vit += sc_data(sc, SC_FOOD_VIT_CASH)->val1;
+	if(sc_data(sc, SC_CHANGE))
+		vit += sc_data(sc, SC_CHANGE)->val2;
+	if(sc_data(sc, SC_GLORYWOUNDS) && bl->type == BL_PC)
+		vit += sc_data(sc, SC_GLORYWOUNDS)->val1;
+	if(sc_data(sc, SC_TRUESIGHT))
 		vit += 5;
-	if(sc->data[SC_LAUDAAGNUS])
-		vit += 4 + sc->data[SC_LAUDAAGNUS]->val1;
-	if(sc->data[SC_MINOR_BBQ])
-		vit += sc->data[SC_MINOR_BBQ]->val1;
-	if(sc->data[SC_INSPIRATION])
-		vit += sc->data[SC_INSPIRATION]->val3;
+	if(sc_data(sc, SC_LAUDAAGNUS))
+		vit += 4 + sc_data(sc, SC_LAUDAAGNUS)->val1;
+	if(sc_data(sc, SC_MINOR_BBQ))
+		vit += sc_data(sc, SC_MINOR_BBQ)->val1;
+	if(sc_data(sc, SC_INSPIRATION))
+		vit += sc_data(sc, SC_INSPIRATION)->val3;
 #ifdef RENEWAL
-	if(sc->data[SC_DEFENCE])
-		vit += sc->data[SC_DEFENCE]->val2;
+	if(sc_data(sc, SC_DEFENCE))
+		vit += sc_data(sc, SC_DEFENCE)->val2;
 #endif
-	if(sc->data[SC_2011RWC_SCROLL])
-		vit += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_MARIONETTE2])
-		vit += sc->data[SC_MARIONETTE2]->val3&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		vit += sc->data[SC_SPIRIT]->val3&0xFF;
-	if(sc->data[SC_STRIPARMOR] && bl->type != BL_PC)
-		vit -= vit * sc->data[SC_STRIPARMOR]->val2 / 100;
-	if(sc->data[SC_HARMONIZE])
-		vit -= sc->data[SC_HARMONIZE]->val2;
-	if(sc->data[SC_STOMACHACHE])
-		vit -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		vit -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_MARIONETTE])
-		vit -= sc->data[SC_MARIONETTE]->val3&0xFF;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
+		vit += sc_data(sc, SC_2011RWC_SCROLL)->val1;
+	if(sc_data(sc, SC_MARIONETTE2))
+		vit += sc_data(sc, SC_MARIONETTE2)->val3&0xFF;
+	if(sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_HIGH)
+		vit += sc_data(sc, SC_SPIRIT)->val3&0xFF;
+	if(sc_data(sc, SC_STRIPARMOR) && bl->type != BL_PC)
+		vit -= vit * sc_data(sc, SC_STRIPARMOR)->val2 / 100;
+	if(sc_data(sc, SC_HARMONIZE))
+		vit -= sc_data(sc, SC_HARMONIZE)->val2;
+	if(sc_data(sc, SC_STOMACHACHE))
+		vit -= sc_data(sc, SC_STOMACHACHE)->val1;
+	if(sc_data(sc, SC_KYOUGAKU))
+		vit -= sc_data(sc, SC_KYOUGAKU)->val2;
+	if(sc_data(sc, SC_MARIONETTE))
+		vit -= sc_data(sc, SC_MARIONETTE)->val3&0xFF;
 
 	return (unsigned short)cap_value(vit,0,USHRT_MAX);
 }
@@ -5014,58 +5187,58 @@ static unsigned short status_calc_int(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(int_,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(sc_data(sc, SC_FULL_THROTTLE))
 		int_ += int_ * 20 / 100;
-	if(sc->data[SC_INCALLSTATUS])
-		int_ += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCINT])
-		int_ += sc->data[SC_INCINT]->val1;
-	if(sc->data[SC_INTFOOD])
-		int_ += sc->data[SC_INTFOOD]->val1;
-	if(sc->data[SC_FOOD_INT_CASH])
-		int_ += sc->data[SC_FOOD_INT_CASH]->val1;
-	if(sc->data[SC_CHANGE])
-		int_ += sc->data[SC_CHANGE]->val3;
-	if(sc->data[SC_BATTLEORDERS] && bl->type == BL_PC)
+	if(sc_data(sc, SC_INCALLSTATUS))
+		int_ += sc_data(sc, SC_INCALLSTATUS)->val1;
+	if(sc_data(sc, SC_INCINT))
+		int_ += sc_data(sc, SC_INCINT)->val1;
+	if(sc_data(sc, SC_INTFOOD))
+		int_ += sc_data(sc, SC_INTFOOD)->val1;
+	if(sc_data(sc, SC_FOOD_INT_CASH))
+		int_ += sc_data(sc, SC_FOOD_INT_CASH)->val1;
+	if(sc_data(sc, SC_CHANGE))
+		int_ += sc_data(sc, SC_CHANGE)->val3;
+	if(sc_data(sc, SC_BATTLEORDERS) && bl->type == BL_PC)
 		int_ += 5;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_data(sc, SC_TRUESIGHT))
 		int_ += 5;
-	if(sc->data[SC_BLESSING]) {
-		if (sc->data[SC_BLESSING]->val2)
-			int_ += sc->data[SC_BLESSING]->val2;
+	if(sc_data(sc, SC_BLESSING)) {
+		if (sc_data(sc, SC_BLESSING)->val2)
+			int_ += sc_data(sc, SC_BLESSING)->val2;
 		else
 			int_ >>= 1;
 	}
-	if(sc->data[SC_NEN])
-		int_ += sc->data[SC_NEN]->val1;
-	if(sc->data[SC_INSPIRATION])
-		int_ += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_COCKTAIL_WARG_BLOOD])
-		int_ += sc->data[SC_COCKTAIL_WARG_BLOOD]->val1;
-	if(sc->data[SC_2011RWC_SCROLL])
-		int_ += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_MARIONETTE2])
-		int_ += ((sc->data[SC_MARIONETTE2]->val4)>>16)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		int_ += ((sc->data[SC_SPIRIT]->val4)>>16)&0xFF;
+	if(sc_data(sc, SC_NEN))
+		int_ += sc_data(sc, SC_NEN)->val1;
+	if(sc_data(sc, SC_INSPIRATION))
+		int_ += sc_data(sc, SC_INSPIRATION)->val3;
+	if(sc_data(sc, SC_COCKTAIL_WARG_BLOOD))
+		int_ += sc_data(sc, SC_COCKTAIL_WARG_BLOOD)->val1;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
+		int_ += sc_data(sc, SC_2011RWC_SCROLL)->val1;
+	if(sc_data(sc, SC_MARIONETTE2))
+		int_ += ((sc_data(sc, SC_MARIONETTE2)->val4)>>16)&0xFF;
+	if(sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_HIGH)
+		int_ += ((sc_data(sc, SC_SPIRIT)->val4)>>16)&0xFF;
 	if(bl->type != BL_PC) {
-		if(sc->data[SC_STRIPHELM])
-			int_ -= int_ * sc->data[SC_STRIPHELM]->val2 / 100;
-		if(sc->data[SC__STRIPACCESSORY])
-			int_ -= int_ * sc->data[SC__STRIPACCESSORY]->val2 / 100;
-	}
-	if(sc->data[SC_HARMONIZE])
-		int_ -= sc->data[SC_HARMONIZE]->val2;
-	if(sc->data[SC_MELODYOFSINK])
-		int_ -= sc->data[SC_MELODYOFSINK]->val3;
-	if(sc->data[SC_MANDRAGORA])
-		int_ -= 4 * sc->data[SC_MANDRAGORA]->val1;
-	if(sc->data[SC_STOMACHACHE])
-		int_ -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		int_ -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_MARIONETTE])
-		int_ -= ((sc->data[SC_MARIONETTE]->val4)>>16)&0xFF;
+		if(sc_data(sc, SC_STRIPHELM))
+			int_ -= int_ * sc_data(sc, SC_STRIPHELM)->val2 / 100;
+		if(sc_data(sc, SC__STRIPACCESSORY))
+			int_ -= int_ * sc_data(sc, SC__STRIPACCESSORY)->val2 / 100;
+	}
+	if(sc_data(sc, SC_HARMONIZE))
+		int_ -= sc_data(sc, SC_HARMONIZE)->val2;
+	if(sc_data(sc, SC_MELODYOFSINK))
+		int_ -= sc_data(sc, SC_MELODYOFSINK)->val3;
+	if(sc_data(sc, SC_MANDRAGORA))
+		int_ -= 4 * sc_data(sc, SC_MANDRAGORA)->val1;
+	if(sc_data(sc, SC_STOMACHACHE))
+		int_ -= sc_data(sc, SC_STOMACHACHE)->val1;
+	if(sc_data(sc, SC_KYOUGAKU))
+		int_ -= sc_data(sc, SC_KYOUGAKU)->val2;
+	if(sc_data(sc, SC_MARIONETTE))
+		int_ -= ((sc_data(sc, SC_MARIONETTE)->val4)>>16)&0xFF;
 
 	return (unsigned short)cap_value(int_,0,USHRT_MAX);
 }
@@ -5075,58 +5248,58 @@ static unsigned short status_calc_dex(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(dex,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(sc_data(sc, SC_FULL_THROTTLE))
 		dex += dex * 20 / 100;
-	if(sc->data[SC_CONCENTRATE] && !sc->data[SC_QUAGMIRE])
-		dex += (dex - sc->data[SC_CONCENTRATE]->val4) * sc->data[SC_CONCENTRATE]->val2 / 100;
-	if(sc->data[SC_INCALLSTATUS])
-		dex += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCDEX])
-		dex += sc->data[SC_INCDEX]->val1;
-	if(sc->data[SC_DEXFOOD])
-		dex += sc->data[SC_DEXFOOD]->val1;
-	if(sc->data[SC_FOOD_DEX_CASH])
-		dex += sc->data[SC_FOOD_DEX_CASH]->val1;
+	if(sc_data(sc, SC_CONCENTRATE) && !sc_data(sc, SC_QUAGMIRE))
+		dex += (dex - sc_data(sc, SC_CONCENTRATE)->val4) * sc_data(sc, SC_CONCENTRATE)->val2 / 100;
+	if(sc_data(sc, SC_INCALLSTATUS))
+		dex += sc_data(sc, SC_INCALLSTATUS)->val1;
+	if(sc_data(sc, SC_INCDEX))
+		dex += sc_data(sc, SC_INCDEX)->val1;
+	if(sc_data(sc, SC_DEXFOOD))
+		dex += sc_data(sc, SC_DEXFOOD)->val1;
+	if(sc_data(sc, SC_FOOD_DEX_CASH))
+		dex += sc_data(sc, SC_FOOD_DEX_CASH)->val1;
 	if(bl->type == BL_PC) {
-		if(sc->data[SC_BATTLEORDERS])
+		if(sc_data(sc, SC_BATTLEORDERS))
 			dex += 5;
-		if(sc->data[SC_HAWKEYES])
-			dex += sc->data[SC_HAWKEYES]->val1;
+		if(sc_data(sc, SC_HAWKEYES))
+			dex += sc_data(sc, SC_HAWKEYES)->val1;
 	}
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_data(sc, SC_TRUESIGHT))
 		dex += 5;
-	if(sc->data[SC_BLESSING]) {
-		if (sc->data[SC_BLESSING]->val2)
-			dex += sc->data[SC_BLESSING]->val2;
+	if(sc_data(sc, SC_BLESSING)) {
+		if (sc_data(sc, SC_BLESSING)->val2)
+			dex += sc_data(sc, SC_BLESSING)->val2;
 		else
 			dex >>= 1;
 	}
-	if(sc->data[SC_INCREASING])
+	if(sc_data(sc, SC_INCREASING))
 		dex += 4; //Added based on skill updates [Reddozen]
-	if(sc->data[SC_SIROMA_ICE_TEA])
-		dex += sc->data[SC_SIROMA_ICE_TEA]->val1;
-	if(sc->data[SC_INSPIRATION])
-		dex += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_2011RWC_SCROLL])
-		dex += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_MARIONETTE2])
-		dex += ((sc->data[SC_MARIONETTE2]->val4)>>8)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		dex += ((sc->data[SC_SPIRIT]->val4)>>8)&0xFF;
-	if(sc->data[SC_MARSHOFABYSS])
-		dex -= dex * sc->data[SC_MARSHOFABYSS]->val2 / 100;
-	if(sc->data[SC_HARMONIZE])
-		dex -= sc->data[SC_HARMONIZE]->val2;
-	if(sc->data[SC_QUAGMIRE])
-		dex -= sc->data[SC_QUAGMIRE]->val2;
-	if(sc->data[SC_STOMACHACHE])
-		dex -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		dex -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC__STRIPACCESSORY] && bl->type != BL_PC)
-		dex -= dex * sc->data[SC__STRIPACCESSORY]->val2 / 100;
-	if(sc->data[SC_MARIONETTE])
-		dex -= ((sc->data[SC_MARIONETTE]->val4)>>8)&0xFF;
+	if(sc_data(sc, SC_SIROMA_ICE_TEA))
+		dex += sc_data(sc, SC_SIROMA_ICE_TEA)->val1;
+	if(sc_data(sc, SC_INSPIRATION))
+		dex += sc_data(sc, SC_INSPIRATION)->val3;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
+		dex += sc_data(sc, SC_2011RWC_SCROLL)->val1;
+	if(sc_data(sc, SC_MARIONETTE2))
+		dex += ((sc_data(sc, SC_MARIONETTE2)->val4)>>8)&0xFF;
+	if(sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_HIGH)
+		dex += ((sc_data(sc, SC_SPIRIT)->val4)>>8)&0xFF;
+	if(sc_data(sc, SC_MARSHOFABYSS))
+		dex -= dex * sc_data(sc, SC_MARSHOFABYSS)->val2 / 100;
+	if(sc_data(sc, SC_HARMONIZE))
+		dex -= sc_data(sc, SC_HARMONIZE)->val2;
+	if(sc_data(sc, SC_QUAGMIRE))
+		dex -= sc_data(sc, SC_QUAGMIRE)->val2;
+	if(sc_data(sc, SC_STOMACHACHE))
+		dex -= sc_data(sc, SC_STOMACHACHE)->val1;
+	if(sc_data(sc, SC_KYOUGAKU))
+		dex -= sc_data(sc, SC_KYOUGAKU)->val2;
+	if(sc_data(sc, SC__STRIPACCESSORY) && bl->type != BL_PC)
+		dex -= dex * sc_data(sc, SC__STRIPACCESSORY)->val2 / 100;
+	if(sc_data(sc, SC_MARIONETTE))
+		dex -= ((sc_data(sc, SC_MARIONETTE)->val4)>>8)&0xFF;
 
 	return (unsigned short)cap_value(dex,0,USHRT_MAX);
 }
@@ -5136,47 +5309,47 @@ static unsigned short status_calc_luk(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(luk,0,USHRT_MAX);
 
-	if(sc->data[SC_CURSE])
+	if(sc_data(sc, SC_CURSE))
 		return 0;
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(sc_data(sc, SC_FULL_THROTTLE))
 		luk += luk * 20 / 100;
-	if(sc->data[SC_INCALLSTATUS])
-		luk += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCLUK])
-		luk += sc->data[SC_INCLUK]->val1;
-	if(sc->data[SC_LUKFOOD])
-		luk += sc->data[SC_LUKFOOD]->val1;
-	if(sc->data[SC_FOOD_LUK_CASH])
-		luk += sc->data[SC_FOOD_LUK_CASH]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_data(sc, SC_INCALLSTATUS))
+		luk += sc_data(sc, SC_INCALLSTATUS)->val1;
+	if(sc_data(sc, SC_INCLUK))
+		luk += sc_data(sc, SC_INCLUK)->val1;
+	if(sc_data(sc, SC_LUKFOOD))
+		luk += sc_data(sc, SC_LUKFOOD)->val1;
+	if(sc_data(sc, SC_FOOD_LUK_CASH))
+		luk += sc_data(sc, SC_FOOD_LUK_CASH)->val1;
+	if(sc_data(sc, SC_TRUESIGHT))
 		luk += 5;
-	if(sc->data[SC_GLORIA])
+	if(sc_data(sc, SC_GLORIA))
 		luk += 30;
-	if(sc->data[SC_PUTTI_TAILS_NOODLES])
-		luk += sc->data[SC_PUTTI_TAILS_NOODLES]->val1;
-	if(sc->data[SC_INSPIRATION])
-		luk += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_LAUDARAMUS])
-		luk += 4 + sc->data[SC_LAUDARAMUS]->val1;
-	if(sc->data[SC_2011RWC_SCROLL])
-		luk += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_MARIONETTE2])
-		luk += sc->data[SC_MARIONETTE2]->val4&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		luk += sc->data[SC_SPIRIT]->val4&0xFF;
-	if(sc->data[SC__STRIPACCESSORY] && bl->type != BL_PC)
-		luk -= luk * sc->data[SC__STRIPACCESSORY]->val2 / 100;
-	if(sc->data[SC_BANANA_BOMB])
+	if(sc_data(sc, SC_PUTTI_TAILS_NOODLES))
+		luk += sc_data(sc, SC_PUTTI_TAILS_NOODLES)->val1;
+	if(sc_data(sc, SC_INSPIRATION))
+		luk += sc_data(sc, SC_INSPIRATION)->val3;
+	if(sc_data(sc, SC_LAUDARAMUS))
+		luk += 4 + sc_data(sc, SC_LAUDARAMUS)->val1;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
+		luk += sc_data(sc, SC_2011RWC_SCROLL)->val1;
+	if(sc_data(sc, SC_MARIONETTE2))
+		luk += sc_data(sc, SC_MARIONETTE2)->val4&0xFF;
+	if(sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_HIGH)
+		luk += sc_data(sc, SC_SPIRIT)->val4&0xFF;
+	if(sc_data(sc, SC__STRIPACCESSORY) && bl->type != BL_PC)
+		luk -= luk * sc_data(sc, SC__STRIPACCESSORY)->val2 / 100;
+	if(sc_data(sc, SC_BANANA_BOMB))
 		luk -= 77;
-	if(sc->data[SC_HARMONIZE])
-		luk -= sc->data[SC_HARMONIZE]->val2;
-	if(sc->data[SC_STOMACHACHE])
-		luk -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		luk -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_MARIONETTE])
-		luk -= sc->data[SC_MARIONETTE]->val4&0xFF;
+	if(sc_data(sc, SC_HARMONIZE))
+		luk -= sc_data(sc, SC_HARMONIZE)->val2;
+	if(sc_data(sc, SC_STOMACHACHE))
+		luk -= sc_data(sc, SC_STOMACHACHE)->val1;
+	if(sc_data(sc, SC_KYOUGAKU))
+		luk -= sc_data(sc, SC_KYOUGAKU)->val2;
+	if(sc_data(sc, SC_MARIONETTE))
+		luk -= sc_data(sc, SC_MARIONETTE)->val4&0xFF;
 
 	return (unsigned short)cap_value(luk,0,USHRT_MAX);
 }
@@ -5186,69 +5359,69 @@ static unsigned short status_calc_batk(struct block_list *bl, struct status_chan
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(batk,0,USHRT_MAX);
 
-	if(sc->data[SC_ATKPOTION])
-		batk += sc->data[SC_ATKPOTION]->val1;
+	if(sc_data(sc, SC_ATKPOTION))
+		batk += sc_data(sc, SC_ATKPOTION)->val1;
 #ifndef RENEWAL
-	if(sc->data[SC_MADNESSCANCEL])
+	if(sc_data(sc, SC_MADNESSCANCEL))
 		batk += 100;
-	if(sc->data[SC_GATLINGFEVER])
-		batk += sc->data[SC_GATLINGFEVER]->val3;
+	if(sc_data(sc, SC_GATLINGFEVER))
+		batk += sc_data(sc, SC_GATLINGFEVER)->val3;
 #endif
-	if(sc->data[SC_BATKFOOD])
-		batk += sc->data[SC_BATKFOOD]->val1;
-	if(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2)
+	if(sc_data(sc, SC_BATKFOOD))
+		batk += sc_data(sc, SC_BATKFOOD)->val1;
+	if(sc_data(sc, SC_FIRE_INSIGNIA) && sc_data(sc, SC_FIRE_INSIGNIA)->val1 == 2)
 		batk += 50;
 	if(bl->type == BL_ELEM &&
-		((sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 1) ||
-		(sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 1) ||
-		(sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 1) ||
-		(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 1)))
+		((sc_data(sc, SC_FIRE_INSIGNIA) && sc_data(sc, SC_FIRE_INSIGNIA)->val1 == 1) ||
+		(sc_data(sc, SC_WATER_INSIGNIA) && sc_data(sc, SC_WATER_INSIGNIA)->val1 == 1) ||
+		(sc_data(sc, SC_WIND_INSIGNIA) && sc_data(sc, SC_WIND_INSIGNIA)->val1 == 1) ||
+		(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 1)))
 		batk += batk / 5;
-	if(sc->data[SC_ANGRIFFS_MODUS])
-		batk += sc->data[SC_ANGRIFFS_MODUS]->val2;
-	if(sc->data[SC_SKE])
+	if(sc_data(sc, SC_ANGRIFFS_MODUS))
+		batk += sc_data(sc, SC_ANGRIFFS_MODUS)->val2;
+	if(sc_data(sc, SC_SKE))
 		batk += 3 * batk;
-	if(sc->data[SC_ZANGETSU])
-		batk += sc->data[SC_ZANGETSU]->val2;
-	if(sc->data[SC_QUEST_BUFF1])
-		batk += sc->data[SC_QUEST_BUFF1]->val1;
-	if(sc->data[SC_QUEST_BUFF2])
-		batk += sc->data[SC_QUEST_BUFF2]->val1;
-	if(sc->data[SC_QUEST_BUFF3])
-		batk += sc->data[SC_QUEST_BUFF3]->val1;
-	if(sc->data[SC_2011RWC_SCROLL])
+	if(sc_data(sc, SC_ZANGETSU))
+		batk += sc_data(sc, SC_ZANGETSU)->val2;
+	if(sc_data(sc, SC_QUEST_BUFF1))
+		batk += sc_data(sc, SC_QUEST_BUFF1)->val1;
+	if(sc_data(sc, SC_QUEST_BUFF2))
+		batk += sc_data(sc, SC_QUEST_BUFF2)->val1;
+	if(sc_data(sc, SC_QUEST_BUFF3))
+		batk += sc_data(sc, SC_QUEST_BUFF3)->val1;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
 		batk += 30;
-	if(sc->data[SC_INCATKRATE])
-		batk += batk * sc->data[SC_INCATKRATE]->val1 / 100;
-	if(sc->data[SC_PROVOKE]
+	if(sc_data(sc, SC_INCATKRATE))
+		batk += batk * sc_data(sc, SC_INCATKRATE)->val1 / 100;
+	if(sc_data(sc, SC_PROVOKE)
 #ifdef RENEWAL
 		&& bl->type != BL_PC
 #endif
 		)
-		batk += batk * sc->data[SC_PROVOKE]->val3 / 100;
+		batk += batk * sc_data(sc, SC_PROVOKE)->val3 / 100;
 #ifndef RENEWAL
-	if(sc->data[SC_CONCENTRATION])
-		batk += batk * sc->data[SC_CONCENTRATION]->val2 / 100;
+	if(sc_data(sc, SC_CONCENTRATION))
+		batk += batk * sc_data(sc, SC_CONCENTRATION)->val2 / 100;
 #endif
-	if(sc->data[SC_BLOODLUST])
-		batk += batk * sc->data[SC_BLOODLUST]->val2 / 100;
-	if(sc->data[SC_FLEET])
-		batk += batk * sc->data[SC_FLEET]->val3 / 100;
-	if(sc->data[SC_CURSE])
+	if(sc_data(sc, SC_BLOODLUST))
+		batk += batk * sc_data(sc, SC_BLOODLUST)->val2 / 100;
+	if(sc_data(sc, SC_FLEET))
+		batk += batk * sc_data(sc, SC_FLEET)->val3 / 100;
+	if(sc_data(sc, SC_CURSE))
 		batk -= batk * 25 / 100;
 	//Curse shouldn't effect on this? <- Curse/Bleeding?
-	//if(sc->data[SC_BLEEDING])
+	//if(sc_data(sc, SC_BLEEDING))
 		//batk -= batk * 25 / 100;
 #ifdef RENEWAL
-	if(sc->data[SC_STRIPWEAPON] && bl->type != BL_PC)
-		batk -= batk * sc->data[SC_STRIPWEAPON]->val2 / 100;
+	if(sc_data(sc, SC_STRIPWEAPON) && bl->type != BL_PC)
+		batk -= batk * sc_data(sc, SC_STRIPWEAPON)->val2 / 100;
 #endif
-	if(sc->data[SC_JOINTBEAT] && sc->data[SC_JOINTBEAT]->val2&BREAK_WAIST)
+	if(sc_data(sc, SC_JOINTBEAT) && sc_data(sc, SC_JOINTBEAT)->val2&BREAK_WAIST)
 		batk -= batk * 25 / 100;
-	if(sc->data[SC__ENERVATION])
-		batk -= batk * sc->data[SC__ENERVATION]->val2 / 100;
-	if(sc->data[SC_ASH])
-		batk -= batk * sc->data[SC_ASH]->val4 / 100;
+	if(sc_data(sc, SC__ENERVATION))
+		batk -= batk * sc_data(sc, SC__ENERVATION)->val2 / 100;
+	if(sc_data(sc, SC_ASH))
+		batk -= batk * sc_data(sc, SC_ASH)->val4 / 100;
 
 	return (unsigned short)cap_value(batk,0,USHRT_MAX);
 }
@@ -5258,61 +5431,61 @@ static unsigned short status_calc_watk(struct block_list *bl, struct status_chan
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(watk,0,USHRT_MAX);
 
-	if(sc->data[SC_WATKFOOD])
-		watk += sc->data[SC_WATKFOOD]->val1;
+	if(sc_data(sc, SC_WATKFOOD))
+		watk += sc_data(sc, SC_WATKFOOD)->val1;
 #ifndef RENEWAL
-	if(sc->data[SC_IMPOSITIO])
-		watk += sc->data[SC_IMPOSITIO]->val2;
-	if(sc->data[SC_VOLCANO])
-		watk += sc->data[SC_VOLCANO]->val2;
-	if(sc->data[SC_DRUMBATTLE])
-		watk += sc->data[SC_DRUMBATTLE]->val2;
+	if(sc_data(sc, SC_IMPOSITIO))
+		watk += sc_data(sc, SC_IMPOSITIO)->val2;
+	if(sc_data(sc, SC_VOLCANO))
+		watk += sc_data(sc, SC_VOLCANO)->val2;
+	if(sc_data(sc, SC_DRUMBATTLE))
+		watk += sc_data(sc, SC_DRUMBATTLE)->val2;
 #endif
-	if(sc->data[SC_MERC_ATKUP])
-		watk += sc->data[SC_MERC_ATKUP]->val2;
-	if(sc->data[SC_SKE])
+	if(sc_data(sc, SC_MERC_ATKUP))
+		watk += sc_data(sc, SC_MERC_ATKUP)->val2;
+	if(sc_data(sc, SC_SKE))
 		watk += 3 * watk;
-	if(sc->data[SC_INSPIRATION])
-		watk += 40 * sc->data[SC_INSPIRATION]->val1 + 3 * sc->data[SC_INSPIRATION]->val2;
-	if(sc->data[SC_STRIKING])
-		watk += sc->data[SC_STRIKING]->val2;
-	if((sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2) ||
-		(sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 2) ||
-		(sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 2) ||
-		(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2))
+	if(sc_data(sc, SC_INSPIRATION))
+		watk += 40 * sc_data(sc, SC_INSPIRATION)->val1 + 3 * sc_data(sc, SC_INSPIRATION)->val2;
+	if(sc_data(sc, SC_STRIKING))
+		watk += sc_data(sc, SC_STRIKING)->val2;
+	if((sc_data(sc, SC_FIRE_INSIGNIA) && sc_data(sc, SC_FIRE_INSIGNIA)->val1 == 2) ||
+		(sc_data(sc, SC_WATER_INSIGNIA) && sc_data(sc, SC_WATER_INSIGNIA)->val1 == 2) ||
+		(sc_data(sc, SC_WIND_INSIGNIA) && sc_data(sc, SC_WIND_INSIGNIA)->val1 == 2) ||
+		(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 2))
 		watk += watk / 10;
-	if(sc->data[SC_PYROCLASTIC] && bl->type == BL_PC)
-		watk += sc->data[SC_PYROCLASTIC]->val2;
-	if(sc->data[SC_ODINS_POWER])
-		watk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1;
-	if(sc->data[SC_FULL_SWING_K])
-		watk += sc->data[SC_FULL_SWING_K]->val1;
+	if(sc_data(sc, SC_PYROCLASTIC) && bl->type == BL_PC)
+		watk += sc_data(sc, SC_PYROCLASTIC)->val2;
+	if(sc_data(sc, SC_ODINS_POWER))
+		watk += 40 + 30 * sc_data(sc, SC_ODINS_POWER)->val1;
+	if(sc_data(sc, SC_FULL_SWING_K))
+		watk += sc_data(sc, SC_FULL_SWING_K)->val1;
 #ifndef RENEWAL
-	if(sc->data[SC_CONCENTRATION])
-		watk += watk * sc->data[SC_CONCENTRATION]->val2 / 100;
+	if(sc_data(sc, SC_CONCENTRATION))
+		watk += watk * sc_data(sc, SC_CONCENTRATION)->val2 / 100;
 #endif
-	if(sc->data[SC_INCATKRATE] && bl->type != BL_MOB)
-		watk += watk * sc->data[SC_INCATKRATE]->val1 / 100;
-	if(sc->data[SC_PROVOKE]
+	if(sc_data(sc, SC_INCATKRATE) && bl->type != BL_MOB)
+		watk += watk * sc_data(sc, SC_INCATKRATE)->val1 / 100;
+	if(sc_data(sc, SC_PROVOKE)
 #ifdef RENEWAL
 		&& bl->type != BL_PC
 #endif
 		)
-		watk += watk * sc->data[SC_PROVOKE]->val3 / 100;
-	if(sc->data[SC_FLEET])
-		watk += watk * sc->data[SC_FLEET]->val3 / 100;
-	if(sc->data[SC_TIDAL_WEAPON])
-		watk += watk * sc->data[SC_TIDAL_WEAPON]->val2 / 100;
-	if(sc->data[SC_ANGRIFFS_MODUS])
-		watk += watk * sc->data[SC_ANGRIFFS_MODUS]->val2 / 100;
-	if(sc->data[SC_CURSE])
+		watk += watk * sc_data(sc, SC_PROVOKE)->val3 / 100;
+	if(sc_data(sc, SC_FLEET))
+		watk += watk * sc_data(sc, SC_FLEET)->val3 / 100;
+	if(sc_data(sc, SC_TIDAL_WEAPON))
+		watk += watk * sc_data(sc, SC_TIDAL_WEAPON)->val2 / 100;
+	if(sc_data(sc, SC_ANGRIFFS_MODUS))
+		watk += watk * sc_data(sc, SC_ANGRIFFS_MODUS)->val2 / 100;
+	if(sc_data(sc, SC_CURSE))
 		watk -= watk * 25 / 100;
 #ifndef RENEWAL
-	if(sc->data[SC_STRIPWEAPON] && bl->type != BL_PC)
-		watk -= watk * sc->data[SC_STRIPWEAPON]->val2 / 100;
+	if(sc_data(sc, SC_STRIPWEAPON) && bl->type != BL_PC)
+		watk -= watk * sc_data(sc, SC_STRIPWEAPON)->val2 / 100;
 #endif
-	if(sc->data[SC__ENERVATION])
-		watk -= watk * sc->data[SC__ENERVATION]->val2 / 100;
+	if(sc_data(sc, SC__ENERVATION))
+		watk -= watk * sc_data(sc, SC__ENERVATION)->val2 / 100;
 
 	return (unsigned short)cap_value(watk,0,USHRT_MAX);
 }
@@ -5323,37 +5496,37 @@ static unsigned short status_calc_ematk(struct block_list *bl, struct status_cha
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(matk,0,USHRT_MAX);
 
-	if(sc->data[SC_MATKPOTION])
-		matk += sc->data[SC_MATKPOTION]->val1;
-	if(sc->data[SC_MATKFOOD])
-		matk += sc->data[SC_MATKFOOD]->val1;
-	if(sc->data[SC_MANA_PLUS])
-		matk += sc->data[SC_MANA_PLUS]->val1;
-	if(sc->data[SC_AQUAPLAY_OPTION])
-		matk += sc->data[SC_AQUAPLAY_OPTION]->val2;
-	if(sc->data[SC_CHILLY_AIR_OPTION])
-		matk += sc->data[SC_CHILLY_AIR_OPTION]->val2;
-	if(sc->data[SC_COOLER_OPTION])
-		matk += sc->data[SC_COOLER_OPTION]->val2;
-	if(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3)
+	if(sc_data(sc, SC_MATKPOTION))
+		matk += sc_data(sc, SC_MATKPOTION)->val1;
+	if(sc_data(sc, SC_MATKFOOD))
+		matk += sc_data(sc, SC_MATKFOOD)->val1;
+	if(sc_data(sc, SC_MANA_PLUS))
+		matk += sc_data(sc, SC_MANA_PLUS)->val1;
+	if(sc_data(sc, SC_AQUAPLAY_OPTION))
+		matk += sc_data(sc, SC_AQUAPLAY_OPTION)->val2;
+	if(sc_data(sc, SC_CHILLY_AIR_OPTION))
+		matk += sc_data(sc, SC_CHILLY_AIR_OPTION)->val2;
+	if(sc_data(sc, SC_COOLER_OPTION))
+		matk += sc_data(sc, SC_COOLER_OPTION)->val2;
+	if(sc_data(sc, SC_FIRE_INSIGNIA) && sc_data(sc, SC_FIRE_INSIGNIA)->val1 == 3)
 		matk += 50;
-	if(sc->data[SC_ODINS_POWER])
-		matk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1;
-	if(sc->data[SC_MOONLITSERENADE])
-		matk += sc->data[SC_MOONLITSERENADE]->val3;
-	if(sc->data[SC_IZAYOI])
-		matk += 25 * sc->data[SC_IZAYOI]->val1;
-	if(sc->data[SC_ZANGETSU])
-		matk += sc->data[SC_ZANGETSU]->val3;
-	if(sc->data[SC_QUEST_BUFF1])
-		matk += sc->data[SC_QUEST_BUFF1]->val1;
-	if(sc->data[SC_QUEST_BUFF2])
-		matk += sc->data[SC_QUEST_BUFF2]->val1;
-	if(sc->data[SC_QUEST_BUFF3])
-		matk += sc->data[SC_QUEST_BUFF3]->val1;
-	if(sc->data[SC_MTF_MATK2])
-		matk += sc->data[SC_MTF_MATK2]->val1;
-	if(sc->data[SC_2011RWC_SCROLL])
+	if(sc_data(sc, SC_ODINS_POWER))
+		matk += 40 + 30 * sc_data(sc, SC_ODINS_POWER)->val1;
+	if(sc_data(sc, SC_MOONLITSERENADE))
+		matk += sc_data(sc, SC_MOONLITSERENADE)->val3;
+	if(sc_data(sc, SC_IZAYOI))
+		matk += 25 * sc_data(sc, SC_IZAYOI)->val1;
+	if(sc_data(sc, SC_ZANGETSU))
+		matk += sc_data(sc, SC_ZANGETSU)->val3;
+	if(sc_data(sc, SC_QUEST_BUFF1))
+		matk += sc_data(sc, SC_QUEST_BUFF1)->val1;
+	if(sc_data(sc, SC_QUEST_BUFF2))
+		matk += sc_data(sc, SC_QUEST_BUFF2)->val1;
+	if(sc_data(sc, SC_QUEST_BUFF3))
+		matk += sc_data(sc, SC_QUEST_BUFF3)->val1;
+	if(sc_data(sc, SC_MTF_MATK2))
+		matk += sc_data(sc, SC_MTF_MATK2)->val1;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
 		matk += 30;
 
 	return (unsigned short)cap_value(matk,0,USHRT_MAX);
@@ -5366,51 +5539,51 @@ static unsigned short status_calc_matk(struct block_list *bl, struct status_chan
 		return (unsigned short)cap_value(matk,0,USHRT_MAX);
 
 	if(!viewable) { //Some statuses that are hidden in the status window
-		if(sc->data[SC_MINDBREAKER])
-			matk += matk * sc->data[SC_MINDBREAKER]->val2 / 100;
+		if(sc_data(sc, SC_MINDBREAKER))
+			matk += matk * sc_data(sc, SC_MINDBREAKER)->val2 / 100;
 		return (unsigned short)cap_value(matk,0,USHRT_MAX);
 	}
 #ifndef RENEWAL
 	//Take note fixed value first before % modifiers
-	if(sc->data[SC_MATKPOTION])
-		matk += sc->data[SC_MATKPOTION]->val1;
-	if(sc->data[SC_MATKFOOD])
-		matk += sc->data[SC_MATKFOOD]->val1;
-	if(sc->data[SC_MANA_PLUS])
-		matk += sc->data[SC_MANA_PLUS]->val1;
-	if(sc->data[SC_AQUAPLAY_OPTION])
-		matk += sc->data[SC_AQUAPLAY_OPTION]->val2;
-	if(sc->data[SC_CHILLY_AIR_OPTION])
-		matk += sc->data[SC_CHILLY_AIR_OPTION]->val2;
-	if(sc->data[SC_COOLER_OPTION])
-		matk += sc->data[SC_COOLER_OPTION]->val2;
-	if(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3)
+	if(sc_data(sc, SC_MATKPOTION))
+		matk += sc_data(sc, SC_MATKPOTION)->val1;
+	if(sc_data(sc, SC_MATKFOOD))
+		matk += sc_data(sc, SC_MATKFOOD)->val1;
+	if(sc_data(sc, SC_MANA_PLUS))
+		matk += sc_data(sc, SC_MANA_PLUS)->val1;
+	if(sc_data(sc, SC_AQUAPLAY_OPTION))
+		matk += sc_data(sc, SC_AQUAPLAY_OPTION)->val2;
+	if(sc_data(sc, SC_CHILLY_AIR_OPTION))
+		matk += sc_data(sc, SC_CHILLY_AIR_OPTION)->val2;
+	if(sc_data(sc, SC_COOLER_OPTION))
+		matk += sc_data(sc, SC_COOLER_OPTION)->val2;
+	if(sc_data(sc, SC_FIRE_INSIGNIA) && sc_data(sc, SC_FIRE_INSIGNIA)->val1 == 3)
 		matk += 50;
-	if(sc->data[SC_ODINS_POWER])
-		matk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1;
-	if(sc->data[SC_MOONLITSERENADE])
-		matk += sc->data[SC_MOONLITSERENADE]->val3;
-	if(sc->data[SC_IZAYOI])
-		matk += 25 * sc->data[SC_IZAYOI]->val1;
-	if(sc->data[SC_ZANGETSU])
-		matk += sc->data[SC_ZANGETSU]->val3;
-	if(sc->data[SC_QUEST_BUFF1])
-		matk += sc->data[SC_QUEST_BUFF1]->val1;
-	if(sc->data[SC_QUEST_BUFF2])
-		matk += sc->data[SC_QUEST_BUFF2]->val1;
-	if(sc->data[SC_QUEST_BUFF3])
-		matk += sc->data[SC_QUEST_BUFF3]->val1;
-	if(sc->data[SC_MTF_MATK2])
-		matk += sc->data[SC_MTF_MATK2]->val1;
-	if(sc->data[SC_2011RWC_SCROLL])
+	if(sc_data(sc, SC_ODINS_POWER))
+		matk += 40 + 30 * sc_data(sc, SC_ODINS_POWER)->val1;
+	if(sc_data(sc, SC_MOONLITSERENADE))
+		matk += sc_data(sc, SC_MOONLITSERENADE)->val3;
+	if(sc_data(sc, SC_IZAYOI))
+		matk += 25 * sc_data(sc, SC_IZAYOI)->val1;
+	if(sc_data(sc, SC_ZANGETSU))
+		matk += sc_data(sc, SC_ZANGETSU)->val3;
+	if(sc_data(sc, SC_QUEST_BUFF1))
+		matk += sc_data(sc, SC_QUEST_BUFF1)->val1;
+	if(sc_data(sc, SC_QUEST_BUFF2))
+		matk += sc_data(sc, SC_QUEST_BUFF2)->val1;
+	if(sc_data(sc, SC_QUEST_BUFF3))
+		matk += sc_data(sc, SC_QUEST_BUFF3)->val1;
+	if(sc_data(sc, SC_MTF_MATK2))
+		matk += sc_data(sc, SC_MTF_MATK2)->val1;
+	if(sc_data(sc, SC_2011RWC_SCROLL))
 		matk += 30;
 #endif
-	if(sc->data[SC_MAGICPOWER] && sc->data[SC_MAGICPOWER]->val4)
-		matk += matk * sc->data[SC_MAGICPOWER]->val3 / 100;
-	if(sc->data[SC_INCMATKRATE])
-		matk += matk * sc->data[SC_INCMATKRATE]->val1 / 100;
-	if(sc->data[SC_MTF_MATK])
-		matk += matk * sc->data[SC_MTF_MATK]->val1 / 100;
+	if(sc_data(sc, SC_MAGICPOWER) && sc_data(sc, SC_MAGICPOWER)->val4)
+		matk += matk * sc_data(sc, SC_MAGICPOWER)->val3 / 100;
+	if(sc_data(sc, SC_INCMATKRATE))
+		matk += matk * sc_data(sc, SC_INCMATKRATE)->val1 / 100;
+	if(sc_data(sc, SC_MTF_MATK))
+		matk += matk * sc_data(sc, SC_MTF_MATK)->val1 / 100;
 
 	return (unsigned short)cap_value(matk,0,USHRT_MAX);
 }
@@ -5420,30 +5593,30 @@ static short status_calc_critical(struct block_list *bl, struct status_change *s
 	if(!sc || !sc->count)
 		return (short)cap_value(critical,10,SHRT_MAX);
 
-	if(sc->data[SC_INCCRI])
-		critical += sc->data[SC_INCCRI]->val2;
-	if(sc->data[SC_CRIFOOD])
-		critical += sc->data[SC_CRIFOOD]->val1;
-	if(sc->data[SC_EXPLOSIONSPIRITS])
-		critical += sc->data[SC_EXPLOSIONSPIRITS]->val2;
-	if(sc->data[SC_FORTUNE])
-		critical += sc->data[SC_FORTUNE]->val2;
-	if(sc->data[SC_TRUESIGHT])
-		critical += sc->data[SC_TRUESIGHT]->val2;
-	if(sc->data[SC_CLOAKING])
+	if(sc_data(sc, SC_INCCRI))
+		critical += sc_data(sc, SC_INCCRI)->val2;
+	if(sc_data(sc, SC_CRIFOOD))
+		critical += sc_data(sc, SC_CRIFOOD)->val1;
+	if(sc_data(sc, SC_EXPLOSIONSPIRITS))
+		critical += sc_data(sc, SC_EXPLOSIONSPIRITS)->val2;
+	if(sc_data(sc, SC_FORTUNE))
+		critical += sc_data(sc, SC_FORTUNE)->val2;
+	if(sc_data(sc, SC_TRUESIGHT))
+		critical += sc_data(sc, SC_TRUESIGHT)->val2;
+	if(sc_data(sc, SC_CLOAKING))
 		critical += critical;
-	if(sc->data[SC_BEYONDOFWARCRY])
-		critical += sc->data[SC_BEYONDOFWARCRY]->val3;
+	if(sc_data(sc, SC_BEYONDOFWARCRY))
+		critical += sc_data(sc, SC_BEYONDOFWARCRY)->val3;
 #ifdef RENEWAL
-	if(sc->data[SC_SPEARQUICKEN])
-		critical += 3 * sc->data[SC_SPEARQUICKEN]->val1 * 10;
+	if(sc_data(sc, SC_SPEARQUICKEN))
+		critical += 3 * sc_data(sc, SC_SPEARQUICKEN)->val1 * 10;
 #endif
-	if(sc->data[SC_STRIKING])
-		critical += critical * sc->data[SC_STRIKING]->val1 / 100;
-	if(sc->data[SC__INVISIBILITY])
-		critical += critical * sc->data[SC__INVISIBILITY]->val2 / 100;
-	if(sc->data[SC__UNLUCKY])
-		critical -= sc->data[SC__UNLUCKY]->val2;
+	if(sc_data(sc, SC_STRIKING))
+		critical += critical * sc_data(sc, SC_STRIKING)->val1 / 100;
+	if(sc_data(sc, SC__INVISIBILITY))
+		critical += critical * sc_data(sc, SC__INVISIBILITY)->val2 / 100;
+	if(sc_data(sc, SC__UNLUCKY))
+		critical -= sc_data(sc, SC__UNLUCKY)->val2;
 
 	return (short)cap_value(critical,10,SHRT_MAX);
 }
@@ -5453,40 +5626,40 @@ static short status_calc_hit(struct block_list *bl, struct status_change *sc, in
 	if(!sc || !sc->count)
 		return (short)cap_value(hit,1,SHRT_MAX);
 
-	if(sc->data[SC_INCHIT])
-		hit += sc->data[SC_INCHIT]->val1;
-	if(sc->data[SC_HITFOOD])
-		hit += sc->data[SC_HITFOOD]->val1;
-	if(sc->data[SC_TRUESIGHT])
-		hit += sc->data[SC_TRUESIGHT]->val3;
-	if(sc->data[SC_HUMMING])
-		hit += sc->data[SC_HUMMING]->val2;
-	if(sc->data[SC_CONCENTRATION])
-		hit += sc->data[SC_CONCENTRATION]->val3;
-	if(sc->data[SC_INCREASING])
+	if(sc_data(sc, SC_INCHIT))
+		hit += sc_data(sc, SC_INCHIT)->val1;
+	if(sc_data(sc, SC_HITFOOD))
+		hit += sc_data(sc, SC_HITFOOD)->val1;
+	if(sc_data(sc, SC_TRUESIGHT))
+		hit += sc_data(sc, SC_TRUESIGHT)->val3;
+	if(sc_data(sc, SC_HUMMING))
+		hit += sc_data(sc, SC_HUMMING)->val2;
+	if(sc_data(sc, SC_CONCENTRATION))
+		hit += sc_data(sc, SC_CONCENTRATION)->val3;
+	if(sc_data(sc, SC_INCREASING))
 		hit += 20; //RockmanEXE: Changed based on updated [Reddozen]
-	if(sc->data[SC_INSPIRATION])
-		hit += 5 * sc->data[SC_INSPIRATION]->val1 + sc->data[SC_INSPIRATION]->val2 / 2;
-	if(sc->data[SC_MERC_HITUP])
-		hit += sc->data[SC_MERC_HITUP]->val2;
-	if(sc->data[SC_MTF_HITFLEE])
-		hit += sc->data[SC_MTF_HITFLEE]->val1;
-	if(sc->data[SC_INCHITRATE])
-		hit += hit * sc->data[SC_INCHITRATE]->val1 / 100;
-	if(sc->data[SC_ADJUSTMENT])
+	if(sc_data(sc, SC_INSPIRATION))
+		hit += 5 * sc_data(sc, SC_INSPIRATION)->val1 + sc_data(sc, SC_INSPIRATION)->val2 / 2;
+	if(sc_data(sc, SC_MERC_HITUP))
+		hit += sc_data(sc, SC_MERC_HITUP)->val2;
+	if(sc_data(sc, SC_MTF_HITFLEE))
+		hit += sc_data(sc, SC_MTF_HITFLEE)->val1;
+	if(sc_data(sc, SC_INCHITRATE))
+		hit += hit * sc_data(sc, SC_INCHITRATE)->val1 / 100;
+	if(sc_data(sc, SC_ADJUSTMENT))
 		hit -= 30;
-	if(sc->data[SC_ILLUSIONDOPING])
+	if(sc_data(sc, SC_ILLUSIONDOPING))
 		hit -= 50;
-	if(sc->data[SC_BLIND] || sc->data[SC_PYREXIA])
+	if(sc_data(sc, SC_BLIND) || sc_data(sc, SC_PYREXIA))
 		hit -= hit * 25 / 100;
-	if(sc->data[SC__GROOMY])
-		hit -= hit * sc->data[SC__GROOMY]->val2 / 100;
-	if(sc->data[SC_FEAR])
+	if(sc_data(sc, SC__GROOMY))
+		hit -= hit * sc_data(sc, SC__GROOMY)->val2 / 100;
+	if(sc_data(sc, SC_FEAR))
 		hit -= hit * 20 / 100;
-	if(sc->data[SC_TEARGAS])
+	if(sc_data(sc, SC_TEARGAS))
 		hit -= hit * 50 / 100;
-	if(sc->data[SC_ASH])
-		hit -= hit * sc->data[SC_ASH]->val2 / 100;
+	if(sc_data(sc, SC_ASH))
+		hit -= hit * sc_data(sc, SC_ASH)->val2 / 100;
 
 	return (short)cap_value(hit,1,SHRT_MAX);
 }
@@ -5502,83 +5675,83 @@ static short status_calc_flee(struct block_list *bl, struct status_change *sc, i
 
 	if(!sc || !sc->count)
 		return (short)cap_value(flee,1,SHRT_MAX);
-	if(sc->data[SC_OVERED_BOOST]) //Should be final and unmodifiable by any means
-		return sc->data[SC_OVERED_BOOST]->val2;
-	if(sc->data[SC_TINDER_BREAKER] || sc->data[SC_TINDER_BREAKER2])
+	if(sc_data(sc, SC_OVERED_BOOST)) //Should be final and unmodifiable by any means
+		return sc_data(sc, SC_OVERED_BOOST)->val2;
+	if(sc_data(sc, SC_TINDER_BREAKER) || sc_data(sc, SC_TINDER_BREAKER2))
 		return 0;
 
-	if(sc->data[SC_INCFLEE])
-		flee += sc->data[SC_INCFLEE]->val1;
-	if(sc->data[SC_FLEEFOOD])
-		flee += sc->data[SC_FLEEFOOD]->val1;
-	if(sc->data[SC_PARTYFLEE])
-		flee += sc->data[SC_PARTYFLEE]->val1 * 10;
+	if(sc_data(sc, SC_INCFLEE))
+		flee += sc_data(sc, SC_INCFLEE)->val1;
+	if(sc_data(sc, SC_FLEEFOOD))
+		flee += sc_data(sc, SC_FLEEFOOD)->val1;
+	if(sc_data(sc, SC_PARTYFLEE))
+		flee += sc_data(sc, SC_PARTYFLEE)->val1 * 10;
 #ifdef RENEWAL
-	if(sc->data[SC_SPEARQUICKEN])
-		flee += 2 * sc->data[SC_SPEARQUICKEN]->val1;
+	if(sc_data(sc, SC_SPEARQUICKEN))
+		flee += 2 * sc_data(sc, SC_SPEARQUICKEN)->val1;
 #endif
-	if(sc->data[SC_CLOSECONFINE])
+	if(sc_data(sc, SC_CLOSECONFINE))
 		flee += 10;
-	if(sc->data[SC_WHISTLE])
-		flee += sc->data[SC_WHISTLE]->val2;
-	if(sc->data[SC_VIOLENTGALE])
-		flee += sc->data[SC_VIOLENTGALE]->val2;
-	if(sc->data[SC_WINDWALK])
-		flee += sc->data[SC_WINDWALK]->val2;
-	if(sc->data[SC_MOON_COMFORT]) //SG skill [Komurka]
-		flee += sc->data[SC_MOON_COMFORT]->val2;
-	if(sc->data[SC_ADJUSTMENT])
+	if(sc_data(sc, SC_WHISTLE))
+		flee += sc_data(sc, SC_WHISTLE)->val2;
+	if(sc_data(sc, SC_VIOLENTGALE))
+		flee += sc_data(sc, SC_VIOLENTGALE)->val2;
+	if(sc_data(sc, SC_WINDWALK))
+		flee += sc_data(sc, SC_WINDWALK)->val2;
+	if(sc_data(sc, SC_MOON_COMFORT)) //SG skill [Komurka]
+		flee += sc_data(sc, SC_MOON_COMFORT)->val2;
+	if(sc_data(sc, SC_ADJUSTMENT))
 		flee += 30;
-	if(sc->data[SC_SPEED])
-		flee += 10 + sc->data[SC_SPEED]->val1 * 10;
-	if(sc->data[SC_MERC_FLEEUP])
-		flee += sc->data[SC_MERC_FLEEUP]->val2;
-	if(sc->data[SC_HALLUCINATIONWALK])
-		flee += sc->data[SC_HALLUCINATIONWALK]->val2;
-	if(sc->data[SC_ZEPHYR])
-		flee += sc->data[SC_ZEPHYR]->val2;
-	if(sc->data[SC_MTF_HITFLEE])
-		flee += sc->data[SC_MTF_HITFLEE]->val2;
-	if(sc->data[SC_INCFLEERATE])
-		flee += flee * sc->data[SC_INCFLEERATE]->val1 / 100;
-	if(sc->data[SC_WIND_STEP_OPTION])
-		flee += flee * sc->data[SC_WIND_STEP_OPTION]->val2 / 100;
-	if(sc->data[SC_GOLDENE_FERSE])
-		flee += flee * sc->data[SC_GOLDENE_FERSE]->val2 / 100;
-	if(sc->data[SC_SMOKEPOWDER])
+	if(sc_data(sc, SC_SPEED))
+		flee += 10 + sc_data(sc, SC_SPEED)->val1 * 10;
+	if(sc_data(sc, SC_MERC_FLEEUP))
+		flee += sc_data(sc, SC_MERC_FLEEUP)->val2;
+	if(sc_data(sc, SC_HALLUCINATIONWALK))
+		flee += sc_data(sc, SC_HALLUCINATIONWALK)->val2;
+	if(sc_data(sc, SC_ZEPHYR))
+		flee += sc_data(sc, SC_ZEPHYR)->val2;
+	if(sc_data(sc, SC_MTF_HITFLEE))
+		flee += sc_data(sc, SC_MTF_HITFLEE)->val2;
+	if(sc_data(sc, SC_INCFLEERATE))
+		flee += flee * sc_data(sc, SC_INCFLEERATE)->val1 / 100;
+	if(sc_data(sc, SC_WIND_STEP_OPTION))
+		flee += flee * sc_data(sc, SC_WIND_STEP_OPTION)->val2 / 100;
+	if(sc_data(sc, SC_GOLDENE_FERSE))
+		flee += flee * sc_data(sc, SC_GOLDENE_FERSE)->val2 / 100;
+	if(sc_data(sc, SC_SMOKEPOWDER))
 		flee += flee * 20 / 100;
-	if(sc->data[SC_GATLINGFEVER])
-		flee -= sc->data[SC_GATLINGFEVER]->val4;
-	if(sc->data[SC_WATER_BARRIER])
-		flee -= sc->data[SC_WATER_BARRIER]->val2;
-	if(sc->data[SC_ANGRIFFS_MODUS])
-		flee -= sc->data[SC_ANGRIFFS_MODUS]->val3;
-	if(sc->data[SC_C_MARKER])
+	if(sc_data(sc, SC_GATLINGFEVER))
+		flee -= sc_data(sc, SC_GATLINGFEVER)->val4;
+	if(sc_data(sc, SC_WATER_BARRIER))
+		flee -= sc_data(sc, SC_WATER_BARRIER)->val2;
+	if(sc_data(sc, SC_ANGRIFFS_MODUS))
+		flee -= sc_data(sc, SC_ANGRIFFS_MODUS)->val3;
+	if(sc_data(sc, SC_C_MARKER))
 		flee -= 10;
-	if(sc->data[SC_HEAT_BARREL])
-		flee -= sc->data[SC_HEAT_BARREL]->val4;
-	if(sc->data[SC_SPIDERWEB])
+	if(sc_data(sc, SC_HEAT_BARREL))
+		flee -= sc_data(sc, SC_HEAT_BARREL)->val4;
+	if(sc_data(sc, SC_SPIDERWEB))
 		flee -= flee * 50 / 100;
-	if(sc->data[SC_BERSERK])
+	if(sc_data(sc, SC_BERSERK))
 		flee -= flee * 50 / 100;
-	if(sc->data[SC_BLIND] || sc->data[SC_PYREXIA])
+	if(sc_data(sc, SC_BLIND) || sc_data(sc, SC_PYREXIA))
 		flee -= flee * 25 / 100;
-	if(sc->data[SC_FEAR])
+	if(sc_data(sc, SC_FEAR))
 		flee -= flee * 20 / 100;
-	if(sc->data[SC_PARALYSE])
+	if(sc_data(sc, SC_PARALYSE))
 		flee -= flee * 10 / 100; //10% Flee reduction
-	if(sc->data[SC_INFRAREDSCAN])
+	if(sc_data(sc, SC_INFRAREDSCAN))
 		flee -= flee * 30 / 100;
-	if(sc->data[SC__LAZINESS])
-		flee -= flee * sc->data[SC__LAZINESS]->val2 / 100;
-	if(sc->data[SC_GLOOMYDAY])
-		flee -= flee * sc->data[SC_GLOOMYDAY]->val2 / 100;
-	if(sc->data[SC_SATURDAYNIGHTFEVER])
-		flee -= flee * (40 + 10 * sc->data[SC_SATURDAYNIGHTFEVER]->val1) / 100;
-	if(sc->data[SC_TEARGAS])
+	if(sc_data(sc, SC__LAZINESS))
+		flee -= flee * sc_data(sc, SC__LAZINESS)->val2 / 100;
+	if(sc_data(sc, SC_GLOOMYDAY))
+		flee -= flee * sc_data(sc, SC_GLOOMYDAY)->val2 / 100;
+	if(sc_data(sc, SC_SATURDAYNIGHTFEVER))
+		flee -= flee * (40 + 10 * sc_data(sc, SC_SATURDAYNIGHTFEVER)->val1) / 100;
+	if(sc_data(sc, SC_TEARGAS))
 		flee -= flee * 50 / 100;
-	if(sc->data[SC_ASH])
-		flee -= flee * sc->data[SC_ASH]->val4 / 100;
+	if(sc_data(sc, SC_ASH))
+		flee -= flee * sc_data(sc, SC_ASH)->val4 / 100;
 
 	return (short)cap_value(flee,1,SHRT_MAX);
 }
@@ -5588,12 +5761,12 @@ static short status_calc_flee2(struct block_list *bl, struct status_change *sc,
 	if(!sc || !sc->count)
 		return (short)cap_value(flee2,10,SHRT_MAX);
 
-	if(sc->data[SC_INCFLEE2])
-		flee2 += sc->data[SC_INCFLEE2]->val2;
-	if(sc->data[SC_WHISTLE])
-		flee2 += sc->data[SC_WHISTLE]->val3 * 10;
-	if(sc->data[SC__UNLUCKY])
-		flee2 -= flee2 * sc->data[SC__UNLUCKY]->val2 / 100;
+	if(sc_data(sc, SC_INCFLEE2))
+		flee2 += sc_data(sc, SC_INCFLEE2)->val2;
+	if(sc_data(sc, SC_WHISTLE))
+		flee2 += sc_data(sc, SC_WHISTLE)->val3 * 10;
+	if(sc_data(sc, SC__UNLUCKY))
+		flee2 -= flee2 * sc_data(sc, SC__UNLUCKY)->val2 / 100;
 
 	return (short)cap_value(flee2,10,SHRT_MAX);
 }
@@ -5605,97 +5778,97 @@ defType status_calc_def(struct block_list *bl, struct status_change *sc, int def
 
 	if(!viewable) {
 #ifdef RENEWAL
-		if(sc->data[SC_ASSUMPTIO])
+		if(sc_data(sc, SC_ASSUMPTIO))
 			def <<= 1; //only eDEF is doubled
 #endif
-		if(sc->data[SC_NEUTRALBARRIER])
-			def += def * (10 + 5 * sc->data[SC_NEUTRALBARRIER]->val1) / 100;
-		if(sc->data[SC_FORCEOFVANGUARD])
-			def += def * 2 * sc->data[SC_FORCEOFVANGUARD]->val1 / 100;
-		if(sc->data[SC_CAMOUFLAGE])
-			def -= def * 5 * sc->data[SC_CAMOUFLAGE]->val3 / 100;
-		if(sc->data[SC_OVERED_BOOST] && bl->type == BL_PC)
-			def -= def * sc->data[SC_OVERED_BOOST]->val4 / 100;
+		if(sc_data(sc, SC_NEUTRALBARRIER))
+			def += def * (10 + 5 * sc_data(sc, SC_NEUTRALBARRIER)->val1) / 100;
+		if(sc_data(sc, SC_FORCEOFVANGUARD))
+			def += def * 2 * sc_data(sc, SC_FORCEOFVANGUARD)->val1 / 100;
+		if(sc_data(sc, SC_CAMOUFLAGE))
+			def -= def * 5 * sc_data(sc, SC_CAMOUFLAGE)->val3 / 100;
+		if(sc_data(sc, SC_OVERED_BOOST) && bl->type == BL_PC)
+			def -= def * sc_data(sc, SC_OVERED_BOOST)->val4 / 100;
 		return (defType)cap_value(def,DEFTYPE_MIN,DEFTYPE_MAX);
 	}
 
-	if(sc->data[SC_BERSERK])
+	if(sc_data(sc, SC_BERSERK))
 		return 0;
-	if(sc->data[SC_SKA])
-		return sc->data[SC_SKA]->val3;
-	if(sc->data[SC_BARRIER])
+	if(sc_data(sc, SC_SKA))
+		return sc_data(sc, SC_SKA)->val3;
+	if(sc_data(sc, SC_BARRIER))
 		return 100;
-	if(sc->data[SC_KEEPING])
+	if(sc_data(sc, SC_KEEPING))
 		return 90;
 #ifndef RENEWAL //Does not provide 90 DEF in renewal mode
-	if(sc->data[SC_STEELBODY])
+	if(sc_data(sc, SC_STEELBODY))
 		return 90;
 #endif
-	if(sc->data[SC_DEFSET])
-		return sc->data[SC_DEFSET]->val1;
+	if(sc_data(sc, SC_DEFSET))
+		return sc_data(sc, SC_DEFSET)->val1;
 
 #ifndef RENEWAL
-	if(sc->data[SC_ARMORCHANGE])
-		def += sc->data[SC_ARMORCHANGE]->val2;
-	if(sc->data[SC_DEFENCE]) //[orn]
-		def += sc->data[SC_DEFENCE]->val2;
+	if(sc_data(sc, SC_ARMORCHANGE))
+		def += sc_data(sc, SC_ARMORCHANGE)->val2;
+	if(sc_data(sc, SC_DEFENCE)) //[orn]
+		def += sc_data(sc, SC_DEFENCE)->val2;
 #endif
-	if(sc->data[SC_DRUMBATTLE])
-		def += sc->data[SC_DRUMBATTLE]->val3;
-	if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2)
+	if(sc_data(sc, SC_DRUMBATTLE))
+		def += sc_data(sc, SC_DRUMBATTLE)->val3;
+	if(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 2)
 		def += 50;
-	if(sc->data[SC_STONEHARDSKIN])
-		def += sc->data[SC_STONEHARDSKIN]->val1;
-	if(sc->data[SC_SHIELDSPELL_REF] && sc->data[SC_SHIELDSPELL_REF]->val1 == 2)
-		def += sc->data[SC_SHIELDSPELL_REF]->val2;
-	if(sc->data[SC_PRESTIGE])
-		def += sc->data[SC_PRESTIGE]->val1;
+	if(sc_data(sc, SC_STONEHARDSKIN))
+		def += sc_data(sc, SC_STONEHARDSKIN)->val1;
+	if(sc_data(sc, SC_SHIELDSPELL_REF) && sc_data(sc, SC_SHIELDSPELL_REF)->val1 == 2)
+		def += sc_data(sc, SC_SHIELDSPELL_REF)->val2;
+	if(sc_data(sc, SC_PRESTIGE))
+		def += sc_data(sc, SC_PRESTIGE)->val1;
 #ifndef RENEWAL
-	if(sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 1)
-		def += (5 + sc->data[SC_BANDING]->val1) * sc->data[SC_BANDING]->val2 / 10;
+	if(sc_data(sc, SC_BANDING) && sc_data(sc, SC_BANDING)->val2 > 1)
+		def += (5 + sc_data(sc, SC_BANDING)->val1) * sc_data(sc, SC_BANDING)->val2 / 10;
 #endif
-	if(sc->data[SC_INCDEFRATE])
-		def += def * sc->data[SC_INCDEFRATE]->val1 / 100;
-	if(sc->data[SC_ECHOSONG])
-		def += def * sc->data[SC_ECHOSONG]->val3 / 100;
-	if(sc->data[SC_SOLID_SKIN_OPTION])
-		def += def * sc->data[SC_SOLID_SKIN_OPTION]->val2 / 100;
-	if(sc->data[SC_POWER_OF_GAIA])
-		def += def * sc->data[SC_POWER_OF_GAIA]->val2 / 100;
-	if(sc->data[SC_ODINS_POWER])
-		def -= 20 * sc->data[SC_ODINS_POWER]->val1;
-	if(sc->data[SC_ANGRIFFS_MODUS])
-		def -= 30 + 20 * sc->data[SC_ANGRIFFS_MODUS]->val1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc_data(sc, SC_INCDEFRATE))
+		def += def * sc_data(sc, SC_INCDEFRATE)->val1 / 100;
+	if(sc_data(sc, SC_ECHOSONG))
+		def += def * sc_data(sc, SC_ECHOSONG)->val3 / 100;
+	if(sc_data(sc, SC_SOLID_SKIN_OPTION))
+		def += def * sc_data(sc, SC_SOLID_SKIN_OPTION)->val2 / 100;
+	if(sc_data(sc, SC_POWER_OF_GAIA))
+		def += def * sc_data(sc, SC_POWER_OF_GAIA)->val2 / 100;
+	if(sc_data(sc, SC_ODINS_POWER))
+		def -= 20 * sc_data(sc, SC_ODINS_POWER)->val1;
+	if(sc_data(sc, SC_ANGRIFFS_MODUS))
+		def -= 30 + 20 * sc_data(sc, SC_ANGRIFFS_MODUS)->val1;
+	if(sc_data(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 		def >>= 1;
-	if(sc->data[SC_FREEZE])
+	if(sc_data(sc, SC_FREEZE))
 		def >>= 1;
-	if(sc->data[SC_SKE])
+	if(sc_data(sc, SC_SKE))
 		def >>= 1;
-	if(sc->data[SC_SIGNUMCRUCIS])
-		def -= def * sc->data[SC_SIGNUMCRUCIS]->val2 / 100;
-	if(sc->data[SC_CONCENTRATION])
-		def -= def * sc->data[SC_CONCENTRATION]->val4 / 100;
-	if(sc->data[SC_PROVOKE] && bl->type != BL_PC) //Provoke doesn't alter player defense
-		def -= def * sc->data[SC_PROVOKE]->val4 / 100;
-	if(sc->data[SC_STRIPSHIELD] && bl->type != BL_PC)
-		def -= def * sc->data[SC_STRIPSHIELD]->val2 / 100;
-	if(sc->data[SC_FLING])
-		def -= def * sc->data[SC_FLING]->val2 / 100;
-	if(sc->data[SC_FREEZING])
+	if(sc_data(sc, SC_SIGNUMCRUCIS))
+		def -= def * sc_data(sc, SC_SIGNUMCRUCIS)->val2 / 100;
+	if(sc_data(sc, SC_CONCENTRATION))
+		def -= def * sc_data(sc, SC_CONCENTRATION)->val4 / 100;
+	if(sc_data(sc, SC_PROVOKE) && bl->type != BL_PC) //Provoke doesn't alter player defense
+		def -= def * sc_data(sc, SC_PROVOKE)->val4 / 100;
+	if(sc_data(sc, SC_STRIPSHIELD) && bl->type != BL_PC)
+		def -= def * sc_data(sc, SC_STRIPSHIELD)->val2 / 100;
+	if(sc_data(sc, SC_FLING))
+		def -= def * sc_data(sc, SC_FLING)->val2 / 100;
+	if(sc_data(sc, SC_FREEZING))
 		def -= def * 10 / 100;
-	if(sc->data[SC_ANALYZE])
-		def -= def * 14 * sc->data[SC_ANALYZE]->val1 / 100;
-	if(sc->data[SC_SATURDAYNIGHTFEVER])
-		def -= def * (10 + 10 * sc->data[SC_SATURDAYNIGHTFEVER]->val1) / 100;
-	if(sc->data[SC_EARTHDRIVE])
+	if(sc_data(sc, SC_ANALYZE))
+		def -= def * 14 * sc_data(sc, SC_ANALYZE)->val1 / 100;
+	if(sc_data(sc, SC_SATURDAYNIGHTFEVER))
+		def -= def * (10 + 10 * sc_data(sc, SC_SATURDAYNIGHTFEVER)->val1) / 100;
+	if(sc_data(sc, SC_EARTHDRIVE))
 		def -= def * 25 / 100;
-	if(sc->data[SC_ROCK_CRUSHER])
-		def -= def * sc->data[SC_ROCK_CRUSHER]->val2 / 100;
-	if(sc->data[SC_ASH])
-		def -= def * sc->data[SC_ASH]->val3 / 100;
-	if(sc->data[SC_OVERED_BOOST] && bl->type == BL_HOM)
-		def -= def * sc->data[SC_OVERED_BOOST]->val4 / 100;
+	if(sc_data(sc, SC_ROCK_CRUSHER))
+		def -= def * sc_data(sc, SC_ROCK_CRUSHER)->val2 / 100;
+	if(sc_data(sc, SC_ASH))
+		def -= def * sc_data(sc, SC_ASH)->val3 / 100;
+	if(sc_data(sc, SC_OVERED_BOOST) && bl->type == BL_HOM)
+		def -= def * sc_data(sc, SC_OVERED_BOOST)->val4 / 100;
 
 	return (defType)cap_value(def,DEFTYPE_MIN,DEFTYPE_MAX);
 }
@@ -5711,10 +5884,10 @@ short status_calc_def2(struct block_list *bl, struct status_change *sc, int def2
 	}
 
 	if(!viewable) {
-		if(sc->data[SC_GT_REVITALIZE])
-			def2 += sc->data[SC_GT_REVITALIZE]->val2;
-		if(sc->data[SC_CAMOUFLAGE])
-			def2 -= def2 * 5 * sc->data[SC_CAMOUFLAGE]->val3 / 100;
+		if(sc_data(sc, SC_GT_REVITALIZE))
+			def2 += sc_data(sc, SC_GT_REVITALIZE)->val2;
+		if(sc_data(sc, SC_CAMOUFLAGE))
+			def2 -= def2 * 5 * sc_data(sc, SC_CAMOUFLAGE)->val3 / 100;
 #ifdef RENEWAL
 		return (short)cap_value(def2,SHRT_MIN,SHRT_MAX);
 #else
@@ -5722,52 +5895,52 @@ short status_calc_def2(struct block_list *bl, struct status_change *sc, int def2
 #endif
 	}
 
-	if(sc->data[SC_BERSERK])
+	if(sc_data(sc, SC_BERSERK))
 		return 0;
-	if(sc->data[SC_ETERNALCHAOS])
+	if(sc_data(sc, SC_ETERNALCHAOS))
 		return 0;
-	if(sc->data[SC_DEFSET])
-		return sc->data[SC_DEFSET]->val1;
+	if(sc_data(sc, SC_DEFSET))
+		return sc_data(sc, SC_DEFSET)->val1;
 
-	if(sc->data[SC_SUN_COMFORT])
-		def2 += sc->data[SC_SUN_COMFORT]->val2;
+	if(sc_data(sc, SC_SUN_COMFORT))
+		def2 += sc_data(sc, SC_SUN_COMFORT)->val2;
 #ifdef RENEWAL
-	if(sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 1)
-		def2 += (5 + sc->data[SC_BANDING]->val1) * sc->data[SC_BANDING]->val2;
+	if(sc_data(sc, SC_BANDING) && sc_data(sc, SC_BANDING)->val2 > 1)
+		def2 += (5 + sc_data(sc, SC_BANDING)->val1) * sc_data(sc, SC_BANDING)->val2;
 #endif
-	if(sc->data[SC_ANGELUS])
+	if(sc_data(sc, SC_ANGELUS))
 #ifdef RENEWAL //In renewal only the VIT stat bonus is boosted by angelus
-		def2 += status_get_vit(bl) / 2 * sc->data[SC_ANGELUS]->val2 / 100;
+		def2 += status_get_vit(bl) / 2 * sc_data(sc, SC_ANGELUS)->val2 / 100;
 #else
-		def2 += def2 * sc->data[SC_ANGELUS]->val2 / 100;
-	if(sc->data[SC_CONCENTRATION])
-		def2 -= def2 * sc->data[SC_CONCENTRATION]->val4 / 100;
+		def2 += def2 * sc_data(sc, SC_ANGELUS)->val2 / 100;
+	if(sc_data(sc, SC_CONCENTRATION))
+		def2 -= def2 * sc_data(sc, SC_CONCENTRATION)->val4 / 100;
 #endif
-	if(sc->data[SC_POISON])
+	if(sc_data(sc, SC_POISON))
 		def2 -= def2 * 25 / 100;
-	if(sc->data[SC_DPOISON])
+	if(sc_data(sc, SC_DPOISON))
 		def2 -= def2 * 25 / 100;
-	if(sc->data[SC_SKE])
+	if(sc_data(sc, SC_SKE))
 		def2 -= def2 * 50 / 100;
-	if(sc->data[SC_PROVOKE])
-		def2 -= def2 * sc->data[SC_PROVOKE]->val4 / 100;
-	if(sc->data[SC_JOINTBEAT])
-		def2 -= def2 * (sc->data[SC_JOINTBEAT]->val2&BREAK_SHOULDER ? 50 : 0) / 100 +
-				def2 * (sc->data[SC_JOINTBEAT]->val2&BREAK_WAIST ? 25 : 0) / 100;
-	if(sc->data[SC_FLING])
-		def2 -= def2 * sc->data[SC_FLING]->val3 / 100;
-	if(sc->data[SC_FREEZING])
+	if(sc_data(sc, SC_PROVOKE))
+		def2 -= def2 * sc_data(sc, SC_PROVOKE)->val4 / 100;
+	if(sc_data(sc, SC_JOINTBEAT))
+		def2 -= def2 * (sc_data(sc, SC_JOINTBEAT)->val2&BREAK_SHOULDER ? 50 : 0) / 100 +
+				def2 * (sc_data(sc, SC_JOINTBEAT)->val2&BREAK_WAIST ? 25 : 0) / 100;
+	if(sc_data(sc, SC_FLING))
+		def2 -= def2 * sc_data(sc, SC_FLING)->val3 / 100;
+	if(sc_data(sc, SC_FREEZING))
 		def2 -= def2 * 10 / 100;
-	if(sc->data[SC_ANALYZE])
-		def2 -= def2 * 14 * sc->data[SC_ANALYZE]->val1 / 100;
-	if(sc->data[SC_SATURDAYNIGHTFEVER])
-		def2 -= def2 * (10 + 10 * sc->data[SC_SATURDAYNIGHTFEVER]->val1) / 100;
-	if(sc->data[SC_ASH])
-		def2 -= def2 * sc->data[SC_ASH]->val3 / 100;
-	if(sc->data[SC_PARALYSIS])
-		def2 -= def2 * sc->data[SC_PARALYSIS]->val2 / 100;
-	if(sc->data[SC_EQC])
-		def2 -= def2 * sc->data[SC_EQC]->val2 / 100;
+	if(sc_data(sc, SC_ANALYZE))
+		def2 -= def2 * 14 * sc_data(sc, SC_ANALYZE)->val1 / 100;
+	if(sc_data(sc, SC_SATURDAYNIGHTFEVER))
+		def2 -= def2 * (10 + 10 * sc_data(sc, SC_SATURDAYNIGHTFEVER)->val1) / 100;
+	if(sc_data(sc, SC_ASH))
+		def2 -= def2 * sc_data(sc, SC_ASH)->val3 / 100;
+	if(sc_data(sc, SC_PARALYSIS))
+		def2 -= def2 * sc_data(sc, SC_PARALYSIS)->val2 / 100;
+	if(sc_data(sc, SC_EQC))
+		def2 -= def2 * sc_data(sc, SC_EQC)->val2 / 100;
 
 #ifdef RENEWAL
 	return (short)cap_value(def2,SHRT_MIN,SHRT_MAX);
@@ -5783,52 +5956,52 @@ defType status_calc_mdef(struct block_list *bl, struct status_change *sc, int md
 
 	if(!viewable) {
 #ifdef RENEWAL
-		if(sc->data[SC_ASSUMPTIO])
+		if(sc_data(sc, SC_ASSUMPTIO))
 			mdef <<= 1; //Only eMDEF is doubled
 #endif
-		if(sc->data[SC_NEUTRALBARRIER])
-			mdef += mdef * (10 + 5 * sc->data[SC_NEUTRALBARRIER]->val1) / 100;
+		if(sc_data(sc, SC_NEUTRALBARRIER))
+			mdef += mdef * (10 + 5 * sc_data(sc, SC_NEUTRALBARRIER)->val1) / 100;
 		return (defType)cap_value(mdef,DEFTYPE_MIN,DEFTYPE_MAX);
 	}
 
-	if(sc->data[SC_BERSERK])
+	if(sc_data(sc, SC_BERSERK))
 		return 0;
-	if(sc->data[SC_BARRIER])
+	if(sc_data(sc, SC_BARRIER))
 		return 100;
 #ifndef RENEWAL //No longer provides 90 MDEF in renewal mode
-	if(sc->data[SC_STEELBODY])
+	if(sc_data(sc, SC_STEELBODY))
 		return 90;
 #endif
-	if(sc->data[SC_MDEFSET])
-		return sc->data[SC_MDEFSET]->val1;
+	if(sc_data(sc, SC_MDEFSET))
+		return sc_data(sc, SC_MDEFSET)->val1;
 
 #ifndef RENEWAL
-	if(sc->data[SC_ARMORCHANGE])
-		mdef += sc->data[SC_ARMORCHANGE]->val3;
+	if(sc_data(sc, SC_ARMORCHANGE))
+		mdef += sc_data(sc, SC_ARMORCHANGE)->val3;
 #endif
-	if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3)
+	if(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 3)
 		mdef += 50;	
-	if(sc->data[SC_ENDURE]) //It has been confirmed that eddga card grants 1 MDEF, not 0, not 10, but 1
-		mdef += (sc->data[SC_ENDURE]->val4 == 0) ? sc->data[SC_ENDURE]->val1 : 1;
-	if(sc->data[SC_STONEHARDSKIN])
-		mdef += sc->data[SC_STONEHARDSKIN]->val1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc_data(sc, SC_ENDURE)) //It has been confirmed that eddga card grants 1 MDEF, not 0, not 10, but 1
+		mdef += (sc_data(sc, SC_ENDURE)->val4 == 0) ? sc_data(sc, SC_ENDURE)->val1 : 1;
+	if(sc_data(sc, SC_STONEHARDSKIN))
+		mdef += sc_data(sc, SC_STONEHARDSKIN)->val1;
+	if(sc_data(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 		mdef += mdef * 25 / 100;
-	if(sc->data[SC_FREEZE])
+	if(sc_data(sc, SC_FREEZE))
 		mdef += mdef * 25 / 100;
-	if(sc->data[SC_SYMPHONYOFLOVER])
-		mdef += mdef * sc->data[SC_SYMPHONYOFLOVER]->val3 / 100;
-	if(sc->data[SC_GT_CHANGE]) {
-		mdef -= sc->data[SC_GT_CHANGE]->val4;
+	if(sc_data(sc, SC_SYMPHONYOFLOVER))
+		mdef += mdef * sc_data(sc, SC_SYMPHONYOFLOVER)->val3 / 100;
+	if(sc_data(sc, SC_GT_CHANGE)) {
+		mdef -= sc_data(sc, SC_GT_CHANGE)->val4;
 		if(mdef < 0)
 			return 0;
 	}
-	if(sc->data[SC_ODINS_POWER])
-		mdef -= 20 * sc->data[SC_ODINS_POWER]->val1;
-	if(sc->data[SC_BURNING])
+	if(sc_data(sc, SC_ODINS_POWER))
+		mdef -= 20 * sc_data(sc, SC_ODINS_POWER)->val1;
+	if(sc_data(sc, SC_BURNING))
 		mdef -= mdef * 25 / 100;
-	if(sc->data[SC_ANALYZE])
-		mdef -= mdef * 14 * sc->data[SC_ANALYZE]->val1 / 100;
+	if(sc_data(sc, SC_ANALYZE))
+		mdef -= mdef * 14 * sc_data(sc, SC_ANALYZE)->val1 / 100;
 
 	return (defType)cap_value(mdef,DEFTYPE_MIN,DEFTYPE_MAX);
 }
@@ -5844,8 +6017,8 @@ short status_calc_mdef2(struct block_list *bl, struct status_change *sc, int mde
 	}
 
 	if(!viewable) {
-		if(sc->data[SC_MINDBREAKER])
-			mdef2 -= mdef2 * sc->data[SC_MINDBREAKER]->val3 / 100;
+		if(sc_data(sc, SC_MINDBREAKER))
+			mdef2 -= mdef2 * sc_data(sc, SC_MINDBREAKER)->val3 / 100;
 #ifdef RENEWAL
 		return (short)cap_value(mdef2,SHRT_MIN,SHRT_MAX);
 #else
@@ -5853,17 +6026,17 @@ short status_calc_mdef2(struct block_list *bl, struct status_change *sc, int mde
 #endif
 	}
 
-	if(sc->data[SC_BERSERK])
+	if(sc_data(sc, SC_BERSERK))
 		return 0;
-	if(sc->data[SC_SKA])
+	if(sc_data(sc, SC_SKA))
 		return 90;
-	if(sc->data[SC_MDEFSET])
-		return sc->data[SC_MDEFSET]->val1;
+	if(sc_data(sc, SC_MDEFSET))
+		return sc_data(sc, SC_MDEFSET)->val1;
 
-	if(sc->data[SC_BURNING])
+	if(sc_data(sc, SC_BURNING))
 		mdef2 -= mdef2 * 25 / 100;
-	if(sc->data[SC_ANALYZE])
-		mdef2 -= mdef2 * 14 * sc->data[SC_ANALYZE]->val1 / 100;
+	if(sc_data(sc, SC_ANALYZE))
+		mdef2 -= mdef2 * 14 * sc_data(sc, SC_ANALYZE)->val1 / 100;
 
 #ifdef RENEWAL
 	return (short)cap_value(mdef2,SHRT_MIN,SHRT_MAX);
@@ -5892,9 +6065,9 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		{
 			int val = 0;
 
-			if( sc->data[SC_FUSION] )
+			if( sc_data(sc, SC_FUSION) )
 				val = 25;
-			if( sc->data[SC_ALL_RIDING] )
+			if( sc_data(sc, SC_ALL_RIDING) )
 				val = battle_config.rental_mount_speed_boost;
 			else if( sd ) {
 				if( pc_isriding(sd) || sd->sc.option&(OPTION_DRAGON) )
@@ -5903,7 +6076,7 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 					val = 15 + 5 * pc_checkskill(sd,RA_WUGRIDER);
 				else if( pc_ismadogear(sd) ) {
 					val = -(50 - 10 * pc_checkskill(sd,NC_MADOLICENCE));
-					if( sc->data[SC_ACCELERATION] )
+					if( sc_data(sc, SC_ACCELERATION) )
 						val += 25;
 				}
 			}
@@ -5915,73 +6088,73 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		{
 			int val = 0;
 
-			if( sd && sc->data[SC_HIDING] && pc_checkskill(sd,RG_TUNNELDRIVE) > 0 )
+			if( sd && sc_data(sc, SC_HIDING) && pc_checkskill(sd,RG_TUNNELDRIVE) > 0 )
 				val = 120 - 6 * pc_checkskill(sd,RG_TUNNELDRIVE);
-			else if( sd && sc->data[SC_CHASEWALK] && sc->data[SC_CHASEWALK]->val3 < 0 )
-				val = sc->data[SC_CHASEWALK]->val3;
+			else if( sd && sc_data(sc, SC_CHASEWALK) && sc_data(sc, SC_CHASEWALK)->val3 < 0 )
+				val = sc_data(sc, SC_CHASEWALK)->val3;
 			else {
 				//Longing for Freedom cancels song/dance penalty
-				if( sc->data[SC_LONGING] )
-					val = max( val, 50 - 10 * sc->data[SC_LONGING]->val1 );
-				else if( sd && sc->data[SC_DANCING] )
-					val = max( val, 500 - (40 + 10 * (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER)) *
+				if( sc_data(sc, SC_LONGING) )
+					val = max( val, 50 - 10 * sc_data(sc, SC_LONGING)->val1 );
+				else if( sd && sc_data(sc, SC_DANCING) )
+					val = max( val, 500 - (40 + 10 * (sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_BARDDANCER)) *
 						pc_checkskill(sd,(sd->status.sex ? BA_MUSICALLESSON : DC_DANCINGLESSON)) );
-				if( sc->data[SC_DECREASEAGI] )
+				if( sc_data(sc, SC_DECREASEAGI) )
 					val = max( val, 25 );
-				if( sc->data[SC_QUAGMIRE] )
-					val = max( val, sc->data[SC_QUAGMIRE]->val2 );
-				if( sc->data[SC_DONTFORGETME] )
-					val = max( val, sc->data[SC_DONTFORGETME]->val3 );
-				if( sc->data[SC_CURSE] )
+				if( sc_data(sc, SC_QUAGMIRE) )
+					val = max( val, sc_data(sc, SC_QUAGMIRE)->val2 );
+				if( sc_data(sc, SC_DONTFORGETME) )
+					val = max( val, sc_data(sc, SC_DONTFORGETME)->val3 );
+				if( sc_data(sc, SC_CURSE) )
 					val = max( val, 300 );
-				if( sc->data[SC_CHASEWALK] )
-					val = max( val, sc->data[SC_CHASEWALK]->val3 );
-				if( sc->data[SC_WEDDING] )
+				if( sc_data(sc, SC_CHASEWALK) )
+					val = max( val, sc_data(sc, SC_CHASEWALK)->val3 );
+				if( sc_data(sc, SC_WEDDING) )
 					val = max( val, 100 );
-				if( sc->data[SC_JOINTBEAT] && sc->data[SC_JOINTBEAT]->val2&(BREAK_ANKLE|BREAK_KNEE) )
-					val = max( val, (sc->data[SC_JOINTBEAT]->val2&BREAK_ANKLE ? 50 : 0) + (sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE ? 30 : 0) );
-				if( sc->data[SC_CLOAKING] && (sc->data[SC_CLOAKING]->val4&1) == 0 )
-					val = max( val, (sc->data[SC_CLOAKING]->val1 < 3 ? 300 : 30 - 3 * sc->data[SC_CLOAKING]->val1) );
-				if( sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY )
+				if( sc_data(sc, SC_JOINTBEAT) && sc_data(sc, SC_JOINTBEAT)->val2&(BREAK_ANKLE|BREAK_KNEE) )
+					val = max( val, (sc_data(sc, SC_JOINTBEAT)->val2&BREAK_ANKLE ? 50 : 0) + (sc_data(sc, SC_JOINTBEAT)->val2&BREAK_KNEE ? 30 : 0) );
+				if( sc_data(sc, SC_CLOAKING) && (sc_data(sc, SC_CLOAKING)->val4&1) == 0 )
+					val = max( val, (sc_data(sc, SC_CLOAKING)->val1 < 3 ? 300 : 30 - 3 * sc_data(sc, SC_CLOAKING)->val1) );
+				if( sc_data(sc, SC_GOSPEL) && sc_data(sc, SC_GOSPEL)->val4 == BCT_ENEMY )
 					val = max( val, 75 );
-				if( sc->data[SC_SLOWDOWN] ) //Slow Potion
-					val = max( val, sc->data[SC_SLOWDOWN]->val1 );
-				if( sc->data[SC_GATLINGFEVER] )
+				if( sc_data(sc, SC_SLOWDOWN) ) //Slow Potion
+					val = max( val, sc_data(sc, SC_SLOWDOWN)->val1 );
+				if( sc_data(sc, SC_GATLINGFEVER) )
 					val = max( val, 100 );
-				if( sc->data[SC_SUITON] )
-					val = max( val, sc->data[SC_SUITON]->val3 );
-				if( sc->data[SC_SWOO] )
+				if( sc_data(sc, SC_SUITON) )
+					val = max( val, sc_data(sc, SC_SUITON)->val3 );
+				if( sc_data(sc, SC_SWOO) )
 					val = max( val, 300 );
-				if( sc->data[SC_SKA] )
+				if( sc_data(sc, SC_SKA) )
 					val = max( val, 25 );
-				if( sc->data[SC_ADORAMUS] )
+				if( sc_data(sc, SC_ADORAMUS) )
 					val = max( val, 25 );
-				if( sc->data[SC_HALLUCINATIONWALK_POSTDELAY] )
+				if( sc_data(sc, SC_HALLUCINATIONWALK_POSTDELAY) )
 					val = max( val, 50 );
-				if( sc->data[SC_GLOOMYDAY] && sc->data[SC_GLOOMYDAY]->val4 )
+				if( sc_data(sc, SC_GLOOMYDAY) && sc_data(sc, SC_GLOOMYDAY)->val4 )
 					val = max( val, 50 );
-				if( sc->data[SC_FREEZING] )
+				if( sc_data(sc, SC_FREEZING) )
 					val = max( val, 50 );
-				if( sc->data[SC_MARSHOFABYSS] )
-					val = max( val, sc->data[SC_MARSHOFABYSS]->val3 );
-				if( sc->data[SC_CAMOUFLAGE] && sc->data[SC_CAMOUFLAGE]->val1 > 2 )
-					val = max( val, 25 * (5 - sc->data[SC_CAMOUFLAGE]->val1) );
-				if( sc->data[SC_STEALTHFIELD_MASTER] )
+				if( sc_data(sc, SC_MARSHOFABYSS) )
+					val = max( val, sc_data(sc, SC_MARSHOFABYSS)->val3 );
+				if( sc_data(sc, SC_CAMOUFLAGE) && sc_data(sc, SC_CAMOUFLAGE)->val1 > 2 )
+					val = max( val, 25 * (5 - sc_data(sc, SC_CAMOUFLAGE)->val1) );
+				if( sc_data(sc, SC_STEALTHFIELD_MASTER) )
 					val = max( val, 20 );
-				if( sc->data[SC__LAZINESS] )
+				if( sc_data(sc, SC__LAZINESS) )
 					val = max( val, 25 );
-				if( sc->data[SC_BANDING_DEFENCE] )
-					val = max( val, sc->data[SC_BANDING_DEFENCE]->val1 ); //-90% Walking speed
-				if( sc->data[SC_ROCK_CRUSHER_ATK] )
-					val = max( val, sc->data[SC_ROCK_CRUSHER_ATK]->val2 );
-				if( sc->data[SC_POWER_OF_GAIA] )
-					val = max( val, sc->data[SC_POWER_OF_GAIA]->val2 );
-				if( sc->data[SC_MELON_BOMB] )
-					val = max( val, sc->data[SC_MELON_BOMB]->val2 );
-				if( sc->data[SC_REBOUND] )
+				if( sc_data(sc, SC_BANDING_DEFENCE) )
+					val = max( val, sc_data(sc, SC_BANDING_DEFENCE)->val1 ); //-90% Walking speed
+				if( sc_data(sc, SC_ROCK_CRUSHER_ATK) )
+					val = max( val, sc_data(sc, SC_ROCK_CRUSHER_ATK)->val2 );
+				if( sc_data(sc, SC_POWER_OF_GAIA) )
+					val = max( val, sc_data(sc, SC_POWER_OF_GAIA)->val2 );
+				if( sc_data(sc, SC_MELON_BOMB) )
+					val = max( val, sc_data(sc, SC_MELON_BOMB)->val2 );
+				if( sc_data(sc, SC_REBOUND) )
 					val = max( val, 25 );
-				if( sc->data[SC_B_TRAP] )
-					val = max( val, sc->data[SC_B_TRAP]->val2 );
+				if( sc_data(sc, SC_B_TRAP) )
+					val = max( val, sc_data(sc, SC_B_TRAP)->val2 );
 
 				if( sd && sd->bonus.speed_rate + sd->bonus.speed_add_rate > 0 ) //Permanent item-based speedup
 					val = max( val, sd->bonus.speed_rate + sd->bonus.speed_add_rate );
@@ -5990,46 +6163,46 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 			speed_rate += val;
 		}
 
-		if( sc->data[SC_MARSHOFABYSS] && speed_rate > 150 )
+		if( sc_data(sc, SC_MARSHOFABYSS) && speed_rate > 150 )
 			speed_rate = 150;
 
 		//GetMoveHasteValue1()
 		{
 			int val = 0;
 
-			if( sc->data[SC_SPEEDUP1] )
-				val = max( val, sc->data[SC_SPEEDUP1]->val1 );
-			if( sc->data[SC_INCREASEAGI] )
+			if( sc_data(sc, SC_SPEEDUP1) )
+				val = max( val, sc_data(sc, SC_SPEEDUP1)->val1 );
+			if( sc_data(sc, SC_INCREASEAGI) )
 				val = max( val, 25 );
-			if( sc->data[SC_WINDWALK] )
-				val = max( val, 2 * sc->data[SC_WINDWALK]->val1 );
-			if( sc->data[SC_CARTBOOST] )
+			if( sc_data(sc, SC_WINDWALK) )
+				val = max( val, 2 * sc_data(sc, SC_WINDWALK)->val1 );
+			if( sc_data(sc, SC_CARTBOOST) )
 				val = max( val, 20 );
 			if( sd && (sd->class_&MAPID_UPPERMASK) == MAPID_ASSASSIN && pc_checkskill(sd,TF_MISS) > 0 )
 				val = max( val, 1 * pc_checkskill(sd,TF_MISS) );
-			if( sc->data[SC_CLOAKING] && (sc->data[SC_CLOAKING]->val4&1) == 1 )
-				val = max( val, (sc->data[SC_CLOAKING]->val1 >= 10 ? 25 : 3 * sc->data[SC_CLOAKING]->val1 - 3) );
-			if( sc->data[SC_BERSERK] )
+			if( sc_data(sc, SC_CLOAKING) && (sc_data(sc, SC_CLOAKING)->val4&1) == 1 )
+				val = max( val, (sc_data(sc, SC_CLOAKING)->val1 >= 10 ? 25 : 3 * sc_data(sc, SC_CLOAKING)->val1 - 3) );
+			if( sc_data(sc, SC_BERSERK) )
 				val = max( val, 25 );
-			if( sc->data[SC_RUN] )
+			if( sc_data(sc, SC_RUN) )
 				val = max( val, 55 );
-			if( sc->data[SC_AVOID] )
-				val = max( val, 10 * sc->data[SC_AVOID]->val1 );
-			if( sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+			if( sc_data(sc, SC_AVOID) )
+				val = max( val, 10 * sc_data(sc, SC_AVOID)->val1 );
+			if( sc_data(sc, SC_INVINCIBLE) && !sc_data(sc, SC_INVINCIBLEOFF) )
 				val = max( val, 75 );
-			if( sc->data[SC_CLOAKINGEXCEED] )
-				val = max( val, sc->data[SC_CLOAKINGEXCEED]->val3 );
-			if( sc->data[SC_GN_CARTBOOST] )
-				val = max( val, sc->data[SC_GN_CARTBOOST]->val2 );
-			if( sc->data[SC_SWINGDANCE] )
+			if( sc_data(sc, SC_CLOAKINGEXCEED) )
+				val = max( val, sc_data(sc, SC_CLOAKINGEXCEED)->val3 );
+			if( sc_data(sc, SC_GN_CARTBOOST) )
+				val = max( val, sc_data(sc, SC_GN_CARTBOOST)->val2 );
+			if( sc_data(sc, SC_SWINGDANCE) )
 				val = max( val, 25 );
-			if( sc->data[SC_WIND_STEP_OPTION] )
-				val = max( val, sc->data[SC_WIND_STEP_OPTION]->val2 );
-			if( sc->data[SC_FULL_THROTTLE] )
+			if( sc_data(sc, SC_WIND_STEP_OPTION) )
+				val = max( val, sc_data(sc, SC_WIND_STEP_OPTION)->val2 );
+			if( sc_data(sc, SC_FULL_THROTTLE) )
 				val = max( val, 100 );
 			//FIXME: Official items use a single bonus for this [ultramage]
-			if( sc->data[SC_SPEEDUP0] ) //Temporary item-based speedup
-				val = max( val, sc->data[SC_SPEEDUP0]->val1 );
+			if( sc_data(sc, SC_SPEEDUP0) ) //Temporary item-based speedup
+				val = max( val, sc_data(sc, SC_SPEEDUP0)->val1 );
 			if( sd && sd->bonus.speed_rate + sd->bonus.speed_add_rate < 0 )
 				val = max( val, -(sd->bonus.speed_rate + sd->bonus.speed_add_rate) );
 
@@ -6044,16 +6217,16 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 	{
 		if( sd && pc_iscarton(sd) )
 			speed += speed * (50 - 5 * pc_checkskill(sd,MC_PUSHCART)) / 100;
-		if( sc->data[SC_PARALYSE] )
+		if( sc_data(sc, SC_PARALYSE) )
 			speed += speed * 50 / 100;
 		if( speed_rate != 100 )
 			speed = speed * speed_rate / 100;
-		if( sc->data[SC_STEELBODY] )
+		if( sc_data(sc, SC_STEELBODY) )
 			speed = 200;
-		if( sc->data[SC_DEFENDER] )
+		if( sc_data(sc, SC_DEFENDER) )
 			speed = max(speed, 200);
-		if( sc->data[SC_WALKSPEED] && sc->data[SC_WALKSPEED]->val1 > 0 ) //ChangeSpeed
-			speed = speed * 100 / sc->data[SC_WALKSPEED]->val1;
+		if( sc_data(sc, SC_WALKSPEED) && sc_data(sc, SC_WALKSPEED)->val1 > 0 ) //ChangeSpeed
+			speed = speed * 100 / sc_data(sc, SC_WALKSPEED)->val1;
 	}
 
 	return (unsigned short)cap_value(speed,MIN_WALK_SPEED,MAX_WALK_SPEED);
@@ -6076,58 +6249,58 @@ static short status_calc_aspd(struct block_list *bl, struct status_change *sc, s
 	if(!sc || !sc->count)
 		return 0;
 
-	if(sc->data[i = SC_ASPDPOTION3] ||
-		sc->data[i = SC_ASPDPOTION2] ||
-		sc->data[i = SC_ASPDPOTION1] ||
-		sc->data[i = SC_ASPDPOTION0])
-		pots += sc->data[i]->val1;
+	if(sc_data(sc, i = SC_ASPDPOTION3) ||
+		sc_data(sc, i = SC_ASPDPOTION2) ||
+		sc_data(sc, i = SC_ASPDPOTION1) ||
+		sc_data(sc, i = SC_ASPDPOTION0))
+		pots += sc_data(sc, i)->val1;
 
 	//Fixed ASPD value
-	if(!sc->data[SC_QUAGMIRE]) {
-		if(sc->data[SC_TWOHANDQUICKEN] && skills1 < 7)
+	if(!sc_data(sc, SC_QUAGMIRE)) {
+		if(sc_data(sc, SC_TWOHANDQUICKEN) && skills1 < 7)
 			skills1 = 7;
-		if(sc->data[SC_ONEHAND] && skills1 < 7)
+		if(sc_data(sc, SC_ONEHAND) && skills1 < 7)
 			skills1 = 7;
-		if(sc->data[SC_MERC_QUICKEN] && skills1 < 7) //Needs more info
+		if(sc_data(sc, SC_MERC_QUICKEN) && skills1 < 7) //Needs more info
 			skills1 = 7;
-		if(sc->data[SC_ADRENALINE2] && skills1 < 6)
+		if(sc_data(sc, SC_ADRENALINE2) && skills1 < 6)
 			skills1 = 6;
-		if(sc->data[SC_ADRENALINE] && skills1 < 7)
+		if(sc_data(sc, SC_ADRENALINE) && skills1 < 7)
 			skills1 = 7;
-		if(sc->data[SC_SPEARQUICKEN] && skills1 < 7)
+		if(sc_data(sc, SC_SPEARQUICKEN) && skills1 < 7)
 			skills1 = 7;
-		if(sc->data[SC_FLEET] && skills1 < 5)
+		if(sc_data(sc, SC_FLEET) && skills1 < 5)
 			skills1 = 5;
 	}
-	if(sc->data[SC_BERSERK] && skills1 < 15)
+	if(sc_data(sc, SC_BERSERK) && skills1 < 15)
 		skills1 = 15;
-	if(sc->data[SC_MADNESSCANCEL] && skills1 < 20)
+	if(sc_data(sc, SC_MADNESSCANCEL) && skills1 < 20)
 		skills1 = 20;
 
 	//Percentage ASPD value
-	if(sc->data[SC_SWINGDANCE])
-		skills2 += sc->data[SC_SWINGDANCE]->val3;
-	if(sc->data[SC_DANCEWITHWUG])
-		skills2 += sc->data[SC_DANCEWITHWUG]->val3;
-	if(sc->data[SC_GT_CHANGE])
-		skills2 += sc->data[SC_GT_CHANGE]->val3;
-	if(sc->data[SC_BOOST500])
-		skills2 += sc->data[SC_BOOST500]->val1;
-	if(sc->data[SC_EXTRACT_SALAMINE_JUICE])
-		skills2 += sc->data[SC_EXTRACT_SALAMINE_JUICE]->val1;
-	if(sc->data[SC_GOLDENE_FERSE])
-		skills2 += sc->data[SC_GOLDENE_FERSE]->val3;
-	if(sc->data[SC_HEAT_BARREL])
-		skills2 += sc->data[SC_HEAT_BARREL]->val3;
-	if(sc->data[SC_INCASPDRATE])
-		skills2 += sc->data[SC_INCASPDRATE]->val1;
-	if(sc->data[SC_GATLINGFEVER])
-		skills2 += sc->data[SC_GATLINGFEVER]->val1;
-	if(sc->data[SC_STAR_COMFORT])
-		skills2 += 3 * sc->data[SC_STAR_COMFORT]->val1;
-	if(sc->data[SC_ASSNCROS] && !skills1) {
+	if(sc_data(sc, SC_SWINGDANCE))
+		skills2 += sc_data(sc, SC_SWINGDANCE)->val3;
+	if(sc_data(sc, SC_DANCEWITHWUG))
+		skills2 += sc_data(sc, SC_DANCEWITHWUG)->val3;
+	if(sc_data(sc, SC_GT_CHANGE))
+		skills2 += sc_data(sc, SC_GT_CHANGE)->val3;
+	if(sc_data(sc, SC_BOOST500))
+		skills2 += sc_data(sc, SC_BOOST500)->val1;
+	if(sc_data(sc, SC_EXTRACT_SALAMINE_JUICE))
+		skills2 += sc_data(sc, SC_EXTRACT_SALAMINE_JUICE)->val1;
+	if(sc_data(sc, SC_GOLDENE_FERSE))
+		skills2 += sc_data(sc, SC_GOLDENE_FERSE)->val3;
+	if(sc_data(sc, SC_HEAT_BARREL))
+		skills2 += sc_data(sc, SC_HEAT_BARREL)->val3;
+	if(sc_data(sc, SC_INCASPDRATE))
+		skills2 += sc_data(sc, SC_INCASPDRATE)->val1;
+	if(sc_data(sc, SC_GATLINGFEVER))
+		skills2 += sc_data(sc, SC_GATLINGFEVER)->val1;
+	if(sc_data(sc, SC_STAR_COMFORT))
+		skills2 += 3 * sc_data(sc, SC_STAR_COMFORT)->val1;
+	if(sc_data(sc, SC_ASSNCROS) && !skills1) {
 		if(bl->type != BL_PC)
-			skills2 += sc->data[SC_ASSNCROS]->val2 / 10;
+			skills2 += sc_data(sc, SC_ASSNCROS)->val2 / 10;
 		else {
 			switch(((TBL_PC *)bl)->status.weapon) {
 				case W_BOW:
@@ -6138,51 +6311,51 @@ static short status_calc_aspd(struct block_list *bl, struct status_change *sc, s
 				case W_GRENADE:
 					break;
 				default:
-					skills2 += sc->data[SC_ASSNCROS]->val2 / 10;
+					skills2 += sc_data(sc, SC_ASSNCROS)->val2 / 10;
 					break;
 			}
 		}
 	}
-	if(sc->data[SC_DONTFORGETME])
-		skills2 -= sc->data[SC_DONTFORGETME]->val2 / 10;
-	if(sc->data[SC_LONGING])
-		skills2 -= sc->data[SC_LONGING]->val2 / 10;
-	if(sc->data[SC_STEELBODY])
+	if(sc_data(sc, SC_DONTFORGETME))
+		skills2 -= sc_data(sc, SC_DONTFORGETME)->val2 / 10;
+	if(sc_data(sc, SC_LONGING))
+		skills2 -= sc_data(sc, SC_LONGING)->val2 / 10;
+	if(sc_data(sc, SC_STEELBODY))
 		skills2 -= 25;
-	if(sc->data[SC_SKA])
+	if(sc_data(sc, SC_SKA))
 		skills2 -= 25;
-	if(sc->data[SC_DEFENDER])
-		skills2 -= sc->data[SC_DEFENDER]->val4 / 10;
-	if(sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY) //Needs more info
+	if(sc_data(sc, SC_DEFENDER))
+		skills2 -= sc_data(sc, SC_DEFENDER)->val4 / 10;
+	if(sc_data(sc, SC_GOSPEL) && sc_data(sc, SC_GOSPEL)->val4 == BCT_ENEMY) //Needs more info
 		skills2 -= 25;
-	if(sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 != BCT_SELF)
-		skills2 -= sc->data[SC_GRAVITATION]->val2 / 10;
-	if(sc->data[SC_JOINTBEAT]) { //Needs more info
-		if( sc->data[SC_JOINTBEAT]->val2&BREAK_WRIST )
+	if(sc_data(sc, SC_GRAVITATION) && sc_data(sc, SC_GRAVITATION)->val3 != BCT_SELF)
+		skills2 -= sc_data(sc, SC_GRAVITATION)->val2 / 10;
+	if(sc_data(sc, SC_JOINTBEAT)) { //Needs more info
+		if( sc_data(sc, SC_JOINTBEAT)->val2&BREAK_WRIST )
 			skills2 -= 25;
-		if( sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE )
+		if( sc_data(sc, SC_JOINTBEAT)->val2&BREAK_KNEE )
 			skills2 -= 10;
 	}
-	if(sc->data[SC_FREEZING])
+	if(sc_data(sc, SC_FREEZING))
 		skills2 -= 15;
-	if(sc->data[SC_HALLUCINATIONWALK_POSTDELAY])
+	if(sc_data(sc, SC_HALLUCINATIONWALK_POSTDELAY))
 		skills2 -= 50;
-	if(sc->data[SC_PARALYSE])
+	if(sc_data(sc, SC_PARALYSE))
 		skills2 -= 10;
-	if(sc->data[SC__BODYPAINT])
-		skills2 -= 5 * sc->data[SC__BODYPAINT]->val1;
-	if(sc->data[SC__INVISIBILITY])
-		skills2 -= sc->data[SC__INVISIBILITY]->val3;
-	if(sc->data[SC__GROOMY])
-		skills2 -= sc->data[SC__GROOMY]->val3;
-	if(sc->data[SC_GLOOMYDAY])
-		skills2 -= sc->data[SC_GLOOMYDAY]->val3;
-	if(sc->data[SC_EARTHDRIVE])
+	if(sc_data(sc, SC__BODYPAINT))
+		skills2 -= 5 * sc_data(sc, SC__BODYPAINT)->val1;
+	if(sc_data(sc, SC__INVISIBILITY))
+		skills2 -= sc_data(sc, SC__INVISIBILITY)->val3;
+	if(sc_data(sc, SC__GROOMY))
+		skills2 -= sc_data(sc, SC__GROOMY)->val3;
+	if(sc_data(sc, SC_GLOOMYDAY))
+		skills2 -= sc_data(sc, SC_GLOOMYDAY)->val3;
+	if(sc_data(sc, SC_EARTHDRIVE))
 		skills2 -= 25;
-	if(sc->data[SC_MELON_BOMB])
-		skills2 -= sc->data[SC_MELON_BOMB]->val3;
-	if(sc->data[SC_PAIN_KILLER])
-		skills2 -= sc->data[SC_PAIN_KILLER]->val2;
+	if(sc_data(sc, SC_MELON_BOMB))
+		skills2 -= sc_data(sc, SC_MELON_BOMB)->val3;
+	if(sc_data(sc, SC_PAIN_KILLER))
+		skills2 -= sc_data(sc, SC_PAIN_KILLER)->val2;
 
 	return (flag&1 ? (skills1 + pots) : skills2);
 }
@@ -6201,17 +6374,17 @@ static short status_calc_fix_aspd(struct block_list *bl, struct status_change *s
 {
 	if (!sc || !sc->count)
 		return cap_value(aspd, 0, 2000);
-	if (sc->data[SC_OVERED_BOOST])
-		return cap_value(2000 - 10 * sc->data[SC_OVERED_BOOST]->val3, 0, 2000);
+	if (sc_data(sc, SC_OVERED_BOOST))
+		return cap_value(2000 - 10 * sc_data(sc, SC_OVERED_BOOST)->val3, 0, 2000);
 
-	if ((sc->data[SC_GUST_OPTION] || sc->data[SC_BLAST_OPTION] || sc->data[SC_WILD_STORM_OPTION]))
+	if ((sc_data(sc, SC_GUST_OPTION) || sc_data(sc, SC_BLAST_OPTION) || sc_data(sc, SC_WILD_STORM_OPTION)))
 		aspd -= 50; //+5 ASPD
-	if (sc->data[SC_FIGHTINGSPIRIT])
-		aspd -= sc->data[SC_FIGHTINGSPIRIT]->val2;
-	if (sc->data[SC_MTF_ASPD])
-		aspd -= sc->data[SC_MTF_ASPD]->val1;
-	if (sc->data[SC_MTF_ASPD2])
-		aspd -= sc->data[SC_MTF_ASPD]->val1;
+	if (sc_data(sc, SC_FIGHTINGSPIRIT))
+		aspd -= sc_data(sc, SC_FIGHTINGSPIRIT)->val2;
+	if (sc_data(sc, SC_MTF_ASPD))
+		aspd -= sc_data(sc, SC_MTF_ASPD)->val1;
+	if (sc_data(sc, SC_MTF_ASPD2))
+		aspd -= sc_data(sc, SC_MTF_ASPD)->val1;
 
     return cap_value(aspd, 0, 2000); //Will be recap for proper bl anyway
 }
@@ -6232,39 +6405,39 @@ static short status_calc_aspd_rate(struct block_list *bl, struct status_change *
 	if(!sc || !sc->count)
 		return (short)cap_value(aspd_rate,0,SHRT_MAX);
 
-	if(!sc->data[SC_QUAGMIRE]) {
+	if(!sc_data(sc, SC_QUAGMIRE)) {
 		int max = 0;
 
-		if(sc->data[SC_STAR_COMFORT])
-			max = sc->data[SC_STAR_COMFORT]->val2;
-		if(sc->data[SC_TWOHANDQUICKEN] &&
-			max < sc->data[SC_TWOHANDQUICKEN]->val2)
-			max = sc->data[SC_TWOHANDQUICKEN]->val2;
-		if(sc->data[SC_ONEHAND] &&
-			max < sc->data[SC_ONEHAND]->val2)
-			max = sc->data[SC_ONEHAND]->val2;
-		if(sc->data[SC_MERC_QUICKEN] &&
-			max < sc->data[SC_MERC_QUICKEN]->val2)
-			max = sc->data[SC_MERC_QUICKEN]->val2;
-		if(sc->data[SC_ADRENALINE2] &&
-			max < sc->data[SC_ADRENALINE2]->val3)
-			max = sc->data[SC_ADRENALINE2]->val3;
-		if(sc->data[SC_ADRENALINE] &&
-			max < sc->data[SC_ADRENALINE]->val3)
-			max = sc->data[SC_ADRENALINE]->val3;
-		if(sc->data[SC_SPEARQUICKEN] &&
-			max < sc->data[SC_SPEARQUICKEN]->val2)
-			max = sc->data[SC_SPEARQUICKEN]->val2;
-		if(sc->data[SC_GATLINGFEVER] &&
-			max < sc->data[SC_GATLINGFEVER]->val2)
-			max = sc->data[SC_GATLINGFEVER]->val2;
-		if(sc->data[SC_FLEET] &&
-			max < sc->data[SC_FLEET]->val2)
-			max = sc->data[SC_FLEET]->val2;
-		if(sc->data[SC_ASSNCROS] &&
-			max < sc->data[SC_ASSNCROS]->val2) {
+		if(sc_data(sc, SC_STAR_COMFORT))
+			max = sc_data(sc, SC_STAR_COMFORT)->val2;
+		if(sc_data(sc, SC_TWOHANDQUICKEN) &&
+			max < sc_data(sc, SC_TWOHANDQUICKEN)->val2)
+			max = sc_data(sc, SC_TWOHANDQUICKEN)->val2;
+		if(sc_data(sc, SC_ONEHAND) &&
+			max < sc_data(sc, SC_ONEHAND)->val2)
+			max = sc_data(sc, SC_ONEHAND)->val2;
+		if(sc_data(sc, SC_MERC_QUICKEN) &&
+			max < sc_data(sc, SC_MERC_QUICKEN)->val2)
+			max = sc_data(sc, SC_MERC_QUICKEN)->val2;
+		if(sc_data(sc, SC_ADRENALINE2) &&
+			max < sc_data(sc, SC_ADRENALINE2)->val3)
+			max = sc_data(sc, SC_ADRENALINE2)->val3;
+		if(sc_data(sc, SC_ADRENALINE) &&
+			max < sc_data(sc, SC_ADRENALINE)->val3)
+			max = sc_data(sc, SC_ADRENALINE)->val3;
+		if(sc_data(sc, SC_SPEARQUICKEN) &&
+			max < sc_data(sc, SC_SPEARQUICKEN)->val2)
+			max = sc_data(sc, SC_SPEARQUICKEN)->val2;
+		if(sc_data(sc, SC_GATLINGFEVER) &&
+			max < sc_data(sc, SC_GATLINGFEVER)->val2)
+			max = sc_data(sc, SC_GATLINGFEVER)->val2;
+		if(sc_data(sc, SC_FLEET) &&
+			max < sc_data(sc, SC_FLEET)->val2)
+			max = sc_data(sc, SC_FLEET)->val2;
+		if(sc_data(sc, SC_ASSNCROS) &&
+			max < sc_data(sc, SC_ASSNCROS)->val2) {
 			if(bl->type != BL_PC)
-				max = sc->data[SC_ASSNCROS]->val2;
+				max = sc_data(sc, SC_ASSNCROS)->val2;
 			else {
 				switch(((TBL_PC *)bl)->status.weapon) {
 					case W_BOW:
@@ -6275,7 +6448,7 @@ static short status_calc_aspd_rate(struct block_list *bl, struct status_change *
 					case W_GRENADE:
 						break;
 					default:
-						max = sc->data[SC_ASSNCROS]->val2;
+						max = sc_data(sc, SC_ASSNCROS)->val2;
 						break;
 				}
 			}
@@ -6283,73 +6456,73 @@ static short status_calc_aspd_rate(struct block_list *bl, struct status_change *
 		aspd_rate -= max;
 		//These stack with the rest of bonuses
 		max = 0;
-		if(sc->data[SC_BERSERK] && max < 300)
+		if(sc_data(sc, SC_BERSERK) && max < 300)
 			max = 300;
-		if(sc->data[SC_MADNESSCANCEL] && max < 200)
+		if(sc_data(sc, SC_MADNESSCANCEL) && max < 200)
 			max = 200;
-		if(sc->data[SC_SWINGDANCE] && max < 10 * sc->data[SC_SWINGDANCE]->val3)
-			max = 10 * sc->data[SC_SWINGDANCE]->val3;
-		if(sc->data[SC_DANCEWITHWUG] && max < 10 * sc->data[SC_DANCEWITHWUG]->val3)
-			max = 10 * sc->data[SC_DANCEWITHWUG]->val3;
+		if(sc_data(sc, SC_SWINGDANCE) && max < 10 * sc_data(sc, SC_SWINGDANCE)->val3)
+			max = 10 * sc_data(sc, SC_SWINGDANCE)->val3;
+		if(sc_data(sc, SC_DANCEWITHWUG) && max < 10 * sc_data(sc, SC_DANCEWITHWUG)->val3)
+			max = 10 * sc_data(sc, SC_DANCEWITHWUG)->val3;
 		aspd_rate -= max;
 	}
-	if(sc->data[i = SC_ASPDPOTION3] ||
-		sc->data[i = SC_ASPDPOTION2] ||
-		sc->data[i = SC_ASPDPOTION1] ||
-		sc->data[i = SC_ASPDPOTION0])
-		aspd_rate -= sc->data[i]->val2;
-	if(sc->data[SC_GT_CHANGE])
-		aspd_rate -= 10 * sc->data[SC_GT_CHANGE]->val3;
-	if(sc->data[SC_BOOST500])
-		aspd_rate -= 10 * sc->data[SC_BOOST500]->val1;
-	if(sc->data[SC_EXTRACT_SALAMINE_JUICE])
-		aspd_rate -= 10 * sc->data[SC_EXTRACT_SALAMINE_JUICE]->val1;
-	if(sc->data[SC_INCASPDRATE])
-		aspd_rate -= 10 * sc->data[SC_INCASPDRATE]->val1;
-	if(sc->data[SC_GOLDENE_FERSE])
-		aspd_rate -= 10 * sc->data[SC_GOLDENE_FERSE]->val3;
-	if(sc->data[SC_HEAT_BARREL])
-		aspd_rate -= 10 * sc->data[SC_HEAT_BARREL]->val3;
-	if(sc->data[SC_DONTFORGETME])
-		aspd_rate += sc->data[SC_DONTFORGETME]->val2;
-	if(sc->data[SC_LONGING])
-		aspd_rate += sc->data[SC_LONGING]->val2;
-	if(sc->data[SC_STEELBODY])
+	if(sc_data(sc, i = SC_ASPDPOTION3) ||
+		sc_data(sc, i = SC_ASPDPOTION2) ||
+		sc_data(sc, i = SC_ASPDPOTION1) ||
+		sc_data(sc, i = SC_ASPDPOTION0))
+		aspd_rate -= sc_data(sc, i)->val2;
+	if(sc_data(sc, SC_GT_CHANGE))
+		aspd_rate -= 10 * sc_data(sc, SC_GT_CHANGE)->val3;
+	if(sc_data(sc, SC_BOOST500))
+		aspd_rate -= 10 * sc_data(sc, SC_BOOST500)->val1;
+	if(sc_data(sc, SC_EXTRACT_SALAMINE_JUICE))
+		aspd_rate -= 10 * sc_data(sc, SC_EXTRACT_SALAMINE_JUICE)->val1;
+	if(sc_data(sc, SC_INCASPDRATE))
+		aspd_rate -= 10 * sc_data(sc, SC_INCASPDRATE)->val1;
+	if(sc_data(sc, SC_GOLDENE_FERSE))
+		aspd_rate -= 10 * sc_data(sc, SC_GOLDENE_FERSE)->val3;
+	if(sc_data(sc, SC_HEAT_BARREL))
+		aspd_rate -= 10 * sc_data(sc, SC_HEAT_BARREL)->val3;
+	if(sc_data(sc, SC_DONTFORGETME))
+		aspd_rate += sc_data(sc, SC_DONTFORGETME)->val2;
+	if(sc_data(sc, SC_LONGING))
+		aspd_rate += sc_data(sc, SC_LONGING)->val2;
+	if(sc_data(sc, SC_STEELBODY))
 		aspd_rate += 250;
-	if(sc->data[SC_SKA])
+	if(sc_data(sc, SC_SKA))
 		aspd_rate += 250;
-	if(sc->data[SC_DEFENDER])
-		aspd_rate += sc->data[SC_DEFENDER]->val4;
-	if(sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY)
+	if(sc_data(sc, SC_DEFENDER))
+		aspd_rate += sc_data(sc, SC_DEFENDER)->val4;
+	if(sc_data(sc, SC_GOSPEL) && sc_data(sc, SC_GOSPEL)->val4 == BCT_ENEMY)
 		aspd_rate += 250;
-	if(sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 != BCT_SELF)
-		aspd_rate += sc->data[SC_GRAVITATION]->val2;
-	if(sc->data[SC_JOINTBEAT]) {
-		if(sc->data[SC_JOINTBEAT]->val2&BREAK_WRIST)
+	if(sc_data(sc, SC_GRAVITATION) && sc_data(sc, SC_GRAVITATION)->val3 != BCT_SELF)
+		aspd_rate += sc_data(sc, SC_GRAVITATION)->val2;
+	if(sc_data(sc, SC_JOINTBEAT)) {
+		if(sc_data(sc, SC_JOINTBEAT)->val2&BREAK_WRIST)
 			aspd_rate += 250;
-		if(sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE)
+		if(sc_data(sc, SC_JOINTBEAT)->val2&BREAK_KNEE)
 			aspd_rate += 100;
 	}
-	if(sc->data[SC_FREEZING])
+	if(sc_data(sc, SC_FREEZING))
 		aspd_rate += 150;
-	if(sc->data[SC_HALLUCINATIONWALK_POSTDELAY])
+	if(sc_data(sc, SC_HALLUCINATIONWALK_POSTDELAY))
 		aspd_rate += 500;
-	if(sc->data[SC_PARALYSE])
+	if(sc_data(sc, SC_PARALYSE))
 		aspd_rate += 100;
-	if(sc->data[SC__BODYPAINT])
-		aspd_rate += 50 * sc->data[SC__BODYPAINT]->val1;
-	if(sc->data[SC__INVISIBILITY])
-		aspd_rate += 10 * sc->data[SC__INVISIBILITY]->val3;
-	if(sc->data[SC__GROOMY])
-		aspd_rate += 10 * sc->data[SC__GROOMY]->val3;
-	if(sc->data[SC_GLOOMYDAY])
-		aspd_rate += 10 * sc->data[SC_GLOOMYDAY]->val3;
-	if(sc->data[SC_EARTHDRIVE])
+	if(sc_data(sc, SC__BODYPAINT))
+		aspd_rate += 50 * sc_data(sc, SC__BODYPAINT)->val1;
+	if(sc_data(sc, SC__INVISIBILITY))
+		aspd_rate += 10 * sc_data(sc, SC__INVISIBILITY)->val3;
+	if(sc_data(sc, SC__GROOMY))
+		aspd_rate += 10 * sc_data(sc, SC__GROOMY)->val3;
+	if(sc_data(sc, SC_GLOOMYDAY))
+		aspd_rate += 10 * sc_data(sc, SC_GLOOMYDAY)->val3;
+	if(sc_data(sc, SC_EARTHDRIVE))
 		aspd_rate += 250;
-	if(sc->data[SC_MELON_BOMB])
-		aspd_rate += 10 * sc->data[SC_MELON_BOMB]->val3;
-	if(sc->data[SC_PAIN_KILLER])
-		aspd_rate += 10 * sc->data[SC_PAIN_KILLER]->val2;
+	if(sc_data(sc, SC_MELON_BOMB))
+		aspd_rate += 10 * sc_data(sc, SC_MELON_BOMB)->val3;
+	if(sc_data(sc, SC_PAIN_KILLER))
+		aspd_rate += 10 * sc_data(sc, SC_PAIN_KILLER)->val2;
 
 	return (short)cap_value(aspd_rate,0,SHRT_MAX);
 }
@@ -6368,9 +6541,9 @@ static unsigned short status_calc_dmotion(struct block_list *bl, struct status_c
 		return 0; //It has been confirmed on official servers that mvp mobs have no dmotion even without endure
 	if(!sc || !sc->count || map_flag_gvg2(bl->m) || map[bl->m].flag.battleground)
 		return (unsigned short)cap_value(dmotion,0,USHRT_MAX);
-	if(sc->data[SC_ENDURE])
+	if(sc_data(sc, SC_ENDURE))
 		return 0;
-	if(sc->data[SC_RUN] || sc->data[SC_WUGDASH])
+	if(sc_data(sc, SC_RUN) || sc_data(sc, SC_WUGDASH))
 		return 0;
 
 	return (unsigned short)cap_value(dmotion,0,USHRT_MAX);
@@ -6426,18 +6599,18 @@ static unsigned char status_calc_element(struct block_list *bl, struct status_ch
 	if(!sc || !sc->count)
 		return (unsigned char)cap_value(element,0,UCHAR_MAX);
 
-	if(sc->data[SC_FREEZE])
+	if(sc_data(sc, SC_FREEZE))
 		return ELE_WATER;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc_data(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 		return ELE_EARTH;
-	if(sc->data[SC_BENEDICTIO])
+	if(sc_data(sc, SC_BENEDICTIO))
 		return ELE_HOLY;
-	if(sc->data[SC_CHANGEUNDEAD])
+	if(sc_data(sc, SC_CHANGEUNDEAD))
 		return ELE_UNDEAD;
-	if(sc->data[SC_ELEMENTALCHANGE])
-		return sc->data[SC_ELEMENTALCHANGE]->val2;
-	if(sc->data[SC_SHAPESHIFT])
-		return sc->data[SC_SHAPESHIFT]->val2;
+	if(sc_data(sc, SC_ELEMENTALCHANGE))
+		return sc_data(sc, SC_ELEMENTALCHANGE)->val2;
+	if(sc_data(sc, SC_SHAPESHIFT))
+		return sc_data(sc, SC_SHAPESHIFT)->val2;
 
 	return (unsigned char)cap_value(element,0,UCHAR_MAX);
 }
@@ -6454,17 +6627,17 @@ static unsigned char status_calc_element_lv(struct block_list *bl, struct status
 	if(!sc || !sc->count)
 		return cap_value(lv,1,4);
 
-	if(sc->data[SC_FREEZE])
+	if(sc_data(sc, SC_FREEZE))
 		return 1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc_data(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 		return 1;
-	if(sc->data[SC_BENEDICTIO])
+	if(sc_data(sc, SC_BENEDICTIO))
 		return 1;
-	if(sc->data[SC_CHANGEUNDEAD])
+	if(sc_data(sc, SC_CHANGEUNDEAD))
 		return 1;
-	if(sc->data[SC_ELEMENTALCHANGE])
-		return sc->data[SC_ELEMENTALCHANGE]->val1;
-	if(sc->data[SC_SHAPESHIFT])
+	if(sc_data(sc, SC_ELEMENTALCHANGE))
+		return sc_data(sc, SC_ELEMENTALCHANGE)->val1;
+	if(sc_data(sc, SC_SHAPESHIFT))
 		return 1;
 
 	return (unsigned char)cap_value(lv,1,4);
@@ -6482,31 +6655,31 @@ unsigned char status_calc_attack_element(struct block_list *bl, struct status_ch
 	if(!sc || !sc->count)
 		return (unsigned char)cap_value(element,0,UCHAR_MAX);
 
-	if(sc->data[SC_ENCHANTARMS])
-		return sc->data[SC_ENCHANTARMS]->val2;
-	if(sc->data[SC_WATERWEAPON] ||
-		(sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 2))
+	if(sc_data(sc, SC_ENCHANTARMS))
+		return sc_data(sc, SC_ENCHANTARMS)->val2;
+	if(sc_data(sc, SC_WATERWEAPON) ||
+		(sc_data(sc, SC_WATER_INSIGNIA) && sc_data(sc, SC_WATER_INSIGNIA)->val1 == 2))
 		return ELE_WATER;
-	if(sc->data[SC_EARTHWEAPON] ||
-		(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2))
+	if(sc_data(sc, SC_EARTHWEAPON) ||
+		(sc_data(sc, SC_EARTH_INSIGNIA) && sc_data(sc, SC_EARTH_INSIGNIA)->val1 == 2))
 		return ELE_EARTH;
-	if(sc->data[SC_FIREWEAPON] ||
-		(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2))
+	if(sc_data(sc, SC_FIREWEAPON) ||
+		(sc_data(sc, SC_FIRE_INSIGNIA) && sc_data(sc, SC_FIRE_INSIGNIA)->val1 == 2))
 		return ELE_FIRE;
-	if(sc->data[SC_WINDWEAPON] ||
-		(sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 2))
+	if(sc_data(sc, SC_WINDWEAPON) ||
+		(sc_data(sc, SC_WIND_INSIGNIA) && sc_data(sc, SC_WIND_INSIGNIA)->val1 == 2))
 		return ELE_WIND;
-	if(sc->data[SC_ENCPOISON])
+	if(sc_data(sc, SC_ENCPOISON))
 		return ELE_POISON;
-	if(sc->data[SC_ASPERSIO])
+	if(sc_data(sc, SC_ASPERSIO))
 		return ELE_HOLY;
-	if(sc->data[SC_SHADOWWEAPON])
+	if(sc_data(sc, SC_SHADOWWEAPON))
 		return ELE_DARK;
-	if(sc->data[SC_GHOSTWEAPON] || sc->data[SC__INVISIBILITY])
+	if(sc_data(sc, SC_GHOSTWEAPON) || sc_data(sc, SC__INVISIBILITY))
 		return ELE_GHOST;
-	if(sc->data[SC_TIDAL_WEAPON_OPTION] || sc->data[SC_TIDAL_WEAPON])
+	if(sc_data(sc, SC_TIDAL_WEAPON_OPTION) || sc_data(sc, SC_TIDAL_WEAPON))
 		return ELE_WATER;
-	if(sc->data[SC_PYROCLASTIC])
+	if(sc_data(sc, SC_PYROCLASTIC))
 		return ELE_FIRE;
 
 	return (unsigned char)cap_value(element,0,UCHAR_MAX);
@@ -6517,13 +6690,13 @@ static unsigned short status_calc_mode(struct block_list *bl, struct status_chan
 	if(!sc || !sc->count)
 		return (unsigned short)cap_value(mode,0,USHRT_MAX);
 
-	if(sc->data[SC_MODECHANGE]) {
-		if (sc->data[SC_MODECHANGE]->val2)
-			mode = sc->data[SC_MODECHANGE]->val2; //Set mode
-		if (sc->data[SC_MODECHANGE]->val3)
-			mode |= sc->data[SC_MODECHANGE]->val3; //Add mode
-		if (sc->data[SC_MODECHANGE]->val4)
-			mode &= ~sc->data[SC_MODECHANGE]->val4; //Del mode
+	if(sc_data(sc, SC_MODECHANGE)) {
+		if (sc_data(sc, SC_MODECHANGE)->val2)
+			mode = sc_data(sc, SC_MODECHANGE)->val2; //Set mode
+		if (sc_data(sc, SC_MODECHANGE)->val3)
+			mode |= sc_data(sc, SC_MODECHANGE)->val3; //Add mode
+		if (sc_data(sc, SC_MODECHANGE)->val4)
+			mode &= ~sc_data(sc, SC_MODECHANGE)->val4; //Del mode
 	}
 
 	return (unsigned short)cap_value(mode,0,USHRT_MAX);
@@ -6807,7 +6980,7 @@ int status_isimmune(struct block_list *bl)
 {
 	struct status_change *sc = status_get_sc(bl);
 
-	if (sc && sc->data[SC_HERMODE])
+	if (sc && sc_data(sc, SC_HERMODE))
 		return 100;
 	if (bl->type == BL_PC && ((TBL_PC *)bl)->special_state.no_magic_damage >= battle_config.gtb_sc_immunity)
 		return ((TBL_PC *)bl)->special_state.no_magic_damage;
@@ -6990,6 +7163,107 @@ void status_change_init(struct block_list *bl)
 	memset(sc,0,sizeof (struct status_change));
 }
 
+/// Number of status change sets currently spilled past their inline slots
+static struct {
+	unsigned int spilled, spilled_peak;
+} sc_slot_stats;
+
+/// Periodic status change ticks re-armed while sc_tick_align is set
+static struct {
+	unsigned int rearmed, aligned;
+	uint64 delay; //Total milliseconds added by alignment
+} sc_tick_stats;
+
+/**
+ * Stores the entry of a newly started status change
+ * @param sc: Status change data
+ * @param type: Status change type
+ * @param sce: Entry to store
+ */
+static void status_sc_attach(struct status_change *sc, enum sc_type type, struct status_change_entry *sce)
+{
+	struct sc_slot *slot;
+	int n = sc->slot_count;
+
+	if( n < SC_INLINE_SLOTS )
+		slot = &sc->slot[n];
+	else {
+		if( n - SC_INLINE_SLOTS >= sc->ext_max ) {
+			if( !sc->ext ) {
+				sc_slot_stats.spilled++;
+				sc_slot_stats.spilled_peak = max(sc_slot_stats.spilled_peak, sc_slot_stats.spilled);
+			}
+			sc->ext_max = (sc->ext_max ? sc->ext_max * 2 : SC_INLINE_SLOTS * 2);
+			RECREATE(sc->ext, struct sc_slot, sc->ext_max);
+		}
+		slot = &sc->ext[n - SC_INLINE_SLOTS];
+	}
+	slot->type = type;
+	slot->entry = sce;
+	sc->slot_count++;
+	sc->active[type>>5] |= 1U<<(type&31);
+}
+
+/**
+ * Forgets the entry of an ended status change
+ * The last slot is moved into the freed one, order isn't kept
+ * @param sc: Status change data
+ * @param type: Status change type
+ */
+static void status_sc_detach(struct status_change *sc, enum sc_type type)
+{
+	struct sc_slot *slot = NULL, *last;
+	int i;
+
+	if( !(sc->active[type>>5]&(1U<<(type&31))) )
+		return;
+	for( i = 0; i < sc->slot_count; i++ ) {
+		slot = (i < SC_INLINE_SLOTS ? &sc->slot[i] : &sc->ext[i - SC_INLINE_SLOTS]);
+		if( slot->type == type )
+			break;
+	}
+	if( i == sc->slot_count )
+		return;
+	i = --sc->slot_count;
+	last = (i < SC_INLINE_SLOTS ? &sc->slot[i] : &sc->ext[i - SC_INLINE_SLOTS]);
+	*slot = *last;
+	sc->active[type>>5] &= ~(1U<<(type&31));
+	if( !sc->slot_count && sc->ext ) {
+		aFree(sc->ext);
+		sc->ext = NULL;
+		sc->ext_max = 0;
+		sc_slot_stats.spilled--;
+	}
+}
+
+static int status_sc_report_sub(struct block_list *bl, va_list ap)
+{
+	struct status_change *sc = status_get_sc(bl);
+	unsigned int *total = va_arg(ap, unsigned int *), *active = va_arg(ap, unsigned int *), *ext = va_arg(ap, unsigned int *);
+
+	if( sc ) {
+		(*total)++;
+		(*active) += sc->slot_count;
+		(*ext) += sc->ext_max * sizeof(struct sc_slot);
+	}
+	return 0;
+}
+
+/// Displays status change storage usage, compared with a SC_MAX sized table per unit
+void status_sc_report(void)
+{
+	unsigned int total = 0, active = 0, ext = 0;
+	unsigned int legacy = (unsigned int)(offsetof(struct status_change, slot_count) + SC_MAX * sizeof(struct status_change_entry *));
+
+	map_foreachiddb(status_sc_report_sub, &total, &active, &ext);
+	ShowMessage(CL_BOLD"[Status change storage report]\n"CL_NORMAL);
+	ShowMessage("\tunits: %u, active entries: %u, spilled sets: %u (peak %u)\n", total, active, sc_slot_stats.spilled, sc_slot_stats.spilled_peak);
+	ShowMessage("\tper unit: %u bytes (was %u bytes)\n", (unsigned int)sizeof(struct status_change), legacy);
+	ShowMessage("\ttotal: %u KB (was %u KB)\n", (unsigned int)((total * sizeof(struct status_change) + ext) / 1024), (unsigned int)(((uint64)total * legacy) / 1024));
+	ShowMessage("\tperiodic ticks (sc_tick_align: %d): %u re-armed, %u delayed, %u ms average delay\n", battle_config.sc_tick_align,
+		sc_tick_stats.rearmed, sc_tick_stats.aligned, (unsigned int)(sc_tick_stats.aligned ? sc_tick_stats.delay / sc_tick_stats.aligned : 0));
+}
+
 /**
  * Applies SC defense to a given status change.
  *
@@ -7260,12 +7534,12 @@ int status_get_sc_def(struct block_list *src, struct block_list *bl, enum sc_typ
 	}
 
 	if (sc) {
-		if (sc->data[SC_SCRESIST])
-			sc_def += sc->data[SC_SCRESIST]->val1 * 100; //Status resist
-		else if (sc->data[SC_SIEGFRIED])
-			sc_def += sc->data[SC_SIEGFRIED]->val3 * 100; //Status resistance
-		else if (sc->data[SC_SHIELDSPELL_REF] && sc->data[SC_SHIELDSPELL_REF]->val1 == 2)
-			sc_def += sc->data[SC_SHIELDSPELL_REF]->val3 * 100;
+		if (sc_data(sc, SC_SCRESIST))
+			sc_def += sc_data(sc, SC_SCRESIST)->val1 * 100; //Status resist
+		else if (sc_data(sc, SC_SIEGFRIED))
+			sc_def += sc_data(sc, SC_SIEGFRIED)->val3 * 100; //Status resistance
+		else if (sc_data(sc, SC_SHIELDSPELL_REF) && sc_data(sc, SC_SHIELDSPELL_REF)->val1 == 2)
+			sc_def += sc_data(sc, SC_SHIELDSPELL_REF)->val3 * 100;
 	}
 
 	if (tick_def == -1) //When tick def not set, reduction is the same for both
@@ -7285,8 +7559,8 @@ int status_get_sc_def(struct block_list *src, struct block_list *bl, enum sc_typ
 		if (sd && SC_COMMON_MIN <= type && type <= SC_COMMON_MAX) { //Item resistance (only applies to rate%)
 			if (sd->reseff[type - SC_COMMON_MIN] > 0)
 				rate -= rate * sd->reseff[type - SC_COMMON_MIN] / 10000;
-			if (sd->sc.data[SC_COMMONSC_RESIST])
-				rate -= rate * sd->sc.data[SC_COMMONSC_RESIST]->val1 / 100;
+			if (sc_data(&sd->sc, SC_COMMONSC_RESIST))
+				rate -= rate * sc_data(&sd->sc, SC_COMMONSC_RESIST)->val1 / 100;
 		}
 		if (rate > 0 && rate%10 != 0)
 			rate += (10 - rate%10); //Aegis accuracy
@@ -7445,7 +7719,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			//return 0; //Prevent status addin hp to gvg mob (like bloodylust = hp * 3, and etc)
 	}
 
-	if( sc->data[SC_REFRESH] ) { //Immunes against status effects
+	if( sc_data(sc, SC_REFRESH) ) { //Immunes against status effects
 		if( type >= SC_COMMON_MIN && type <= SC_COMMON_MAX )
 			return 0;
 		switch( type ) {
@@ -7458,7 +7732,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 		}
 	}
 
-	if( sc->data[SC_INSPIRATION] ) {
+	if( sc_data(sc, SC_INSPIRATION) ) {
 		if( type >= SC_COMMON_MIN && type <= SC_COMMON_MAX )
 			return 0;
 		switch( type ) {
@@ -7472,7 +7746,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 		}
 	}
 
-	if( sc->data[SC_KINGS_GRACE] ) {
+	if( sc_data(sc, SC_KINGS_GRACE) ) {
 		if( type >= SC_COMMON_MIN && type <= SC_COMMON_MAX )
 			return 0;
 		switch( type ) {
@@ -7500,17 +7774,17 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 		case SC_QUAGMIRE:
 		case SC_DONTFORGETME:
 		case SC_ADORAMUS:
-			if(sc->data[SC_SPEEDUP1])
+			if(sc_data(sc, SC_SPEEDUP1))
 				return 0;
 			break;
 		case SC_ANGRIFFS_MODUS:
 		case SC_GOLDENE_FERSE:
-			if((type == SC_GOLDENE_FERSE && sc->data[SC_ANGRIFFS_MODUS]) ||
-				(type == SC_ANGRIFFS_MODUS && sc->data[SC_GOLDENE_FERSE]))
+			if((type == SC_GOLDENE_FERSE && sc_data(sc, SC_ANGRIFFS_MODUS)) ||
+				(type == SC_ANGRIFFS_MODUS && sc_data(sc, SC_GOLDENE_FERSE)))
 				return 0;
 			break;
 		case SC_STONE:
-			if(sc->data[SC_POWER_OF_GAIA])
+			if(sc_data(sc, SC_POWER_OF_GAIA))
 				return 0;
 		case SC_FREEZE:
 			if(undead_flag && !(flag&SCFLAG_NOAVOID))
@@ -7523,13 +7797,13 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 		case SC_WHITEIMPRISON:
 		case SC_DEEPSLEEP:
 		case SC_CRYSTALIZE:
-			if((type == SC_FREEZE || type == SC_FREEZING || type == SC_CRYSTALIZE) && sc->data[SC_WARMER])
+			if((type == SC_FREEZE || type == SC_FREEZING || type == SC_CRYSTALIZE) && sc_data(sc, SC_WARMER))
 				return 0; //Immune to Freeze, Freezing and Crystalize status if under Warmer status [Jobbie]
 			if(sc->opt1)
 				return 0; //Cannot override other OPT1 status changes [Skotlex]
 			break;
 		case SC_BERSERK: //There all like berserk, do not everlap each other
-			if(sc->data[SC_SATURDAYNIGHTFEVER])
+			if(sc_data(sc, SC_SATURDAYNIGHTFEVER))
 				return 0;
 			break;
 		case SC_SIGNUMCRUCIS: //Only affects demons and undead element (but not players)
@@ -7537,7 +7811,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 				return 0;
 			break;
 		case SC_AETERNA:
-			if((sc->data[SC_STONE] && sc->opt1 == OPT1_STONE) || sc->data[SC_FREEZE])
+			if((sc_data(sc, SC_STONE) && sc->opt1 == OPT1_STONE) || sc_data(sc, SC_FREEZE))
 				return 0;
 			break;
 		case SC_KYRIE:
@@ -7545,7 +7819,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 				return 0;
 			break;
 		case SC_OVERTHRUST:
-			if(sc->data[SC_MAXOVERTHRUST])
+			if(sc_data(sc, SC_MAXOVERTHRUST))
 				return 0; //Overthrust can't take effect if under Max Overthrust [Skotlex]
 		case SC_MAXOVERTHRUST:
 			if(sc->option&OPTION_MADOGEAR)
@@ -7554,18 +7828,18 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 		case SC_ADRENALINE:
 			if(sd && !pc_check_weapontype(sd,skill_get_weapontype(BS_ADRENALINE)))
 				return 0;
-			if(sc->data[SC_QUAGMIRE] ||
-				sc->data[SC_DECREASEAGI] ||
-				sc->data[SC_ADORAMUS] ||
+			if(sc_data(sc, SC_QUAGMIRE) ||
+				sc_data(sc, SC_DECREASEAGI) ||
+				sc_data(sc, SC_ADORAMUS) ||
 				(sc->option&OPTION_MADOGEAR)) //Adrenaline doesn't affect Mado Gear [Ind]
 				return 0;
 			break;
 		case SC_ADRENALINE2:
 			if(sd && !pc_check_weapontype(sd,skill_get_weapontype(BS_ADRENALINE2)))
 				return 0;
-			if(sc->data[SC_QUAGMIRE] ||
-				sc->data[SC_DECREASEAGI] ||
-				sc->data[SC_ADORAMUS])
+			if(sc_data(sc, SC_QUAGMIRE) ||
+				sc_data(sc, SC_DECREASEAGI) ||
+				sc_data(sc, SC_ADORAMUS))
 				return 0;
 			break;
 		case SC_MAGNIFICAT:
@@ -7575,7 +7849,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 		case SC_ONEHAND:
 		case SC_MERC_QUICKEN:
 		case SC_TWOHANDQUICKEN:
-			if(sc->data[SC_DECREASEAGI] || sc->data[SC_ADORAMUS])
+			if(sc_data(sc, SC_DECREASEAGI) || sc_data(sc, SC_ADORAMUS))
 				return 0;
 		case SC_CONCENTRATE:
 		case SC_SPEARQUICKEN:
@@ -7586,7 +7860,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			if(sc->option&OPTION_MADOGEAR)
 				return 0; //Mado is immune to wind walk, cart boost, etc (others above) [Ind]
 		case SC_INCREASEAGI:
-			if(sc->data[SC_QUAGMIRE])
+			if(sc_data(sc, SC_QUAGMIRE))
 				return 0;
 			break;
 		case SC_CLOAKING:
@@ -7594,7 +7868,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 				return 0;
 		case SC_CLOAKINGEXCEED:
 		case SC_HIDING:
-			if(sc->data[SC_BITE])
+			if(sc_data(sc, SC_BITE))
 				return 0; //Prevent Cloaking, Exceed and Hiding
 			break;
 		case SC_MODECHANGE: {
@@ -7603,11 +7877,11 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 
 				if(!bstatus)
 					return 0;
-				if(sc->data[type]) { //Pile up with previous values
+				if(sc_data(sc, type)) { //Pile up with previous values
 					if(!val2)
-						val2 = sc->data[type]->val2;
-					val3 |= sc->data[type]->val3;
-					val4 |= sc->data[type]->val4;
+						val2 = sc_data(sc, type)->val2;
+					val3 |= sc_data(sc, type)->val3;
+					val4 |= sc_data(sc, type)->val4;
 				}
 				mode = (val2 ? val2 : bstatus->mode); //Base mode
 				if(val4)
@@ -7615,7 +7889,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 				if(val3)
 					mode |= val3; //Add mode
 				if(mode == bstatus->mode) { //No change.
-					if(sc->data[type]) //Abort previous status
+					if(sc_data(sc, type)) //Abort previous status
 						return status_change_end(bl,type,INVALID_TIMER);
 					return 0;
 				}
@@ -7693,51 +7967,51 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 				return 0; //Stats only for Mercenaries
 			break;
 		case SC_STRFOOD:
-			if(sc->data[SC_FOOD_STR_CASH] && sc->data[SC_FOOD_STR_CASH]->val1 > val1)
+			if(sc_data(sc, SC_FOOD_STR_CASH) && sc_data(sc, SC_FOOD_STR_CASH)->val1 > val1)
 				return 0;
 			break;
 		case SC_AGIFOOD:
-			if(sc->data[SC_FOOD_AGI_CASH] && sc->data[SC_FOOD_AGI_CASH]->val1 > val1)
+			if(sc_data(sc, SC_FOOD_AGI_CASH) && sc_data(sc, SC_FOOD_AGI_CASH)->val1 > val1)
 				return 0;
 			break;
 		case SC_VITFOOD:
-			if(sc->data[SC_FOOD_VIT_CASH] && sc->data[SC_FOOD_VIT_CASH]->val1 > val1)
+			if(sc_data(sc, SC_FOOD_VIT_CASH) && sc_data(sc, SC_FOOD_VIT_CASH)->val1 > val1)
 				return 0;
 			break;
 		case SC_INTFOOD:
-			if(sc->data[SC_FOOD_INT_CASH] && sc->data[SC_FOOD_INT_CASH]->val1 > val1)
+			if(sc_data(sc, SC_FOOD_INT_CASH) && sc_data(sc, SC_FOOD_INT_CASH)->val1 > val1)
 				return 0;
 			break;
 		case SC_DEXFOOD:
-			if(sc->data[SC_FOOD_DEX_CASH] && sc->data[SC_FOOD_DEX_CASH]->val1 > val1)
+			if(sc_data(sc, SC_FOOD_DEX_CASH) && sc_data(sc, SC_FOOD_DEX_CASH)->val1 > val1)
 				return 0;
 			break;
 		case SC_LUKFOOD:
-			if(sc->data[SC_FOOD_LUK_CASH] && sc->data[SC_FOOD_LUK_CASH]->val1 > val1)
+			if(sc_data(sc, SC_FOOD_LUK_CASH) && sc_data(sc, SC_FOOD_LUK_CASH)->val1 > val1)
 				return 0;
 			break;
 		case SC_FOOD_STR_CASH:
-			if((sc->data[SC_STRFOOD] && sc->data[SC_STRFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+			if((sc_data(sc, SC_STRFOOD) && sc_data(sc, SC_STRFOOD)->val1 > val1) || sc_data(sc, SC_2011RWC_SCROLL))
 				return 0;
 			break;
 		case SC_FOOD_AGI_CASH:
-			if((sc->data[SC_AGIFOOD] && sc->data[SC_AGIFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+			if((sc_data(sc, SC_AGIFOOD) && sc_data(sc, SC_AGIFOOD)->val1 > val1) || sc_data(sc, SC_2011RWC_SCROLL))
 				return 0;
 			break;
 		case SC_FOOD_VIT_CASH:
-			if((sc->data[SC_VITFOOD] && sc->data[SC_VITFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+			if((sc_data(sc, SC_VITFOOD) && sc_data(sc, SC_VITFOOD)->val1 > val1) || sc_data(sc, SC_2011RWC_SCROLL))
 				return 0;
 			break;
 		case SC_FOOD_INT_CASH:
-			if((sc->data[SC_INTFOOD] && sc->data[SC_INTFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+			if((sc_data(sc, SC_INTFOOD) && sc_data(sc, SC_INTFOOD)->val1 > val1) || sc_data(sc, SC_2011RWC_SCROLL))
 				return 0;
 			break;
 		case SC_FOOD_DEX_CASH:
-			if((sc->data[SC_DEXFOOD] && sc->data[SC_DEXFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+			if((sc_data(sc, SC_DEXFOOD) && sc_data(sc, SC_DEXFOOD)->val1 > val1) || sc_data(sc, SC_2011RWC_SCROLL))
 				return 0;
 			break;
 		case SC_FOOD_LUK_CASH:
-			if((sc->data[SC_LUKFOOD] && sc->data[SC_LUKFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+			if((sc_data(sc, SC_LUKFOOD) && sc_data(sc, SC_LUKFOOD)->val1 > val1) || sc_data(sc, SC_2011RWC_SCROLL))
 				return 0;
 			break;
 		case SC_CAMOUFLAGE:
@@ -7776,44 +8050,44 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 				int i = SC_TOXIN;
 
 				for(; i <= SC_LEECHESEND; i++)
-					if(sc->data[i])
+					if(sc_data(sc, i))
 						return 0;
 			}
 			break;
 		case SC_MAGNETICFIELD:
-			if(sc->data[SC_HOVERING])
+			if(sc_data(sc, SC_HOVERING))
 				return 0;
 			break;
 		case SC_BLEEDING:
-			if(sc->data[SC_POWER_OF_GAIA])
+			if(sc_data(sc, SC_POWER_OF_GAIA))
 				return 0;
 			break;
 		case SC_SATURDAYNIGHTFEVER:
-			if(sc->data[SC_BERSERK])
+			if(sc_data(sc, SC_BERSERK))
 				return 0;
 			break;
 		case SC_ALL_RIDING:
 			if(sc->option&(OPTION_RIDING|OPTION_DRAGON|OPTION_WUGRIDER|OPTION_MADOGEAR))
 				return 0;
-			if(sc->data[type]) { // Already mounted, just dismount
+			if(sc_data(sc, type)) { // Already mounted, just dismount
 				status_change_end(bl,type,INVALID_TIMER);
 				return 0;
 			}
 			break;
 		case SC_MADNESSCANCEL:
-			if(sc->data[SC_HEAT_BARREL] || sc->data[SC_P_ALTER])
+			if(sc_data(sc, SC_HEAT_BARREL) || sc_data(sc, SC_P_ALTER))
 				return 0;
 			break;
 		case SC_HEAT_BARREL:
-			if(sc->data[SC_MADNESSCANCEL] || sc->data[SC_P_ALTER])
+			if(sc_data(sc, SC_MADNESSCANCEL) || sc_data(sc, SC_P_ALTER))
 				return 0;
 			break;
 		case SC_P_ALTER:
-			if(sc->data[SC_MADNESSCANCEL] || sc->data[SC_HEAT_BARREL])
+			if(sc_data(sc, SC_MADNESSCANCEL) || sc_data(sc, SC_HEAT_BARREL))
 				return 0;
 			break;
 		case SC_KINGS_GRACE:
-			if(sc->data[SC_DEVOTION] || sc->data[SC_WHITEIMPRISON])
+			if(sc_data(sc, SC_DEVOTION) || sc_data(sc, SC_WHITEIMPRISON))
 				return 0;
 			break;
 		case SC_WEDDING:
@@ -7892,16 +8166,16 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			//but cannot be plagiarized (this requires aegis investigation on packets and official behavior) [Brainstorm]
 			if ((!undead_flag && status->race != RC_DEMON) || bl->type == BL_PC) {
 				status_change_end(bl,SC_CURSE,INVALID_TIMER);
-				if (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+				if (sc_data(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 					status_change_end(bl,SC_STONE,INVALID_TIMER);
 			}
-			if (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
+			if (sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_HIGH)
 				status_change_end(bl,SC_SPIRIT,INVALID_TIMER);
 			break;
 		case SC_INCREASEAGI:
 			status_change_end(bl,SC_DECREASEAGI,INVALID_TIMER);
 			status_change_end(bl,SC_ADORAMUS,INVALID_TIMER);
-			if (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
+			if (sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_HIGH)
 				status_change_end(bl,SC_SPIRIT,INVALID_TIMER);
 			break;
 		case SC_QUAGMIRE:
@@ -7941,11 +8215,11 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			status_change_end(bl,SC_ASSUMPTIO,INVALID_TIMER);
 			break;
 		case SC_DELUGE:
-			if (sc->data[SC_FOGWALL] && sc->data[SC_BLIND])
+			if (sc_data(sc, SC_FOGWALL) && sc_data(sc, SC_BLIND))
 				status_change_end(bl,SC_BLIND,INVALID_TIMER);
 			break;
 		case SC_SILENCE:
-			if (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF)
+			if (sc_data(sc, SC_GOSPEL) && sc_data(sc, SC_GOSPEL)->val4 == BCT_SELF)
 				status_change_end(bl,SC_GOSPEL,INVALID_TIMER);
 			break;
 		case SC_HIDING:
@@ -7977,7 +8251,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			break;
 		case SC_CARTBOOST:
 		case SC_GN_CARTBOOST: //Cancel Decrease Agi, but take no further effect [Skotlex]
-			if (sc->data[SC_DECREASEAGI] || sc->data[SC_ADORAMUS]) {
+			if (sc_data(sc, SC_DECREASEAGI) || sc_data(sc, SC_ADORAMUS)) {
 				status_change_end(bl,SC_DECREASEAGI,INVALID_TIMER);
 				return 0;
 			}
@@ -8086,8 +8360,8 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			}
 			if (type != SC_SONGOFMANA) status_change_end(bl,SC_SONGOFMANA,INVALID_TIMER);
 			if (type != SC_DANCEWITHWUG) status_change_end(bl,SC_DANCEWITHWUG,INVALID_TIMER);
-			if (type != SC_SATURDAYNIGHTFEVER && sc->data[SC_SATURDAYNIGHTFEVER]) {
-				sc->data[SC_SATURDAYNIGHTFEVER]->val2 = 0;
+			if (type != SC_SATURDAYNIGHTFEVER && sc_data(sc, SC_SATURDAYNIGHTFEVER)) {
+				sc_data(sc, SC_SATURDAYNIGHTFEVER)->val2 = 0;
 				status_change_end(bl,SC_SATURDAYNIGHTFEVER,INVALID_TIMER);
 			}
 			break;
@@ -8167,7 +8441,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			break;
 	}
 
-	if( (sce = sc->data[type]) ) { //Check for overlapping fails
+	if( (sce = sc_data(sc, type)) ) { //Check for overlapping fails
 		switch( type ) {
 			case SC_MERC_FLEEUP:
 			case SC_MERC_ATKUP:
@@ -8256,7 +8530,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 				val4 = sce->val4;
 				break;
 			case SC_LERADSDEW:
-				if( sc && (sc->data[SC_BERSERK] || sc->data[SC_SATURDAYNIGHTFEVER]) )
+				if( sc && (sc_data(sc, SC_BERSERK) || sc_data(sc, SC_SATURDAYNIGHTFEVER)) )
 					return 0;
 			//Fall through
 			case SC_SHAPESHIFT:
@@ -8328,7 +8602,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 					tick = -1;
 				break;
 			case SC_AUTOBERSERK:
-				if( status->hp < status->max_hp>>2 && (!sc->data[SC_PROVOKE] || sc->data[SC_PROVOKE]->val2 == 0) )
+				if( status->hp < status->max_hp>>2 && (!sc_data(sc, SC_PROVOKE) || sc_data(sc, SC_PROVOKE)->val2 == 0) )
 					sc_start4(src,bl,SC_PROVOKE,100,10,1,0,0,60000);
 				tick = -1;
 				break;
@@ -8613,7 +8887,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 				tick_time = val2 = tick; //Interval at which SP is drained
 				tick = -1;
 				val3 = 35 - 5 * val1; //Speed adjustment
-				if( sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_ROGUE )
+				if( sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_ROGUE )
 					val3 -= 40;
 				val4 = 10 + val1 * 2; //SP cost
 				if( map_flag_gvg2(bl->m) || map[bl->m].flag.battleground )
@@ -8699,7 +8973,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			case SC_BERSERK:
 				if( val3 == SC__BLOODYLUST )
 					sc_start(src,bl,(sc_type)val3,100,val1,tick + 100);
-				if( !val3 && !(sc->data[SC_ENDURE] && sc->data[SC_ENDURE]->val4) )
+				if( !val3 && !(sc_data(sc, SC_ENDURE) && sc_data(sc, SC_ENDURE)->val4) )
 					sc_start4(src,bl,SC_ENDURE,100,10,0,0,2,tick);
 				//HP healing is performing after the calc_status call
 				//val2 holds HP penalty
@@ -8733,7 +9007,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 					//Fetch caster information
 					struct block_list *pbl = map_id2bl(val1);
 					struct status_change *psc = (pbl ? status_get_sc(pbl) : NULL);
-					struct status_change_entry *psce = (psc ? psc->data[SC_MARIONETTE] : NULL);
+					struct status_change_entry *psce = (psc ? sc_data(psc, SC_MARIONETTE) : NULL);
 					//Fetch target's stats
 					struct status_data *status = status_get_status_data(bl); //Battle status
 
@@ -8799,11 +9073,11 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 						while( i >= 0 ) {
 							enum sc_type type2 = types[i];
 
-							if( d_sc->data[type2] )
-								status_change_start(d_bl,bl,type2,10000,d_sc->data[type2]->val1,0,0,(type2 == SC_REFLECTSHIELD ? 1 : 0),skill_get_time(status_sc2skill(type2),d_sc->data[type2]->val1),SCFLAG_NOAVOID|SCFLAG_NOICON);
+							if( sc_data(d_sc, type2) )
+								status_change_start(d_bl,bl,type2,10000,sc_data(d_sc, type2)->val1,0,0,(type2 == SC_REFLECTSHIELD ? 1 : 0),skill_get_time(status_sc2skill(type2),sc_data(d_sc, type2)->val1),SCFLAG_NOAVOID|SCFLAG_NOICON);
 							i--;
 						}
-						if( sc->data[SC_DEFENDER] )
+						if( sc_data(sc, SC_DEFENDER) )
 							status_change_end(bl,SC_DEFENDER,INVALID_TIMER);
 					}
 				}
@@ -8823,7 +9097,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 					struct block_list *src = (val2 ? map_id2bl(val2) : NULL);
 					struct status_change *sc2 = (src ? status_get_sc(src) : NULL);
 					enum sc_type type2 = (type == SC_TINDER_BREAKER2 ? SC_TINDER_BREAKER : SC_CLOSECONFINE);
-					struct status_change_entry *sce2 = (sc2 ? sc2->data[type2] : NULL);
+					struct status_change_entry *sce2 = (sc2 ? sc_data(sc2, type2) : NULL);
 
 					if( src && sc2 ) {
 						if( !sce2 ) //Start lock on caster
@@ -9024,7 +9298,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 						val3 = map;
 						val4 = pos;
 					} else if( !val3 || val3 == sd->mapindex ||
-						!sd->sc.data[SC_JAILED] ) //If player is being jailed and is already in jail (issue: 8206)
+						!sc_data(&sd->sc, SC_JAILED) ) //If player is being jailed and is already in jail (issue: 8206)
 					{ //Use save point
 						val3 = sd->status.save_point.map;
 						val4 = (sd->status.save_point.x&0xFFFF)|(sd->status.save_point.y<<16);
@@ -9755,7 +10029,7 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 			case SC_PAIN_KILLER:
 				val2 = 2 * val1; //Aspd reduction %
 				val3 = 2 * val1; //Dmg reduction %
-				if( sc->data[SC_PARALYSIS] )
+				if( sc_data(sc, SC_PARALYSIS) )
 					sc_start(src,bl,SC_ENDURE,100,val1,tick); //Start endure for same duration
 				break;
 			case SC_CBC:
@@ -10309,13 +10583,14 @@ int status_change_start(struct block_list *src, struct block_list *bl, enum sc_t
 		tick = tick_time;
 
 	//Don't trust the previous sce assignment, in case the SC ended somewhere between there and here
-	if((sce = sc->data[type])) { //Reuse old sc
+	if((sce = sc_data(sc, type))) { //Reuse old sc
 		if(sce->timer != INVALID_TIMER)
 			delete_timer(sce->timer,status_change_timer);
 		sc_isnew = false;
 	} else { //New sc
 		++sc->count;
-		sce = sc->data[type] = ers_alloc(sc_data_ers,struct status_change_entry);
+		sce = ers_alloc(sc_data_ers,struct status_change_entry);
+		status_sc_attach(sc,type,sce);
 	}
 
 	sce->val1 = val1;
@@ -10430,13 +10705,15 @@ int status_change_clear(struct block_list *bl,int type)
 	if(!sc || !sc->count)
 		return 0;
 
+	status_calc_defer_begin();
+
 	for(i = 0; i < SC_MAX; i++) {
-		if(!sc->data[i])
+		if(!sc_data(sc, i))
 			continue;
 		if(type == 0) {
 			switch(i) { //Type 0: PC killed -> Place here statuses that do not dispel on death
 				case SC_ELEMENTALCHANGE: //Only when its Holy or Dark that it doesn't dispell on death
-					if(sc->data[i]->val2 != ELE_HOLY && sc->data[i]->val2 != ELE_DARK)
+					if(sc_data(sc, i)->val2 != ELE_HOLY && sc_data(sc, i)->val2 != ELE_DARK)
 						break;
 				case SC_WEIGHT50:
 				case SC_WEIGHT90:
@@ -10541,15 +10818,17 @@ int status_change_clear(struct block_list *bl,int type)
 		status_change_end(bl,(sc_type)i,INVALID_TIMER);
 
 		//If for some reason status_change_end decides to still keep the status when quitting [Skotlex]
-		if(type == 1 && sc->data[i]) {
+		if(type == 1 && sc_data(sc, i)) {
 			sc->count--;
-			if(sc->data[i]->timer != INVALID_TIMER)
-				delete_timer(sc->data[i]->timer,status_change_timer);
-			ers_free(sc_data_ers,sc->data[i]);
-			sc->data[i] = NULL;
+			if(sc_data(sc, i)->timer != INVALID_TIMER)
+				delete_timer(sc_data(sc, i)->timer,status_change_timer);
+			ers_free(sc_data_ers,sc_data(sc, i));
+			status_sc_detach(sc,(sc_type)i);
 		}
 	}
 
+	status_calc_defer_end();
+
 	sc->opt1 = 0;
 	sc->opt2 = 0;
 	sc->opt3 = 0;
@@ -10586,7 +10865,7 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 	sc = status_get_sc(bl);
 	status = status_get_status_data(bl);
 
-	if (type < 0 || type >= SC_MAX || !sc || !(sce = sc->data[type]))
+	if (type < 0 || type >= SC_MAX || !sc || !(sce = sc_data(sc, type)))
 		return 0;
 
 	sd = BL_CAST(BL_PC,bl);
@@ -10629,7 +10908,7 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 	if (StatusChangeStateTable[type])
 		status_calc_state(bl,sc,(enum scs_flag)StatusChangeStateTable[type],false);
 
-	sc->data[type] = NULL;
+	status_sc_detach(sc,type);
 
 	if (sd && StatusDisplayType[type])
 		status_display_remove(sd,type);
@@ -10681,7 +10960,7 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 			}
 			break;
 		case SC_AUTOBERSERK:
-			if (sc->data[SC_PROVOKE] && sc->data[SC_PROVOKE]->val2 == 1)
+			if (sc_data(sc, SC_PROVOKE) && sc_data(sc, SC_PROVOKE)->val2 == 1)
 				status_change_end(bl,SC_PROVOKE,INVALID_TIMER);
 			break;
 		case SC_ENDURE:
@@ -10695,12 +10974,12 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 					int i;
 
 					for (i = 0; i < MAX_DEVOTION; i++) {
-						if (sd->devotion[i] && (tsd = map_id2sd(sd->devotion[i])) && tsd->sc.data[type])
+						if (sd->devotion[i] && (tsd = map_id2sd(sd->devotion[i])) && sc_data(&tsd->sc, type))
 							status_change_end(&tsd->bl,type,INVALID_TIMER);
 					}
 				} else if (bl->type == BL_MER && ((TBL_MER *)bl)->devotion_flag) { //Clear Status from Master
 					tsd = ((TBL_MER *)bl)->master;
-					if (tsd && tsd->sc.data[type])
+					if (tsd && sc_data(&tsd->sc, type))
 						status_change_end(&tsd->bl,type,INVALID_TIMER);
 				}
 			}
@@ -10728,8 +11007,8 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 				struct status_change *tsc = status_get_sc(tbl);
 
 				sce->val4 = 0;
-				if (tbl && tsc && tsc->data[SC_BLADESTOP]) {
-					tsc->data[SC_BLADESTOP]->val4 = 0;
+				if (tbl && tsc && sc_data(tsc, SC_BLADESTOP)) {
+					sc_data(tsc, SC_BLADESTOP)->val4 = 0;
 					status_change_end(tbl,SC_BLADESTOP,INVALID_TIMER);
 				}
 				clif_bladestop(bl,tid,0);
@@ -10752,7 +11031,7 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 					sd->delunit_prevline = line;
 				}
 				if (sce->val4 && sce->val4 != BCT_SELF && (dsd = map_id2sd(sce->val4))) { //End status on partner as well
-					dsc = dsd->sc.data[SC_DANCING];
+					dsc = sc_data(&dsd->sc, SC_DANCING);
 					if (dsc) { //This will prevent recursive loops
 						dsc->val2 = dsc->val4 = 0;
 						status_change_end(&dsd->bl,SC_DANCING,INVALID_TIMER);
@@ -10800,8 +11079,8 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 				struct status_change *sc2 = (src ? status_get_sc(src) : NULL);
 				enum sc_type type2 = (type == SC_CLOSECONFINE2 ? SC_CLOSECONFINE : SC_TINDER_BREAKER);
 
-				if (src && sc2 && sc2->data[type2]) //If status was already ended, do nothing
-					if (type == SC_TINDER_BREAKER2 || (--(sc2->data[type2]->val1) <= 0)) //Decrease count
+				if (src && sc2 && sc_data(sc2, type2)) //If status was already ended, do nothing
+					if (type == SC_TINDER_BREAKER2 || (--(sc_data(sc2, type2)->val1) <= 0)) //Decrease count
 						status_change_end(src,type2,INVALID_TIMER); //No more holds, free him up
 			}
 		case SC_TINDER_BREAKER:
@@ -10825,20 +11104,20 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 				struct block_list *pbl = map_id2bl(sce->val1);
 				struct status_change *sc2 = pbl ? status_get_sc(pbl) : NULL;
 
-				if (sc2 && sc2->data[type2]) {
-					sc2->data[type2]->val1 = 0;
+				if (sc2 && sc_data(sc2, type2)) {
+					sc_data(sc2, type2)->val1 = 0;
 					status_change_end(pbl,type2,INVALID_TIMER);
 				}
 			}
 			break;
 		case SC_BERSERK:
-			if (status->hp > 200 && sc->data[SC__BLOODYLUST]) {
+			if (status->hp > 200 && sc_data(sc, SC__BLOODYLUST)) {
 				status_percent_heal(bl,100,0);
 				status_change_end(bl,SC__BLOODYLUST,INVALID_TIMER);
 			} else if (status->hp > 100 && sce->val2)
 				status_set_hp(bl,100,0); //Check if status isn't ended by skill (when val2 = 0)
-			if (sc->data[SC_ENDURE] && sc->data[SC_ENDURE]->val4 == 2) {
-				sc->data[SC_ENDURE]->val4 = 0;
+			if (sc_data(sc, SC_ENDURE) && sc_data(sc, SC_ENDURE)->val4 == 2) {
+				sc_data(sc, SC_ENDURE)->val4 = 0;
 				status_change_end(bl,SC_ENDURE,INVALID_TIMER);
 			}
 			sc_start4(bl,bl,SC_REGENERATION,100,10,0,0,(RGN_HP|RGN_SP),skill_get_time(status_sc2skill(type),sce->val1));
@@ -10911,12 +11190,12 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 				struct block_list *tbl = map_id2bl(sce->val2);
 
 				sce->val2 = 0;
-				if (tbl && (sc = status_get_sc(tbl)) && sc->data[SC_STOP] && sc->data[SC_STOP]->val2 == bl->id)
+				if (tbl && (sc = status_get_sc(tbl)) && sc_data(sc, SC_STOP) && sc_data(sc, SC_STOP)->val2 == bl->id)
 					status_change_end(tbl,SC_STOP,INVALID_TIMER);
 			}
 			break;
 		case SC_CONCENTRATION:
-			if (sc->data[SC_ENDURE] && !sc->data[SC_ENDURE]->val4)
+			if (sc_data(sc, SC_ENDURE) && !sc_data(sc, SC_ENDURE)->val4)
 				status_change_end(bl,SC_ENDURE,INVALID_TIMER);
 			break;
 		case SC_HALLUCINATIONWALK:
@@ -10985,7 +11264,7 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 				struct block_list *src = map_id2bl(sce->val2);
 				struct status_change *sc = status_get_sc(src);
 
-				if (sc && sc->data[SC_CURSEDCIRCLE_ATKER] && --(sc->data[SC_CURSEDCIRCLE_ATKER]->val2) == 0) {
+				if (sc && sc_data(sc, SC_CURSEDCIRCLE_ATKER) && --(sc_data(sc, SC_CURSEDCIRCLE_ATKER)->val2) == 0) {
 					clif_bladestop(bl,src->id,0);
 					status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 				}
@@ -11361,6 +11640,36 @@ int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const
 	return 1;
 }
 
+/**
+ * Delays the next periodic tick of a status change to the unit's slot on the
+ * sc_tick_align grid, so that all of the unit's periodic statuses wake up together.
+ * The slot is derived from the unit id to spread different units over the grid.
+ * Only intervals that are a multiple of the grid are aligned: once on its slot such a
+ * status stays there, so it is delayed a single time and keeps its rate afterwards.
+ * Shorter or uneven intervals would be stretched or drift on every tick, they keep their timing.
+ * @param bl: Unit owning the status change
+ * @param tick: Tick the status change would normally be processed at
+ * @param interval: Time since the previous tick
+ * @return Aligned tick
+ */
+static unsigned int status_sc_tick_align(struct block_list *bl, unsigned int tick, unsigned int interval)
+{
+	unsigned int grid = (unsigned int)battle_config.sc_tick_align, slot, offset;
+
+	if( grid <= 1 || interval < grid || interval % grid )
+		return tick;
+
+	slot = (unsigned int)bl->id % grid;
+	offset = (slot + grid - tick % grid) % grid;
+	if( offset ) {
+		sc_tick_stats.aligned++;
+		sc_tick_stats.delay += offset;
+	}
+	sc_tick_stats.rearmed++;
+
+	return tick + offset;
+}
+
 /*==========================================
  * For recusive status, like for each 5s we drop sp etc.
  * Reseting the end timer.
@@ -11382,7 +11691,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 	sc = status_get_sc(bl);
 	status = status_get_status_data(bl);
 
-	if( !(sc && (sce = sc->data[type])) ) {
+	if( !(sc && (sce = sc_data(sc, type))) ) {
 		ShowDebug("status_change_timer: Null pointer id: %d data: %d bl-type: %d\n",id,data,bl->type);
 		return 0;
 	}
@@ -11398,8 +11707,8 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 
 //Set the next timer of the sce (don't assume the status still exists)
 #define sc_timer_next(t,f,i,d) \
-	if( (sce = sc->data[type]) ) \
-		sce->timer = add_timer(t,f,i,d); \
+	if( (sce = sc_data(sc, type)) ) \
+		sce->timer = add_timer(status_sc_tick_align(bl,t,(t) - tick),f,i,d); \
 	else \
 		ShowError("status_change_timer: Unexpected NULL status change id: %d data: %d\n",id,data)
 
@@ -11414,9 +11723,9 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 		case SC_CHASEWALK:
 			if( !status_charge(bl,0,sce->val4) )
 				break; //Not enough SP to continue
-			if( !sc->data[SC_CHASEWALK2] ) {
+			if( !sc_data(sc, SC_CHASEWALK2) ) {
 				sc_start(bl,bl,SC_CHASEWALK2,100,1<<(sce->val1 - 1),
-				(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_ROGUE ? 10 : 1) * //SL bonus -> x10 duration
+				(sc_data(sc, SC_SPIRIT) && sc_data(sc, SC_SPIRIT)->val2 == SL_ROGUE ? 10 : 1) * //SL bonus -> x10 duration
 				skill_get_time2(status_sc2skill(type),sce->val1));
 			}
 			sc_timer_next(sce->val2 + tick,status_change_timer,bl->id,data);
@@ -11484,7 +11793,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 		case SC_POISON:
 		case SC_DPOISON:
 			if( --(sce->val3) >= 0 ) {
-				if( !sc->data[SC_SLOWPOISON] ) {
+				if( !sc_data(sc, SC_SLOWPOISON) ) {
 					if( sce->val2 && bl->type == BL_MOB ) {
 						struct block_list *src = map_id2bl(sce->val2);
 
@@ -11494,7 +11803,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 					map_freeblock_lock();
 					if( status->hp >= max(status->max_hp>>2,sce->val4) ) //Stop damaging after 25% HP left
 						status_zap(bl,sce->val4,0);
-					if( sc->data[type] ) { //Check if the status still last (can be dead since then)
+					if( sc_data(sc, type) ) { //Check if the status still last (can be dead since then)
 						sc_timer_next(1000 + tick,status_change_timer,bl->id,data);
 					}
 					map_freeblock_unlock();
@@ -11536,7 +11845,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 					mob_log_damage((TBL_MOB *)bl,src,(hp < status->hp ? hp : status->hp - cap_mob_hp));
 				map_freeblock_lock();
 				status_fix_damage(src,bl,(sd || hp < status->hp ? hp : status->hp - cap_mob_hp),1);
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					if( status->hp == cap_mob_hp ) {
 						map_freeblock_unlock();
 						return 0;
@@ -11620,7 +11929,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 						break;
 				}
 				if( s != 0 && sce->val3%s == 0 ) {
-					if( sc->data[SC_LONGING] )
+					if( sc_data(sc, SC_LONGING) )
 						sp *= 3;
 					if( !status_charge(bl,0,sp) )
 						break;
@@ -11695,7 +12004,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			break;
 
 		case SC_BLIND:
-			if( sc->data[SC_FOGWALL] ) { //Blind lasts forever while you are standing on the fog
+			if( sc_data(sc, SC_FOGWALL) ) { //Blind lasts forever while you are standing on the fog
 				sc_timer_next(5000 + tick,status_change_timer,bl->id,data);
 				return 0;
 			}
@@ -11714,7 +12023,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 				map_freeblock_lock();
 				status_damage(NULL,bl,100,0,clif_damage(bl,bl,tick,status_get_amotion(bl),status_get_dmotion(bl) + 500,100,0,DMG_NORMAL,0),0);
 				unit_skillcastcancel(bl,2);
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					sc_timer_next(3000 + tick,status_change_timer,bl->id,data);
 				}
 				map_freeblock_unlock();
@@ -11730,7 +12039,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 				damage += status->vit * (sce->val1 - 3);
 				status_damage(NULL,bl,damage,0,clif_damage(bl,bl,tick,status_get_amotion(bl),status_get_dmotion(bl) + 500,damage,0,DMG_NORMAL,0),0);
 				unit_skillcastcancel(bl,2);
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					sc_timer_next(1000 + tick,status_change_timer,bl->id,data);
 				}
 				map_freeblock_unlock();
@@ -11749,7 +12058,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 					status_zap(bl,damage,0);
 					map_freeblock_unlock();
 				}
-				if( sc->data[type] ) { //Random Skill Cast
+				if( sc_data(sc, type) ) { //Random Skill Cast
 					map_freeblock_lock();
 					if( sd && !pc_issit(sd) ) { //Can't cast if sit
 						int mushroom_skill_id = 0, checked = 0, checked_max = MAX_SKILL_MAGICMUSHROOM_DB * 3;
@@ -11790,7 +12099,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 				map_freeblock_lock();
 				status_damage(NULL,bl,1,status->max_sp * 3 / 100,clif_damage(bl,bl,tick,status_get_amotion(bl),1,1,0,DMG_NORMAL,0),0);
 				unit_skillcastcancel(bl,2);
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					sc_timer_next(10000 + tick,status_change_timer,bl->id,data);
 				}
 				map_freeblock_unlock();
@@ -11832,11 +12141,11 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 						break;
 					skill_attack(BF_MAGIC,src,src,bl,status_sc2skill(type),sce->val1,tick,SD_LEVEL|SD_ANIMATION);
 				} else {
-					if( sc->data[SC_AKAITSUKI] && heal )
+					if( sc_data(sc, SC_AKAITSUKI) && heal )
 						heal = ~heal + 1;
 					status_heal(bl,heal,0,3);
 				}
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					sc_timer_next(5000 + tick,status_change_timer,bl->id,data);
 				}
 				map_freeblock_unlock();
@@ -11852,7 +12161,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 				map_freeblock_lock();
 				status_damage(src,bl,damage,0,clif_damage(bl,bl,tick,status_get_amotion(bl),1,damage,0,DMG_NORMAL,0),0);
 				unit_skillcastcancel(bl,2);
-				if( sc->data[type] ) { //Target still lives [LimitLine]
+				if( sc_data(sc, type) ) { //Target still lives [LimitLine]
 					sc_timer_next(3000 + tick,status_change_timer,bl->id,data); //Deals damage every 3 seconds
 				}
 				map_freeblock_unlock();
@@ -11964,7 +12273,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 				map_freeblock_lock();
 				if( group )
 					skill_attack(BF_MISC,src,src,bl,group->skill_id,group->skill_lv,tick,SD_LEVEL|SD_ANIMATION);
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					sc_timer_next(1000 + tick,status_change_timer,bl->id,data);
 				}
 				map_freeblock_unlock();
@@ -11982,7 +12291,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 				map_freeblock_lock();
 				heal = 200 + 100 * sce->val1 + status_get_int(src);
 				skill_attack(BF_MISC,src,src,bl,status_sc2skill(type),sce->val1,tick,SD_LEVEL|SD_ANIMATION);
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					sc_timer_next(1000 + tick,status_change_timer,bl->id,data);
 				}
 				status_heal(src,heal * (5 + 5 * sce->val1) / 100,0,0); //5 + 5% per level
@@ -11998,7 +12307,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 
 				map_freeblock_lock();
 				status_damage(src,bl,damage,0,clif_damage(bl,bl,tick,0,0,damage,0,DMG_ENDURE,0),1);
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					sc_timer_next(2000 + tick,status_change_timer,bl->id,data);
 				}
 				map_freeblock_unlock();
@@ -12110,7 +12419,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 					damage = status->hp - 1; //Do not kill, just keep you with 1 HP minimum
 				map_freeblock_lock();
 				status_fix_damage(NULL,bl,damage,clif_damage(bl,bl,tick,0,0,damage,0,DMG_NORMAL,0));
-				if( sc->data[type] ) {
+				if( sc_data(sc, type) ) {
 					sc_timer_next(1000 + tick,status_change_timer,bl->id,data);
 				}
 				map_freeblock_unlock();
@@ -12128,7 +12437,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 				struct block_list *src = map_id2bl(sce->val2);
 				struct status_change *ssc = status_get_sc(src);
 
-				if( !src || !ssc || !ssc->data[SC_MAGNETICFIELD] )
+				if( !src || !ssc || !sc_data(ssc, SC_MAGNETICFIELD) )
 					break; //Source no more under Magnetic Field
 			}
 			sc_timer_next(1000 + tick,status_change_timer,bl->id,data);
@@ -12166,7 +12475,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 
 		case SC_RAISINGDRAGON: //1% every 5 seconds [Jobbie]
 			if( --(sce->val3) >= 0 && status_charge(bl,sce->val2,0) ) {
-				if( !sc->data[type] )
+				if( !sc_data(sc, type) )
 					return 0;
 				sc_timer_next(5000 + tick,status_change_timer,bl->id,data);
 				return 0;
@@ -12330,9 +12639,9 @@ int status_change_timer_sub(struct block_list *bl, va_list ap) {
 
 	switch( type ) {
 		case SC_SIGHT: //Un-hides targets on 7*7 range
-			if( tsc && tsc->data[SC__SHADOWFORM] &&
+			if( tsc && sc_data(tsc, SC__SHADOWFORM) &&
 				(sce && sce->val4 > 0 && sce->val4%2000 == 0) && //For every 2 seconds do the checking
-				rnd()%100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10 ) //[100 - (Skill Level x 10)] %
+				rnd()%100 < 100 - sc_data(tsc, SC__SHADOWFORM)->val1 * 10 ) //[100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 		//Fall through
 		case SC_CONCENTRATE:
@@ -12343,8 +12652,8 @@ int status_change_timer_sub(struct block_list *bl, va_list ap) {
 			break;
 		case SC_RUWACH: //Un-hides targets on 5*5 range and deals little damages
 			if( tsc ) {
-				if( tsc->data[SC_HIDING] || tsc->data[SC_CLOAKING] ||
-					tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_CLOAKINGEXCEED] )
+				if( sc_data(tsc, SC_HIDING) || sc_data(tsc, SC_CLOAKING) ||
+					sc_data(tsc, SC_CAMOUFLAGE) || sc_data(tsc, SC_CLOAKINGEXCEED) )
 				{
 					status_change_end(bl, SC_HIDING, INVALID_TIMER);
 					status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
@@ -12353,9 +12662,9 @@ int status_change_timer_sub(struct block_list *bl, va_list ap) {
 					if( battle_check_target(src, bl, BCT_ENEMY) > 0 )
 						skill_attack(BF_MAGIC, src, src, bl, status_sc2skill(type), 1, tick, 0);
 				}
-				if( tsc->data[SC__SHADOWFORM] &&
+				if( sc_data(tsc, SC__SHADOWFORM) &&
 					(sce && sce->val4 > 0 && sce->val4%2000 == 0) &&
-					rnd()%100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10 )
+					rnd()%100 < 100 - sc_data(tsc, SC__SHADOWFORM)->val1 * 10 )
 					status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 			}
 			break;
@@ -12374,8 +12683,8 @@ int status_change_timer_sub(struct block_list *bl, va_list ap) {
 			}
 			break;
 		case SC_CURSEDCIRCLE_TARGET:
-			if( tsc && tsc->data[SC_CURSEDCIRCLE_TARGET] && tsc->data[SC_CURSEDCIRCLE_TARGET]->val2 == src->id ) {
-				clif_bladestop(bl, tsc->data[SC_CURSEDCIRCLE_TARGET]->val2, 0);
+			if( tsc && sc_data(tsc, SC_CURSEDCIRCLE_TARGET) && sc_data(tsc, SC_CURSEDCIRCLE_TARGET)->val2 == src->id ) {
+				clif_bladestop(bl, sc_data(tsc, SC_CURSEDCIRCLE_TARGET)->val2, 0);
 				status_change_end(bl, type, INVALID_TIMER);
 			}
 			break;
@@ -12385,8 +12694,8 @@ int status_change_timer_sub(struct block_list *bl, va_list ap) {
 				enum sc_type type2 = (type == SC_CLOSECONFINE ? SC_CLOSECONFINE2 : SC_TINDER_BREAKER2);
 
 				//Locked char has released the hold on everyone.
-				if( tsc && tsc->data[type2] && tsc->data[type2]->val2 == src->id ) {
-					tsc->data[type2]->val2 = 0;
+				if( tsc && sc_data(tsc, type2) && sc_data(tsc, type2)->val2 == src->id ) {
+					sc_data(tsc, type2)->val2 = 0;
 					status_change_end(bl, type2, INVALID_TIMER);
 				}
 			}
@@ -12413,13 +12722,14 @@ void status_change_clear_buffs(struct block_list *bl, int type)
 		return;
 
 	map_freeblock_lock();
+	status_calc_defer_begin();
 
 	if( type&6 ) //Debuffs and spesific debuffs with a RK_REFRESH
 		for( i = SC_COMMON_MIN; i <= SC_COMMON_MAX; i++ )
 			status_change_end(bl, (sc_type)i, INVALID_TIMER);
 
 	for( i = SC_COMMON_MAX + 1; i < SC_MAX; i++ ) {
-		if( !sc->data[i] )
+		if( !sc_data(sc, i) )
 			continue;
 		switch( i ) {
 			//Stuff that cannot be removed
@@ -12555,7 +12865,7 @@ void status_change_clear_buffs(struct block_list *bl, int type)
 			case SC_SATURDAYNIGHTFEVER:
 				if( !(type&1) )
 					continue;
-				sc->data[i]->val2 = 0;
+				sc_data(sc, i)->val2 = 0;
 				break;
 			default:
 				if( !(type&1) )
@@ -12582,6 +12892,7 @@ void status_change_clear_buffs(struct block_list *bl, int type)
 #endif
 	sc->bs_counter = 0;
 
+	status_calc_defer_end();
 	map_freeblock_unlock();
 }
 
@@ -12602,7 +12913,7 @@ int status_change_spread(struct block_list *src, struct block_list *bl) {
 		return 0;
 
 	for( i = SC_COMMON_MIN; i < SC_MAX; i++ ) {
-		if( !sc->data[i] || i == SC_COMMON_MAX )
+		if( !sc_data(sc, i) || i == SC_COMMON_MAX )
 			continue;
 		switch( i ) {
 			//Buffs that can be spreaded through Deadly Infect
@@ -12633,8 +12944,8 @@ int status_change_spread(struct block_list *src, struct block_list *bl) {
 			case SC_VENOMBLEED:
 			case SC_DEATHHURT:
 			case SC_PARALYSE:
-				if( sc->data[i]->timer != INVALID_TIMER ) {
-					timer = get_timer(sc->data[i]->timer);
+				if( sc_data(sc, i)->timer != INVALID_TIMER ) {
+					timer = get_timer(sc_data(sc, i)->timer);
 					if( timer == NULL || timer->func != status_change_timer || DIFF_TICK(timer->tick,tick) < 0 )
 						continue;
 					data.tick = DIFF_TICK(timer->tick,tick);
@@ -12644,34 +12955,34 @@ int status_change_spread(struct block_list *src, struct block_list *bl) {
 			//Special cases
 			case SC_POISON:
 			case SC_DPOISON:
-				data.tick = sc->data[i]->val3 * 1000;
+				data.tick = sc_data(sc, i)->val3 * 1000;
 				break;
 			case SC_FEAR:
 			case SC_LEECHESEND:
-				data.tick = sc->data[i]->val4 * 1000;
+				data.tick = sc_data(sc, i)->val4 * 1000;
 				break;
 			case SC_BURNING:
-				data.tick = sc->data[i]->val4 * 3000;
+				data.tick = sc_data(sc, i)->val4 * 3000;
 				break;
 			case SC_PYREXIA:
 			//case SC_OBLIVIONCURSE:
-				data.tick = sc->data[i]->val4 * 3000;
+				data.tick = sc_data(sc, i)->val4 * 3000;
 				break;
 			case SC_MAGICMUSHROOM:
-				data.tick = sc->data[i]->val4 * 4000;
+				data.tick = sc_data(sc, i)->val4 * 4000;
 				break;
 			case SC_TOXIN:
 			case SC_BLEEDING:
-				data.tick = sc->data[i]->val4 * 10000;
+				data.tick = sc_data(sc, i)->val4 * 10000;
 				break;
 			default:
 				continue;
 		}
 		if( i ) {
-			data.val1 = sc->data[i]->val1;
-			data.val2 = sc->data[i]->val2;
-			data.val3 = sc->data[i]->val3;
-			data.val4 = sc->data[i]->val4;
+			data.val1 = sc_data(sc, i)->val1;
+			data.val2 = sc_data(sc, i)->val2;
+			data.val3 = sc_data(sc, i)->val3;
+			data.val4 = sc_data(sc, i)->val4;
 			status_change_start(src,bl,(sc_type)i,10000,data.val1,data.val2,data.val3,data.val4,data.tick,SCFLAG_NOAVOID|SCFLAG_FIXEDTICK|SCFLAG_FIXEDRATE);
 			flag = 1;
 		}
@@ -12682,10 +12993,110 @@ int status_change_spread(struct block_list *src, struct block_list *bl) {
 
 //Natural regen related stuff
 static unsigned int natural_heal_prev_tick,natural_heal_diff_tick;
-static int status_natural_heal(struct block_list *bl, va_list args)
+
+/// Natural heal participants (BL_REGEN units), kept dense for status_natural_heal_timer.
+/// Status and regen data are cached per entry so idle units are skipped without any lookup.
+static struct {
+	struct block_list **bl; //NULL while a removal is pending
+	struct status_data **status;
+	struct regen_data **regen;
+	int count, max;
+	bool running; //Timer is walking the list, removals are deferred
+	bool pending; //Entries were removed while running
+} regen_list;
+static DBMap *regen_pos_db; // int id -> position in regen_list + 1
+
+/**
+ * Adds a unit to the natural heal list, called when it enters id_db
+ * @param bl: Object with regen data [PC|HOM|MER|ELEM]
+ */
+void status_regen_add(struct block_list *bl)
 {
 	struct regen_data *regen;
-	struct status_data *status;
+	int i;
+
+	nullpo_retv(bl);
+
+	if( !(regen = status_get_regen_data(bl)) )
+		return;
+
+	if( (i = idb_iget(regen_pos_db, bl->id) - 1) < 0 ) {
+		if( regen_list.count == regen_list.max ) {
+			regen_list.max = max(regen_list.max * 2, 256);
+			RECREATE(regen_list.bl, struct block_list *, regen_list.max);
+			RECREATE(regen_list.status, struct status_data *, regen_list.max);
+			RECREATE(regen_list.regen, struct regen_data *, regen_list.max);
+		}
+		i = regen_list.count++;
+		idb_iput(regen_pos_db, bl->id, i + 1);
+	}
+	regen_list.bl[i] = bl;
+	regen_list.status[i] = status_get_status_data(bl);
+	regen_list.regen[i] = regen;
+}
+
+/**
+ * Moves the last natural heal entry into position i
+ * @param i: Free position
+ */
+static void status_regen_fill(int i)
+{
+	int last = --regen_list.count;
+
+	if( i == last )
+		return;
+	regen_list.bl[i] = regen_list.bl[last];
+	regen_list.status[i] = regen_list.status[last];
+	regen_list.regen[i] = regen_list.regen[last];
+	if( regen_list.bl[i] )
+		idb_iput(regen_pos_db, regen_list.bl[i]->id, i + 1);
+}
+
+/**
+ * Removes a unit from the natural heal list, called when it leaves id_db
+ * @param bl: Object with regen data [PC|HOM|MER|ELEM]
+ */
+void status_regen_remove(struct block_list *bl)
+{
+	int i;
+
+	nullpo_retv(bl);
+
+	if( (i = idb_iget(regen_pos_db, bl->id) - 1) < 0 || regen_list.bl[i] != bl )
+		return;
+	idb_remove(regen_pos_db, bl->id);
+	if( regen_list.running ) { //Compacted once the timer is done
+		regen_list.bl[i] = NULL;
+		regen_list.pending = true;
+		return;
+	}
+	status_regen_fill(i);
+}
+
+/**
+ * Tells whether status_natural_heal has anything to do for a unit,
+ * using only its cached status and regen data
+ * @return True if the unit regenerates or bleeds this tick
+ */
+static bool status_natural_heal_active(struct block_list *bl, struct status_data *status, struct regen_data *regen)
+{
+	int flag = regen->flag;
+
+	if (bl->type == BL_PC) {
+		struct map_session_data *sd = (TBL_PC *)bl;
+
+		if (sd->hp_loss.value || sd->sp_loss.value || sd->hp_regen.value || sd->sp_regen.value)
+			return true;
+	}
+	if (flag&RGN_HP && (status->hp >= status->max_hp || regen->state.block&1))
+		flag &= ~(RGN_HP|RGN_SHP);
+	if (flag&RGN_SP && (status->sp >= status->max_sp || regen->state.block&2))
+		flag &= ~(RGN_SP|RGN_SSP);
+	return (flag != RGN_NONE);
+}
+
+static int status_natural_heal(struct block_list *bl, struct status_data *status, struct regen_data *regen)
+{
 	struct status_change *sc;
 	struct unit_data *ud;
 	struct view_data *vd = NULL;
@@ -12693,10 +13104,6 @@ static int status_natural_heal(struct block_list *bl, va_list args)
 	struct map_session_data *sd;
 	int rate, multi = 1, flag;
 
-	regen = status_get_regen_data(bl);
-	if (!regen)
-		return 0;
-	status = status_get_status_data(bl);
 	sc = status_get_sc(bl);
 	if (sc && !sc->count)
 		sc = NULL;
@@ -12790,7 +13197,7 @@ static int status_natural_heal(struct block_list *bl, va_list args)
 			rate *= 2;
 #ifdef RENEWAL
 		if (bl->type == BL_PC && (((TBL_PC *)bl)->class_&MAPID_UPPERMASK) == MAPID_MONK &&
-			sc && sc->data[SC_EXPLOSIONSPIRITS] && (!sc->data[SC_SPIRIT] || sc->data[SC_SPIRIT]->val2 != SL_MONK))
+			sc && sc_data(sc, SC_EXPLOSIONSPIRITS) && (!sc_data(sc, SC_SPIRIT) || sc_data(sc, SC_SPIRIT)->val2 != SL_MONK))
 			rate /= 2; //Tick doubled in Fury state
 #endif
 		regen->tick.sp += rate;
@@ -12845,8 +13252,23 @@ static int status_natural_heal(struct block_list *bl, va_list args)
 //Natural heal main timer.
 static int status_natural_heal_timer(int tid, unsigned int tick, int id, intptr_t data)
 {
+	int i;
+
 	natural_heal_diff_tick = DIFF_TICK(tick,natural_heal_prev_tick);
-	map_foreachregen(status_natural_heal);
+	regen_list.running = true;
+	for( i = 0; i < regen_list.count; i++ ) {
+		struct block_list *bl = regen_list.bl[i];
+
+		if( bl && status_natural_heal_active(bl, regen_list.status[i], regen_list.regen[i]) )
+			status_natural_heal(bl, regen_list.status[i], regen_list.regen[i]);
+	}
+	regen_list.running = false;
+	if( regen_list.pending ) { //Drop units removed while healing
+		for( i = regen_list.count - 1; i >= 0; i-- )
+			if( !regen_list.bl[i] )
+				status_regen_fill(i);
+		regen_list.pending = false;
+	}
 	natural_heal_prev_tick = tick;
 	return 0;
 }
@@ -12947,6 +13369,7 @@ int do_init_status(void)
 	status_readdb();
 	natural_heal_prev_tick = gettick();
 	sc_data_ers = ers_new(sizeof(struct status_change_entry),"status.c::sc_data_ers",ERS_OPT_NONE);
+	regen_pos_db = idb_alloc(DB_OPT_BASE);
 	add_timer_interval(natural_heal_prev_tick + NATURAL_HEAL_INTERVAL,status_natural_heal_timer,0,0,NATURAL_HEAL_INTERVAL);
 	return 0;
 }
@@ -12954,4 +13377,13 @@ int do_init_status(void)
 void do_final_status(void)
 {
 	ers_destroy(sc_data_ers);
+	regen_pos_db->destroy(regen_pos_db, NULL);
+	aFree(regen_list.bl);
+	aFree(regen_list.status);
+	aFree(regen_list.regen);
+	memset(&regen_list, 0, sizeof(regen_list));
+	if( status_calc_dirty )
+		aFree(status_calc_dirty);
+	status_calc_dirty = NULL;
+	status_calc_dirty_count = status_calc_dirty_max = 0;
 }
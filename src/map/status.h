@@ -1954,6 +1954,9 @@ struct sc_display_entry {
 	int val1, val2, val3;
 };
 
+//Number of status change entries stored inline in struct status_change
+#define SC_INLINE_SLOTS 4
+
 //Status change entry
 struct status_change_entry {
 	int timer;
@@ -1984,9 +1987,38 @@ struct status_change {
 	unsigned char sg_counter; //Storm gust counter (previous hits from storm gust)
 #endif
 	unsigned char bs_counter; //Blood Sucker counter
-	struct status_change_entry *data[SC_MAX];
+	//Active entries are kept in a small vector instead of a SC_MAX sized table,
+	//with a bitset in front of it so that checking for an inactive SC stays cheap
+	unsigned short slot_count, ext_max; //Used slots, capacity of ext
+	uint32 active[(SC_MAX + 31) / 32];
+	struct sc_slot {
+		int type;
+		struct status_change_entry *entry;
+	} slot[SC_INLINE_SLOTS], *ext; //ext holds the entries past SC_INLINE_SLOTS
+	enum scb_flag calc_pending; //Recalculations deferred until status_calc_flush (status_calc_defer)
 };
 
+/**
+ * Returns the entry of an active status change, or NULL if it isn't active.
+ * Replaces direct indexing of the old data[SC_MAX] table.
+ */
+static inline struct status_change_entry *sc_data(const struct status_change *sc, int type)
+{
+	int i;
+
+	if( (unsigned int)type >= SC_MAX || !(sc->active[type>>5]&(1U<<(type&31))) )
+		return NULL;
+	for( i = 0; i < sc->slot_count && i < SC_INLINE_SLOTS; i++ ) {
+		if( sc->slot[i].type == type )
+			return sc->slot[i].entry;
+	}
+	for( i = 0; i < sc->slot_count - SC_INLINE_SLOTS; i++ ) {
+		if( sc->ext[i].type == type )
+			return sc->ext[i].entry;
+	}
+	return NULL;
+}
+
 //For looking up associated data
 sc_type status_skill2sc(uint16 skill_id);
 int status_sc2skill(sc_type sc);
@@ -2016,6 +2048,8 @@ int status_revive(struct block_list *bl, unsigned char per_hp, unsigned char per
 int status_fixed_revive(struct block_list *bl, unsigned int per_hp, unsigned int per_sp);
 
 struct regen_data *status_get_regen_data(struct block_list *bl);
+void status_regen_add(struct block_list *bl);
+void status_regen_remove(struct block_list *bl);
 struct status_data *status_get_status_data(struct block_list *bl);
 struct status_data *status_get_base_status(struct block_list *bl);
 const char * status_get_name(struct block_list *bl);
@@ -2077,6 +2111,7 @@ int status_get_race2(struct block_list *bl);
 struct view_data *status_get_viewdata(struct block_list *bl);
 void status_set_viewdata(struct block_list *bl, int class_);
 void status_change_init(struct block_list *bl);
+void status_sc_report(void);
 struct status_change *status_get_sc(struct block_list *bl);
 
 int status_isdead(struct block_list *bl);
@@ -2098,6 +2133,11 @@ int status_change_timer_sub(struct block_list *bl, va_list ap);
 int status_change_clear(struct block_list *bl, int type);
 void status_change_clear_buffs(struct block_list *bl, int type);
 
+void status_calc_defer_begin(void);
+void status_calc_defer_end(void);
+void status_calc_flush(void);
+void status_calc_report(void);
+
 #define status_calc_bl(bl, flag) status_calc_bl_(bl, (enum scb_flag)(flag), SCO_NONE)
 #define status_calc_mob(md, opt) status_calc_bl_(&(md)->bl, SCB_ALL, opt)
 #define status_calc_pet(pd, opt) status_calc_bl_(&(pd)->bl, SCB_ALL, opt)
@@ -89,6 +89,7 @@ static int storage_reconnect_sub(DBKey key, DBData *data, va_list ap)
 {
 	struct guild_storage *stor = db_data2ptr(data);
 
+	stor->version = 0; //Char-server may have lost track of our slots, next save sends everything
 	if (stor->dirty && stor->opened == 0) //Save closed storages
 		gstorage_storagesave(0, stor->guild_id, 0);
 	return 0;
@@ -258,9 +259,10 @@ void storage_storageadd(struct map_session_data *sd, int index, int amount)
 	if (amount < 1 || amount > sd->status.inventory[index].amount)
 		return;
 
-	if (storage_additem(sd, &sd->status.inventory[index], amount) == 0)
+	if (storage_additem(sd, &sd->status.inventory[index], amount) == 0) {
 		pc_delitem(sd, index, amount, 0, 4, LOG_TYPE_STORAGE);
-	else {
+		pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_STORAGE);
+	} else {
 		clif_storageitemremoved(sd, index, 0);
 		clif_dropitem(sd, index, 0);
 	}
@@ -285,9 +287,10 @@ void storage_storageget(struct map_session_data *sd, int index, int amount)
 	if (amount < 1 || amount > sd->status.storage.items[index].amount)
 		return;
 
-	if ((flag = pc_additem(sd, &sd->status.storage.items[index], amount, LOG_TYPE_STORAGE)) == 0)
+	if ((flag = pc_additem(sd, &sd->status.storage.items[index], amount, LOG_TYPE_STORAGE)) == 0) {
 		storage_delitem(sd, index, amount);
-	else {
+		pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_STORAGE);
+	} else {
 		clif_storageitemremoved(sd, index, 0);
 		clif_additem(sd, 0, 0, flag);
 	}
@@ -315,9 +318,10 @@ void storage_storageaddfromcart(struct map_session_data *sd, int index, int amou
 	if (amount < 1 || amount > sd->status.cart[index].amount)
 		return;
 
-	if (storage_additem(sd, &sd->status.cart[index], amount) == 0)
+	if (storage_additem(sd, &sd->status.cart[index], amount) == 0) {
 		pc_cart_delitem(sd, index, amount, 0, LOG_TYPE_STORAGE);
-	else {
+		pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_STORAGE);
+	} else {
 		clif_storageitemremoved(sd, index, 0);
 		clif_dropitem(sd, index, 0);
 	}
@@ -344,9 +348,10 @@ void storage_storagegettocart(struct map_session_data *sd, int index, int amount
 	if (amount < 1 || amount > sd->status.storage.items[index].amount)
 		return;
 
-	if ((flag = pc_cart_additem(sd, &sd->status.storage.items[index], amount, LOG_TYPE_STORAGE)) == 0)
+	if ((flag = pc_cart_additem(sd, &sd->status.storage.items[index], amount, LOG_TYPE_STORAGE)) == 0) {
 		storage_delitem(sd, index, amount);
-	else {
+		pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_STORAGE);
+	} else {
 		clif_storageitemremoved(sd, index, 0);
 		clif_cart_additem_ack(sd, (flag == 1) ? ADDITEM_TO_CART_FAIL_WEIGHT : ADDITEM_TO_CART_FAIL_COUNT);
 	}
@@ -439,6 +444,39 @@ void gstorage_delete(int guild_id)
 	idb_remove(guild_storage_db, guild_id);
 }
 
+/**
+ * Flag a guild storage slot as changed, only changed slots are sent on the next save
+ * @param stor : guild_storage
+ * @param n : index of the slot
+ */
+static void gstorage_setdirty(struct guild_storage *stor, int n)
+{
+	stor->dirty_slots[n/32] |= 1U<<(n%32);
+	stor->dirty = true;
+}
+
+/**
+ * Sort guild storage, flagging every slot that moved
+ * @param stor : guild_storage
+ */
+static void gstorage_sortitem(struct guild_storage *stor)
+{
+	struct item *prev;
+	int i;
+
+	if (!battle_config.client_sort_storage)
+		return;
+
+	CREATE(prev, struct item, MAX_GUILD_STORAGE);
+	memcpy(prev, stor->items, sizeof(stor->items));
+	storage_sortitem(stor->items, ARRAYLENGTH(stor->items));
+	for (i = 0; i < MAX_GUILD_STORAGE; i++) {
+		if (memcmp(&prev[i], &stor->items[i], sizeof(stor->items[0])))
+			gstorage_setdirty(stor, i);
+	}
+	aFree(prev);
+}
+
 /**
  * Attempt to open guild storage for player
  * @param sd : player
@@ -474,7 +512,7 @@ char gstorage_storageopen(struct map_session_data *sd)
 
 	gstor->opened = sd->status.char_id;
 	sd->state.storage_flag = 2;
-	storage_sortitem(gstor->items, ARRAYLENGTH(gstor->items));
+	gstorage_sortitem(gstor);
 	clif_storagelist(sd, gstor->items, ARRAYLENGTH(gstor->items));
 	clif_updatestorageamount(sd, gstor->storage_amount, MAX_GUILD_STORAGE);
 	return 0;
@@ -523,7 +561,7 @@ bool gstorage_additem(struct map_session_data *sd, struct guild_storage *stor, s
 					return false;
 				stor->items[i].amount += amount;
 				clif_storageitemadded(sd, &stor->items[i], i, amount);
-				stor->dirty = true;
+				gstorage_setdirty(stor, i);
 				return true;
 			}
 		}
@@ -538,7 +576,7 @@ bool gstorage_additem(struct map_session_data *sd, struct guild_storage *stor, s
 	stor->storage_amount++;
 	clif_storageitemadded(sd, &stor->items[i], i, amount);
 	clif_updatestorageamount(sd, stor->storage_amount, MAX_GUILD_STORAGE);
-	stor->dirty = true;
+	gstorage_setdirty(stor, i);
 	return true;
 }
 
@@ -571,7 +609,7 @@ bool gstorage_additem2(struct guild_storage *stor, struct item* item, int amount
 				if (amount != item->amount)
 					ShowWarning("gstorage_additem2: Stack limit reached! Altered amount of item \""CL_WHITE"%s"CL_RESET"\" (%d). '"CL_WHITE"%d"CL_RESET"' -> '"CL_WHITE"%d"CL_RESET"'.\n", id->name, id->nameid, item->amount, amount);
 				stor->items[i].amount += amount;
-				stor->dirty = true;
+				gstorage_setdirty(stor, i);
 				return true;
 			}
 		}
@@ -585,7 +623,7 @@ bool gstorage_additem2(struct guild_storage *stor, struct item* item, int amount
 	memcpy(&stor->items[i], item, sizeof(stor->items[0]));
 	stor->items[i].amount = amount;
 	stor->storage_amount++;
-	stor->dirty = true;
+	gstorage_setdirty(stor, i);
 	return true;
 }
 
@@ -612,7 +650,7 @@ bool gstorage_delitem(struct map_session_data *sd, struct guild_storage *stor, i
 		clif_updatestorageamount(sd, stor->storage_amount, MAX_GUILD_STORAGE);
 	}
 	clif_storageitemremoved(sd, n, amount);
-	stor->dirty = true;
+	gstorage_setdirty(stor, n);
 	return true;
 }
 
@@ -645,9 +683,10 @@ void gstorage_storageadd(struct map_session_data *sd, int index, int amount)
 		return;
 	}
 
-	if (gstorage_additem(sd, stor, &sd->status.inventory[index], amount))
+	if (gstorage_additem(sd, stor, &sd->status.inventory[index], amount)) {
 		pc_delitem(sd, index, amount, 0, 4, LOG_TYPE_GSTORAGE);
-	else {
+		pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_STORAGE);
+	} else {
 		clif_storageitemremoved(sd, index, 0);
 		clif_dropitem(sd, index, 0);
 	}
@@ -684,9 +723,10 @@ void gstorage_storageget(struct map_session_data *sd, int index, int amount)
 		return;
 	}
 
-	if ((flag = pc_additem(sd, &stor->items[index], amount, LOG_TYPE_GSTORAGE)) == 0)
+	if ((flag = pc_additem(sd, &stor->items[index], amount, LOG_TYPE_GSTORAGE)) == 0) {
 		gstorage_delitem(sd, stor, index, amount);
-	else { //Inform fail
+		pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_STORAGE);
+	} else { //Inform fail
 		clif_storageitemremoved(sd, index, 0);
 		clif_additem(sd, 0, 0, flag);
 	}
@@ -717,9 +757,10 @@ void gstorage_storageaddfromcart(struct map_session_data *sd, int index, int amo
 	if (amount < 1 || amount > sd->status.cart[index].amount)
 		return;
 
-	if (gstorage_additem(sd, stor, &sd->status.cart[index], amount))
+	if (gstorage_additem(sd, stor, &sd->status.cart[index], amount)) {
 		pc_cart_delitem(sd, index, amount, 0, LOG_TYPE_GSTORAGE);
-	else {
+		pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_STORAGE);
+	} else {
 		clif_storageitemremoved(sd, index, 0);
 		clif_dropitem(sd, index, 0);
 	}
@@ -751,9 +792,10 @@ void gstorage_storagegettocart(struct map_session_data *sd, int index, int amoun
 	if (amount < 1 || amount > stor->items[index].amount)
 		return;
 
-	if ((flag = pc_cart_additem(sd, &stor->items[index], amount, LOG_TYPE_GSTORAGE)) == 0)
+	if ((flag = pc_cart_additem(sd, &stor->items[index], amount, LOG_TYPE_GSTORAGE)) == 0) {
 		gstorage_delitem(sd, stor, index, amount);
-	else {
+		pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_STORAGE);
+	} else {
 		clif_storageitemremoved(sd, index, 0);
 		clif_cart_additem_ack(sd, (flag == 1) ? ADDITEM_TO_CART_FAIL_WEIGHT : ADDITEM_TO_CART_FAIL_COUNT);
 	}
@@ -773,8 +815,11 @@ bool gstorage_storagesave(uint32 account_id, int guild_id, int flag)
 	if (stor) {
 		if (flag) //Char quitting, close it
 			stor->opened  = 0;
-	 	if (stor->dirty)
-			intif_send_guild_storage(account_id, stor);
+		//Only the changed slots are sent while char-server knows which rows they map to
+		if (stor->dirty && (stor->version ? intif_send_guild_storage_delta(account_id, stor) : intif_send_guild_storage(account_id, stor))) {
+			memset(stor->dirty_slots, 0, sizeof(stor->dirty_slots));
+			stor->version = 0; //Wait for the version of this save before sending another delta
+		}
 		return true;
 	}
 	return false;
@@ -782,15 +827,30 @@ bool gstorage_storagesave(uint32 account_id, int guild_id, int flag)
 
 /**
  * ACK save of guild storage
+ * @param account_id : account that requested the save
  * @param guild_id : guild to use the storage
+ * @param fail : 2 = delta refused, whole storage has to be sent
+ * @param version : version to quote in the next delta, 0 = send whole storage
  */
-void gstorage_storagesaved(int guild_id)
+void gstorage_storagesaved(uint32 account_id, int guild_id, int fail, uint32 version)
 {
 	struct guild_storage *stor;
+	int i;
+
+	if ((stor = gstorage_get_storage(guild_id)) == NULL)
+		return;
+
+	if (fail == 2) { //Char-server doesn't know our slots anymore, resend everything
+		stor->version = 0;
+		stor->dirty = true;
+		gstorage_storagesave(account_id, guild_id, 0);
+		return;
+	}
 
-	if ((stor = gstorage_get_storage(guild_id)) != NULL)
-		if (stor->dirty && stor->opened == 0) //Storage has been correctly saved
-			stor->dirty = false;
+	stor->version = version;
+	ARR_FIND(0, ARRAYLENGTH(stor->dirty_slots), i, stor->dirty_slots[i] != 0);
+	if (stor->dirty && stor->opened == 0 && i == ARRAYLENGTH(stor->dirty_slots)) //Storage has been correctly saved
+		stor->dirty = false;
 }
 
 /**
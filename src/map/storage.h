@@ -38,7 +38,7 @@ void gstorage_storagegettocart(struct map_session_data *sd, int index, int amoun
 void gstorage_storageclose(struct map_session_data *sd);
 void gstorage_storage_quit(struct map_session_data *sd, int flag);
 bool gstorage_storagesave(uint32 account_id, int guild_id, int flag);
-void gstorage_storagesaved(int guild_id);
+void gstorage_storagesaved(uint32 account_id, int guild_id, int fail, uint32 version);
 
 int compare_item(struct item *a, struct item *b);
 
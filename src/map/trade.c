@@ -618,6 +618,9 @@ void trade_tradecommit(struct map_session_data *sd)
 	clif_tradecompleted(sd, 0);
 	clif_tradecompleted(tsd, 0);
 
+	pc_autosave_dirty(sd, PC_AUTOSAVE_DIRTY_TRADE);
+	pc_autosave_dirty(tsd, PC_AUTOSAVE_DIRTY_TRADE);
+
 	//Save both player to avoid crash: they always have no advantage/disadvantage between the 2 players
 	if (save_settings&1) {
 		chrif_save(sd, 0);
@@ -641,9 +641,9 @@ int unit_walktoxy(struct block_list *bl, short x, short y, unsigned char flag)
 	unit_stop_attack(bl); // Sets target to 0
 
 	if( (sc = status_get_sc(bl)) ) {
-		if( sc->data[SC_CONFUSION] )
+		if( sc_data(sc, SC_CONFUSION) )
 			map_random_dir(bl, &ud->to_x, &ud->to_y); // Randomize the target position
-		if( sc->data[SC_COMBO] )
+		if( sc_data(sc, SC_COMBO) )
 			status_change_end(bl, SC_COMBO, INVALID_TIMER);
 	}
 
@@ -747,9 +747,9 @@ int unit_walktobl(struct block_list *bl, struct block_list *tbl, int range, unsi
 	unit_stop_attack(bl); //Sets target to 0
 
 	if ((sc = status_get_sc(bl))) {
-		if (sc->data[SC_CONFUSION]) //Randomize the target position
+		if (sc_data(sc, SC_CONFUSION)) //Randomize the target position
 			map_random_dir(bl, &ud->to_x, &ud->to_y);
-		if (sc->data[SC_COMBO])
+		if (sc_data(sc, SC_COMBO))
 			status_change_end(bl, SC_COMBO, INVALID_TIMER);
 	}
 
@@ -779,7 +779,7 @@ int unit_walktobl(struct block_list *bl, struct block_list *tbl, int range, unsi
  * @param sd Required only when using SC_WUGDASH
  */
 void unit_run_hit(struct block_list *bl, struct status_change *sc, struct map_session_data *sd, enum sc_type type) {
-	int lv = sc->data[type]->val1;
+	int lv = sc_data(sc, type)->val1;
 
 	//If you can't run forward, you must be next to a wall, so bounce back. [Skotlex]
 	if (type == SC_RUN)
@@ -814,7 +814,7 @@ bool unit_run(struct block_list *bl, struct map_session_data *sd, enum sc_type t
 
 	sc = status_get_sc(bl);
 
-	if( !(sc && sc->data[type]) )
+	if( !(sc && sc_data(sc, type)) )
 		return false;
 
 	if( !unit_can_move(bl) ) {
@@ -822,8 +822,8 @@ bool unit_run(struct block_list *bl, struct map_session_data *sd, enum sc_type t
 		return false;
 	}
 
-	dir_x = dirx[sc->data[type]->val2];
-	dir_y = diry[sc->data[type]->val2];
+	dir_x = dirx[sc_data(sc, type)->val2];
+	dir_y = diry[sc_data(sc, type)->val2];
 
 	//Determine destination cell
 	to_x = bl->x;
@@ -1099,7 +1099,7 @@ int unit_blown_immune(struct block_list *bl, int flag)
 
 				if ((flag&0x1) && (flag&0x2) && sd->special_state.no_knockback)
 					return 4; //Target has special_state.no_knockback (equip)
-				if (sd->sc.data[SC_BASILICA] && sd->sc.data[SC_BASILICA]->val4 == sd->bl.id && !(flag&0x4))
+				if (sc_data(&sd->sc, SC_BASILICA) && sc_data(&sd->sc, SC_BASILICA)->val4 == sd->bl.id && !(flag&0x4))
 					return 5; //Basilica caster can't be knocked back by normal monsters
 			}
 			break;
@@ -1322,12 +1322,12 @@ int unit_can_move(struct block_list *bl) {
 
 	if (sc) {
 		if (sc->cant.move || //Status placed here are ones that cannot be cached by sc->cant.move for they depend on other conditions other than their availability
-			(sc->data[SC_FEAR] && sc->data[SC_FEAR]->val2 > 0) ||
-			(sc->data[SC_SPIDERWEB] && sc->data[SC_SPIDERWEB]->val1) ||
-			(sc->data[SC_DANCING] && sc->data[SC_DANCING]->val4 &&
-			(!sc->data[SC_LONGING] ||
-			(sc->data[SC_DANCING]->val1&0xFFFF) == CG_MOONLIT ||
-			(sc->data[SC_DANCING]->val1&0xFFFF) == CG_HERMODE)))
+			(sc_data(sc, SC_FEAR) && sc_data(sc, SC_FEAR)->val2 > 0) ||
+			(sc_data(sc, SC_SPIDERWEB) && sc_data(sc, SC_SPIDERWEB)->val1) ||
+			(sc_data(sc, SC_DANCING) && sc_data(sc, SC_DANCING)->val4 &&
+			(!sc_data(sc, SC_LONGING) ||
+			(sc_data(sc, SC_DANCING)->val1&0xFFFF) == CG_MOONLIT ||
+			(sc_data(sc, SC_DANCING)->val1&0xFFFF) == CG_HERMODE)))
 			return 0;
 		if (sc->opt1 && sc->opt1 != OPT1_STONEWAIT && sc->opt1 != OPT1_BURNING && sc->opt1 != OPT1_FREEZING)
 			return 0;
@@ -1457,10 +1457,10 @@ int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill_id, ui
 		sc = NULL; //Unneeded
 
 	//Temp: Used to signal combo-skills right now
-	if( sc && sc->data[SC_COMBO] && (sc->data[SC_COMBO]->val1 == skill_id ||
+	if( sc && sc_data(sc, SC_COMBO) && (sc_data(sc, SC_COMBO)->val1 == skill_id ||
 		(sd ? skill_check_condition_castbegin(sd, skill_id, skill_lv) : 0)) ) {
-		if( sc->data[SC_COMBO]->val2 )
-			target_id = sc->data[SC_COMBO]->val2;
+		if( sc_data(sc, SC_COMBO)->val2 )
+			target_id = sc_data(sc, SC_COMBO)->val2;
 		else if( target_id == src->id || ud->target > 0 )
 			target_id = ud->target;
 		if( (skill_get_inf(skill_id)&INF_SELF_SKILL) && (skill_get_nk(skill_id)&NK_NO_DAMAGE) ) //Exploit fix
@@ -1469,7 +1469,7 @@ int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill_id, ui
 	} else if( target_id == src->id &&
 		(skill_get_inf(skill_id)&INF_SELF_SKILL) &&
 		((skill_get_inf2(skill_id)&INF2_NO_TARGET_SELF) ||
-		(skill_id == RL_QD_SHOT && sc && sc->data[SC_QD_SHOT_READY])) )
+		(skill_id == RL_QD_SHOT && sc && sc_data(sc, SC_QD_SHOT_READY))) )
 	{
 		if( skill_id == GC_WEAPONCRUSH && sd && !skill_check_condition_castbegin(sd, skill_id, skill_lv) )
 			return 0;
@@ -1483,7 +1483,7 @@ int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill_id, ui
 			return 0;
 		switch( skill_id ) { //Check for skills that auto-select target
 			case MO_CHAINCOMBO:
-				if( sc && sc->data[SC_BLADESTOP] && (target = map_id2bl(sc->data[SC_BLADESTOP]->val4)) == NULL )
+				if( sc && sc_data(sc, SC_BLADESTOP) && (target = map_id2bl(sc_data(sc, SC_BLADESTOP)->val4)) == NULL )
 					return 0;
 				break;
 			case WE_MALE:
@@ -1515,8 +1515,8 @@ int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill_id, ui
 				{
 					int skill_id2 = (skill_id == MH_SONIC_CRAW ? MH_MIDNIGHT_FRENZY : MH_EQC);
 
-					if( sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill_id2 ) { //It's a combo
-						target_id = sc->data[SC_COMBO]->val2;
+					if( sc && sc_data(sc, SC_COMBO) && sc_data(sc, SC_COMBO)->val1 == skill_id2 ) { //It's a combo
+						target_id = sc_data(sc, SC_COMBO)->val2;
 						combo = 1;
 						casttime = -1;
 					}
@@ -1693,17 +1693,17 @@ int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill_id, ui
 				casttime += casttime * min(skill_lv, sd->spiritball);
 			break;
 		case MO_EXTREMITYFIST:
-			if( sc && sc->data[SC_COMBO] &&
-			   (sc->data[SC_COMBO]->val1 == MO_COMBOFINISH ||
-				sc->data[SC_COMBO]->val1 == CH_TIGERFIST ||
-				sc->data[SC_COMBO]->val1 == CH_CHAINCRUSH) )
+			if( sc && sc_data(sc, SC_COMBO) &&
+			   (sc_data(sc, SC_COMBO)->val1 == MO_COMBOFINISH ||
+				sc_data(sc, SC_COMBO)->val1 == CH_TIGERFIST ||
+				sc_data(sc, SC_COMBO)->val1 == CH_CHAINCRUSH) )
 				casttime = -1;
 			combo = 1;
 			break;
 		case SR_GATEOFHELL:
 		case SR_TIGERCANNON:
-			if( sc && sc->data[SC_COMBO] &&
-			   sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE )
+			if( sc && sc_data(sc, SC_COMBO) &&
+			   sc_data(sc, SC_COMBO)->val1 == SR_FALLENEMPIRE )
 				casttime = -1;
 			combo = 1;
 			break;
@@ -1711,15 +1711,15 @@ int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill_id, ui
 			combo = 1;
 			break;
 		case ST_CHASEWALK:
-			if( sc && sc->data[SC_CHASEWALK] )
+			if( sc && sc_data(sc, SC_CHASEWALK) )
 				casttime = -1;
 			break;
 		case TK_RUN:
-			if( sc && sc->data[SC_RUN] )
+			if( sc && sc_data(sc, SC_RUN) )
 				casttime = -1;
 			break;
 		case HP_BASILICA:
-			if( sc && sc->data[SC_BASILICA] )
+			if( sc && sc_data(sc, SC_BASILICA) )
 				casttime = -1; //No Casting time on basilica cancel
 			break;
 		case KN_CHARGEATK: { //+0.5s every 3 cells of distance but hard-limited to 1.5s
@@ -1739,7 +1739,7 @@ int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill_id, ui
 				casttime *= 2;
 			break;
 		case RA_WUGDASH:
-			if( sc && sc->data[SC_WUGDASH] )
+			if( sc && sc_data(sc, SC_WUGDASH) )
 				casttime = -1;
 			break;
 		case EL_WIND_SLASH:
@@ -1781,11 +1781,11 @@ int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill_id, ui
 		casttime = 0;
 
 	if( sc ) { //Why the if else chain: These 3 status do not stack, so its efficient that way
- 		if( sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4&4) && skill_id != AS_CLOAKING ) {
+ 		if( sc_data(sc, SC_CLOAKING) && !(sc_data(sc, SC_CLOAKING)->val4&4) && skill_id != AS_CLOAKING ) {
 			status_change_end(src, SC_CLOAKING, INVALID_TIMER);
 			if( !src->prev )
 				return 0; //Warped away!
-		} else if( sc->data[SC_CLOAKINGEXCEED] && !(sc->data[SC_CLOAKINGEXCEED]->val4&4) && skill_id != GC_CLOAKINGEXCEED ) {
+		} else if( sc_data(sc, SC_CLOAKINGEXCEED) && !(sc_data(sc, SC_CLOAKINGEXCEED)->val4&4) && skill_id != GC_CLOAKINGEXCEED ) {
 			status_change_end(src, SC_CLOAKINGEXCEED, INVALID_TIMER);
 			if( !src->prev )
 				return 0;
@@ -1928,7 +1928,7 @@ int unit_skilluse_pos2(struct block_list *src, short skill_x, short skill_y, uin
 			return 0;
 	}
 
-	if(sc && sc->data[SC__MAELSTROM] && (skill_id >= SC_MANHOLE && skill_id <= SC_FEINTBOMB)) {
+	if(sc && sc_data(sc, SC__MAELSTROM) && (skill_id >= SC_MANHOLE && skill_id <= SC_FEINTBOMB)) {
 		clif_skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 		return 0;
 	}
@@ -2011,11 +2011,11 @@ int unit_skilluse_pos2(struct block_list *src, short skill_x, short skill_y, uin
 	ud->skilltarget  = 0;
 
 	if(sc) { //Why the if else chain: These 3 status do not stack, so its efficient that way
-		if(sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4&4)) {
+		if(sc_data(sc, SC_CLOAKING) && !(sc_data(sc, SC_CLOAKING)->val4&4)) {
 			status_change_end(src, SC_CLOAKING, INVALID_TIMER);
 			if(!src->prev)
 				return 0; //Warped away!
-		} else if(sc->data[SC_CLOAKINGEXCEED] && !(sc->data[SC_CLOAKINGEXCEED]->val4&4)) {
+		} else if(sc_data(sc, SC_CLOAKINGEXCEED) && !(sc_data(sc, SC_CLOAKINGEXCEED)->val4&4)) {
 			status_change_end(src, SC_CLOAKINGEXCEED, INVALID_TIMER);
 			if(!src->prev)
 				return 0;
@@ -2409,7 +2409,7 @@ static int unit_attack_timer_sub(struct block_list *src, int tid, unsigned int t
 		|| (sd && !pc_can_attack(sd,ud->target)) )
 		return 0; //Can't attack under these conditions
 
-	if( sd && sd->sc.count && sd->sc.data[SC_HEAT_BARREL_AFTER] )
+	if( sd && sd->sc.count && sc_data(&sd->sc, SC_HEAT_BARREL_AFTER) )
 		return 0;
 
 	if( src->m != target->m ) {
@@ -2560,8 +2560,8 @@ int unit_skillcastcancel(struct block_list *bl, uint8 type)
 		if (!ud->state.skillcastcancel)
 			return 0;
 
-		if (sd && !sd->sc.data[SC_TOXIN] && (sd->special_state.no_castcancel2 ||
-			((sd->sc.data[SC_UNLIMITEDHUMMINGVOICE] || sd->special_state.no_castcancel) &&
+		if (sd && !sc_data(&sd->sc, SC_TOXIN) && (sd->special_state.no_castcancel2 ||
+			((sc_data(&sd->sc, SC_UNLIMITEDHUMMINGVOICE) || sd->special_state.no_castcancel) &&
 			!map_flag_gvg2(bl->m) && !map[bl->m].flag.battleground))) //Fixed flags being read the wrong way around [blackhole89]
 			return 0;
 	}
@@ -2719,7 +2719,7 @@ int unit_remove_map_(struct block_list *bl, clr_type clrtype, const char *file,
 			status_change_end(bl,SC_CLOAKINGEXCEED,INVALID_TIMER);
 		}
 		status_change_end(bl,SC_CHASEWALK,INVALID_TIMER);
-		if (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF)
+		if (sc_data(sc, SC_GOSPEL) && sc_data(sc, SC_GOSPEL)->val4 == BCT_SELF)
 			status_change_end(bl,SC_GOSPEL,INVALID_TIMER);
 		status_change_end(bl,SC_CHANGE,INVALID_TIMER);
 		status_change_end(bl,SC_STOP,INVALID_TIMER);
@@ -2994,6 +2994,10 @@ int unit_free(struct block_list *bl, clr_type clrtype)
 					sd->regstr = NULL;
 					sd->regstr_num = 0;
 				}
+				if( sd->regarray ) {
+					db_destroy(sd->regarray);
+					sd->regarray = NULL;
+				}
 				if( sd->st && sd->st->state != RUN ) { //Free attached scripts that are waiting
 					script_free_state(sd->st);
 					sd->st = NULL;
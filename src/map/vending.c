@@ -39,6 +39,25 @@ static int vending_getuid(void) {
 	return ++vending_nextid;
 }
 
+/**
+ * Adds or removes all slots of a shop in the searchstore index
+ * @param sd : vender session
+ * @param add : true to add, false to remove
+ */
+static void vending_searchstore_index(struct map_session_data *sd, bool add)
+{
+	int i;
+
+	for( i = 0; i < sd->vend_num; i++ ) {
+		struct item *it = &sd->status.cart[sd->vending[i].index];
+
+		if( add )
+			searchstore_index_add(SEARCHTYPE_VENDING, sd->status.char_id, i, it->nameid, sd->vending[i].value, it->card);
+		else
+			searchstore_index_remove(SEARCHTYPE_VENDING, sd->status.char_id, i, it->nameid, sd->vending[i].value, it->card);
+	}
+}
+
 /**
  * Make a player close his shop
  * @param sd : player session
@@ -52,6 +71,7 @@ void vending_closevending(struct map_session_data *sd)
 			Sql_Query(mmysql_handle, "DELETE FROM `%s` WHERE `id` = %d;", vendings_db, sd->vender_id) != SQL_SUCCESS )
 			Sql_ShowDebug(mmysql_handle);
 
+		vending_searchstore_index(sd, false);
 		sd->state.vending = 0;
 		sd->vender_id = 0;
 		clif_closevendingboard(&sd->bl, 0);
@@ -189,6 +209,7 @@ void vending_purchasereq(struct map_session_data *sd, int aid, int uid, const ui
 		}
 	}
 
+	vending_searchstore_index(vsd, false); //Slots are compacted below
 	pc_payzeny(sd, (int)z, LOG_TYPE_VENDING, vsd);
 	if( battle_config.vending_tax )
 		z -= z * (battle_config.vending_tax / 10000.);
@@ -239,6 +260,7 @@ void vending_purchasereq(struct map_session_data *sd, int aid, int uid, const ui
 		cursor++;
 	}
 	vsd->vend_num = cursor;
+	vending_searchstore_index(vsd, true);
 
 	//Always save BOTH: customer (buyer) and vender
 	if( save_settings&2 ) {
@@ -342,7 +364,7 @@ int8 vending_openvending(struct map_session_data *sd, const char *message, const
 		vendings_db, sd->vender_id, sd->status.account_id, sd->status.char_id, (!sd->status.sex ? 'F' : 'M'), map[sd->bl.m].name, sd->bl.x, sd->bl.y, message_sql, sd->state.autotrade, (at ? at->dir : sd->ud.dir), (at ? at->head_dir : sd->head_dir), (at ? at->sit : pc_issit(sd))) != SQL_SUCCESS )
 		Sql_ShowDebug(mmysql_handle);
 
-	StringBuf_Init(&buf);
+	StringBuf_InitArena(&buf);
 	StringBuf_Printf(&buf, "INSERT INTO `%s`(`vending_id`,`index`,`cartinventory_id`,`amount`,`price`) VALUES", vending_items_db);
 	for( i = 0; i < count; i++ ) {
 		StringBuf_Printf(&buf, "(%d,%d,%d,%d,%d)", sd->vender_id, i, sd->status.cart[sd->vending[i].index].id, sd->vending[i].amount, sd->vending[i].value);
@@ -357,6 +379,7 @@ int8 vending_openvending(struct map_session_data *sd, const char *message, const
 	clif_showvendingboard(&sd->bl, message, 0);
 
 	idb_put(vending_db, sd->status.char_id, sd);
+	vending_searchstore_index(sd, true);
 
 	return 0;
 }
@@ -383,56 +406,52 @@ bool vending_search(struct map_session_data *sd, unsigned short nameid) {
 }
 
 /**
- * Searches for all items in a vending, that match given ids, price and possible cards.
+ * Checks a vending slot found through the searchstore index against given price and possible cards.
  * @param sd : The vender session to search into
+ * @param i : Index in sd->vending
+ * @param nameid : Item id the slot was indexed with
  * @param s : parameter of the search (see s_search_store_search)
  * @return Whether or not the search should be continued.
  */
-bool vending_searchall(struct map_session_data *sd, const struct s_search_store_search *s) {
-	int i, c, slot;
-	unsigned int idx, cidx;
+bool vending_searchslot(struct map_session_data *sd, int i, unsigned short nameid, const struct s_search_store_search *s) {
+	int c, slot;
+	unsigned int cidx;
 	struct item* it;
 
 	nullpo_retr(false, sd);
 
-	if( !sd->state.vending ) //Not vending
+	if( !sd->state.vending || i < 0 || i >= sd->vend_num ) //Not vending
 		return true;
 
-	for( idx = 0; idx < s->item_count; idx++ ) {
-		ARR_FIND(0, sd->vend_num, i, sd->status.cart[sd->vending[i].index].nameid == (short)s->itemlist[idx]);
-		if( i == sd->vend_num ) //Not found
-			continue;
+	it = &sd->status.cart[sd->vending[i].index];
 
-		it = &sd->status.cart[sd->vending[i].index];
-
-		if( s->min_price && s->min_price > sd->vending[i].value ) //Too low price
-			continue;
+	if( it->nameid != nameid ) //Index out of sync
+		return true;
 
-		if( s->max_price && s->max_price < sd->vending[i].value ) //Too high price
-			continue;
+	if( s->min_price && s->min_price > sd->vending[i].value ) //Too low price
+		return true;
 
-		if( s->card_count ) { //Check cards
-			if( itemdb_isspecial(it->card[0]) ) //Something, that is not a carded
-				continue;
+	if( s->max_price && s->max_price < sd->vending[i].value ) //Too high price
+		return true;
 
-			slot = itemdb_slot(it->nameid);
+	if( s->card_count ) { //Check cards
+		if( itemdb_isspecial(it->card[0]) ) //Something, that is not a carded
+			return true;
 
-			for( c = 0; c < slot && it->card[c]; c ++ ) {
-				ARR_FIND(0, s->card_count, cidx, s->cardlist[cidx] == it->card[c]);
-				if( cidx != s->card_count ) //Found
-					break;
-			}
+		slot = itemdb_slot(it->nameid);
 
-			if( c == slot || !it->card[c] ) //No card match
-				continue;
+		for( c = 0; c < slot && it->card[c]; c ++ ) {
+			ARR_FIND(0, s->card_count, cidx, s->cardlist[cidx] == it->card[c]);
+			if( cidx != s->card_count ) //Found
+				break;
 		}
 
-		if( !searchstore_result(s->search_sd, sd->vender_id, sd->status.account_id, sd->message,
-			it->nameid, sd->vending[i].amount, sd->vending[i].value, it->card, it->refine) ) //Result set full
-			return false;
+		if( c == slot || !it->card[c] ) //No card match
+			return true;
 	}
 
-	return true;
+	return searchstore_result(s->search_sd, sd->vender_id, sd->status.account_id, sd->message,
+		it->nameid, sd->vending[i].amount, sd->vending[i].value, it->card, it->refine); //False if result set full
 }
 
 /**
@@ -25,7 +25,7 @@ int8 vending_openvending(struct map_session_data *sd, const char *message, const
 void vending_vendinglistreq(struct map_session_data *sd, int id);
 void vending_purchasereq(struct map_session_data *sd, int aid, int uid, const uint8 *data, int count);
 bool vending_search(struct map_session_data *sd, unsigned short nameid);
-bool vending_searchall(struct map_session_data *sd, const struct s_search_store_search *s);
+bool vending_searchslot(struct map_session_data *sd, int i, unsigned short nameid, const struct s_search_store_search *s);
 
 void do_final_vending(void);
 void do_init_vending(void);
@@ -0,0 +1,216 @@
+#include "../common/cbasetypes.h"
+#include "../common/core.h"
+#include "../common/atomic.h"
+#include "../common/ers.h"
+#include "../common/malloc.h"
+#include "../common/netbuffer.h"
+#include "../common/showmsg.h"
+#include "../common/spinlock.h"
+#include "../common/thread.h"
+#include "../common/timer.h"
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+//
+// Stress test / benchmark of the thread cached allocators.
+// Worker threads and the main thread allocate and free entries of an
+// ERS_OPT_THREADCACHE entry manager, and hand half of them over to be freed
+// by another thread.
+// A plain entry manager behind a global lock is run for comparison.
+// Every entry is stamped while it is in use, so an entry handed out twice
+// is detected.
+// The same is done with netbuffers if conf/network.conf exists.
+// One of the threads is a plain pthread, which has no rathread id and
+// has to take the locked fallback paths.
+//
+
+
+#define THRC 16 // thread Count
+#define PERTHREAD 200000
+#define HOLD 64 // entries held by a thread at once
+#define HANDOFF_MAX 4096
+#define INUSE_MAGIC 0x5A5A0000
+
+
+struct alloc_entry {
+	volatile int32 owner; // INUSE_MAGIC|tag while in use
+	int32 pad[15];
+};
+
+typedef void *(*alloc_fn)(void);
+typedef void (*free_fn)(void *);
+
+static ERS entry_ers = NULL;
+static SPIN_LOCK entry_ers_lock;
+static alloc_fn bench_alloc;
+static free_fn bench_free;
+
+// Entries passed between threads, freed by whoever picks them up
+static SPIN_LOCK handoff_lock;
+static void *handoff[HANDOFF_MAX];
+static int handoff_count = 0;
+
+static volatile int32 done_threads = 0;
+static volatile int32 errors = 0;
+
+
+static void *ers_entry_alloc(void){ return ers_alloc(entry_ers, struct alloc_entry); }
+static void ers_entry_free(void *p){ ers_free(entry_ers, p); }
+static void *locked_entry_alloc(void){ void *p; EnterSpinLock(&entry_ers_lock); p = ers_alloc(entry_ers, struct alloc_entry); LeaveSpinLock(&entry_ers_lock); return p; }
+static void locked_entry_free(void *p){ EnterSpinLock(&entry_ers_lock); ers_free(entry_ers, p); LeaveSpinLock(&entry_ers_lock); }
+static void *netbuffer_entry_alloc(void){ return netbuffer_get(sizeof(struct alloc_entry))->buf; }
+static void netbuffer_entry_free(void *p){ netbuffer_put((netbuf)((char *)p - offsetof(struct netbuf, buf))); }
+
+
+static void entry_release(void *p){
+	struct alloc_entry *e = (struct alloc_entry *)p;
+
+	e->owner = 0;
+	bench_free(p);
+}//end: entry_release()
+
+
+static void *worker(void *p){
+	int32 tag = INUSE_MAGIC|(int32)(intptr_t)p;
+	void *held[HOLD];
+	int i, j;
+
+	for( i = 0; i < PERTHREAD / HOLD; i++ ){
+		for( j = 0; j < HOLD; j++ ){
+			struct alloc_entry *e = (struct alloc_entry *)bench_alloc();
+
+			if( (InterlockedExchange(&e->owner, tag) & 0xFFFF0000) == INUSE_MAGIC )
+				InterlockedIncrement(&errors); // handed out while in use
+			held[j] = e;
+		}
+
+		// every other entry goes to another thread
+		EnterSpinLock(&handoff_lock);
+		for( j = 0; j < HOLD; j += 2 ){
+			if( handoff_count < HANDOFF_MAX )
+				handoff[handoff_count++] = held[j];
+			else
+				entry_release(held[j]);
+			held[j] = NULL;
+		}
+		LeaveSpinLock(&handoff_lock);
+
+		for( j = 1; j < HOLD; j += 2 ){
+			if( ((struct alloc_entry *)held[j])->owner != tag )
+				InterlockedIncrement(&errors);
+			entry_release(held[j]);
+		}
+
+		// free what others handed over
+		EnterSpinLock(&handoff_lock);
+		for( j = 0; j < HOLD / 2 && handoff_count > 0; j++ )
+			entry_release(handoff[--handoff_count]);
+		LeaveSpinLock(&handoff_lock);
+	}
+
+	InterlockedIncrement(&done_threads);
+
+	return NULL;
+}//end: worker()
+
+
+static bool bench_run(const char *label, alloc_fn a, free_fn f){
+	rAthread t[THRC];
+	pthread_t plain;
+	unsigned int tick;
+	int i;
+
+	bench_alloc = a;
+	bench_free = f;
+	done_threads = 0;
+	errors = 0;
+	handoff_count = 0;
+	InitializeSpinLock(&handoff_lock);
+
+	tick = gettick_nocache();
+	for( i = 0; i < THRC; i++ )
+		t[i] = rathread_createEx(worker, (void *)(intptr_t)(i + 1), 1024*512, RAT_PRIO_NORMAL);
+	if( pthread_create(&plain, NULL, worker, (void *)(intptr_t)(THRC + 2)) != 0 )
+		ShowError("%s: pthread_create failed\n", label);
+	worker((void *)(intptr_t)(THRC + 1)); // main thread shares the allocator with the workers
+	for( i = 0; i < THRC; i++ )
+		rathread_wait(t[i], NULL);
+	pthread_join(plain, NULL);
+	tick = gettick_nocache() - tick;
+
+	while( handoff_count > 0 )
+		entry_release(handoff[--handoff_count]);
+	FinalizeSpinLock(&handoff_lock);
+
+	ShowInfo("%-10s %u threads x %u allocations: %5ums\n", label, THRC + 2, PERTHREAD, tick);
+	if( done_threads != THRC + 2 || errors != 0 ){
+		ShowError("%s: %d of %d threads done, %d entries handed out while in use\n", label, done_threads, THRC + 2, errors);
+		return false;
+	}
+	return true;
+}//end: bench_run()
+
+
+int do_init(int argc, char **argv){
+	int ok = 0, runs = 0;
+
+	ShowStatus("==========\n");
+	ShowStatus("TEST: thread cached allocators (%u Threads)\n", THRC + 2);
+	ShowStatus("\n\n");
+
+	InitializeSpinLock(&entry_ers_lock);
+	entry_ers = ers_new(sizeof(struct alloc_entry), "test_alloc.c::entry_ers", ERS_OPT_NONE);
+	runs++;
+	if( bench_run("locked ers", locked_entry_alloc, locked_entry_free) )
+		ok++;
+	ers_destroy(entry_ers);
+	FinalizeSpinLock(&entry_ers_lock);
+
+	entry_ers = ers_new(sizeof(struct alloc_entry), "test_alloc.c::entry_ers", ERS_OPT_THREADCACHE);
+	runs++;
+	if( bench_run("ers", ers_entry_alloc, ers_entry_free) )
+		ok++;
+	ers_destroy(entry_ers);
+
+	if( access("conf/network.conf", R_OK) == 0 ){
+		netbuffer_init();
+		runs++;
+		if( bench_run("netbuffer", netbuffer_entry_alloc, netbuffer_entry_free) )
+			ok++;
+		netbuffer_final();
+	}else
+		ShowInfo("conf/network.conf not found, skipping netbuffer.\n");
+
+	if(ok != runs){
+		ShowFatalError("Test failed.\n");
+		exit(1);
+	}else{
+		ShowStatus("Test passed.\n");
+		exit(0);
+	}
+
+
+return 0;
+}//end: do_init()
+
+
+void do_abort(){
+}//end: do_abort()
+
+
+void set_server_type(){
+	SERVER_TYPE = ATHENA_SERVER_NONE;
+}//end: set_server_type()
+
+
+void do_final(){
+}//end: do_final()
+
+
+int parse_console(const char* command){
+	return 0;
+}//end: parse_console
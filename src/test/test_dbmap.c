@@ -0,0 +1,261 @@
+#include "../common/cbasetypes.h"
+#include "../common/core.h"
+#include "../common/db.h"
+#include "../common/malloc.h"
+#include "../common/showmsg.h"
+#include "../common/strlib.h"
+#include "../common/timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Benchmark of the DBMap hashtable sizing.
+// Every key distribution runs against a table fixed at the previous 283
+// buckets and against the default growing one, and both must return the
+// same data.
+// Pass a file with one key per line (all numbers or names) to replay keys
+// recorded from a running server instead of the generated distributions.
+//
+
+
+#define OLD_HASH_SIZE (256+27)
+#define ROUNDS 20
+#define MAX_KEYS 200000
+#define KEY_LENGTH 64
+
+
+struct bench_keys {
+	const char *name;
+	DBType type;
+	int count;
+	int *ints;
+	char (*strs)[KEY_LENGTH];
+};
+
+static uint32 seed = 1;
+
+static int bench_rand(int range){
+	seed = seed * 1103515245 + 12345;
+	return (int)((seed >> 8) % (uint32)range);
+}//end: bench_rand()
+
+
+static void keys_alloc(struct bench_keys *keys, const char *name, DBType type, int count){
+	keys->name = name;
+	keys->type = type;
+	keys->count = count;
+	keys->ints = NULL;
+	keys->strs = NULL;
+	if( type == DB_STRING )
+		keys->strs = aCalloc(count, KEY_LENGTH);
+	else
+		CREATE(keys->ints, int, count);
+}//end: keys_alloc()
+
+
+static void keys_free(struct bench_keys *keys){
+	aFree(keys->ints);
+	aFree(keys->strs);
+}//end: keys_free()
+
+
+static DBKey keys_get(struct bench_keys *keys, int i){
+	return ( keys->type == DB_STRING ) ? db_str2key(keys->strs[i]) : db_i2key(keys->ints[i]);
+}//end: keys_get()
+
+
+// Block ids handed out by map_get_new_object_id to npcs and mobs at startup
+static void keys_block_ids(struct bench_keys *keys){
+	int i;
+
+	keys_alloc(keys, "block ids", DB_INT, 40000);
+	for( i = 0; i < keys->count; i++ )
+		keys->ints[i] = 110000000 + i;
+}//end: keys_block_ids()
+
+
+// Char ids of online players, spread over the whole char table
+static void keys_char_ids(struct bench_keys *keys){
+	int i;
+
+	keys_alloc(keys, "char ids", DB_INT, 3000);
+	for( i = 0; i < keys->count; i++ )
+		keys->ints[i] = 150000 + i * 37 + bench_rand(37);
+}//end: keys_char_ids()
+
+
+// Item ids of the item database, dense at the bottom with gaps
+static void keys_item_ids(struct bench_keys *keys){
+	int i;
+
+	keys_alloc(keys, "item ids", DB_INT, 15000);
+	for( i = 0; i < keys->count; i++ )
+		keys->ints[i] = 500 + i * 2 + bench_rand(2);
+}//end: keys_item_ids()
+
+
+// NPC event labels as found in ev_db
+static void keys_event_names(struct bench_keys *keys){
+	static const char *labels[] = { "OnInit", "OnPCLoginEvent", "OnClock0000", "OnTimer1000" };
+	int i;
+
+	keys_alloc(keys, "event names", DB_STRING, 16000);
+	for( i = 0; i < keys->count; i++ )
+		snprintf(keys->strs[i], KEY_LENGTH, "npc_%d::%s", i / (int)ARRAYLENGTH(labels), labels[i % ARRAYLENGTH(labels)]);
+}//end: keys_event_names()
+
+
+// Keys recorded from a server, one per line
+static bool keys_file(struct bench_keys *keys, const char *path){
+	char line[KEY_LENGTH];
+	bool numeric = true;
+	FILE *fp;
+	int i, count = 0;
+
+	if( (fp = fopen(path, "r")) == NULL ){
+		ShowError("Can't open '%s'.\n", path);
+		return false;
+	}
+	while( count < MAX_KEYS && fgets(line, sizeof(line), fp) ){
+		char *end;
+
+		line[strcspn(line, "\r\n")] = '\0';
+		if( line[0] == '\0' )
+			continue;
+		strtol(line, &end, 10);
+		if( *end != '\0' )
+			numeric = false;
+		count++;
+	}
+
+	keys_alloc(keys, path, numeric ? DB_INT : DB_STRING, count);
+	rewind(fp);
+	for( i = 0; i < count && fgets(line, sizeof(line), fp); ){
+		line[strcspn(line, "\r\n")] = '\0';
+		if( line[0] == '\0' )
+			continue;
+		if( numeric )
+			keys->ints[i] = atoi(line);
+		else
+			safestrncpy(keys->strs[i], line, KEY_LENGTH);
+		i++;
+	}
+	fclose(fp);
+	return true;
+}//end: keys_file()
+
+
+// Runs inserts, lookups, removals and a full walk, returns a checksum of what was read back
+static uint32 bench_run(struct bench_keys *keys, DBMap *db, const char *label){
+	DBIterator *iter;
+	DBData *data;
+	unsigned int tick[5];
+	uint32 sum = 0;
+	int i, j;
+
+	tick[0] = gettick_nocache();
+	for( i = 0; i < keys->count; i++ )
+		db->put(db, keys_get(keys, i), db_i2data(i + 1), NULL);
+
+	tick[1] = gettick_nocache();
+	for( j = 0; j < ROUNDS; j++ ){
+		for( i = 0; i < keys->count; i++ ){
+			if( (data = db->get(db, keys_get(keys, i))) != NULL )
+				sum += db_data2i(data);
+		}
+	}
+
+	tick[2] = gettick_nocache();
+	for( j = 0; j < ROUNDS; j++ ){
+		for( i = j % 2; i < keys->count; i += 2 )
+			db->remove(db, keys_get(keys, i), NULL);
+		for( i = j % 2; i < keys->count; i += 2 )
+			db->put(db, keys_get(keys, i), db_i2data(i + 1), NULL);
+	}
+
+	tick[3] = gettick_nocache();
+	iter = db_iterator(db);
+	for( j = 0; j < ROUNDS; j++ ){
+		for( data = iter->first(iter, NULL); dbi_exists(iter); data = iter->next(iter, NULL) )
+			sum += db_data2i(data);
+	}
+	dbi_destroy(iter);
+
+	tick[4] = gettick_nocache();
+	sum += db_size(db);
+	db_destroy(db);
+
+	ShowInfo("%-12s %-8s insert %5ums, get %5ums, remove/put %5ums, iterate %5ums\n", keys->name, label, tick[1] - tick[0], tick[2] - tick[1], tick[3] - tick[2], tick[4] - tick[3]);
+	return sum;
+}//end: bench_run()
+
+
+static bool bench_keys(struct bench_keys *keys){
+	DBMap *fixed, *growing;
+	uint32 sum_fixed, sum_growing;
+
+	fixed = db_alloc_sized(__FILE__, __LINE__, keys->type, DB_OPT_DUP_KEY|DB_OPT_NO_RESIZE, KEY_LENGTH, OLD_HASH_SIZE);
+	growing = db_alloc(__FILE__, __LINE__, keys->type, DB_OPT_DUP_KEY, KEY_LENGTH);
+	sum_fixed = bench_run(keys, fixed, "fixed");
+	sum_growing = bench_run(keys, growing, "growing");
+	keys_free(keys);
+
+	if( sum_fixed != sum_growing ){
+		ShowError("%s: results differ (fixed %u, growing %u)\n", keys->name, sum_fixed, sum_growing);
+		return false;
+	}
+	return true;
+}//end: bench_keys()
+
+
+int do_init(int argc, char **argv){
+	struct bench_keys keys;
+	int ok = 0, runs = 0;
+
+	ShowStatus("==========\n");
+	ShowStatus("BENCH: DBMap fixed %d buckets vs growing hashtable, %d rounds\n", OLD_HASH_SIZE, ROUNDS);
+	ShowStatus("\n\n");
+
+	if( argc > 1 && argv[1][0] != '-' ){
+		runs++;
+		if( keys_file(&keys, argv[1]) && bench_keys(&keys) )
+			ok++;
+	}else{
+		runs += 4;
+		keys_block_ids(&keys);   if( bench_keys(&keys) ) ok++;
+		keys_char_ids(&keys);    if( bench_keys(&keys) ) ok++;
+		keys_item_ids(&keys);    if( bench_keys(&keys) ) ok++;
+		keys_event_names(&keys); if( bench_keys(&keys) ) ok++;
+	}
+
+	if(ok != runs){
+		ShowFatalError("Test failed.\n");
+		exit(1);
+	}else{
+		ShowStatus("Test passed.\n");
+		exit(0);
+	}
+
+
+return 0;
+}//end: do_init()
+
+
+void do_abort(){
+}//end: do_abort()
+
+
+void set_server_type(){
+	SERVER_TYPE = ATHENA_SERVER_NONE;
+}//end: set_server_type()
+
+
+void do_final(){
+}//end: do_final()
+
+
+int parse_console(const char* command){
+	return 0;
+}//end: parse_console